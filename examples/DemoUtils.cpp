@@ -122,7 +122,7 @@ void setupMeshControls(Raz::Entity& meshEntity, Raz::Window& window) {
   window.addKeyCallback(Raz::Keyboard::RIGHT, [&meshTransform] (float deltaTime) { meshTransform.rotate(-90_deg * deltaTime, Raz::Axis::Up); });
 }
 
-void setupLightControls(Raz::Entity& lightEntity, const Raz::RenderSystem& renderSystem, Raz::Window& window) {
+void setupLightControls(Raz::Entity& lightEntity, Raz::RenderSystem& renderSystem, Raz::Window& window) {
   auto& light          = lightEntity.getComponent<Raz::Light>();
   auto& lightTransform = lightEntity.getComponent<Raz::Transform>();
 
@@ -31,7 +31,7 @@ void setupMeshControls(Raz::Entity& meshEntity, Raz::Window& window);
 /// Adds callbacks onto a window to allow moving a light & varying its energy.
 /// \param lightEntity Light for which to add controls.
 /// \param window Window on which to add the callbacks.
-void setupLightControls(Raz::Entity& lightEntity, const Raz::RenderSystem& renderSystem, Raz::Window& window);
+void setupLightControls(Raz::Entity& lightEntity, Raz::RenderSystem& renderSystem, Raz::Window& window);
 
 /// Adds a callback onto a window to allow adding a light on a transform's position.
 /// \param transform Transform from which to apply the position to the new light.
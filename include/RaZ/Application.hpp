@@ -5,6 +5,8 @@
 
 #include "RaZ/World.hpp"
 #include "RaZ/Data/Bitset.hpp"
+#include "RaZ/Utils/Allocator.hpp"
+#include "RaZ/Utils/ThreadPool.hpp"
 
 #include <cassert>
 #include <chrono>
@@ -13,10 +15,16 @@
 namespace Raz {
 
 struct FrameTimeInfo {
-  float deltaTime {};   ///< Time elapsed since the application's last execution, in seconds.
-  float globalTime {};  ///< Time elapsed since the application started, in seconds.
-  int substepCount {};  ///< Number of fixed time steps to process.
-  float substepTime {}; ///< Time to be used by each fixed time step, in seconds.
+  float deltaTime {};          ///< Time elapsed since the application's last execution, in seconds.
+  float globalTime {};         ///< Time elapsed since the application started, in seconds.
+  int substepCount {};         ///< Number of fixed time steps to process.
+  float substepTime {};        ///< Time to be used by each fixed time step, in seconds.
+  float interpolationAlpha {}; ///< Fraction of a fixed time step left after processing the substeps, in [0; 1); used to interpolate between states.
+};
+
+enum class WorldUpdateMode {
+  SEQUENTIAL, ///< Worlds are updated one after the other, on the calling thread.
+  PARALLEL    ///< Worlds are updated concurrently on a dedicated thread pool, except those requiring the main thread.
 };
 
 class Application {
@@ -26,11 +34,47 @@ public:
   const std::vector<WorldPtr>& getWorlds() const { return m_worlds; }
   std::vector<WorldPtr>& getWorlds() { return m_worlds; }
   const FrameTimeInfo& getTimeInfo() const { return m_timeInfo; }
+  WorldUpdateMode getWorldUpdateMode() const noexcept { return m_worldUpdateMode; }
+  /// Gets the maximum number of cycles to be executed per second.
+  /// \return Maximum frame rate, in cycles per second; 0 if unlimited.
+  float getTargetFrameRate() const noexcept { return (m_targetFrameTime > 0.f ? 1.f / m_targetFrameTime : 0.f); }
+  /// Gets the linear arena reset at the beginning of each cycle. Allocations made from it are valid until the next cycle starts.
+  /// \return Per-frame arena.
+  LinearArena& getFrameArena() noexcept { return m_frameArena; }
+#if defined(RAZ_USE_PROFILING)
+  /// Gets the global allocation statistics of the last cycle.
+  /// \note The global allocations are only counted when profiling is enabled; the frame arena's statistics are always available.
+  /// \return Last cycle's allocation statistics.
+  const AllocationStats& getFrameAllocationStats() const noexcept { return m_frameAllocationStats; }
+#endif
 
   void setFixedTimeStep(float fixedTimeStep) {
     assert("Error: Fixed time step must be positive." && fixedTimeStep > 0.f);
     m_timeInfo.substepTime = fixedTimeStep;
   }
+  /// Sets the maximum number of fixed time steps that can be processed in a single cycle.
+  /// If more would be required (typically after a long hitch), the exceeding time is dropped; this prevents the cycles from getting ever longer
+  ///  when the fixed steps take more time to process than they simulate.
+  /// \param maxSubstepCount Maximum number of fixed time steps per cycle; must be strictly positive.
+  void setMaxSubstepCount(int maxSubstepCount) {
+    assert("Error: Maximum substep count must be positive." && maxSubstepCount > 0);
+    m_maxSubstepCount = maxSubstepCount;
+  }
+  /// Sets how the worlds are updated on each cycle.
+  /// \note In parallel mode, each world is updated on its own task; worlds containing a system requiring the main thread (like the RenderSystem)
+  ///  are updated on the calling thread meanwhile. Systems of different worlds must then not share any state without synchronization.
+  /// \note The worlds' tasks are executed by a thread pool dedicated to them, so that their systems can themselves parallelize work on the
+  ///  default one; were they run on the latter, waiting for such work could block every thread.
+  /// \param worldUpdateMode World update mode.
+  /// \see System::requiresMainThread()
+  void setWorldUpdateMode(WorldUpdateMode worldUpdateMode) noexcept { m_worldUpdateMode = worldUpdateMode; }
+  /// Sets the maximum number of cycles to be executed per second. When a cycle finishes early, the application waits for the remaining time.
+  /// \note This has no effect with Emscripten, whose cycles are driven by the browser.
+  /// \param targetFrameRate Maximum frame rate, in cycles per second; 0 to run as fast as possible.
+  void setTargetFrameRate(float targetFrameRate) {
+    assert("Error: Target frame rate must not be negative." && targetFrameRate >= 0.f);
+    m_targetFrameTime = (targetFrameRate > 0.f ? 1.f / targetFrameRate : 0.f);
+  }
 
   /// Adds a world into the application.
   /// \tparam Args Types of the arguments to be forwarded to the world.
@@ -50,13 +94,28 @@ public:
   void quit() { m_isRunning = false; }
 
 private:
+  /// Waits until the target frame time has elapsed since the previous cycle started. Sleeps for most of the remaining time, then spins for
+  ///  the rest to compensate for the sleep's imprecision.
+  void waitForNextCycle() const;
+  /// Updates the active worlds concurrently, deactivating those which have no active system left.
+  void updateWorldsInParallel();
+
   std::vector<WorldPtr> m_worlds {};
   Bitset m_activeWorlds {};
 
-  FrameTimeInfo m_timeInfo{ 0.f, 0.f, 0, 0.016666f }; ///< Time-related attributes for each cycle.
-  std::chrono::time_point<std::chrono::system_clock> m_lastFrameTime = std::chrono::system_clock::now();
+  FrameTimeInfo m_timeInfo{ 0.f, 0.f, 0, 0.016666f, 0.f }; ///< Time-related attributes for each cycle.
+  std::chrono::steady_clock::time_point m_lastFrameTime = std::chrono::steady_clock::now();
   float m_remainingTime {}; ///< Extra time remaining after executing the systems' fixed step update.
+  int m_maxSubstepCount = 8;
+  float m_targetFrameTime {}; ///< Minimal time of each cycle, in seconds; 0 if unlimited.
+
+  LinearArena m_frameArena {};
+#if defined(RAZ_USE_PROFILING)
+  AllocationStats m_frameAllocationStats {};
+#endif
 
+  WorldUpdateMode m_worldUpdateMode = WorldUpdateMode::SEQUENTIAL;
+  std::unique_ptr<ThreadPool> m_worldThreadPool {}; ///< Thread pool updating the worlds in parallel mode, created on first use.
   bool m_isRunning = true;
 };
 
@@ -27,6 +27,8 @@ public:
   /// Recovers the name of the current audio device.
   /// \return The current device's name, or an empty string if the required extension is unsupported.
   std::string recoverCurrentDevice() const;
+  /// The audio context is current for the whole process & must not be used concurrently.
+  bool requiresMainThread() const noexcept override { return true; }
   bool update(const FrameTimeInfo& timeInfo) override;
   void destroy() override;
 
@@ -3,6 +3,9 @@
 #ifndef RAZ_COMPONENT_HPP
 #define RAZ_COMPONENT_HPP
 
+#include "RaZ/Utils/Allocator.hpp"
+
+#include <algorithm>
 #include <memory>
 
 namespace Raz {
@@ -11,8 +14,32 @@ class Component;
 using ComponentPtr = std::unique_ptr<Component>;
 
 /// Component class representing a base Component to be inherited.
+/// Components are allocated from pools, avoiding a global heap allocation each time one is added to an entity. Those added through
+///  Entity::addComponent() use the pool dedicated to their type; the others share a common one.
+/// \note As a component may be released from a pointer to its base, each allocation is preceded by a small header referencing its pool.
 class Component {
 public:
+  /// Allocates a component from the given pool resource.
+  /// \param size Size of the component to be allocated.
+  /// \param poolResource Resource to allocate the component from.
+  /// \return Allocated memory.
+  static void* operator new(std::size_t size, std::pmr::memory_resource& poolResource) {
+    return allocate(size, alignof(std::max_align_t), poolResource);
+  }
+  static void* operator new(std::size_t size, std::align_val_t alignment, std::pmr::memory_resource& poolResource) {
+    return allocate(size, static_cast<std::size_t>(alignment), poolResource);
+  }
+  static void* operator new(std::size_t size) { return operator new(size, Allocator::getPoolResource<Component>()); }
+  static void* operator new(std::size_t size, std::align_val_t alignment) { return operator new(size, alignment, Allocator::getPoolResource<Component>()); }
+  static void* operator new(std::size_t, void* ptr) noexcept { return ptr; } // Class-level operators hide the global placement new
+  static void operator delete(void* ptr) noexcept { deallocate(ptr, alignof(std::max_align_t)); }
+  static void operator delete(void* ptr, std::align_val_t alignment) noexcept { deallocate(ptr, static_cast<std::size_t>(alignment)); }
+  static void operator delete(void* ptr, std::pmr::memory_resource&) noexcept { deallocate(ptr, alignof(std::max_align_t)); }
+  static void operator delete(void* ptr, std::align_val_t alignment, std::pmr::memory_resource&) noexcept {
+    deallocate(ptr, static_cast<std::size_t>(alignment));
+  }
+  static void operator delete(void*, void*) noexcept {}
+
   /// Gets the ID of the given component type.
   /// It uses CRTP to assign a different ID to each component type it is called with.
   /// This function will be instantiated every time it is called with a different type, incrementing the assigned index.
@@ -32,6 +59,19 @@ protected:
   Component& operator=(Component&&) noexcept = default;
 
 private:
+  /// Header preceding each allocated component.
+  struct AllocationHeader {
+    std::pmr::memory_resource* poolResource {};
+    std::size_t byteCount {}; ///< Number of bytes allocated from the resource, including the header.
+  };
+
+  /// Computes the size of the header preceding a component, padded so that the component keeps its alignment.
+  /// \param alignment Alignment of the component.
+  /// \return Padded header size.
+  static constexpr std::size_t computeHeaderSize(std::size_t alignment) noexcept { return std::max(alignment, sizeof(AllocationHeader)); }
+  static void* allocate(std::size_t size, std::size_t alignment, std::pmr::memory_resource& poolResource);
+  static void deallocate(void* ptr, std::size_t alignment) noexcept;
+
   static inline std::size_t s_maxId = 0;
 };
 
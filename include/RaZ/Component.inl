@@ -2,6 +2,26 @@
 
 namespace Raz {
 
+inline void* Component::allocate(std::size_t size, std::size_t alignment, std::pmr::memory_resource& poolResource) {
+  const std::size_t headerSize = computeHeaderSize(alignment);
+  const std::size_t byteCount  = headerSize + size;
+
+  auto* memory = static_cast<std::byte*>(poolResource.allocate(byteCount, std::max(alignment, alignof(AllocationHeader))));
+  new (memory) AllocationHeader{ &poolResource, byteCount };
+
+  return memory + headerSize;
+}
+
+inline void Component::deallocate(void* ptr, std::size_t alignment) noexcept {
+  if (ptr == nullptr)
+    return;
+
+  auto* memory = static_cast<std::byte*>(ptr) - computeHeaderSize(alignment);
+  const auto* header = reinterpret_cast<const AllocationHeader*>(memory);
+
+  header->poolResource->deallocate(memory, header->byteCount, std::max(alignment, alignof(AllocationHeader)));
+}
+
 template <typename CompT>
 std::size_t Component::getId() {
   static_assert(std::is_base_of_v<Component, CompT>, "Error: The fetched component must be derived from Component.");
@@ -21,6 +21,17 @@ public:
   constexpr bool isEmpty() const noexcept { return (std::ranges::find(m_bits, true) == m_bits.cend()); }
   constexpr std::size_t getEnabledBitCount() const noexcept { return std::ranges::count(m_bits, true); }
   constexpr std::size_t getDisabledBitCount() const noexcept { return (m_bits.size() - getEnabledBitCount()); }
+  /// Checks if at least one bit is enabled in both bitsets. This is equivalent to !(bitset1 & bitset2).isEmpty(), without creating any bitset.
+  /// \param bitset Bitset to be checked.
+  /// \return True if both bitsets share at least one enabled bit, false otherwise.
+  constexpr bool intersects(const Bitset& bitset) const noexcept {
+    for (std::size_t bitIndex = 0; bitIndex < std::min(m_bits.size(), bitset.getSize()); ++bitIndex) {
+      if (m_bits[bitIndex] && bitset.m_bits[bitIndex])
+        return true;
+    }
+
+    return false;
+  }
   void setBit(std::size_t index, bool value = true);
   constexpr void resize(std::size_t newSize) { m_bits.resize(newSize); }
   constexpr void reset() { std::fill(m_bits.begin(), m_bits.end(), false); }
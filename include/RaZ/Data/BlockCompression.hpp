@@ -0,0 +1,35 @@
+#pragma once
+
+#ifndef RAZ_BLOCKCOMPRESSION_HPP
+#define RAZ_BLOCKCOMPRESSION_HPP
+
+#include "RaZ/Data/CompressedImage.hpp"
+
+namespace Raz {
+
+class Image;
+
+namespace BlockCompression {
+
+/// Compresses an image into the given block format. Blocks are encoded in parallel.
+/// \note Float values are expected to be between 0 & 1, and are clamped otherwise.
+/// \note BC1 ignores the alpha channel; BC4 only keeps the first channel, and BC5 the first two. Gray images are expanded to RGB(A) for the other formats.
+/// \note BC7 blocks are all encoded with mode 6 (single subset, RGBA endpoints); this gives a fast and consistent encoding, but not the best possible quality.
+/// \param image Image to be compressed.
+/// \param format Block format to compress the image into.
+/// \param generateMipmaps True to also compress the whole mipmap chain of the image, false to only compress the original image.
+/// \return Compressed image, sRGB if the original one is.
+CompressedImage compress(const Image& image, BlockCompressionFormat format, bool generateMipmaps = true);
+
+/// Decompresses a level of a compressed image.
+/// \note BC7 decompression only supports mode 6 blocks; an exception is thrown if any other is encountered.
+/// \param image Image to be decompressed.
+/// \param levelIndex Index of the mipmap level to be decompressed.
+/// \return Decompressed byte image: gray for BC4, gray-alpha (red & green) for BC5, RGB for BC1 & RGBA for BC3 & BC7, sRGB(A) if the compressed one is.
+Image decompress(const CompressedImage& image, std::size_t levelIndex = 0);
+
+} // namespace BlockCompression
+
+} // namespace Raz
+
+#endif // RAZ_BLOCKCOMPRESSION_HPP
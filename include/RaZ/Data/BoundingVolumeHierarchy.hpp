@@ -3,8 +3,10 @@
 #ifndef RAZ_BOUNDINGVOLUMEHIERARCHY_HPP
 #define RAZ_BOUNDINGVOLUMEHIERARCHY_HPP
 
+#include "RaZ/Utils/Allocator.hpp"
 #include "RaZ/Utils/Shape.hpp"
 
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -13,9 +15,9 @@ namespace Raz {
 class Entity;
 
 /// [Bounding Volume Hierarchy](https://en.wikipedia.org/wiki/Bounding_volume_hierarchy) (BVH) node, holding the necessary information
-///  to perform queries on the BVH.
+///  to perform queries on the BVH. Nodes are allocated from a pool dedicated to them.
 /// \see BoundingVolumeHierarchy
-class BoundingVolumeHierarchyNode {
+class BoundingVolumeHierarchyNode : public PoolAllocated<BoundingVolumeHierarchyNode> {
   friend class BoundingVolumeHierarchy;
 
 public:
@@ -39,6 +41,12 @@ public:
   /// \param hit Optional ray intersection's information to recover (nullptr if unneeded).
   /// \return Closest entity intersected.
   Entity* query(const Ray& ray, RayHit* hit = nullptr) const;
+  /// Queries the BVH node to find the entity holding the triangle closest to the given point.
+  /// \param point Point to find the closest triangle from.
+  /// \param maxDistance Distance beyond which triangles are ignored; the lower it is, the more nodes can be skipped.
+  /// \param hit Optional closest point's information to recover (nullptr if unneeded). The normal is the closest triangle's one.
+  /// \return Entity holding the closest triangle, or nullptr if none has been found within the given distance.
+  Entity* queryClosest(const Vec3f& point, float maxDistance = std::numeric_limits<float>::max(), RayHit* hit = nullptr) const;
 
   BoundingVolumeHierarchyNode& operator=(const BoundingVolumeHierarchyNode&) = delete;
   BoundingVolumeHierarchyNode& operator=(BoundingVolumeHierarchyNode&&) noexcept = default;
@@ -54,6 +62,12 @@ private:
   /// \param beginIndex First index in the triangles' list.
   /// \param endIndex Past-the-end index in the triangles' list.
   void build(std::vector<TriangleInfo>& trianglesInfo, std::size_t beginIndex, std::size_t endIndex);
+  /// Recursively finds the triangle closest to the given point.
+  /// \param point Point to find the closest triangle from.
+  /// \param closestSquaredDist Squared distance to the closest triangle found so far; updated if a closer one is found.
+  /// \param hit Closest point's information, updated if a closer triangle is found.
+  /// \return Entity holding the closest triangle if it is in this node's hierarchy, nullptr otherwise.
+  Entity* findClosest(const Vec3f& point, float& closestSquaredDist, RayHit& hit) const;
 
   AABB m_boundingBox = AABB(Vec3f(0.f), Vec3f(0.f));
   std::unique_ptr<BoundingVolumeHierarchyNode> m_leftChild {};
@@ -79,6 +93,14 @@ public:
   /// \param hit Optional ray intersection's information to recover (nullptr if unneeded).
   /// \return Closest entity intersected.
   Entity* query(const Ray& ray, RayHit* hit = nullptr) const { return m_rootNode.query(ray, hit); }
+  /// Queries the BVH to find the entity holding the triangle closest to the given point.
+  /// \param point Point to find the closest triangle from.
+  /// \param maxDistance Distance beyond which triangles are ignored; the lower it is, the more nodes can be skipped.
+  /// \param hit Optional closest point's information to recover (nullptr if unneeded). The normal is the closest triangle's one.
+  /// \return Entity holding the closest triangle, or nullptr if none has been found within the given distance.
+  Entity* queryClosest(const Vec3f& point, float maxDistance = std::numeric_limits<float>::max(), RayHit* hit = nullptr) const {
+    return m_rootNode.queryClosest(point, maxDistance, hit);
+  }
 
   BoundingVolumeHierarchy& operator=(const BoundingVolumeHierarchy&) = delete;
   BoundingVolumeHierarchy& operator=(BoundingVolumeHierarchy&&) noexcept = default;
@@ -0,0 +1,76 @@
+#pragma once
+
+#ifndef RAZ_COMPRESSEDIMAGE_HPP
+#define RAZ_COMPRESSEDIMAGE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Raz {
+
+/// Block compression formats, all of which encode blocks of 4x4 pixels.
+enum class BlockCompressionFormat {
+  BC1, ///< RGB, 8 bytes per block (4 bits per pixel). Also known as DXT1.
+  BC3, ///< RGBA, 16 bytes per block (8 bits per pixel). Also known as DXT5.
+  BC4, ///< Single channel, 8 bytes per block (4 bits per pixel).
+  BC5, ///< Two channels, 16 bytes per block (8 bits per pixel). Typically used for normal maps.
+  BC7  ///< High quality RGBA, 16 bytes per block (8 bits per pixel).
+};
+
+/// Mipmap level of a compressed image.
+struct CompressedImageLevel {
+  unsigned int width {};
+  unsigned int height {};
+  std::vector<uint8_t> data {};
+};
+
+/// Image stored as a chain of block-compressed mipmap levels, ready to be sent to the GPU as is.
+class CompressedImage {
+public:
+  CompressedImage() = default;
+  explicit CompressedImage(BlockCompressionFormat format, bool isSrgb = false) noexcept : m_format{ format }, m_isSrgb{ isSrgb } {}
+
+  BlockCompressionFormat getFormat() const noexcept { return m_format; }
+  bool isSrgb() const noexcept { return m_isSrgb; }
+  /// Gets the width of the first (most detailed) level.
+  /// \return Width of the image, or 0 if it has no level.
+  unsigned int getWidth() const noexcept { return (m_levels.empty() ? 0 : m_levels.front().width); }
+  /// Gets the height of the first (most detailed) level.
+  /// \return Height of the image, or 0 if it has no level.
+  unsigned int getHeight() const noexcept { return (m_levels.empty() ? 0 : m_levels.front().height); }
+  std::size_t getLevelCount() const noexcept { return m_levels.size(); }
+  const CompressedImageLevel& getLevel(std::size_t levelIndex) const noexcept { return m_levels[levelIndex]; }
+  const std::vector<CompressedImageLevel>& getLevels() const noexcept { return m_levels; }
+  bool isEmpty() const noexcept { return m_levels.empty(); }
+
+  /// Gets the size in bytes of a single 4x4 block of the given format.
+  /// \param format Compression format.
+  /// \return Size of a block.
+  static constexpr std::size_t getBlockSize(BlockCompressionFormat format) noexcept {
+    return ((format == BlockCompressionFormat::BC1 || format == BlockCompressionFormat::BC4) ? 8 : 16);
+  }
+  /// Computes the size in bytes of a level of the given dimensions. Partial blocks on the edges count as full blocks.
+  /// \param format Compression format.
+  /// \param width Width of the level.
+  /// \param height Height of the level.
+  /// \return Size of the level's compressed data.
+  static constexpr std::size_t computeLevelSize(BlockCompressionFormat format, unsigned int width, unsigned int height) noexcept {
+    return static_cast<std::size_t>((width + 3) / 4) * ((height + 3) / 4) * getBlockSize(format);
+  }
+
+  /// Appends a level to the mipmap chain.
+  /// \param width Width of the level.
+  /// \param height Height of the level.
+  /// \param data Compressed data of the level. Its size must match the one computed from the dimensions & format.
+  void addLevel(unsigned int width, unsigned int height, std::vector<uint8_t> data);
+
+private:
+  BlockCompressionFormat m_format = BlockCompressionFormat::BC1;
+  bool m_isSrgb = false;
+  std::vector<CompressedImageLevel> m_levels {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_COMPRESSEDIMAGE_HPP
@@ -0,0 +1,28 @@
+#pragma once
+
+#ifndef RAZ_DDSFORMAT_HPP
+#define RAZ_DDSFORMAT_HPP
+
+namespace Raz {
+
+class CompressedImage;
+class FilePath;
+
+namespace DdsFormat {
+
+/// Loads a block-compressed image & its mipmaps from a [DDS](https://learn.microsoft.com/en-us/windows/win32/direct3ddds/dx-graphics-dds) file.
+/// \note Only 2D textures using BC1, BC3, BC4, BC5 or BC7 are supported, either declared with a FourCC code or a DX10 header.
+/// \param filePath File from which to load the image.
+/// \return Loaded compressed image.
+CompressedImage load(const FilePath& filePath);
+
+/// Saves a block-compressed image & its mipmaps to a DDS file. A DX10 header is always written, allowing to store sRGB & BC7 images.
+/// \param filePath File to which to save the image.
+/// \param image Compressed image to export.
+void save(const FilePath& filePath, const CompressedImage& image);
+
+} // namespace DdsFormat
+
+} // namespace Raz
+
+#endif // RAZ_DDSFORMAT_HPP
@@ -3,10 +3,12 @@
 #ifndef RAZ_IMAGE_HPP
 #define RAZ_IMAGE_HPP
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
+#include <functional>
 #include <memory>
-#include <vector>
+#include <utility>
 
 namespace Raz {
 
@@ -38,6 +40,68 @@ enum class ImageDataType {
   FLOAT
 };
 
+/// ImageBuffer class, holding the contiguous values of an image.
+/// The memory can either be allocated by the buffer itself or adopted from an external allocation (for example a decoder's output),
+///   avoiding a copy of the whole data.
+/// \tparam T Type of the values to be held.
+template <typename T>
+class ImageBuffer {
+public:
+  /// Function called to release an adopted allocation.
+  using Deleter = std::function<void(T*)>;
+
+  ImageBuffer() = default;
+  explicit ImageBuffer(std::size_t size) { resize(size); }
+  /// Creates a buffer adopting an externally allocated memory, which will be released through the given deleter once the buffer is destroyed.
+  /// \param data Memory to be adopted. Must hold at least `size` values.
+  /// \param size Number of values held by the memory.
+  /// \param deleter Function to be called to release the memory.
+  ImageBuffer(T* data, std::size_t size, Deleter deleter) noexcept : m_data(data, std::move(deleter)), m_size{ size } {}
+  ImageBuffer(const ImageBuffer& buffer) : ImageBuffer(buffer.m_size) { std::copy_n(buffer.data(), m_size, data()); }
+  ImageBuffer(ImageBuffer&& buffer) noexcept : m_data{ std::move(buffer.m_data) }, m_size{ std::exchange(buffer.m_size, 0) } {}
+
+  const T* data() const noexcept { return m_data.get(); }
+  T* data() noexcept { return m_data.get(); }
+  std::size_t size() const noexcept { return m_size; }
+  bool empty() const noexcept { return (m_size == 0); }
+  const T* begin() const noexcept { return data(); }
+  T* begin() noexcept { return data(); }
+  const T* cbegin() const noexcept { return data(); }
+  const T* end() const noexcept { return data() + m_size; }
+  T* end() noexcept { return data() + m_size; }
+  const T* cend() const noexcept { return data() + m_size; }
+
+  /// Resizes the buffer, keeping the existing values; new ones are zero-initialized.
+  /// \note If the size changes, a new memory is allocated by the buffer and any adopted one is released.
+  /// \param size New number of values.
+  void resize(std::size_t size) {
+    if (m_data && size == m_size)
+      return;
+
+    std::unique_ptr<T[], Deleter> newData(new T[size](), [] (T* ptr) noexcept { delete[] ptr; });
+    std::copy_n(data(), std::min(size, m_size), newData.get());
+
+    m_data = std::move(newData);
+    m_size = size;
+  }
+
+  ImageBuffer& operator=(const ImageBuffer& buffer) {
+    if (this != &buffer)
+      *this = ImageBuffer(buffer);
+
+    return *this;
+  }
+  ImageBuffer& operator=(ImageBuffer&& buffer) noexcept {
+    m_data = std::move(buffer.m_data);
+    m_size = std::exchange(buffer.m_size, 0);
+    return *this;
+  }
+
+private:
+  std::unique_ptr<T[], Deleter> m_data {};
+  std::size_t m_size {};
+};
+
 /// ImageData class, representing data held by an Image.
 struct ImageData {
   ImageData() = default;
@@ -47,6 +111,9 @@ struct ImageData {
   virtual ImageDataType getDataType() const = 0;
   virtual const void* getDataPtr() const = 0;
   virtual void* getDataPtr() = 0;
+  /// Gets the number of values held.
+  /// \return Data size.
+  virtual std::size_t getSize() const = 0;
 
   /// Checks if the image doesn't contain data.
   /// \return True if the image has no data, false otherwise.
@@ -69,6 +136,11 @@ struct ImageData {
 /// ImageData in bytes.
 struct ImageDataB final : public ImageData {
   explicit ImageDataB(std::size_t dataSize) { resize(dataSize); }
+  /// Creates image data adopting an externally allocated memory, without copying it.
+  /// \param values Memory to be adopted. Must hold at least `dataSize` values.
+  /// \param dataSize Number of values held by the memory.
+  /// \param deleter Function to be called to release the memory once the data is destroyed.
+  ImageDataB(uint8_t* values, std::size_t dataSize, ImageBuffer<uint8_t>::Deleter deleter) noexcept : data(values, dataSize, std::move(deleter)) {}
 
   ImageDataType getDataType() const override { return ImageDataType::BYTE; }
   const void* getDataPtr() const override { return data.data(); }
@@ -76,6 +148,9 @@ struct ImageDataB final : public ImageData {
 
   template <typename... Args>
   static ImageDataBPtr create(Args&&... args) { return std::make_unique<ImageDataB>(std::forward<Args>(args)...); }
+  /// Gets the number of values held.
+  /// \return Data size.
+  std::size_t getSize() const override { return data.size(); }
 
   /// Checks if the image doesn't contain data.
   /// \return True if the image has no data, false otherwise.
@@ -90,12 +165,17 @@ struct ImageDataB final : public ImageData {
   /// \return True if data are equal, false otherwise.
   bool operator==(const ImageData& imgData) const override;
 
-  std::vector<uint8_t> data;
+  ImageBuffer<uint8_t> data;
 };
 
 /// ImageData in floating point values (for High Dynamic Range (HDR) images).
 struct ImageDataF final : public ImageData {
   explicit ImageDataF(std::size_t dataSize) { resize(dataSize); }
+  /// Creates image data adopting an externally allocated memory, without copying it.
+  /// \param values Memory to be adopted. Must hold at least `dataSize` values.
+  /// \param dataSize Number of values held by the memory.
+  /// \param deleter Function to be called to release the memory once the data is destroyed.
+  ImageDataF(float* values, std::size_t dataSize, ImageBuffer<float>::Deleter deleter) noexcept : data(values, dataSize, std::move(deleter)) {}
 
   ImageDataType getDataType() const override { return ImageDataType::FLOAT; }
   const void* getDataPtr() const override { return data.data(); }
@@ -103,6 +183,9 @@ struct ImageDataF final : public ImageData {
 
   template <typename... Args>
   static ImageDataFPtr create(Args&&... args) { return std::make_unique<ImageDataF>(std::forward<Args>(args)...); }
+  /// Gets the number of values held.
+  /// \return Data size.
+  std::size_t getSize() const override { return data.size(); }
 
   /// Checks if the image doesn't contain data.
   /// \return True if the image has no data, false otherwise.
@@ -117,7 +200,7 @@ struct ImageDataF final : public ImageData {
   /// \return True if data are equal, false otherwise.
   bool operator==(const ImageData& imgData) const override;
 
-  std::vector<float> data;
+  ImageBuffer<float> data;
 };
 
 /// Image class, handling images of different formats.
@@ -126,6 +209,12 @@ public:
   Image() = default;
   explicit Image(ImageColorspace colorspace, ImageDataType dataType = ImageDataType::BYTE);
   Image(unsigned int width, unsigned int height, ImageColorspace colorspace, ImageDataType dataType = ImageDataType::BYTE);
+  /// Creates an image taking ownership of already existing data, without copying it.
+  /// \param width Width of the image.
+  /// \param height Height of the image.
+  /// \param colorspace Colorspace of the image.
+  /// \param data Data to be held by the image. Its size must be equal to the image's width * height * channel count.
+  Image(unsigned int width, unsigned int height, ImageColorspace colorspace, ImageDataPtr data);
   Image(const Image& img);
   Image(Image&&) noexcept = default;
 
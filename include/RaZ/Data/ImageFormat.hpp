@@ -3,6 +3,7 @@
 #ifndef RAZ_IMAGEFORMAT_HPP
 #define RAZ_IMAGEFORMAT_HPP
 
+#include <span>
 #include <vector>
 
 namespace Raz {
@@ -31,6 +32,13 @@ Image loadFromData(const std::vector<unsigned char>& imgData, bool flipVerticall
 /// \return Loaded image's data.
 Image loadFromData(const unsigned char* imgData, std::size_t dataSize, bool flipVertically = false);
 
+/// Loads an image from a span of bytes, which can for example point to a memory-mapped file.
+/// \note The decoded values are directly adopted by the returned image; no additional copy is made.
+/// \param imgData Data to be loaded as image.
+/// \param flipVertically Flip vertically the image when loading.
+/// \return Loaded image's data.
+Image loadFromData(std::span<const unsigned char> imgData, bool flipVertically = false);
+
 /// Saves an image to a file.
 /// \param filePath File to which to save the image.
 /// \param flipVertically Flip vertically the image when saving.
@@ -6,11 +6,81 @@
 #include "RaZ/Data/Image.hpp"
 
 #include <array>
+#include <vector>
 
 namespace Raz::ImageUtils {
 
+enum class ResizeFilter {
+  BOX,      ///< Averages all source pixels covered by the destination one; nearest neighbor when upscaling.
+  BILINEAR, ///< Triangle (tent) filter; standard bilinear interpolation when upscaling.
+  LANCZOS   ///< Lanczos windowed sinc filter with a radius of 3; sharpest but most expensive.
+};
+
 std::array<Image, 6> convertEquirectangularToCubemap(const Image& equirectangularImg);
 
+/// Resizes an image with a separable filter.
+/// The image is processed in parallel, in horizontal then vertical passes over cache-sized tiles.
+/// \note Values are filtered as they are stored; sRGB images should be converted to linear beforehand for a gamma-correct result.
+/// \param img Image to be resized.
+/// \param width Width of the resized image. Must be strictly positive.
+/// \param height Height of the resized image. Must be strictly positive.
+/// \param filter Filter to resample the image with.
+/// \return Resized image, with the same colorspace & data type as the original one.
+Image resize(const Image& img, unsigned int width, unsigned int height, ResizeFilter filter = ResizeFilter::BILINEAR);
+
+/// Generates the mipmap chain of an image, each level having half the dimensions of the previous one, down to 1x1.
+/// \param img Image to generate the mipmaps from.
+/// \param filter Filter to downscale each level with.
+/// \return Mipmap levels, from the first one (half the original image's size) to the last (1x1). The original image is not included.
+std::vector<Image> generateMipmaps(const Image& img, ResizeFilter filter = ResizeFilter::BOX);
+
+/// Converts an sRGB(A) image to a linear RGB(A) one.
+/// \param img sRGB or sRGBA image to be converted.
+/// \return Linear RGB(A) image, with a float data type to avoid losing precision in dark values. The alpha channel, if any, is left untouched.
+Image convertSrgbToLinear(const Image& img);
+
+/// Converts a linear RGB(A) image to an sRGB(A) one.
+/// \param img RGB or RGBA image to be converted. Float values are expected to be between 0 & 1, and are clamped otherwise.
+/// \return sRGB(A) image, with a byte data type. The alpha channel, if any, is left untouched.
+Image convertLinearToSrgb(const Image& img);
+
+/// Adds an alpha channel to a RGB or sRGB image.
+/// \param img Image to be converted.
+/// \param alphaValue Alpha value to be given to every pixel, between 0 & 1.
+/// \return RGBA or sRGBA image.
+Image convertRgbToRgba(const Image& img, float alphaValue = 1.f);
+
+/// Removes the alpha channel of a RGBA or sRGBA image.
+/// \param img Image to be converted.
+/// \return RGB or sRGB image.
+Image convertRgbaToRgb(const Image& img);
+
+/// Reorders the channels of an image in place.
+///
+///     // Converting a BGRA image to a RGBA one
+///     swizzleChannels(img, { 2, 1, 0, 3 });
+///
+/// \param img Image whose channels are to be reordered.
+/// \param channelMapping Source channel index of each destination channel. Only the image's channel count of mappings are used,
+///   each of which must be lower than the channel count.
+void swizzleChannels(Image& img, const std::array<uint8_t, 4>& channelMapping);
+
+/// Flips an image horizontally in place, mirroring it around its vertical axis.
+/// \param img Image to be flipped.
+void flipHorizontally(Image& img);
+
+/// Flips an image vertically in place, mirroring it around its horizontal axis.
+/// \param img Image to be flipped.
+void flipVertically(Image& img);
+
+/// Multiplies the color channels of an image by its alpha channel in place.
+/// \param img Image to be premultiplied. Must have an alpha channel.
+void premultiplyAlpha(Image& img);
+
+/// Divides the color channels of a premultiplied image by its alpha channel in place. Fully transparent pixels are left untouched.
+/// \param img Image to be unpremultiplied. Must have an alpha channel.
+void unpremultiplyAlpha(Image& img);
+
 } // namespace Raz::ImageUtils
 
 #endif // RAZ_IMAGEUTILS_HPP
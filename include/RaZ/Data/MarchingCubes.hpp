@@ -3,11 +3,21 @@
 #ifndef RAZ_MARCHINGCUBES_HPP
 #define RAZ_MARCHINGCUBES_HPP
 
+#include "RaZ/Math/Vector.hpp"
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
 namespace Raz {
 
 template <typename T>
 class Grid3;
 using Grid3b = Grid3<bool>;
+using Grid3f = Grid3<float>;
+template <typename T>
+class SparseGrid3;
+using SparseGrid3b = SparseGrid3<bool>;
 class Mesh;
 
 namespace MarchingCubes {
@@ -17,6 +27,45 @@ namespace MarchingCubes {
 /// \return Mesh representing the contour corresponding to the input grid.
 Mesh compute(const Grid3b& grid);
 
+/// Computes a smooth mesh from a scalar field using the marching cubes algorithm.
+/// Vertices are placed where the field crosses the iso-level, linearly interpolated along the cells' edges, & are shared between adjacent triangles.
+/// Their normals are computed from the field's gradient, and point towards increasing values.
+/// \param grid 3D grid of scalar values, such as a signed distance field.
+/// \param isoLevel Value defining the contour; points whose value is lower than it are considered inside.
+/// \return Indexed mesh representing the contour, placed the same way as the one computed from a boolean grid.
+Mesh compute(const Grid3f& grid, float isoLevel);
+
+/// Computes a mesh from a sparse grid using the marching cubes algorithm. Chunks are meshed in parallel, & those whose values are all identical are skipped.
+/// Vertices are shared between adjacent triangles, including across chunk borders, & their normals are averaged from all the triangles using them.
+/// \param grid Sparse 3D grid to create the mesh from.
+/// \return Mesh representing the contour corresponding to the input grid, placed the same way as the one computed from a dense grid.
+Mesh compute(const SparseGrid3b& grid);
+
+/// Meshes a sparse grid chunk by chunk, keeping the result of each so that only the parts affected by modified chunks are recomputed.
+class IncrementalMesher {
+public:
+  std::size_t getMeshedChunkCount() const noexcept { return m_chunkMeshes.size(); }
+
+  /// Recomputes, in parallel, the chunks affected by the grid's dirty ones, then clears the grid's dirty flags.
+  /// \note The cells on a chunk's lower borders depend on the neighboring chunks' values, which are remeshed as well.
+  /// \param grid Sparse 3D grid to update the mesh from. Must keep the same dimensions between updates.
+  /// \return Number of chunks which have been remeshed.
+  std::size_t update(SparseGrid3b& grid);
+  /// Builds the mesh from all the meshed chunks, welding the vertices shared across their borders.
+  /// \return Mesh representing the contour corresponding to the grid at the last update.
+  Mesh buildMesh() const;
+
+  /// Mesh data of a single chunk, whose vertices are identified by the grid edge they lie on.
+  struct ChunkMesh {
+    std::vector<Vec3f> positions {};
+    std::vector<uint64_t> edgeKeys {};
+    std::vector<unsigned int> indices {};
+  };
+
+private:
+  std::map<std::size_t, ChunkMesh> m_chunkMeshes {};
+};
+
 } // namespace MarchingCubes
 
 } // namespace Raz
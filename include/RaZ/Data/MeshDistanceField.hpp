@@ -4,6 +4,7 @@
 #define RAZ_MESHDISTANCEFIELD_HPP
 
 #include "RaZ/Data/Grid3.hpp"
+#include "RaZ/Data/SparseGrid3.hpp"
 #include "RaZ/Utils/Shape.hpp"
 
 namespace Raz {
@@ -28,11 +29,32 @@ public:
   /// \note This requires a BVH to have been set.
   /// \see setBvh()
   void compute(std::size_t sampleCount);
+  /// Computes the exact distance field's values for each point within the grid. Much faster than sampling directions, this is to be preferred for baking.
+  /// Distances are first computed in a narrow band around the mesh from the closest triangles, then propagated to the rest of the grid by jump flooding.
+  /// Signs are found by counting, along each row of the grid, the mesh's surface crossings; the mesh must thus be closed for them to be correct.
+  /// \param narrowBandWidth Distance, in number of cells, around the mesh's surface within which the distances are computed directly; must not be 0.
+  /// \param propagateBeyondBand True to fill the whole grid, false to leave the points outside the narrow band to the maximum (signed) float value.
+  /// \note This requires a BVH to have been set.
+  /// \see setBvh(), recoverNarrowBand()
+  void computeExact(std::size_t narrowBandWidth = 2, bool propagateBeyondBand = true);
   /// Recovers the distance field's values in a list of 2D floating-point images.
   /// \return Images of each slice of the field along the depth.
   std::vector<Image> recoverSlices() const;
+  /// Recovers the distance field's values close to the mesh in a sparse grid, which only allocates the chunks holding them.
+  /// Values beyond the given distance are clamped to it; those outside of the mesh are not stored, but those inside still are.
+  /// \param maxDistance Distance beyond which values are not needed, which is used as the sparse grid's default value.
+  /// \param chunkSize Number of values along each side of the sparse grid's chunks.
+  /// \return Sparse grid of the distances within the narrow band around the mesh.
+  SparseGrid3f recoverNarrowBand(float maxDistance, std::size_t chunkSize = 32) const;
 
 private:
+  /// Computes the position of a grid point within the area.
+  /// \param widthIndex Index of the point along the width.
+  /// \param heightIndex Index of the point along the height.
+  /// \param depthIndex Index of the point along the depth.
+  /// \return Point's position.
+  Vec3f computePoint(std::size_t widthIndex, std::size_t heightIndex, std::size_t depthIndex) const noexcept;
+
   AABB m_area = AABB(Vec3f(0.f), Vec3f(0.f));
   const BoundingVolumeHierarchy* m_bvh = nullptr;
 };
@@ -0,0 +1,55 @@
+#pragma once
+
+#ifndef RAZ_NOISEFIELD_HPP
+#define RAZ_NOISEFIELD_HPP
+
+#include "RaZ/Math/NoiseSettings.hpp"
+#include "RaZ/Math/Vector.hpp"
+
+namespace Raz {
+
+template <typename T>
+class Grid2;
+using Grid2f = Grid2<float>;
+template <typename T>
+class Grid3;
+using Grid3f = Grid3<float>;
+class Image;
+
+enum class NoiseType {
+  PERLIN, ///< [Perlin noise](https://en.wikipedia.org/wiki/Perlin_noise).
+  SIMPLEX ///< [Simplex noise](https://en.wikipedia.org/wiki/Simplex_noise), summing fewer corners & showing fewer directional artifacts than Perlin noise.
+};
+
+namespace NoiseField {
+
+/// Fills a 2D grid with noise values, computed in parallel by rows.
+/// The value of the point at [widthIndex; heightIndex] is the noise at (widthIndex + offset.x; heightIndex + offset.y) multiplied by the settings' frequency.
+/// \param grid Grid to be filled.
+/// \param type Type of the noise to be computed.
+/// \param settings Frequency, fractional Brownian motion & seed parameters.
+/// \param offset Offset to be applied to the points' coordinates; this allows filling adjacent regions, such as terrain tiles, seamlessly.
+void fill(Grid2f& grid, NoiseType type, const NoiseSettings& settings = {}, const Vec2f& offset = Vec2f(0.f));
+
+/// Fills a 3D grid with noise values, computed in parallel by depth slices.
+/// The value of the point at [widthIndex; heightIndex; depthIndex] is the noise at (widthIndex + offset.x; heightIndex + offset.y; depthIndex + offset.z)
+///   multiplied by the settings' frequency.
+/// \param grid Grid to be filled.
+/// \param type Type of the noise to be computed.
+/// \param settings Frequency, fractional Brownian motion & seed parameters.
+/// \param offset Offset to be applied to the points' coordinates; this allows filling adjacent regions, such as terrain chunks, seamlessly.
+void fill(Grid3f& grid, NoiseType type, const NoiseSettings& settings = {}, const Vec3f& offset = Vec3f(0.f));
+
+/// Fills an image with noise values, computed in parallel by rows. All channels of a pixel are given the same value.
+/// Byte images always receive normalized values, remapped between [0; 255]; float images receive them as computed.
+/// \param image Image to be filled; must not be empty.
+/// \param type Type of the noise to be computed.
+/// \param settings Frequency, fractional Brownian motion & seed parameters.
+/// \param offset Offset to be applied to the pixels' coordinates.
+void fill(Image& image, NoiseType type, const NoiseSettings& settings = {}, const Vec2f& offset = Vec2f(0.f));
+
+} // namespace NoiseField
+
+} // namespace Raz
+
+#endif // RAZ_NOISEFIELD_HPP
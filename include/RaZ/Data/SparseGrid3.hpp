@@ -0,0 +1,157 @@
+#pragma once
+
+#ifndef RAZ_SPARSEGRID3_HPP
+#define RAZ_SPARSEGRID3_HPP
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace Raz {
+
+/// 3-dimensional grid of values, split into cubic chunks (bricks) which are only allocated when holding a value different from the default one.
+/// This allows representing very large volumes which are mostly empty, such as terrains, with a memory footprint proportional to their non-empty parts.
+/// Chunks modified since the dirty flags have last been cleared are tracked, so that their dependent data can be updated incrementally.
+/// \tparam T Type of the values.
+template <typename T>
+class SparseGrid3 {
+public:
+  using Chunk = std::vector<T>;
+
+  /// Creates a sparse 3D grid; no memory is allocated for the values until they are set.
+  /// \param width Number of values along the width; must be equal to or greater than 1.
+  /// \param height Number of values along the height; must be equal to or greater than 1.
+  /// \param depth Number of values along the depth; must be equal to or greater than 1.
+  /// \param defaultValue Value of each point in the grid which has not been set.
+  /// \param chunkSize Number of values along each side of a chunk; must be equal to or greater than 1.
+  SparseGrid3(std::size_t width, std::size_t height, std::size_t depth, const T& defaultValue = {}, std::size_t chunkSize = 32)
+    : m_width{ width }, m_height{ height }, m_depth{ depth }, m_chunkSize{ chunkSize }, m_defaultValue{ defaultValue } {
+    if (width == 0 || height == 0 || depth == 0)
+      throw std::invalid_argument("[SparseGrid3] The width, height & depth must not be 0.");
+
+    if (chunkSize == 0)
+      throw std::invalid_argument("[SparseGrid3] The chunk size must not be 0.");
+
+    m_chunkCountX = (width + chunkSize - 1) / chunkSize;
+    m_chunkCountY = (height + chunkSize - 1) / chunkSize;
+    m_chunkCountZ = (depth + chunkSize - 1) / chunkSize;
+  }
+
+  constexpr std::size_t getWidth() const noexcept { return m_width; }
+  constexpr std::size_t getHeight() const noexcept { return m_height; }
+  constexpr std::size_t getDepth() const noexcept { return m_depth; }
+  constexpr std::size_t getChunkSize() const noexcept { return m_chunkSize; }
+  constexpr std::size_t getChunkCountX() const noexcept { return m_chunkCountX; }
+  constexpr std::size_t getChunkCountY() const noexcept { return m_chunkCountY; }
+  constexpr std::size_t getChunkCountZ() const noexcept { return m_chunkCountZ; }
+  const T& getDefaultValue() const noexcept { return m_defaultValue; }
+  /// Gets the number of chunks currently allocated.
+  /// \return Allocated chunk count.
+  std::size_t getAllocatedChunkCount() const noexcept { return m_chunks.size(); }
+  const std::unordered_map<std::size_t, Chunk>& getChunks() const noexcept { return m_chunks; }
+  /// Gets the indices of the chunks whose values have been modified since the last call to clearDirtyChunks().
+  /// \return Indices of the modified chunks, some of which may not be allocated anymore.
+  const std::unordered_set<std::size_t>& getDirtyChunks() const noexcept { return m_dirtyChunks; }
+
+  std::conditional_t<std::is_same_v<T, bool>, T, const T&> getValue(std::size_t widthIndex, std::size_t heightIndex, std::size_t depthIndex) const noexcept {
+    const auto chunkIt = m_chunks.find(computeChunkIndex(widthIndex, heightIndex, depthIndex));
+
+    if (chunkIt == m_chunks.cend())
+      return m_defaultValue;
+
+    return chunkIt->second[computeLocalIndex(widthIndex, heightIndex, depthIndex)];
+  }
+
+  /// Finds an allocated chunk.
+  /// \param chunkIndex Index of the chunk to be found.
+  /// \return Values of the chunk, stored in depth, height & width order, or nullptr if it is not allocated.
+  const Chunk* findChunk(std::size_t chunkIndex) const noexcept {
+    const auto chunkIt = m_chunks.find(chunkIndex);
+    return (chunkIt != m_chunks.cend() ? &chunkIt->second : nullptr);
+  }
+
+  /// Computes the index of the chunk containing the given point.
+  /// \param widthIndex Index of the point along the width.
+  /// \param heightIndex Index of the point along the height.
+  /// \param depthIndex Index of the point along the depth.
+  /// \return Index of the chunk.
+  constexpr std::size_t computeChunkIndex(std::size_t widthIndex, std::size_t heightIndex, std::size_t depthIndex) const noexcept {
+    assert("Error: The given width index is invalid." && widthIndex < m_width);
+    assert("Error: The given height index is invalid." && heightIndex < m_height);
+    assert("Error: The given depth index is invalid." && depthIndex < m_depth);
+    return ((depthIndex / m_chunkSize) * m_chunkCountY + heightIndex / m_chunkSize) * m_chunkCountX + widthIndex / m_chunkSize;
+  }
+
+  /// Recovers the coordinates of a chunk, in number of chunks along the width, height & depth.
+  /// \param chunkIndex Index of the chunk.
+  /// \return Chunk coordinates.
+  constexpr std::array<std::size_t, 3> recoverChunkCoordinates(std::size_t chunkIndex) const noexcept {
+    return { chunkIndex % m_chunkCountX, (chunkIndex / m_chunkCountX) % m_chunkCountY, chunkIndex / (m_chunkCountX * m_chunkCountY) };
+  }
+
+  /// Sets a value in the grid. Setting the default value to a point whose chunk is not allocated does nothing.
+  /// \param widthIndex Index of the point along the width.
+  /// \param heightIndex Index of the point along the height.
+  /// \param depthIndex Index of the point along the depth.
+  /// \param value Value to be set.
+  void setValue(std::size_t widthIndex, std::size_t heightIndex, std::size_t depthIndex, T value) {
+    const std::size_t chunkIndex = computeChunkIndex(widthIndex, heightIndex, depthIndex);
+    auto chunkIt = m_chunks.find(chunkIndex);
+
+    if (chunkIt == m_chunks.end()) {
+      if (value == m_defaultValue)
+        return;
+
+      chunkIt = m_chunks.emplace(chunkIndex, Chunk(m_chunkSize * m_chunkSize * m_chunkSize, m_defaultValue)).first;
+    }
+
+    chunkIt->second[computeLocalIndex(widthIndex, heightIndex, depthIndex)] = std::move(value);
+    m_dirtyChunks.emplace(chunkIndex);
+  }
+
+  /// Deallocates a chunk, all its values being reset to the default one. This can be used to stream out parts of a volume.
+  /// \param chunkIndex Index of the chunk to be removed.
+  void removeChunk(std::size_t chunkIndex) {
+    if (m_chunks.erase(chunkIndex) > 0)
+      m_dirtyChunks.emplace(chunkIndex);
+  }
+
+  /// Deallocates all chunks whose values are all equal to the default one.
+  /// \return Number of chunks that have been deallocated.
+  std::size_t prune() {
+    return std::erase_if(m_chunks, [this] (const auto& chunk) {
+      return std::all_of(chunk.second.cbegin(), chunk.second.cend(), [this] (const T& value) { return (value == m_defaultValue); });
+    });
+  }
+
+  void clearDirtyChunks() noexcept { m_dirtyChunks.clear(); }
+
+private:
+  constexpr std::size_t computeLocalIndex(std::size_t widthIndex, std::size_t heightIndex, std::size_t depthIndex) const noexcept {
+    return ((depthIndex % m_chunkSize) * m_chunkSize + heightIndex % m_chunkSize) * m_chunkSize + widthIndex % m_chunkSize;
+  }
+
+  std::size_t m_width {};
+  std::size_t m_height {};
+  std::size_t m_depth {};
+  std::size_t m_chunkSize {};
+  std::size_t m_chunkCountX {};
+  std::size_t m_chunkCountY {};
+  std::size_t m_chunkCountZ {};
+  T m_defaultValue {};
+  std::unordered_map<std::size_t, Chunk> m_chunks {};
+  std::unordered_set<std::size_t> m_dirtyChunks {};
+};
+
+using SparseGrid3b = SparseGrid3<bool>;
+using SparseGrid3f = SparseGrid3<float>;
+
+} // namespace Raz
+
+#endif // RAZ_SPARSEGRID3_HPP
@@ -11,7 +11,8 @@ CompT& Entity::addComponent(Args&&... args) {
   if (compId >= m_components.size())
     m_components.resize(compId + 1);
 
-  m_components[compId] = std::make_unique<CompT>(std::forward<Args>(args)...);
+  // Each component type is allocated from its own pool
+  m_components[compId] = ComponentPtr(new (Allocator::getPoolResource<CompT>()) CompT(std::forward<Args>(args)...));
   m_enabledComponents.setBit(compId);
 
   return static_cast<CompT&>(*m_components[compId]);
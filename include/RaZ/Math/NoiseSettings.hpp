@@ -0,0 +1,22 @@
+#pragma once
+
+#ifndef RAZ_NOISESETTINGS_HPP
+#define RAZ_NOISESETTINGS_HPP
+
+#include <cstdint>
+
+namespace Raz {
+
+/// Parameters used to compute noise values in batch, applying a [fractional Brownian motion](https://en.wikipedia.org/wiki/Fractional_Brownian_motion).
+struct NoiseSettings {
+  float frequency     = 1.f;   ///< Frequency of the first octave, by which the points' coordinates are multiplied.
+  uint8_t octaveCount = 1;     ///< Amount of octaves to be summed, each adding finer details.
+  float lacunarity    = 2.f;   ///< Factor by which the frequency is multiplied between two successive octaves.
+  float persistence   = 0.5f;  ///< Factor by which the amplitude is multiplied between two successive octaves.
+  uint32_t seed       = 0;     ///< Seed from which the pseudo-random gradients are picked.
+  bool normalize      = false; ///< Remap the values between [0; 1]. If false, the original [-1; 1] range is preserved.
+};
+
+} // namespace Raz
+
+#endif // RAZ_NOISESETTINGS_HPP
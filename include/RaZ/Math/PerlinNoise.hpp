@@ -3,7 +3,11 @@
 #ifndef RAZ_PERLINNOISE_HPP
 #define RAZ_PERLINNOISE_HPP
 
+#include "RaZ/Math/NoiseSettings.hpp"
+#include "RaZ/Math/Vector.hpp"
+
 #include <cstdint>
+#include <span>
 
 namespace Raz::PerlinNoise {
 
@@ -31,6 +35,20 @@ float compute2D(float x, float y, uint8_t octaveCount = 1, bool normalize = fals
 /// \return 3D Perlin noise value. May be slightly below or above the expected range.
 float compute3D(float x, float y, float z, uint8_t octaveCount = 1, bool normalize = false);
 
+/// Computes the 2D Perlin noise at several points at once, which is much faster than computing them one by one.
+/// With the default settings, the values are equal to those given by the single-point computation for positive coordinates; negative ones are handled as well.
+/// \param points Coordinates of the points.
+/// \param values Computed noise values, one for each point.
+/// \param settings Frequency, fractional Brownian motion & seed parameters.
+void compute2D(std::span<const Vec2f> points, std::span<float> values, const NoiseSettings& settings = {});
+
+/// Computes the 3D Perlin noise at several points at once, which is much faster than computing them one by one.
+/// With the default settings, the values are equal to those given by the single-point computation for positive coordinates; negative ones are handled as well.
+/// \param points Coordinates of the points.
+/// \param values Computed noise values, one for each point.
+/// \param settings Frequency, fractional Brownian motion & seed parameters.
+void compute3D(std::span<const Vec3f> points, std::span<float> values, const NoiseSettings& settings = {});
+
 } // namespace Raz::PerlinNoise
 
 #endif // RAZ_PERLINNOISE_HPP
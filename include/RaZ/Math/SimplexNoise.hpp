@@ -0,0 +1,49 @@
+#pragma once
+
+#ifndef RAZ_SIMPLEXNOISE_HPP
+#define RAZ_SIMPLEXNOISE_HPP
+
+#include "RaZ/Math/NoiseSettings.hpp"
+#include "RaZ/Math/Vector.hpp"
+
+#include <cstdint>
+#include <span>
+
+namespace Raz::SimplexNoise {
+
+/// Computes the 2D [simplex noise](https://en.wikipedia.org/wiki/Simplex_noise) at the given coordinates.
+/// Only the 3 corners of the triangle containing the point are summed instead of the 4 corners of a square, and fewer directional artifacts appear than with Perlin noise.
+/// \param x X coordinate.
+/// \param y Y coordinate.
+/// \param octaveCount Amount of octaves to apply for the [fractional Brownian motion](https://en.wikipedia.org/wiki/Fractional_Brownian_motion) computation.
+/// \param normalize Remap the value between [0; 1]. If false, the original [-1; 1] range is preserved.
+/// \return 2D simplex noise value. May be slightly below or above the expected range.
+float compute2D(float x, float y, uint8_t octaveCount = 1, bool normalize = false);
+
+/// Computes the 3D [simplex noise](https://en.wikipedia.org/wiki/Simplex_noise) at the given coordinates.
+/// Only the 4 corners of the tetrahedron containing the point are summed instead of the 8 corners of a cube, and fewer directional artifacts appear than with Perlin noise.
+/// \param x X coordinate.
+/// \param y Y coordinate.
+/// \param z Z coordinate.
+/// \param octaveCount Amount of octaves to apply for the [fractional Brownian motion](https://en.wikipedia.org/wiki/Fractional_Brownian_motion) computation.
+/// \param normalize Remap the value between [0; 1]. If false, the original [-1; 1] range is preserved.
+/// \return 3D simplex noise value. May be slightly below or above the expected range.
+float compute3D(float x, float y, float z, uint8_t octaveCount = 1, bool normalize = false);
+
+/// Computes the 2D simplex noise at several points at once, which is much faster than computing them one by one.
+/// With the default settings, the values are equal to those given by the single-point computation.
+/// \param points Coordinates of the points.
+/// \param values Computed noise values, one for each point.
+/// \param settings Frequency, fractional Brownian motion & seed parameters.
+void compute2D(std::span<const Vec2f> points, std::span<float> values, const NoiseSettings& settings = {});
+
+/// Computes the 3D simplex noise at several points at once, which is much faster than computing them one by one.
+/// With the default settings, the values are equal to those given by the single-point computation.
+/// \param points Coordinates of the points.
+/// \param values Computed noise values, one for each point.
+/// \param settings Frequency, fractional Brownian motion & seed parameters.
+void compute3D(std::span<const Vec3f> points, std::span<float> values, const NoiseSettings& settings = {});
+
+} // namespace Raz::SimplexNoise
+
+#endif // RAZ_SIMPLEXNOISE_HPP
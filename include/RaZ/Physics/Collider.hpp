@@ -6,9 +6,11 @@
 #include "RaZ/Component.hpp"
 
 #include <cassert>
+#include <cstdint>
 
 namespace Raz {
 
+struct ContactManifold;
 class Ray;
 struct RayHit;
 class Shape;
@@ -22,6 +24,9 @@ public:
   Collider(Collider&&) noexcept = default;
 
   ShapeType getShapeType() const noexcept { return m_shapeType; }
+  /// Gets the layers the collider belongs to, each bit representing a layer.
+  /// \return Layers of the collider.
+  std::uint32_t getLayerMask() const noexcept { return m_layerMask; }
   bool hasShape() const noexcept { return (m_colliderShape != nullptr); }
   const Shape& getShape() const noexcept { assert("Error: No collider shape defined." && hasShape()); return *m_colliderShape; }
   Shape& getShape() noexcept { assert("Error: No collider shape defined." && hasShape()); return *m_colliderShape; }
@@ -29,16 +34,27 @@ public:
   template <typename ShapeT> ShapeT& getShape() noexcept { return const_cast<ShapeT&>(static_cast<const Collider*>(this)->getShape<ShapeT>()); }
 
   void setShape(Shape&& shape);
+  /// Sets the layers the collider belongs to, each bit representing a layer. Physics queries only find colliders sharing at least one layer with
+  ///  their own mask. By default, a collider only belongs to the first layer.
+  /// \param layerMask Layers of the collider.
+  void setLayerMask(std::uint32_t layerMask) noexcept { m_layerMask = layerMask; }
 
   bool intersects(const Collider& collider) const { return intersects(*collider.m_colliderShape); }
   bool intersects(const Shape& shape) const;
   bool intersects(const Ray& ray, RayHit* hit = nullptr) const;
+  /// Computes the contact between the given shape & the collider.
+  /// \param shape Shape to compute the contact with, expressed in the collider's space.
+  /// \param manifold Computed contact manifold, whose normal points from the collider towards the shape.
+  /// \return True if the shape is in contact with the collider, false otherwise.
+  /// \see NarrowPhase::computeContact()
+  bool computeContact(const Shape& shape, ContactManifold& manifold) const;
 
   Collider& operator=(const Collider&) = delete;
   Collider& operator=(Collider&&) noexcept = default;
 
 private:
   ShapeType m_shapeType {};
+  std::uint32_t m_layerMask = 1;
   std::unique_ptr<Shape> m_colliderShape {};
 };
 
@@ -0,0 +1,100 @@
+#pragma once
+
+#ifndef RAZ_CONVEXHULL_HPP
+#define RAZ_CONVEXHULL_HPP
+
+#include "RaZ/Utils/Shape.hpp"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace Raz {
+
+class Mesh;
+
+/// Convex polyhedron enclosing a set of points, defined by its vertices & triangular faces.
+/// Its intersection checks are made through the narrow phase's GJK algorithm.
+/// \see NarrowPhase
+class ConvexHull final : public Shape {
+public:
+  /// Triangular face of the hull, whose vertices are defined in counter-clockwise order seen from the outside.
+  struct Face {
+    std::array<std::uint32_t, 3> indices {}; ///< Indices of the face's vertices.
+    Vec3f normal {};                         ///< Normal of the face, pointing outward.
+    float distance {};                       ///< Distance of the face's plane from the origin along its normal.
+  };
+
+  /// Creates the convex hull enclosing the given points.
+  /// \param points Points to compute the hull of. At least 4 of them must not be coplanar.
+  explicit ConvexHull(const std::vector<Vec3f>& points);
+  /// Creates the convex hull enclosing all vertices of a mesh.
+  /// \param mesh Mesh to compute the hull of.
+  explicit ConvexHull(const Mesh& mesh);
+
+  ShapeType getType() const noexcept override { return ShapeType::CONVEX_HULL; }
+  const std::vector<Vec3f>& getVertices() const noexcept { return m_vertices; }
+  const std::vector<Face>& getFaces() const noexcept { return m_faces; }
+
+  /// Point containment check.
+  /// \param point Point to be checked.
+  /// \return True if the point is inside the hull or on its surface, false otherwise.
+  bool contains(const Vec3f& point) const override;
+  /// Hull-line intersection check.
+  /// \param line Line to check if there is an intersection with.
+  /// \return True if both shapes intersect each other, false otherwise.
+  bool intersects(const Line& line) const override;
+  /// Hull-plane intersection check.
+  /// \param plane Plane to check if there is an intersection with.
+  /// \return True if both shapes intersect each other, false otherwise.
+  bool intersects(const Plane& plane) const override;
+  /// Hull-sphere intersection check.
+  /// \param sphere Sphere to check if there is an intersection with.
+  /// \return True if both shapes intersect each other, false otherwise.
+  bool intersects(const Sphere& sphere) const override;
+  /// Hull-triangle intersection check.
+  /// \param triangle Triangle to check if there is an intersection with.
+  /// \return True if both shapes intersect each other, false otherwise.
+  bool intersects(const Triangle& triangle) const override;
+  /// Hull-quad intersection check.
+  /// \param quad Quad to check if there is an intersection with.
+  /// \return True if both shapes intersect each other, false otherwise.
+  bool intersects(const Quad& quad) const override;
+  /// Hull-AABB intersection check.
+  /// \param aabb AABB to check if there is an intersection with.
+  /// \return True if both shapes intersect each other, false otherwise.
+  bool intersects(const AABB& aabb) const override;
+  /// Hull-OBB intersection check.
+  /// \param obb OBB to check if there is an intersection with.
+  /// \return True if both shapes intersect each other, false otherwise.
+  bool intersects(const OBB& obb) const override;
+  /// Ray-hull intersection check.
+  /// \param ray Ray to check if there is an intersection with.
+  /// \param hit Optional ray intersection's information to recover (nullptr if unneeded).
+  /// \return True if the ray intersects the hull, false otherwise.
+  bool intersects(const Ray& ray, RayHit* hit) const override;
+  /// Translates the hull by the given vector.
+  /// \param displacement Displacement to be translated by.
+  void translate(const Vec3f& displacement) noexcept override;
+  /// Computes the projection of a point (closest point) onto the hull.
+  /// The projected point may be inside the hull itself or on its surface.
+  /// \param point Point to compute the projection from.
+  /// \return Point projected onto/into the hull.
+  Vec3f computeProjection(const Vec3f& point) const override;
+  /// Computes the hull's centroid, which is the average of its vertices.
+  /// \return Computed centroid.
+  Vec3f computeCentroid() const override;
+  AABB computeBoundingBox() const override;
+  /// Computes the hull's support point, which is its farthest vertex in the given direction.
+  /// \param direction Direction in which to find the support point.
+  /// \return Computed support point.
+  Vec3f computeSupport(const Vec3f& direction) const noexcept;
+
+private:
+  std::vector<Vec3f> m_vertices {};
+  std::vector<Face> m_faces {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_CONVEXHULL_HPP
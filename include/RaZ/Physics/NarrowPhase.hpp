@@ -0,0 +1,61 @@
+#pragma once
+
+#ifndef RAZ_NARROWPHASE_HPP
+#define RAZ_NARROWPHASE_HPP
+
+#include "RaZ/Math/Vector.hpp"
+
+#include <array>
+
+namespace Raz {
+
+class Shape;
+
+/// Point of contact between two shapes.
+struct ContactPoint {
+  Vec3f position {};        ///< Position of the contact, on the first shape's surface.
+  float penetrationDepth {}; ///< Distance by which the shapes interpenetrate at this point.
+};
+
+/// Set of contact points between two shapes, sharing the same normal.
+struct ContactManifold {
+  static constexpr std::size_t maxPointCount = 4;
+
+  Vec3f normal {}; ///< Contact normal, pointing from the second shape towards the first one. Moving the first shape along it by the
+                   ///  deepest penetration separates them.
+  std::array<ContactPoint, maxPointCount> points {}; ///< Contact points, sorted by decreasing penetration depth.
+  std::size_t pointCount {};                         ///< Number of valid contact points.
+};
+
+/// Exact intersection checks & contact generation between any pair of shapes. Convex shapes are checked with the GJK (Gilbert-Johnson-Keerthi)
+///  algorithm, contacts being computed with EPA (Expanding Polytope Algorithm). Planes are handled analytically, and triangle meshes by checking
+///  each of their triangles individually.
+namespace NarrowPhase {
+
+/// Computes the support point of a convex shape, which is its farthest point in the given direction.
+/// \param shape Shape to compute the support point of. Must not be a plane nor a triangle mesh.
+/// \param direction Direction in which to find the support point; does not need to be normalized.
+/// \return Computed support point.
+Vec3f computeSupport(const Shape& shape, const Vec3f& direction);
+
+/// Checks if two shapes intersect each other.
+/// \param shape1 First shape to be checked.
+/// \param shape2 Second shape to be checked.
+/// \return True if both shapes intersect each other, false otherwise.
+bool intersects(const Shape& shape1, const Shape& shape2);
+
+/// Computes the contact between two shapes.
+/// \note Convex shapes produce a single contact point, completed by the first shape's vertices inside the second & conversely when they
+///  are polyhedra. Triangle meshes produce one contact point per triangle, the manifold keeping the deepest ones and their deepest's normal.
+///  No contact is computed between two planes.
+/// \param shape1 First shape to compute the contact of.
+/// \param shape2 Second shape to compute the contact of.
+/// \param manifold Computed contact manifold.
+/// \return True if both shapes are in contact, false otherwise.
+bool computeContact(const Shape& shape1, const Shape& shape2, ContactManifold& manifold);
+
+} // namespace NarrowPhase
+
+} // namespace Raz
+
+#endif // RAZ_NARROWPHASE_HPP
@@ -5,29 +5,172 @@
 
 #include "RaZ/System.hpp"
 #include "RaZ/Math/Vector.hpp"
+#include "RaZ/Utils/Ray.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <unordered_map>
+#include <vector>
 
 namespace Raz {
 
+/// Collider found by a physics query.
+struct ColliderHit {
+  Entity* entity {}; ///< Entity holding the collider; nullptr if nothing has been hit.
+  RayHit hit {};     ///< Hit information, in world space.
+};
+
 class PhysicsSystem final : public System {
 public:
+  static constexpr std::uint32_t allLayers = std::numeric_limits<std::uint32_t>::max(); ///< Layer mask matching all colliders.
+  static constexpr float maxQueryDistance  = std::numeric_limits<float>::max();
+
   PhysicsSystem();
 
   constexpr const Vec3f& getGravity() const noexcept { return m_gravity; }
   constexpr float getFriction() const noexcept { return m_friction; }
+  constexpr float getSleepVelocityThreshold() const noexcept { return m_sleepVelocityThreshold; }
+  constexpr float getSleepTimeThreshold() const noexcept { return m_sleepTimeThreshold; }
 
-  void setGravity(const Vec3f& gravity) { m_gravity = gravity; }
+  /// Sets the gravity acceleration, waking up all rigid bodies if it differs from the current one.
+  /// \param gravity New gravity acceleration.
+  void setGravity(const Vec3f& gravity);
   void setFriction(float friction) {
     assert("Error: Friction coefficient must be between 0 & 1." && (friction >= 0.f && friction <= 1.f));
     m_friction = friction;
   }
+  /// Sets the average velocity under which a rigid body is considered to be at rest.
+  /// \param velocityThreshold Velocity threshold; rigid bodies cannot be put to sleep if it is 0.
+  void setSleepVelocityThreshold(float velocityThreshold) {
+    assert("Error: The sleep velocity threshold must be positive." && velocityThreshold >= 0.f);
+    m_sleepVelocityThreshold = velocityThreshold;
+  }
+  /// Sets the time during which a rigid body must stay at rest before being put to sleep.
+  /// \param timeThreshold Time threshold, in seconds.
+  void setSleepTimeThreshold(float timeThreshold) {
+    assert("Error: The sleep time threshold must be positive." && timeThreshold >= 0.f);
+    m_sleepTimeThreshold = timeThreshold;
+  }
 
   bool update(const FrameTimeInfo& timeInfo) override;
+  /// Updates the structure used to accelerate the physics queries from the colliders' current state.
+  /// The structure is entirely rebuilt if colliders have been added or removed since its last update, or only refitted otherwise.
+  /// \note This is automatically done at the end of each update; it only needs to be called when colliders have been modified since then
+  ///  and must be queried before the next update.
+  void updateQueryStructure();
+  /// Casts a ray against all colliders, finding the closest one hit.
+  /// \note Colliders whose shape cannot be intersected by a ray (lines, quads & OBBs) are ignored, as are those surrounding the ray's origin
+  ///  and only intersected behind it.
+  /// \param ray Ray to be cast, in world space.
+  /// \param hit Optional ray intersection's information to recover (nullptr if unneeded).
+  /// \param maxDistance Distance beyond which colliders are ignored.
+  /// \param layerMask Layers of the colliders to be considered.
+  /// \return Entity holding the closest collider hit, or nullptr if none has been.
+  Entity* raycast(const Ray& ray, RayHit* hit = nullptr, float maxDistance = maxQueryDistance, std::uint32_t layerMask = allLayers) const;
+  /// Casts a ray against all colliders, finding all those hit.
+  /// \param ray Ray to be cast, in world space.
+  /// \param maxDistance Distance beyond which colliders are ignored.
+  /// \param layerMask Layers of the colliders to be considered.
+  /// \return Colliders hit, sorted by increasing distance.
+  /// \see raycast()
+  std::vector<ColliderHit> raycastAll(const Ray& ray, float maxDistance = maxQueryDistance, std::uint32_t layerMask = allLayers) const;
+  /// Casts several rays in parallel, finding the closest collider hit by each of them.
+  /// \param rays Rays to be cast, in world space.
+  /// \param maxDistance Distance beyond which colliders are ignored.
+  /// \param layerMask Layers of the colliders to be considered.
+  /// \return Closest collider hit by each ray, in the same order; its entity is nullptr if nothing has been hit.
+  /// \see raycast()
+  /// \warning The work is executed & waited for on the default thread pool; this must thus not be called from one of its tasks.
+  std::vector<ColliderHit> raycastBatch(const std::vector<Ray>& rays, float maxDistance = maxQueryDistance, std::uint32_t layerMask = allLayers) const;
+  /// Finds all colliders overlapping the given sphere.
+  /// \param sphere Sphere to find the overlapping colliders of, in world space.
+  /// \param layerMask Layers of the colliders to be considered.
+  /// \return Entities holding the overlapping colliders.
+  std::vector<Entity*> overlap(const Sphere& sphere, std::uint32_t layerMask = allLayers) const;
+  /// Finds all colliders overlapping the given box.
+  /// \param box Box to find the overlapping colliders of, in world space.
+  /// \param layerMask Layers of the colliders to be considered.
+  /// \return Entities holding the overlapping colliders.
+  std::vector<Entity*> overlap(const AABB& box, std::uint32_t layerMask = allLayers) const;
+  /// Finds the colliders overlapping each of the given spheres, in parallel.
+  /// \param spheres Spheres to find the overlapping colliders of, in world space.
+  /// \param layerMask Layers of the colliders to be considered.
+  /// \return Entities holding the colliders overlapping each sphere, in the same order.
+  /// \see overlap()
+  /// \warning The work is executed & waited for on the default thread pool; this must thus not be called from one of its tasks.
+  std::vector<std::vector<Entity*>> overlapBatch(const std::vector<Sphere>& spheres, std::uint32_t layerMask = allLayers) const;
+  /// Moves a sphere along a direction, finding the first collider it touches.
+  /// \note Only sphere, box & plane colliders are considered. The swept sphere is tested against boxes expanded by its radius, which may
+  ///  report a contact slightly early around their edges & corners.
+  /// \param sphere Sphere to be moved, in world space.
+  /// \param direction Normalized direction in which to move the sphere.
+  /// \param hit Optional contact's information to recover (nullptr if unneeded). Its distance is the one travelled by the sphere before the contact.
+  /// \param maxDistance Maximum distance to move the sphere.
+  /// \param layerMask Layers of the colliders to be considered.
+  /// \return Entity holding the first collider touched, or nullptr if none has been.
+  Entity* sweep(const Sphere& sphere, const Vec3f& direction, RayHit* hit = nullptr,
+                float maxDistance = maxQueryDistance, std::uint32_t layerMask = allLayers) const;
 
 private:
+  struct ColliderState {
+    Vec3f position {};
+    std::optional<AABB> boundingBox {}; ///< Collider's bounding box in world space; none if the collider is unbounded (plane).
+    bool isMovedBySimulation {};        ///< Whether the collider belongs to an awake rigid body, hence is expected to move.
+  };
+
+  struct QueryNode {
+    AABB boundingBox = AABB(Vec3f(0.f), Vec3f(0.f));
+    std::uint32_t firstIndex {};    ///< Index of the first child node if an inner node, of the first collider otherwise.
+    std::uint32_t colliderCount {}; ///< Number of colliders if a leaf node, 0 otherwise.
+  };
+
+  /// Links the entity to the system, requiring the query structure to be rebuilt.
+  /// \param entity Entity to be linked.
+  void linkEntity(const EntityPtr& entity) override;
+  /// Unlinks the entity from the system, requiring the query structure to be rebuilt & waking up the bodies its collider may have supported.
+  /// \param entity Entity to be unlinked.
+  void unlinkEntity(const EntityPtr& entity) override;
+  /// Wakes up the sleeping rigid bodies touching colliders which have been moved, disabled or removed since the last update, as these may
+  ///  have been supporting them.
+  void wakeDisturbedBodies();
   void solveConstraints();
+  /// Separates a rigid body having a solid collider (sphere, box or convex hull) from all colliders it is in contact with, using their
+  ///  contact manifolds, & reflects its velocity along their normals.
+  /// \param entity Entity holding the rigid body & its collider.
+  void solveContacts(Entity& entity);
+  /// Puts to sleep the rigid bodies which have stayed at rest long enough.
+  /// \param elapsedTime Time simulated since the last call, which is the substep time.
+  void updateSleepingBodies(float elapsedTime);
+  void buildQueryNode(std::vector<std::pair<Entity*, AABB>>& colliderBoxes, std::size_t nodeIndex, std::size_t beginIndex, std::size_t endIndex);
+  /// Traverses the query structure, executing an action on all colliders whose bounding box overlaps the given one.
+  /// \param box Bounding box to find the colliders of.
+  /// \param layerMask Layers of the colliders to be considered.
+  /// \param action Action to be executed, taking the collider's entity as argument.
+  template <typename FuncT>
+  void traverseQueryStructure(const AABB& box, std::uint32_t layerMask, const FuncT& action) const;
+  /// Traverses the query structure, executing an action on all colliders whose bounding box is hit by the given ray.
+  /// \param ray Ray to traverse the structure with.
+  /// \param maxDistance Distance beyond which nodes are skipped; the action can return a lower one to skip more nodes.
+  /// \param boxExpansion Distance by which to expand the nodes' bounding boxes, for the ray to find the colliders it passes near.
+  /// \param layerMask Layers of the colliders to be considered.
+  /// \param action Action to be executed, taking the collider's entity as argument & returning the new maximum distance.
+  template <typename FuncT>
+  void traverseQueryStructure(const Ray& ray, float maxDistance, float boxExpansion, std::uint32_t layerMask, const FuncT& action) const;
 
   Vec3f m_gravity  = Vec3f(0.f, -9.80665f, 0.f); ///< Gravity acceleration.
   float m_friction = 0.95f; ///< Friction coefficient.
+  float m_sleepVelocityThreshold = 0.05f; ///< Average velocity under which a rigid body is considered at rest.
+  float m_sleepTimeThreshold     = 0.5f;  ///< Time during which a rigid body must stay at rest to be put to sleep.
+
+  std::vector<QueryNode> m_queryNodes {};       ///< Bounding volume hierarchy of the colliders, whose children are always stored after their parent.
+  std::vector<Entity*> m_queryColliders {};     ///< Colliders referenced by the query nodes' leaves.
+  std::vector<Entity*> m_unboundedColliders {}; ///< Colliders without any bounding box (planes), tested by all queries.
+  bool m_queryStructureDirty = true;
+
+  std::unordered_map<const Entity*, ColliderState> m_colliderStates {}; ///< States of the colliders as of the last update.
+  std::vector<ColliderState> m_disturbedColliders {}; ///< Previous states of the colliders unlinked since the last update.
 };
 
 } // namespace Raz
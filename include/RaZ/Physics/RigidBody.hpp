@@ -22,11 +22,41 @@ public:
   constexpr float getBounciness() const noexcept { return m_bounciness; }
   constexpr const Vec3f& getForces() const noexcept { return m_forces; }
   constexpr const Vec3f& getVelocity() const noexcept { return m_velocity; }
+  /// Checks if the rigid body is sleeping, in which case it is neither moved nor checked for collisions by the physics system.
+  /// \return True if the rigid body is sleeping, false otherwise.
+  constexpr bool isSleeping() const noexcept { return m_isSleeping; }
 
   void setMass(float mass) noexcept;
   void setBounciness(float bounciness) noexcept;
-  template <typename... Args> constexpr void setForces(const Args&... forces) noexcept { m_forces = (forces + ...); }
-  constexpr void setVelocity(const Vec3f& velocity) noexcept { m_velocity = velocity; }
+  /// Sets the forces applied to the rigid body, waking it up if they differ from the current ones.
+  /// \param forces Forces to be applied; they are added together.
+  template <typename... Args> constexpr void setForces(const Args&... forces) noexcept {
+    const Vec3f newForces = (forces + ...);
+
+    if (!newForces.strictlyEquals(m_forces))
+      wakeUp();
+
+    m_forces = newForces;
+  }
+  /// Sets the rigid body's velocity, waking it up if it is not null.
+  /// \param velocity New velocity.
+  constexpr void setVelocity(const Vec3f& velocity) noexcept {
+    if (!velocity.strictlyEquals(Vec3f(0.f)))
+      wakeUp();
+
+    m_velocity = velocity;
+  }
+
+  /// Wakes the rigid body up, making it moved again by the physics system.
+  constexpr void wakeUp() noexcept {
+    m_isSleeping = false;
+    m_sleepTime  = 0.f;
+  }
+  /// Puts the rigid body to sleep, stopping it until it is woken up; this is automatically done by the physics system when it stays still.
+  constexpr void putToSleep() noexcept {
+    m_isSleeping = true;
+    m_velocity   = Vec3f(0.f);
+  }
 
 private:
   float m_mass {}; ///< Mass of the rigid body.
@@ -36,6 +66,10 @@ private:
   Vec3f m_forces {}; ///< Additional forces applied to the rigid body; gravity is computed independently later.
   Vec3f m_velocity {}; ///< Velocity of the rigid body.
   Vec3f m_oldPosition {}; ///< Previous position of the rigid body.
+
+  bool m_isSleeping = false; ///< Whether the rigid body is sleeping.
+  float m_sleepTime {}; ///< Time during which the rigid body has stayed close to its rest position.
+  Vec3f m_restPosition {}; ///< Position around which the rigid body must stay for it to be put to sleep.
 };
 
 } // namespace Raz
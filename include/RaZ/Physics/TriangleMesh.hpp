@@ -0,0 +1,105 @@
+#pragma once
+
+#ifndef RAZ_TRIANGLEMESH_HPP
+#define RAZ_TRIANGLEMESH_HPP
+
+#include "RaZ/Utils/Shape.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace Raz {
+
+class Mesh;
+
+/// Arbitrary (possibly concave) surface made of triangles, whose intersection checks are accelerated by a bounding volume hierarchy.
+/// Each triangle is checked individually, through the narrow phase's GJK algorithm.
+/// \see NarrowPhase
+class TriangleMesh final : public Shape {
+public:
+  /// Creates a triangle mesh from the given triangles.
+  /// \param triangles Triangles composing the mesh; there must be at least one.
+  explicit TriangleMesh(std::vector<Triangle> triangles);
+  /// Creates a triangle mesh from the triangles of all submeshes of a mesh.
+  /// \param mesh Mesh to create the triangle mesh from.
+  explicit TriangleMesh(const Mesh& mesh);
+
+  ShapeType getType() const noexcept override { return ShapeType::TRIANGLE_MESH; }
+  const std::vector<Triangle>& getTriangles() const noexcept { return m_triangles; }
+
+  /// Point containment check. The mesh is assumed to be closed; for an open mesh, the result is meaningless.
+  /// \param point Point to be checked.
+  /// \return True if the point is inside the mesh, false otherwise.
+  bool contains(const Vec3f& point) const override;
+  /// Mesh-line intersection check.
+  /// \param line Line to check if there is an intersection with.
+  /// \return True if both shapes intersect each other, false otherwise.
+  bool intersects(const Line& line) const override;
+  /// Mesh-plane intersection check.
+  /// \param plane Plane to check if there is an intersection with.
+  /// \return True if both shapes intersect each other, false otherwise.
+  bool intersects(const Plane& plane) const override;
+  /// Mesh-sphere intersection check.
+  /// \param sphere Sphere to check if there is an intersection with.
+  /// \return True if both shapes intersect each other, false otherwise.
+  bool intersects(const Sphere& sphere) const override;
+  /// Mesh-triangle intersection check.
+  /// \param triangle Triangle to check if there is an intersection with.
+  /// \return True if both shapes intersect each other, false otherwise.
+  bool intersects(const Triangle& triangle) const override;
+  /// Mesh-quad intersection check.
+  /// \param quad Quad to check if there is an intersection with.
+  /// \return True if both shapes intersect each other, false otherwise.
+  bool intersects(const Quad& quad) const override;
+  /// Mesh-AABB intersection check.
+  /// \param aabb AABB to check if there is an intersection with.
+  /// \return True if both shapes intersect each other, false otherwise.
+  bool intersects(const AABB& aabb) const override;
+  /// Mesh-OBB intersection check.
+  /// \param obb OBB to check if there is an intersection with.
+  /// \return True if both shapes intersect each other, false otherwise.
+  bool intersects(const OBB& obb) const override;
+  /// Ray-mesh intersection check, finding the closest triangle hit.
+  /// \param ray Ray to check if there is an intersection with.
+  /// \param hit Optional ray intersection's information to recover (nullptr if unneeded).
+  /// \return True if the ray intersects the mesh, false otherwise.
+  bool intersects(const Ray& ray, RayHit* hit) const override;
+  /// Translates the mesh by the given vector.
+  /// \param displacement Displacement to be translated by.
+  void translate(const Vec3f& displacement) noexcept override;
+  /// Computes the projection of a point (closest point) onto the mesh.
+  /// The projected point is necessarily located on the mesh's surface.
+  /// \param point Point to compute the projection from.
+  /// \return Point projected onto the mesh.
+  Vec3f computeProjection(const Vec3f& point) const override;
+  /// Computes the mesh's centroid, which is the average of its triangles' centroids.
+  /// \return Computed centroid.
+  Vec3f computeCentroid() const override;
+  AABB computeBoundingBox() const override { return m_nodes.front().boundingBox; }
+  /// Finds the triangles whose bounding box overlaps the given one.
+  /// \param box Bounding box to find the triangles of.
+  /// \param triangleIndices Indices of the triangles found. Those are appended to the already existing ones.
+  void findTriangles(const AABB& box, std::vector<std::size_t>& triangleIndices) const;
+
+private:
+  struct Node {
+    AABB boundingBox = AABB(Vec3f(0.f), Vec3f(0.f));
+    std::uint32_t firstIndex {};    ///< Index of the first child node if an inner node, of the first triangle otherwise.
+    std::uint32_t triangleCount {}; ///< Number of triangles if a leaf node, 0 otherwise.
+  };
+
+  void buildNodes();
+  void buildNode(std::vector<std::pair<Triangle, AABB>>& triangleBoxes, std::size_t nodeIndex, std::size_t beginIndex, std::size_t endIndex);
+  /// Traverses the hierarchy, executing an action on all triangles whose bounding box passes the given check.
+  /// \param checkBox Check to be made on each bounding box, returning true if its content must be traversed.
+  /// \param action Action to be executed, taking the triangle's index as argument.
+  template <typename CheckFuncT, typename ActionFuncT>
+  void traverseNodes(const CheckFuncT& checkBox, const ActionFuncT& action) const;
+
+  std::vector<Triangle> m_triangles {};
+  std::vector<Node> m_nodes {}; ///< Bounding volume hierarchy of the triangles, whose children are always stored after their parent.
+};
+
+} // namespace Raz
+
+#endif // RAZ_TRIANGLEMESH_HPP
@@ -18,10 +18,13 @@
 #include "Audio/SoundEffect.hpp"
 #include "Audio/SoundEffectSlot.hpp"
 #include "Data/Bitset.hpp"
+#include "Data/BlockCompression.hpp"
 #include "Data/BoundingVolumeHierarchy.hpp"
 #include "Data/BoundingVolumeHierarchySystem.hpp"
 #include "Data/BvhFormat.hpp"
 #include "Data/Color.hpp"
+#include "Data/CompressedImage.hpp"
+#include "Data/DdsFormat.hpp"
 #include "Data/FbxFormat.hpp"
 #include "Data/GltfFormat.hpp"
 #include "Data/Graph.hpp"
@@ -34,8 +37,10 @@
 #include "Data/Mesh.hpp"
 #include "Data/MeshDistanceField.hpp"
 #include "Data/MeshFormat.hpp"
+#include "Data/NoiseField.hpp"
 #include "Data/ObjFormat.hpp"
 #include "Data/OffFormat.hpp"
+#include "Data/SparseGrid3.hpp"
 #include "Data/Submesh.hpp"
 #include "Data/TgaFormat.hpp"
 #include "Data/WavFormat.hpp"
@@ -43,8 +48,10 @@
 #include "Math/Constants.hpp"
 #include "Math/MathUtils.hpp"
 #include "Math/Matrix.hpp"
+#include "Math/NoiseSettings.hpp"
 #include "Math/PerlinNoise.hpp"
 #include "Math/Quaternion.hpp"
+#include "Math/SimplexNoise.hpp"
 #include "Math/Transform.hpp"
 #include "Math/Vector.hpp"
 #include "Network/HttpClient.hpp"
@@ -53,8 +60,11 @@
 #include "Network/UdpClient.hpp"
 #include "Network/UdpServer.hpp"
 #include "Physics/Collider.hpp"
+#include "Physics/ConvexHull.hpp"
+#include "Physics/NarrowPhase.hpp"
 #include "Physics/PhysicsSystem.hpp"
 #include "Physics/RigidBody.hpp"
+#include "Physics/TriangleMesh.hpp"
 #include "Render/BloomRenderProcess.hpp"
 #include "Render/BoxBlurRenderProcess.hpp"
 #include "Render/Camera.hpp"
@@ -64,9 +74,11 @@
 #include "Render/Cubemap.hpp"
 #include "Render/FilmGrainRenderProcess.hpp"
 #include "Render/Framebuffer.hpp"
+#include "Render/FrameCapturer.hpp"
 #include "Render/GaussianBlurRenderProcess.hpp"
 #include "Render/GraphicObjects.hpp"
 #include "Render/Light.hpp"
+#include "Render/LightClusterer.hpp"
 #include "Render/Material.hpp"
 #include "Render/MeshRenderer.hpp"
 #include "Render/MonoPassRenderProcess.hpp"
@@ -77,10 +89,12 @@
 #include "Render/RenderPass.hpp"
 #include "Render/RenderProcess.hpp"
 #include "Render/RenderSystem.hpp"
+#include "Render/ScreenEffect.hpp"
 #include "Render/ScreenSpaceReflectionsRenderProcess.hpp"
 #include "Render/Shader.hpp"
 #include "Render/ShaderProgram.hpp"
 #include "Render/SobelFilterRenderProcess.hpp"
+#include "Render/StaticMeshRenderer.hpp"
 #include "Render/SubmeshRenderer.hpp"
 #include "Render/Texture.hpp"
 #include "Render/UniformBuffer.hpp"
@@ -90,6 +104,7 @@
 #include "Script/LuaScript.hpp"
 #include "Script/LuaWrapper.hpp"
 #include "Script/ScriptSystem.hpp"
+#include "Utils/Allocator.hpp"
 #include "Utils/CompilerUtils.hpp"
 #include "Utils/EnumUtils.hpp"
 #include "Utils/FilePath.hpp"
@@ -98,6 +113,7 @@
 #include "Utils/Input.hpp"
 #include "Utils/Logger.hpp"
 #include "Utils/Plugin.hpp"
+#include "Utils/Profiler.hpp"
 #include "Utils/Ray.hpp"
 #include "Utils/Shape.hpp"
 #include "Utils/StrUtils.hpp"
@@ -18,13 +18,21 @@ public:
   std::size_t getDownscalePassCount() const noexcept { return m_downscalePasses.size(); }
   const RenderPass& getDownscalePass(std::size_t passIndex) const noexcept { return *m_downscalePasses[passIndex]; }
   RenderPass& getDownscalePass(std::size_t passIndex) noexcept { return *m_downscalePasses[passIndex]; }
-  std::size_t getDownscaleBufferCount() const noexcept { return m_downscaleBuffers.size(); }
-  const Texture2D& getDownscaleBuffer(std::size_t bufferIndex) const noexcept { return *m_downscaleBuffers[bufferIndex].lock(); }
+  std::size_t getDownscaleBufferCount() const noexcept { return m_downscalePasses.size(); }
+  /// Gets a downscale buffer.
+  /// \note The buffers being transient textures, their content may be overwritten by other passes after they have been used.
+  /// \param bufferIndex Index of the buffer to get.
+  /// \return Downscale buffer.
+  const Texture2D& getDownscaleBuffer(std::size_t bufferIndex) const noexcept;
   std::size_t getUpscalePassCount() const noexcept { return m_upscalePasses.size(); }
   const RenderPass& getUpscalePass(std::size_t passIndex) const noexcept { return *m_upscalePasses[passIndex]; }
   RenderPass& getUpscalePass(std::size_t passIndex) noexcept { return *m_upscalePasses[passIndex]; }
-  std::size_t getUpscaleBufferCount() const noexcept { return m_upscaleBuffers.size(); }
-  const Texture2D& getUpscaleBuffer(std::size_t bufferIndex) const noexcept { return *m_upscaleBuffers[bufferIndex].lock(); }
+  std::size_t getUpscaleBufferCount() const noexcept { return m_upscalePasses.size(); }
+  /// Gets an upscale buffer.
+  /// \note The buffers being transient textures, their content may be overwritten by other passes after they have been used.
+  /// \param bufferIndex Index of the buffer to get.
+  /// \return Upscale buffer.
+  const Texture2D& getUpscaleBuffer(std::size_t bufferIndex) const noexcept;
 
   void setState(bool enabled) override;
   void addParent(RenderPass& parentPass) override;
@@ -41,10 +49,7 @@ private:
   RenderPass* m_thresholdPass {};
 
   std::vector<RenderPass*> m_downscalePasses {};
-  std::vector<std::weak_ptr<Texture2D>> m_downscaleBuffers {};
-
   std::vector<RenderPass*> m_upscalePasses {};
-  std::vector<std::weak_ptr<Texture2D>> m_upscaleBuffers {};
 
   RenderPass* m_finalPass {};
 };
@@ -6,6 +6,7 @@
 #include "RaZ/Component.hpp"
 #include "RaZ/Math/Angle.hpp"
 #include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Math/Vector.hpp"
 
 namespace Raz {
 
@@ -33,6 +34,8 @@ public:
   constexpr unsigned int getFrameWidth() const noexcept { return m_frameWidth; }
   constexpr unsigned int getFrameHeight() const noexcept { return m_frameHeight; }
   constexpr Radiansf getFieldOfView() const noexcept { return m_fieldOfView; }
+  constexpr float getNearPlane() const noexcept { return m_nearPlane; }
+  constexpr float getFarPlane() const noexcept { return m_farPlane; }
   constexpr float getOrthographicBound() const noexcept { return m_orthoBound; }
   constexpr CameraType getCameraType() const noexcept { return m_cameraType; }
   constexpr const Mat4f& getViewMatrix() const noexcept { return m_viewMat; }
@@ -0,0 +1,117 @@
+#pragma once
+
+#ifndef RAZ_FRAMECAPTURER_HPP
+#define RAZ_FRAMECAPTURER_HPP
+
+#include "RaZ/Data/OwnerValue.hpp"
+#include "RaZ/Render/Renderer.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <array>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+
+namespace Raz {
+
+class Image;
+
+/// Function receiving a captured frame.
+using FrameCaptureCallback = std::function<void(Image&&)>;
+
+/// Frame capturer, recovering the content of the framebuffer currently bound for reading without stalling the rendering.
+/// Each capture reads the frame into one of a ring of pixel buffers, the data being transferred by the GPU in the background;
+///   a fence tells when it can be mapped & copied into an image, which is then delivered to the capture's callback on a worker thread.
+/// A frame is thus delivered a few frames after having been captured, and the callbacks may run concurrently & in any order.
+/// At most bufferCount callbacks can be running at once; further deliveries wait for one of them to finish.
+/// \note With WebGL, buffers can't be mapped; the frames are read synchronously, but are still delivered on a worker thread.
+/// \warning The pixel storage pack alignment should be set to 1 in order to recover actual pixels.
+/// \see Renderer::setPixelStorage()
+class FrameCapturer {
+public:
+  static constexpr std::size_t bufferCount = 3; ///< Number of pixel buffers in the ring, bounding the number of captures that can be in flight.
+
+  /// Creates a frame capturer.
+  /// \param width Width of the frames to be captured.
+  /// \param height Height of the frames to be captured.
+  /// \param format Format of the frames to be captured; DEPTH frames are always recovered as floating-point values.
+  /// \param dataType Type of the frames' data.
+  /// \param threadPool Thread pool on which to execute the callbacks.
+  FrameCapturer(unsigned int width, unsigned int height,
+                TextureFormat format = TextureFormat::RGB, PixelDataType dataType = PixelDataType::UBYTE,
+                ThreadPool& threadPool = Threading::getDefaultThreadPool());
+  FrameCapturer(const FrameCapturer&) = delete;
+  FrameCapturer(FrameCapturer&&) = delete;
+
+  unsigned int getWidth() const noexcept { return m_width; }
+  unsigned int getHeight() const noexcept { return m_height; }
+  TextureFormat getFormat() const noexcept { return m_format; }
+  PixelDataType getDataType() const noexcept { return m_dataType; }
+  std::size_t getPendingCaptureCount() const noexcept { return m_pendingCaptureCount; }
+
+  /// Changes the size of the frames to be captured.
+  /// \note The pending captures are delivered beforehand, waiting for them if needed.
+  /// \param width New width of the frames.
+  /// \param height New height of the frames.
+  void resize(unsigned int width, unsigned int height);
+  /// Starts capturing the content of the framebuffer currently bound for reading.
+  /// \note If all buffers are still in use, the oldest capture is waited for to be delivered; no frame is ever dropped.
+  /// \param callback Function to which the frame will be delivered; being executed on a worker thread, it must be thread-safe.
+  void capture(FrameCaptureCallback callback);
+  /// Delivers the captures whose data has been transferred, without waiting for those still in flight.
+  /// \return Number of delivered captures.
+  std::size_t update();
+  /// Delivers all pending captures, waiting for their data to be transferred & for all callbacks to have been executed.
+  void flush();
+
+  FrameCapturer& operator=(const FrameCapturer&) = delete;
+  FrameCapturer& operator=(FrameCapturer&&) = delete;
+
+  /// Destroys the frame capturer, delivering the pending captures & waiting for all callbacks to have been executed beforehand.
+  ~FrameCapturer();
+
+private:
+  struct PendingCapture {
+    void* sync {};
+    FrameCaptureCallback callback {};
+  };
+
+  /// Creates an image with the capturer's dimensions & format.
+  /// \return Empty image.
+  Image createImage() const;
+  /// Computes the size of a frame's data & allocates the pixel buffers' storage accordingly, creating them if needed.
+  void allocateBuffers();
+#if !defined(USE_WEBGL)
+  std::size_t recoverOldestBufferIndex() const noexcept { return (m_nextBufferIndex + bufferCount - m_pendingCaptureCount) % bufferCount; }
+#endif
+  /// Delivers the oldest pending capture, whose data must have been transferred.
+  void deliverOldestCapture();
+  /// Executes a callback with its frame on the thread pool, waiting beforehand for one to finish if too many are already running.
+  /// \param callback Callback to be executed.
+  /// \param image Frame to be given to the callback.
+  void executeCallback(FrameCaptureCallback&& callback, Image&& image);
+  /// Waits for all the running callbacks to have finished.
+  void waitForCallbacks();
+
+  unsigned int m_width {};
+  unsigned int m_height {};
+  TextureFormat m_format {};
+  PixelDataType m_dataType {};
+  ThreadPool* m_threadPool {};
+  std::size_t m_frameDataSize {}; ///< Size of a frame's data, in bytes.
+
+#if !defined(USE_WEBGL)
+  std::array<OwnerValue<unsigned int>, bufferCount> m_bufferIndices {};
+  std::array<PendingCapture, bufferCount> m_pendingCaptures {};
+  std::size_t m_nextBufferIndex {}; ///< Index of the buffer to be used by the next capture.
+#endif
+  std::size_t m_pendingCaptureCount {}; ///< Number of captures yet to be delivered, preceding the next buffer.
+
+  std::mutex m_callbacksMutex {};
+  std::condition_variable m_callbacksCondVar {};
+  std::size_t m_runningCallbackCount {}; ///< Number of callbacks given to the thread pool that haven't finished yet.
+};
+
+} // namespace Raz
+
+#endif // RAZ_FRAMECAPTURER_HPP
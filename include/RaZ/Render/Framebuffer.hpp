@@ -18,6 +18,7 @@ class VertexShader;
 
 /// Framebuffer class, handling buffers used for deferred rendering.
 class Framebuffer {
+  friend class RenderGraph;
   friend class RenderPass;
 
 public:
@@ -72,6 +72,28 @@ private:
   OwnerValue<unsigned int> m_index {};
 };
 
+#if !defined(USE_OPENGL_ES)
+class IndirectBuffer {
+public:
+  IndirectBuffer();
+  IndirectBuffer(const IndirectBuffer&) = delete;
+  IndirectBuffer(IndirectBuffer&&) noexcept = default;
+
+  unsigned int getIndex() const { return m_index; }
+
+  void bind() const;
+  void unbind() const;
+
+  IndirectBuffer& operator=(const IndirectBuffer&) = delete;
+  IndirectBuffer& operator=(IndirectBuffer&&) noexcept = default;
+
+  ~IndirectBuffer();
+
+private:
+  OwnerValue<unsigned int> m_index {};
+};
+#endif
+
 } // namespace Raz
 
 #endif // RAZ_GRAPHICOBJECTS_HPP
@@ -3,10 +3,15 @@
 #ifndef RAZ_LIGHT_HPP
 #define RAZ_LIGHT_HPP
 
+#include "RaZ/Component.hpp"
 #include "RaZ/Data/Color.hpp"
 #include "RaZ/Math/Angle.hpp"
 #include "RaZ/Math/Vector.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 namespace Raz {
 
 enum class LightType {
@@ -29,12 +34,27 @@ public:
   constexpr float getEnergy() const noexcept { return m_energy; }
   constexpr const Color& getColor() const noexcept { return m_color; }
   constexpr Radiansf getAngle() const noexcept { return m_angle; }
+  /// Checks if any of the light's properties has been modified since its update status has last been reset.
+  /// \return True if the light has been updated, false otherwise.
+  constexpr bool hasUpdated() const noexcept { return m_updated; }
+
+  constexpr void setType(LightType type) noexcept { m_type = type; m_updated = true; }
+  constexpr void setDirection(const Vec3f& direction) noexcept { m_direction = direction; m_updated = true; }
+  constexpr void setEnergy(float energy) noexcept { m_energy = energy; m_updated = true; }
+  constexpr void setColor(const Color& color) noexcept { m_color = color; m_updated = true; }
+  constexpr void setAngle(Radiansf angle) noexcept { m_angle = angle; m_updated = true; }
+  constexpr void setUpdated(bool updated) noexcept { m_updated = updated; }
+
+  /// Computes the distance beyond which the light's contribution, attenuated by the squared distance, falls below the given threshold.
+  /// \param threshold Minimal intensity a light is considered to have an effect with.
+  /// \return Influence radius of the light; infinite for directional lights.
+  float computeInfluenceRadius(float threshold = 1.f / 256.f) const noexcept {
+    if (m_type == LightType::DIRECTIONAL)
+      return std::numeric_limits<float>::infinity();
 
-  constexpr void setType(LightType type) noexcept { m_type = type; }
-  constexpr void setDirection(const Vec3f& direction) noexcept { m_direction = direction; }
-  constexpr void setEnergy(float energy) noexcept { m_energy = energy; }
-  constexpr void setColor(const Color& color) noexcept { m_color = color; }
-  constexpr void setAngle(Radiansf angle) noexcept { m_angle = angle; }
+    const float maxIntensity = m_energy * std::max({ m_color.red(), m_color.green(), m_color.blue() });
+    return (maxIntensity <= 0.f ? 0.f : std::sqrt(maxIntensity / threshold));
+  }
 
 private:
   LightType m_type {};
@@ -42,6 +62,7 @@ private:
   float m_energy = 1.f;
   Color m_color {};
   Radiansf m_angle = Radiansf(0.f);
+  bool m_updated   = true;
 };
 
 } // namespace Raz
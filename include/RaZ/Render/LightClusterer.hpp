@@ -0,0 +1,98 @@
+#pragma once
+
+#ifndef RAZ_LIGHTCLUSTERER_HPP
+#define RAZ_LIGHTCLUSTERER_HPP
+
+#include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Math/Vector.hpp"
+
+#include <vector>
+
+namespace Raz {
+
+/// Sphere of influence of a point or spot light, to be binned into clusters.
+struct ClusteredLight {
+  Vec3f position {};     ///< Position of the light in world space.
+  float radius {};       ///< Distance beyond which the light's contribution is negligible.
+  unsigned int index {}; ///< Index of the light to be referenced by the clusters.
+};
+
+/// Range of light indices affecting a single cluster.
+struct LightCluster {
+  unsigned int offset {}; ///< Index of the cluster's first light index in the light index list.
+  unsigned int count {};  ///< Number of lights affecting the cluster.
+};
+
+/// Light clusterer, binning lights into a grid of froxels (frustum-aligned voxels) subdividing the view frustum.
+/// Slices are uniform in screen space and exponential in depth, so that froxels remain roughly cubic.
+/// This lets shaders iterate only over the lights that may affect the cluster containing the fragment they are processing.
+/// \note No rendering context is needed for the clustering itself; the results are meant to be uploaded to the GPU afterward.
+class LightClusterer {
+public:
+  static constexpr unsigned int clusterCountX = 16; ///< Number of horizontal slices; must match LIGHT_CLUSTER_COUNT_X in the shaders.
+  static constexpr unsigned int clusterCountY = 9;  ///< Number of vertical slices; must match LIGHT_CLUSTER_COUNT_Y in the shaders.
+  static constexpr unsigned int clusterCountZ = 24; ///< Number of depth slices; must match LIGHT_CLUSTER_COUNT_Z in the shaders.
+  static constexpr unsigned int clusterCount  = clusterCountX * clusterCountY * clusterCountZ;
+
+  const std::vector<LightCluster>& getClusters() const noexcept { return m_clusters; }
+  /// Gets the cluster at the given coordinates.
+  /// \param clusterX Horizontal coordinate, from left to right.
+  /// \param clusterY Vertical coordinate, from bottom to top.
+  /// \param clusterZ Depth coordinate, from near to far.
+  /// \return Reference to the cluster.
+  const LightCluster& getCluster(unsigned int clusterX, unsigned int clusterY, unsigned int clusterZ) const noexcept {
+    assert("Error: The given cluster coordinates are out of bounds." && clusterX < clusterCountX && clusterY < clusterCountY && clusterZ < clusterCountZ);
+    return m_clusters[computeClusterIndex(clusterX, clusterY, clusterZ)];
+  }
+  /// Gets the list of light indices, referenced by each cluster's offset & count.
+  /// \return Light indices of all clusters, stored contiguously.
+  const std::vector<unsigned int>& getLightIndices() const noexcept { return m_lightIndices; }
+
+  /// Computes the index of a cluster in the list, which is laid out row by row & slice by slice.
+  /// \param clusterX Horizontal coordinate of the cluster.
+  /// \param clusterY Vertical coordinate of the cluster.
+  /// \param clusterZ Depth coordinate of the cluster.
+  /// \return Index of the cluster.
+  static constexpr unsigned int computeClusterIndex(unsigned int clusterX, unsigned int clusterY, unsigned int clusterZ) noexcept {
+    return clusterX + clusterY * clusterCountX + clusterZ * clusterCountX * clusterCountY;
+  }
+  /// Computes the factor to apply to the logarithm of a depth to get its slice.
+  /// \param nearPlane Near plane's distance.
+  /// \param farPlane Far plane's distance.
+  /// \return Depth slice scale.
+  static float computeDepthScale(float nearPlane, float farPlane);
+  /// Computes the depth slice containing the given view-space depth.
+  /// \param depth Distance along the view direction; values outside of [nearPlane; farPlane] are clamped to the first or last slice.
+  /// \param nearPlane Near plane's distance.
+  /// \param depthScale Depth scale, as computed by computeDepthScale().
+  /// \return Index of the depth slice.
+  static unsigned int computeDepthSlice(float depth, float nearPlane, float depthScale);
+  /// Bins the given lights into the clusters of the frustum defined by the given matrices.
+  /// \note If enough lights are given, their clusters are computed in parallel.
+  /// \param lights Lights to be clustered.
+  /// \param viewMat View matrix.
+  /// \param projMat Projection matrix, either perspective or orthographic.
+  /// \param nearPlane Near plane's distance.
+  /// \param farPlane Far plane's distance.
+  void computeClusters(const std::vector<ClusteredLight>& lights, const Mat4f& viewMat, const Mat4f& projMat, float nearPlane, float farPlane);
+
+private:
+  /// Inclusive range of clusters overlapped by a light.
+  struct ClusterRange {
+    unsigned int minX {};
+    unsigned int maxX {};
+    unsigned int minY {};
+    unsigned int maxY {};
+    unsigned int minZ {};
+    unsigned int maxZ {};
+    bool isVisible = false;
+  };
+
+  std::vector<LightCluster> m_clusters = std::vector<LightCluster>(clusterCount);
+  std::vector<unsigned int> m_lightIndices {};
+  std::vector<ClusterRange> m_lightRanges {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_LIGHTCLUSTERER_HPP
@@ -10,10 +10,16 @@
 namespace Raz {
 
 class FragmentShader;
+struct ScreenEffect;
 
 class MonoPassRenderProcess : public RenderProcess {
 public:
   MonoPassRenderProcess(RenderGraph& renderGraph, FragmentShader&& fragShader, std::string passName = {});
+  /// Creates a process applying a screen effect, whose pass can be fused with other effects' by the render graph.
+  /// \param renderGraph Render graph to add the process' pass to.
+  /// \param screenEffect Screen effect to be applied.
+  /// \param passName Name of the process' pass.
+  MonoPassRenderProcess(RenderGraph& renderGraph, ScreenEffect screenEffect, std::string passName = {});
 
   bool isEnabled() const noexcept override;
 
@@ -29,6 +35,9 @@ protected:
   void setOutputBuffer(Texture2DPtr outputBuffer, unsigned int index);
 
   RenderPass& m_pass;
+
+private:
+  MonoPassRenderProcess(RenderGraph& renderGraph, RenderPass& pass);
 };
 
 } // namespace Raz
@@ -7,6 +7,7 @@
 #include "RaZ/Render/RenderPass.hpp"
 #include "RaZ/Render/RenderProcess.hpp"
 
+#include <chrono>
 #include <unordered_set>
 
 namespace Raz {
@@ -14,24 +15,99 @@ namespace Raz {
 class Entity;
 class RenderSystem;
 
+/// Timings of a render pass' execution.
+struct RenderPassTiming {
+  const RenderPass* pass {};
+  float cpuTime {}; ///< Time taken to issue the pass' commands, in milliseconds.
+  float gpuTime {}; ///< Time taken by the GPU to execute the pass, in milliseconds. Being recovered without waiting for the GPU, it is that of a previous frame.
+};
+
 class RenderGraph : public Graph<RenderPass> {
+  friend RenderPass;
   friend RenderSystem;
 
 public:
-  RenderGraph() = default;
+  RenderGraph() { m_geometryPass.m_renderGraph = this; }
   RenderGraph(const RenderGraph&) = delete;
   RenderGraph(RenderGraph&&) noexcept = delete;
 
   bool isValid() const;
   const RenderPass& getGeometryPass() const { return m_geometryPass; }
   RenderPass& getGeometryPass() { return m_geometryPass; }
+  /// Checks if the graph has been compiled since it has last been modified.
+  /// \return True if the graph is compiled, false otherwise.
+  bool isCompiled() const noexcept { return m_isCompiled; }
+  /// Gets the passes to be executed after the geometry pass, in their execution order, as computed during the last compilation.
+  /// \return Passes to be executed.
+  /// \see compile()
+  /// \note Passes whose screen effects have been fused are replaced by the fused pass, which is owned by the graph.
+  const std::vector<const RenderPass*>& getExecutionList() const noexcept { return m_executionList; }
+  /// Checks if chains of screen effects are fused when compiling the graph.
+  /// \return True if the screen effects are fused, false otherwise.
+  bool isScreenEffectFusionEnabled() const noexcept { return m_isFusionEnabled; }
+  /// Gets the number of passes created by fusing chains of screen effects during the last compilation.
+  /// \return Number of fused passes.
+  std::size_t getFusedPassCount() const noexcept { return m_fusedPasses.size(); }
+  /// Gets the timings of the passes executed during the last frame, starting with the geometry pass & following the execution order.
+  /// \note If the profiler is enabled, the GPU timings are also aggregated alongside the CPU ones, named after their pass followed by " (GPU)".
+  /// \return Per-pass timings of the last frame.
+  const std::vector<RenderPassTiming>& getFrameTimings() const noexcept { return m_frameTimings; }
+  std::size_t getTransientTextureCount() const noexcept { return m_transientTextures.size(); }
+  /// Gets the number of textures actually allocated to back the transient ones.
+  /// \return Number of allocated transient textures.
+  std::size_t getAllocatedTransientTextureCount() const noexcept { return m_transientTexturePool.size(); }
+  /// Checks if the given texture is a transient texture, either one returned by addTransientTexture() or one allocated to back them.
+  /// \param texture Texture to be checked.
+  /// \return True if the texture is transient, false otherwise.
+  bool isTransientTexture(const Texture2D& texture) const noexcept;
 
+  /// Adds a render pass to the graph.
+  /// \tparam Args Types of the arguments to be forwarded to the render pass.
+  /// \param args Arguments to be forwarded to the render pass.
+  /// \return Reference to the newly added render pass.
+  template <typename... Args> RenderPass& addNode(Args&&... args);
+  /// Removes a render pass from the graph.
+  /// \param renderPass Render pass to be removed.
+  void removeNode(RenderPass& renderPass);
+  /// Changes whether chains of screen effects are fused when compiling the graph.
+  /// \note The intermediate buffers of a fused chain are not written to anymore; fusion should be disabled if they are read outside of the graph.
+  /// \param enabled True if the screen effects should be fused, false otherwise.
+  /// \see compile()
+  void enableScreenEffectFusion(bool enabled = true) noexcept {
+    m_isFusionEnabled = enabled;
+    m_isCompiled      = false;
+  }
+  /// Disables the fusion of screen effects, executing each pass separately.
+  /// \see enableScreenEffectFusion()
+  void disableScreenEffectFusion() noexcept { enableScreenEffectFusion(false); }
   /// Adds a render process to the graph.
   /// \tparam RenderProcessT Type of the process to add; must be derived from RenderProcess.
   /// \tparam Args Types of the arguments to be forwared to the render process.
   /// \param args Arguments to be forwarded to the render process.
   /// \return Reference to the newly added render process.
   template <typename RenderProcessT, typename... Args> RenderProcessT& addRenderProcess(Args&&... args);
+  /// Adds a transient texture, whose memory is managed by the render graph & whose dimensions follow the viewport's.
+  /// The returned texture is a placeholder without storage, to be given to the passes reading from or writing to it. When allocating the
+  ///  transient textures, it is replaced in those passes by a pooled texture, shared with all transient textures of the same format & size
+  ///  whose lifetimes, from the first to the last pass using them in the execution order, do not overlap.
+  /// \note As the texture backing it may be written to by other passes, a transient texture's content is only valid during its lifetime.
+  /// \param colorspace Colorspace of the texture.
+  /// \param dataType Data type of the texture.
+  /// \param sizeDivisor Value by which the viewport's dimensions are divided to get the texture's; must be strictly positive.
+  /// \return Placeholder texture to be given to the passes.
+  /// \see compile()
+  Texture2DPtr addTransientTexture(TextureColorspace colorspace, TextureDataType dataType, unsigned int sizeDivisor = 1);
+  /// Compiles the graph, computing the list of passes to be executed & allocating the transient textures.
+  /// Passes are sorted so that each is executed after its parents. Those whose output does not reach any enabled leaf pass, either by
+  ///  being disabled or by having only children that are not executed, are culled.
+  /// Chains of passes applying screen effects are fused into a single pass reading the chain's input & writing its output, when each
+  ///  pass' output is only read by the next one in the chain & only the first samples its input at arbitrary coordinates. The effects'
+  ///  parameters are kept in their respective passes, being forwarded to the fused one before each execution. The chain's input, being
+  ///  read when the fused pass is executed, is considered used until then by the transient textures' allocation.
+  /// \note This is automatically done before the next execution whenever the graph has been modified through its passes: adding or
+  ///  removing one, changing their links, enabled states or textures. Setting a texture directly to a pass' program requires this to be
+  ///  called again.
+  void compile();
   void resizeViewport(unsigned int width, unsigned int height);
   void updateShaders() const;
 
@@ -39,20 +115,78 @@ public:
   RenderGraph& operator=(RenderGraph&&) noexcept = delete;
 
 private:
+  struct TransientTextureUse {
+    RenderPass* pass {};
+    std::string uniformName {}; ///< Name of the uniform the texture is read from; empty if the texture is written to.
+    const Texture2D* texture {}; ///< Texture currently given to the pass in place of the transient one.
+  };
+
+  struct TransientTexture {
+    std::weak_ptr<Texture2D> placeholder {};
+    TextureColorspace colorspace {};
+    TextureDataType dataType {};
+    unsigned int sizeDivisor = 1;
+    std::vector<TransientTextureUse> uses {};
+  };
+
+  struct PooledTexture {
+    Texture2DPtr texture {};
+    unsigned int sizeDivisor = 1;
+    std::size_t lastUseIndex {}; ///< Index in the execution order of the last pass using the texture.
+    bool isAssigned = false;
+  };
+
+  /// Passes applying screen effects one after the other, to be fused into a single pass.
+  using EffectChain = std::vector<const RenderPass*>;
+
+  struct FusedPass {
+    std::unique_ptr<RenderPass> pass {};
+    std::vector<const RenderPass*> effectPasses {}; ///< Passes whose screen effects are applied by the fused pass, in order.
+    std::string shaderSource {};
+  };
+
+  /// Recovers the passes in the order they are executed, starting with the geometry pass.
+  /// \return Ordered render passes.
+  std::vector<RenderPass*> recoverExecutionOrder();
+  /// Recovers the chains of screen effects in the execution list which can be fused.
+  /// \return Fusable chains, in their execution order.
+  std::vector<EffectChain> recoverScreenEffectChains() const;
+  /// Computes the transient textures' lifetimes & assigns them pooled textures, replacing them in the passes using them.
+  /// \param passes Render passes, in their execution order.
+  /// \param effectChains Chains of screen effects to be fused, whose passes are all considered executed at the position of their last one.
+  void allocateTransientTextures(const std::vector<RenderPass*>& passes, const std::vector<EffectChain>& effectChains);
+  /// Fuses the given chains of screen effects, replacing them in the execution list with the fused passes.
+  /// \param effectChains Chains of screen effects to be fused.
+  void fuseScreenEffects(const std::vector<EffectChain>& effectChains);
+  /// Forwards the effects' parameters & textures to the fused passes applying them.
+  void updateFusedPasses() const;
+  /// Resizes the allocated transient textures according to the viewport's dimensions.
+  void resizeTransientTextures() const;
   /// Executes the render graph, executing all passes starting with the geometry's.
   /// \param renderSystem Render system executing the render graph.
   void execute(const RenderSystem& renderSystem);
   /// Executes the geometry pass.
   /// \param renderSystem Render system executing the render graph.
   void executeGeometryPass(const RenderSystem& renderSystem) const;
-  /// Executes a render pass, which in turn recursively executes its parents if they have not already been in the current frame.
-  /// \param renderPass Render pass to be executed.
-  void executePass(const RenderPass& renderPass);
+  /// Records the timings of a pass which has just been executed.
+  /// \param renderPass Executed render pass.
+  /// \param timingName Name under which to aggregate the pass' GPU timing in the profiler, followed by " (GPU)"; only used if the pass hasn't built it yet.
+  /// \param startTime Time at which the pass' execution started.
+  void recordPassTiming(const RenderPass& renderPass, std::string_view timingName, std::chrono::steady_clock::time_point startTime);
 
   RenderPass m_geometryPass {};
   std::vector<std::unique_ptr<RenderProcess>> m_renderProcesses {};
-  std::unordered_set<const RenderPass*> m_executedPasses {};
+  std::vector<const RenderPass*> m_executionList {};
+  std::vector<FusedPass> m_fusedPasses {};
+  bool m_isFusionEnabled = true;
+  bool m_isCompiled = false;
   const RenderPass* m_lastExecutedPass {};
+  std::vector<RenderPassTiming> m_frameTimings {};
+
+  std::vector<TransientTexture> m_transientTextures {};
+  std::vector<PooledTexture> m_transientTexturePool {};
+  unsigned int m_viewportWidth {};
+  unsigned int m_viewportHeight {};
 };
 
 } // namespace Raz
@@ -1,5 +1,15 @@
 namespace Raz {
 
+template <typename... Args>
+RenderPass& RenderGraph::addNode(Args&&... args) {
+  RenderPass& renderPass   = Graph::addNode(std::forward<Args>(args)...);
+  renderPass.m_renderGraph = this;
+
+  m_isCompiled = false;
+
+  return renderPass;
+}
+
 template <typename RenderProcessT, typename... Args>
 RenderProcessT& RenderGraph::addRenderProcess(Args&&... args) {
   static_assert(std::is_base_of_v<RenderProcess, RenderProcessT>, "Error: The added render process must be derived from RenderProcess.");
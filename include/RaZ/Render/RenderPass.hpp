@@ -8,11 +8,16 @@
 #if !defined(USE_OPENGL_ES)
 #include "RaZ/Render/RenderTimer.hpp"
 #endif
+#include "RaZ/Render/ScreenEffect.hpp"
 #include "RaZ/Render/ShaderProgram.hpp"
 #include "RaZ/Render/Texture.hpp"
 
+#include <optional>
+
 namespace Raz {
 
+class RenderGraph;
+
 class RenderPass final : public GraphNode<RenderPass> {
   friend class RenderGraph;
 
@@ -22,6 +27,10 @@ public:
     : m_name{ std::move(passName) }, m_program(std::move(vertShader), std::move(fragShader)) {}
   explicit RenderPass(FragmentShader&& fragShader, std::string passName = {}) noexcept
     : RenderPass(Framebuffer::recoverVertexShader(), std::move(fragShader), std::move(passName)) {}
+  /// Creates a render pass applying a screen effect, which lets it be fused with other ones by the render graph.
+  /// \param screenEffect Screen effect from which to generate the pass' fragment shader.
+  /// \param passName Name of the pass.
+  explicit RenderPass(ScreenEffect screenEffect, std::string passName = {});
   RenderPass(const RenderPass&) = delete;
   RenderPass(RenderPass&&) noexcept = default;
 
@@ -34,7 +43,9 @@ public:
   bool hasReadTexture(const std::string& uniformName) const noexcept { return m_program.hasTexture(uniformName); }
   const Texture& getReadTexture(const std::string& uniformName) const noexcept { return m_program.getTexture(uniformName); }
   const Framebuffer& getFramebuffer() const { return m_writeFramebuffer; }
-  /// Recovers the elapsed time (in milliseconds) of the pass' execution.
+  bool hasScreenEffect() const noexcept { return m_screenEffect.has_value(); }
+  const ScreenEffect& getScreenEffect() const noexcept { assert("Error: The render pass has no screen effect." && hasScreenEffect()); return *m_screenEffect; }
+  /// Recovers the elapsed time (in milliseconds) of the pass' latest execution which has finished on the GPU, without waiting for the pending ones.
   /// \note This action is not available with OpenGL ES and will always return 0.
   /// \return Time taken to execute the pass.
   float recoverElapsedTime() const noexcept {
@@ -45,12 +56,42 @@ public:
 #endif
   }
 
-  void setName(std::string name) noexcept { m_name = std::move(name); }
-  void setProgram(RenderShaderProgram&& program) { m_program = std::move(program); }
+  void setName(std::string name) noexcept {
+    m_name = std::move(name);
+    m_profileName = {};
+    m_gpuTimingName.clear();
+  }
+  /// Sets the pass' program.
+  /// \note If the pass has been created from a screen effect, it is no longer considered applying it.
+  /// \param program Program to be set.
+  void setProgram(RenderShaderProgram&& program) { m_program = std::move(program); m_screenEffect.reset(); invalidateRenderGraph(); }
 
+  template <typename... OtherNodesTs>
+  void addParents(GraphNode& node, OtherNodesTs&&... otherNodes) {
+    GraphNode::addParents(node, std::forward<OtherNodesTs>(otherNodes)...);
+    invalidateRenderGraph();
+  }
+  template <typename... OtherNodesTs>
+  void removeParents(GraphNode& node, OtherNodesTs&&... otherNodes) {
+    GraphNode::removeParents(node, std::forward<OtherNodesTs>(otherNodes)...);
+    invalidateRenderGraph();
+  }
+  template <typename... OtherNodesTs>
+  void addChildren(GraphNode& node, OtherNodesTs&&... otherNodes) {
+    GraphNode::addChildren(node, std::forward<OtherNodesTs>(otherNodes)...);
+    invalidateRenderGraph();
+  }
+  template <typename... OtherNodesTs>
+  void removeChildren(GraphNode& node, OtherNodesTs&&... otherNodes) {
+    GraphNode::removeChildren(node, std::forward<OtherNodesTs>(otherNodes)...);
+    invalidateRenderGraph();
+  }
   /// Changes the render pass' enabled state.
   /// \param enabled True if the render pass should be enabled, false if it should be disabled.
-  void enable(bool enabled = true) { m_enabled = enabled; }
+  void enable(bool enabled = true) {
+    m_enabled = enabled;
+    invalidateRenderGraph();
+  }
   /// Disables the render pass.
   void disable() { enable(false); }
   /// Checks that the current render pass is valid, that is, if none of its buffers has been defined as both read & write.
@@ -58,17 +99,17 @@ public:
   /// \see RenderGraph::isValid()
   bool isValid() const;
   void addReadTexture(TexturePtr texture, const std::string& uniformName);
-  void removeReadTexture(const Texture& texture) { m_program.removeTexture(texture); }
-  void clearReadTextures() { m_program.clearTextures(); }
+  void removeReadTexture(const Texture& texture) { m_program.removeTexture(texture); invalidateRenderGraph(); }
+  void clearReadTextures() { m_program.clearTextures(); invalidateRenderGraph(); }
   /// Sets the write depth buffer texture.
   /// \param texture Depth buffer texture to be set; must have a depth colorspace.
-  void setWriteDepthTexture(Texture2DPtr texture) { m_writeFramebuffer.setDepthBuffer(std::move(texture)); }
+  void setWriteDepthTexture(Texture2DPtr texture) { m_writeFramebuffer.setDepthBuffer(std::move(texture)); invalidateRenderGraph(); }
   /// Adds a write color buffer texture.
   /// \param texture Color buffer texture to be added; must have a non-depth colorspace.
   /// \param index Buffer's index (location of the shader's output value).
-  void addWriteColorTexture(Texture2DPtr texture, unsigned int index) { m_writeFramebuffer.addColorBuffer(std::move(texture), index); }
-  void removeWriteTexture(const Texture2DPtr& texture) { m_writeFramebuffer.removeTextureBuffer(texture); }
-  void clearWriteTextures() { m_writeFramebuffer.clearTextureBuffers(); }
+  void addWriteColorTexture(Texture2DPtr texture, unsigned int index) { m_writeFramebuffer.addColorBuffer(std::move(texture), index); invalidateRenderGraph(); }
+  void removeWriteTexture(const Texture2DPtr& texture) { m_writeFramebuffer.removeTextureBuffer(texture); invalidateRenderGraph(); }
+  void clearWriteTextures() { m_writeFramebuffer.clearTextureBuffers(); invalidateRenderGraph(); }
   /// Resizes the render pass' write buffer textures.
   /// \param width New buffers width.
   /// \param height New buffers height.
@@ -82,10 +123,17 @@ public:
   ~RenderPass() override = default;
 
 private:
+  /// Marks the render graph containing the pass, if any, as needing to be compiled again.
+  void invalidateRenderGraph() noexcept;
+
+  RenderGraph* m_renderGraph {};
   bool m_enabled = true;
   std::string m_name {};
+  mutable std::string_view m_profileName {}; ///< Name stored in the profiler on the first profiled execution, reset when the pass is renamed.
+  mutable std::string m_gpuTimingName {};    ///< Name of the GPU timing built on the first profiled execution, reset when the pass is renamed.
   RenderShaderProgram m_program {};
   Framebuffer m_writeFramebuffer {};
+  std::optional<ScreenEffect> m_screenEffect {};
 
 #if !defined(USE_OPENGL_ES)
   RenderTimer m_timer {};
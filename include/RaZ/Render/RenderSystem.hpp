@@ -5,6 +5,8 @@
 
 #include "RaZ/System.hpp"
 #include "RaZ/Render/Cubemap.hpp"
+#include "RaZ/Render/FrameCapturer.hpp"
+#include "RaZ/Render/LightClusterer.hpp"
 #include "RaZ/Render/Renderer.hpp"
 #include "RaZ/Render/RenderGraph.hpp"
 #include "RaZ/Render/UniformBuffer.hpp"
@@ -18,7 +20,9 @@
 namespace Raz {
 
 class Entity;
+class Material;
 class MeshRenderer;
+class StaticMeshRenderer;
 #if defined(RAZ_USE_XR)
 class XrSystem;
 #endif
@@ -65,6 +69,7 @@ public:
   RenderGraph& getRenderGraph() { return m_renderGraph; }
   bool hasCubemap() const { return m_cubemap.has_value(); }
   const Cubemap& getCubemap() const { assert("Error: The cubemap must be set before being accessed." && hasCubemap()); return *m_cubemap; }
+  bool isFrameCaptureEnabled() const noexcept { return m_frameCapturer.has_value(); }
 
   void setCubemap(Cubemap&& cubemap);
 #if defined(RAZ_USE_XR)
@@ -78,17 +83,35 @@ public:
                     uint8_t antiAliasingSampleCount = 1) { m_window = Window::create(*this, width, height, title, settings, antiAliasingSampleCount); }
 #endif
   void resizeViewport(unsigned int width, unsigned int height);
+  /// The rendering context is bound to the main thread.
+  bool requiresMainThread() const noexcept override { return true; }
   bool update(const FrameTimeInfo& timeInfo) override;
   /// Updates all lights referenced by the RenderSystem, sending their data to the GPU.
-  void updateLights() const;
+  /// \note Lights whose properties or transform have been modified are automatically updated every frame; this only needs to be called
+  ///   if a light has been enabled, in which case the lights are to be reordered.
+  /// \note Point & spot lights are binned every frame into clusters subdividing the view frustum, so that only the lights
+  ///   which may affect a fragment are evaluated; their count is thus only bound by the memory available.
+  void updateLights();
   void updateShaders() const;
   void updateMaterials(const MeshRenderer& meshRenderer) const;
+  void updateMaterials(const StaticMeshRenderer& staticMeshRenderer) const;
   void updateMaterials() const;
   /// Retrieves & saves the back buffer's data from the GPU.
   /// \warning The pixel storage pack & unpack alignments should be set to 1 in order to recover actual pixels.
   /// \see Renderer::setPixelStorage()
   /// \warning Retrieving an image from the GPU is slow; use this function with caution.
   void saveToImage(const FilePath& filePath, TextureFormat format = TextureFormat::RGB, PixelDataType dataType = PixelDataType::UBYTE) const;
+  /// Enables the capture of every rendered frame, without stalling the rendering.
+  /// Frames are delivered a few frames after having been rendered, on worker threads; the callback can thus directly encode them, for example
+  ///   by saving them with ImageFormat::save().
+  /// \warning The pixel storage pack & unpack alignments should be set to 1 in order to recover actual pixels.
+  /// \see FrameCapturer, Renderer::setPixelStorage()
+  /// \param callback Function receiving each frame; as it may be executed concurrently for several frames, it must be thread-safe.
+  /// \param format Format of the frames to be captured.
+  /// \param dataType Type of the frames' data.
+  void enableFrameCapture(FrameCaptureCallback callback, TextureFormat format = TextureFormat::RGB, PixelDataType dataType = PixelDataType::UBYTE);
+  /// Disables the frames capture, delivering the frames still being captured & waiting for their callbacks to have been executed.
+  void disableFrameCapture();
   void removeCubemap() { m_cubemap.reset(); }
   void destroy() override;
 
@@ -102,14 +125,28 @@ private:
   void sendInverseViewMatrix(const Mat4f& invViewMat) const { m_cameraUbo.sendData(invViewMat, sizeof(Mat4f)); }
   void sendProjectionMatrix(const Mat4f& projMat) const { m_cameraUbo.sendData(projMat, sizeof(Mat4f) * 2); }
   void sendInverseProjectionMatrix(const Mat4f& invProjMat) const { m_cameraUbo.sendData(invProjMat, sizeof(Mat4f) * 3); }
-  void sendViewProjectionMatrix(const Mat4f& viewProjMat) const { m_cameraUbo.sendData(viewProjMat, sizeof(Mat4f) * 4); }
+  void sendViewProjectionMatrix(const Mat4f& viewProjMat) const {
+    m_viewProjMat = viewProjMat;
+    m_cameraUbo.sendData(viewProjMat, sizeof(Mat4f) * 4);
+  }
   void sendCameraPosition(const Vec3f& cameraPos) const { m_cameraUbo.sendData(cameraPos, sizeof(Mat4f) * 5); }
-  /// Updates a single light, sending its data to the GPU.
-  /// \warning The lights UBO needs to be bound before calling this function.
+  void unlinkEntity(const EntityPtr& entity) override;
+  /// Sends a material's attributes & binds the uniform buffers & light textures to its program.
+  /// \param material Material to be updated.
+  void updateMaterial(const Material& material) const;
+  /// Updates a single light, writing its data into the lights' staging buffer & resetting its update status.
   /// \note If resetting a removed light or updating one not yet known by the application, call updateLights() instead to fully take that change into account.
   /// \param entity Light entity to be updated; if not a directional light, needs to have a Transform component.
   /// \param lightIndex Index of the light to be updated.
-  void updateLight(const Entity& entity, unsigned int lightIndex) const;
+  void updateLight(Entity& entity, unsigned int lightIndex);
+  /// Updates the lights which have been modified since the last frame, sending all of them to the GPU in a single upload.
+  void updateModifiedLights();
+  /// Bins the point & spot lights into the clusters of the given view frustum, sending the resulting clusters & light indices to the GPU.
+  /// \param viewMat View matrix.
+  /// \param projMat Projection matrix.
+  /// \param nearPlane Near plane's distance.
+  /// \param farPlane Far plane's distance.
+  void updateLightClusters(const Mat4f& viewMat, const Mat4f& projMat, float nearPlane, float farPlane);
 #if defined(RAZ_USE_XR)
   void renderXrFrame();
 #endif
@@ -125,12 +162,27 @@ private:
   Entity* m_cameraEntity {};
   RenderGraph m_renderGraph {};
   UniformBuffer m_cameraUbo = UniformBuffer(sizeof(Mat4f) * 5 + sizeof(Vec4f), UniformBufferUsage::DYNAMIC);
-  UniformBuffer m_lightsUbo = UniformBuffer(sizeof(Vec4f) * 4 * 100 + sizeof(Vec4u), UniformBufferUsage::DYNAMIC);
+  UniformBuffer m_lightsUbo = UniformBuffer(sizeof(Vec4f), UniformBufferUsage::DYNAMIC);
   UniformBuffer m_timeUbo   = UniformBuffer(sizeof(float) * 2, UniformBufferUsage::STREAM);
   UniformBuffer m_modelUbo  = UniformBuffer(sizeof(Mat4f), UniformBufferUsage::STREAM);
+  mutable Mat4f m_viewProjMat = Mat4f::identity(); ///< View-projection matrix last sent, against which the static geometry is culled.
+
+  std::vector<Entity*> m_lightEntities {}; ///< Light entities, ordered as their data is stored.
+  unsigned int m_directionalLightCount {};
+  std::vector<Vec4f> m_lightsData {}; ///< Staging copy of the lights' data, each light being represented by 4 texels.
+  std::vector<ClusteredLight> m_clusteredLights {};
+  LightClusterer m_lightClusterer {};
+  std::vector<Vec2f> m_lightClustersData {};
+  std::vector<float> m_lightIndicesData {};
+  Texture2D m_lightsTexture        = Texture2D(TextureColorspace::RGBA, TextureDataType::FLOAT32);
+  Texture2D m_lightClustersTexture = Texture2D(TextureColorspace::RG, TextureDataType::FLOAT32);
+  Texture2D m_lightIndicesTexture  = Texture2D(TextureColorspace::GRAY, TextureDataType::FLOAT32);
 
   std::optional<Cubemap> m_cubemap {};
 
+  std::optional<FrameCapturer> m_frameCapturer {};
+  FrameCaptureCallback m_frameCaptureCallback {};
+
 #if defined(RAZ_USE_XR)
   const XrSystem* m_xrSystem {};
 #endif
@@ -5,28 +5,42 @@
 
 #include "RaZ/Data/OwnerValue.hpp"
 
+#include <array>
 #include <limits>
 
 namespace Raz {
 
+/// GPU timer, measuring the time taken to execute the commands issued between its start & stop.
+/// Measures cycle through a ring of queries, whose results are only recovered once available; the timer thus never waits for the GPU,
+///   the latest available time lagging a few measures behind the one last stopped.
 class RenderTimer {
 public:
+  static constexpr std::size_t queryCount = 4; ///< Number of queries in the ring, bounding the number of measures that can be in flight.
+
   RenderTimer() noexcept;
   RenderTimer(const RenderTimer&) = delete;
   RenderTimer(RenderTimer&&) noexcept = default;
 
+  /// Gets the elapsed time (in milliseconds) of the latest measure whose result has been recovered.
+  /// \see updateTime()
+  /// \return Elapsed time in milliseconds, or 0 if no measure has finished yet.
+  float getTime() const noexcept { return m_time; }
+
   /// Starts the time measure.
+  /// \note If all queries are still in flight, the oldest measure is discarded.
   /// \note This action is not available with OpenGL ES and will do nothing.
   void start() const noexcept;
   /// Stops the time measure.
   /// \note This action is not available with OpenGL ES and will do nothing.
   void stop() const noexcept;
-  /// Recovers the elapsed time (in milliseconds) of the latest measure.
-  /// \warning The measure must be stopped for the actual time to be available.
-  /// \see stop()
+  /// Recovers the results of the finished measures, without waiting for those still in flight.
+  /// \note This action is not available with OpenGL ES and will always return false.
+  /// \return True if a new time has been recovered, false otherwise.
+  bool updateTime() const noexcept;
+  /// Recovers the elapsed time (in milliseconds) of the latest finished measure, without waiting for those still in flight.
   /// \note This action is not available with OpenGL ES and will always return 0.
   /// \return Elapsed time in milliseconds.
-  float recoverTime() const noexcept;
+  float recoverTime() const noexcept { updateTime(); return m_time; }
 
   RenderTimer& operator=(const RenderTimer&) = delete;
   RenderTimer& operator=(RenderTimer&&) noexcept = default;
@@ -35,8 +49,11 @@ public:
 
 private:
 #if !defined(USE_OPENGL_ES)
-  OwnerValue<unsigned int, std::numeric_limits<unsigned int>::max()> m_index {};
+  std::array<OwnerValue<unsigned int, std::numeric_limits<unsigned int>::max()>, queryCount> m_indices {};
+  mutable std::size_t m_nextQueryIndex {};    ///< Index of the query to be used by the next measure.
+  mutable std::size_t m_pendingQueryCount {}; ///< Number of measures whose result has yet to be recovered, preceding the next query.
 #endif
+  mutable float m_time {};
 };
 
 } // namespace Raz
@@ -115,6 +115,8 @@ enum class StateParameter : unsigned int {
   COMPRESSED_TEXTURE_FORMATS = 34467                                             /* GL_COMPRESSED_TEXTURE_FORMATS */, ///<
   ARRAY_BUFFER_BINDING       = 34964                                             /* GL_ARRAY_BUFFER_BINDING       */, ///<
 
+  PROGRAM_BINARY_FORMAT_COUNT = 34814 /* GL_NUM_PROGRAM_BINARY_FORMATS */, ///< Number of program binary formats supported. Requires OpenGL 4.1+ or OpenGL ES 3.0+.
+
 #if !defined(USE_OPENGL_ES)
   UNPACK_SWAP_BYTES   = 3312  /* GL_UNPACK_SWAP_BYTES  */, ///<
   UNPACK_LSB_FIRST    = 3313  /* GL_UNPACK_LSB_FIRST   */, ///<
@@ -261,9 +263,13 @@ enum class AttribDataType : unsigned int {
 };
 
 enum class BufferType : unsigned int {
-  ARRAY_BUFFER   = 34962 /* GL_ARRAY_BUFFER         */, ///<
-  ELEMENT_BUFFER = 34963 /* GL_ELEMENT_ARRAY_BUFFER */, ///<
-  UNIFORM_BUFFER = 35345 /* GL_UNIFORM_BUFFER       */  ///<
+  ARRAY_BUFFER         = 34962 /* GL_ARRAY_BUFFER         */, ///<
+  ELEMENT_BUFFER       = 34963 /* GL_ELEMENT_ARRAY_BUFFER */, ///<
+  PIXEL_PACK_BUFFER    = 35051 /* GL_PIXEL_PACK_BUFFER    */, ///<
+  UNIFORM_BUFFER       = 35345 /* GL_UNIFORM_BUFFER       */, ///<
+#if !defined(USE_OPENGL_ES)
+  DRAW_INDIRECT_BUFFER = 36671 /* GL_DRAW_INDIRECT_BUFFER */  ///< Requires OpenGL 4.0+.
+#endif
 };
 
 enum class BufferDataUsage : unsigned int {
@@ -280,6 +286,16 @@ enum class BufferDataUsage : unsigned int {
   DYNAMIC_COPY = 35050 /* GL_DYNAMIC_COPY */  ///<
 };
 
+enum class BufferMappingAccess : unsigned int {
+  READ              = 1  /* GL_MAP_READ_BIT              */, ///<
+  WRITE             = 2  /* GL_MAP_WRITE_BIT             */, ///<
+  INVALIDATE_RANGE  = 4  /* GL_MAP_INVALIDATE_RANGE_BIT  */, ///<
+  INVALIDATE_BUFFER = 8  /* GL_MAP_INVALIDATE_BUFFER_BIT */, ///<
+  FLUSH_EXPLICIT    = 16 /* GL_MAP_FLUSH_EXPLICIT_BIT    */, ///<
+  UNSYNCHRONIZED    = 32 /* GL_MAP_UNSYNCHRONIZED_BIT    */  ///<
+};
+MAKE_ENUM_FLAG(BufferMappingAccess)
+
 enum class TextureType : unsigned int {
 #if !defined(USE_OPENGL_ES)
   TEXTURE_1D       = 3552  /* GL_TEXTURE_1D                  */, ///<
@@ -312,6 +328,8 @@ enum class TextureParameter : unsigned int {
   SWIZZLE_G      = 36419 /* GL_TEXTURE_SWIZZLE_G    */, ///<
   SWIZZLE_B      = 36420 /* GL_TEXTURE_SWIZZLE_B    */, ///<
   SWIZZLE_A      = 36421 /* GL_TEXTURE_SWIZZLE_A    */, ///<
+  BASE_LEVEL     = 33084 /* GL_TEXTURE_BASE_LEVEL   */, ///<
+  MAX_LEVEL      = 33085 /* GL_TEXTURE_MAX_LEVEL    */, ///<
 #if !defined(USE_OPENGL_ES)
   SWIZZLE_RGBA   = 36422 /* GL_TEXTURE_SWIZZLE_RGBA */  ///<
 #endif
@@ -431,7 +449,17 @@ enum class TextureInternalFormat : unsigned int {
   DEPTH24_STENCIL8  = 35056 /* GL_DEPTH24_STENCIL8   */, ///<
   DEPTH32           = 33191 /* GL_DEPTH_COMPONENT32  */, ///<
   DEPTH32F          = 36012 /* GL_DEPTH_COMPONENT32F */, ///<
-  DEPTH32F_STENCIL8 = 36013 /* GL_DEPTH32F_STENCIL8  */  ///<
+  DEPTH32F_STENCIL8 = 36013 /* GL_DEPTH32F_STENCIL8  */, ///<
+
+  // Compressed formats
+  BC1_RGB   = 33776 /* GL_COMPRESSED_RGB_S3TC_DXT1_EXT        */, ///<
+  BC1_SRGB  = 35916 /* GL_COMPRESSED_SRGB_S3TC_DXT1_EXT       */, ///<
+  BC3_RGBA  = 33779 /* GL_COMPRESSED_RGBA_S3TC_DXT5_EXT       */, ///<
+  BC3_SRGBA = 35919 /* GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT */, ///<
+  BC4_RED   = 36283 /* GL_COMPRESSED_RED_RGTC1                */, ///<
+  BC5_RG    = 36285 /* GL_COMPRESSED_RG_RGTC2                 */, ///<
+  BC7_RGBA  = 36492 /* GL_COMPRESSED_RGBA_BPTC_UNORM          */, ///<
+  BC7_SRGBA = 36493 /* GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM    */  ///<
 };
 
 enum class PixelDataType : unsigned int {
@@ -560,7 +588,9 @@ enum class ProgramParameter : unsigned int {
   TRANSFORM_FEEDBACK_VARYING_MAX_LENGTH = 35958 /* GL_TRANSFORM_FEEDBACK_VARYING_MAX_LENGTH */, ///<
   GEOMETRY_VERTICES_OUT                 = 35094 /* GL_GEOMETRY_VERTICES_OUT                 */, ///<
   GEOMETRY_INPUT_TYPE                   = 35095 /* GL_GEOMETRY_INPUT_TYPE                   */, ///<
-  GEOMETRY_OUTPUT_TYPE                  = 35096 /* GL_GEOMETRY_OUTPUT_TYPE                  */  ///<
+  GEOMETRY_OUTPUT_TYPE                  = 35096 /* GL_GEOMETRY_OUTPUT_TYPE                  */, ///<
+  PROGRAM_BINARY_LENGTH                 = 34625 /* GL_PROGRAM_BINARY_LENGTH                 */, ///< Size of the program's binary. Requires OpenGL 4.1+ or OpenGL ES 3.0+.
+  COMPLETION_STATUS                     = 37297 /* GL_COMPLETION_STATUS_KHR                 */  ///< Whether the program's link has finished. Requires parallel shader compilation support.
 };
 
 enum class ShaderType : unsigned int {
@@ -573,11 +603,12 @@ enum class ShaderType : unsigned int {
 };
 
 enum class ShaderInfo : unsigned int {
-  TYPE            = 35663 /* GL_SHADER_TYPE          */, ///<
-  DELETE_STATUS   = 35712 /* GL_DELETE_STATUS        */, ///<
-  COMPILE_STATUS  = 35713 /* GL_COMPILE_STATUS       */, ///<
-  INFO_LOG_LENGTH = 35716 /* GL_INFO_LOG_LENGTH      */, ///<
-  SOURCE_LENGTH   = 35720 /* GL_SHADER_SOURCE_LENGTH */  ///<
+  TYPE              = 35663 /* GL_SHADER_TYPE           */, ///<
+  DELETE_STATUS     = 35712 /* GL_DELETE_STATUS         */, ///<
+  COMPILE_STATUS    = 35713 /* GL_COMPILE_STATUS        */, ///<
+  INFO_LOG_LENGTH   = 35716 /* GL_INFO_LOG_LENGTH       */, ///<
+  SOURCE_LENGTH     = 35720 /* GL_SHADER_SOURCE_LENGTH  */, ///<
+  COMPLETION_STATUS = 37297 /* GL_COMPLETION_STATUS_KHR */  ///< Whether the shader's compilation has finished. Requires parallel shader compilation support.
 };
 
 enum class UniformType : unsigned int {
@@ -870,6 +901,16 @@ enum class ElementDataType : unsigned int {
   UINT   = 5125 /* GL_UNSIGNED_INT   */  ///<
 };
 
+/// Parameters of an indexed draw, as read from the buffer bound to BufferType::DRAW_INDIRECT_BUFFER by indirect draw calls.
+/// \see Renderer::multiDrawElementsIndirect()
+struct DrawElementsIndirectCommand {
+  unsigned int count {};         ///< Number of indices to be drawn.
+  unsigned int instanceCount {}; ///< Number of instances to be drawn.
+  unsigned int firstIndex {};    ///< Index of the first index to be read from the element buffer.
+  int baseVertex {};             ///< Value added to each index before fetching the vertex.
+  unsigned int baseInstance {};  ///< Index of the first instance, used to fetch the instanced vertex attributes.
+};
+
 enum class BarrierType : unsigned int {
   VERTEX_ATTRIB_ARRAY = 1          /* GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT */, ///<
   ELEMENT_ARRAY       = 2          /* GL_ELEMENT_ARRAY_BARRIER_BIT       */, ///<
@@ -1054,6 +1095,19 @@ public:
   static void sendBufferSubData(BufferType type, std::ptrdiff_t offset, std::ptrdiff_t dataSize, const void* data);
   template <typename T> static void sendBufferSubData(BufferType type, std::ptrdiff_t offset, const T& data) { sendBufferSubData(type, offset,
                                                                                                                                  sizeof(T), &data); }
+#if !defined(USE_WEBGL)
+  /// Maps a range of the currently bound buffer into the client's memory.
+  /// \param type Type of the buffer to be mapped.
+  /// \param offset Offset of the range to be mapped, in bytes.
+  /// \param length Size of the range to be mapped, in bytes.
+  /// \param access Access to the mapped memory.
+  /// \return Pointer to the mapped memory, or nullptr if the mapping failed.
+  static void* mapBufferRange(BufferType type, std::ptrdiff_t offset, std::ptrdiff_t length, BufferMappingAccess access);
+  /// Unmaps the currently bound buffer, invalidating the pointer previously returned by mapBufferRange().
+  /// \param type Type of the buffer to be unmapped.
+  /// \return True if the buffer's data remained valid while mapped, false if it has been corrupted & must be sent again.
+  static bool unmapBuffer(BufferType type);
+#endif
   static void deleteBuffers(unsigned int count, const unsigned int* indices);
   template <std::size_t N> static void deleteBuffers(const unsigned int (&indices)[N]) { deleteBuffers(N, indices); }
   static void deleteBuffer(unsigned int index) { deleteBuffers(1, &index); }
@@ -1175,6 +1229,19 @@ public:
                               unsigned int width, unsigned int height,
                               TextureFormat format,
                               PixelDataType dataType, const void* data);
+  /// Sends the block-compressed image's data corresponding to the currently bound 2D texture.
+  /// \param type Type of the texture.
+  /// \param mipmapLevel Mipmap (level of detail) of the texture. 0 is the most detailed.
+  /// \param internalFormat Image compressed internal format.
+  /// \param width Image width.
+  /// \param height Image height.
+  /// \param dataSize Size in bytes of the compressed data.
+  /// \param data Compressed data to be sent.
+  static void sendCompressedImageData2D(TextureType type,
+                                        unsigned int mipmapLevel,
+                                        TextureInternalFormat internalFormat,
+                                        unsigned int width, unsigned int height,
+                                        std::size_t dataSize, const void* data);
   /// Sends the image's sub-data corresponding to the currently bound 2D texture.
   /// \param type Type of the texture.
   /// \param mipmapLevel Mipmap (level of detail) of the texture. 0 is the most detailed.
@@ -1287,7 +1354,38 @@ public:
   static bool isProgramLinked(unsigned int index);
   static unsigned int recoverActiveUniformCount(unsigned int programIndex);
   static std::vector<unsigned int> recoverAttachedShaders(unsigned int programIndex);
+  /// Links the given program.
+  /// \note If parallel shader compilation is enabled, this returns without waiting for the link to finish & without checking for errors;
+  ///   isProgramLinked() & logProgramErrors() may then be called, which will wait for it.
+  /// \param index Index of the program to link.
   static void linkProgram(unsigned int index);
+  /// Logs the link errors of the given program, along with the compilation errors of its attached shaders, if any.
+  /// \param index Index of the program to log the errors of.
+  static void logProgramErrors(unsigned int index);
+#if !defined(USE_WEBGL)
+  /// Sets whether the program's binary may be recovered after having been linked. This must be set before linking it.
+  /// \note Requires OpenGL 4.1+, OpenGL ES 3.0+ or the 'GL_ARB_get_program_binary' extension.
+  /// \param index Index of the program to set the hint for.
+  /// \param retrievable True if the binary is to be recovered, false otherwise.
+  static void setProgramBinaryRetrievable(unsigned int index, bool retrievable);
+  /// Recovers the binary of a linked program.
+  /// \note Requires OpenGL 4.1+, OpenGL ES 3.0+ or the 'GL_ARB_get_program_binary' extension.
+  /// \param index Index of the program to recover the binary of.
+  /// \param format Driver-specific format of the recovered binary.
+  /// \return Program's binary; empty if none could be recovered.
+  static std::vector<unsigned char> recoverProgramBinary(unsigned int index, unsigned int& format);
+  /// Loads a program from a binary previously recovered with recoverProgramBinary().
+  /// \note The binary may be rejected by the driver, for example after it has been updated; the program's link status tells whether it has been loaded.
+  /// \note Requires OpenGL 4.1+, OpenGL ES 3.0+ or the 'GL_ARB_get_program_binary' extension.
+  /// \param index Index of the program to load the binary into.
+  /// \param format Driver-specific format of the binary.
+  /// \param binary Binary to be loaded.
+  static void sendProgramBinary(unsigned int index, unsigned int format, const std::vector<unsigned char>& binary);
+#endif
+  /// Checks if parallel shader compilation is enabled, in which case compiling shaders & linking programs doesn't wait for the driver.
+  /// \note Requires the 'GL_KHR_parallel_shader_compile' or 'GL_ARB_parallel_shader_compile' extension, which is enabled when available.
+  /// \return True if shaders are compiled in parallel, false otherwise.
+  static bool isParallelShaderCompileEnabled() noexcept { return s_isParallelShaderCompileEnabled; }
   static void useProgram(unsigned int index);
   static void deleteProgram(unsigned int index);
   static unsigned int createShader(ShaderType type);
@@ -1298,6 +1396,10 @@ public:
   static void sendShaderSource(unsigned int index, const std::string& source) { sendShaderSource(index, source.c_str(), static_cast<int>(source.size())); }
   static void sendShaderSource(unsigned int index, std::string_view source) { sendShaderSource(index, source.data(), static_cast<int>(source.size())); }
   static std::string recoverShaderSource(unsigned int index);
+  /// Compiles the given shader.
+  /// \note If parallel shader compilation is enabled, this returns without waiting for the compilation to finish & without checking for errors,
+  ///   which are reported when linking a program the shader is attached to.
+  /// \param index Index of the shader to compile.
   static void compileShader(unsigned int index);
   static void attachShader(unsigned int programIndex, unsigned int shaderIndex);
   static void detachShader(unsigned int programIndex, unsigned int shaderIndex);
@@ -1478,6 +1580,18 @@ public:
   static void drawElementsInstanced(PrimitiveType type, unsigned int primitiveCount, unsigned int instanceCount) {
     drawElementsInstanced(type, primitiveCount, ElementDataType::UINT, nullptr, instanceCount);
   }
+#if !defined(USE_OPENGL_ES)
+  /// Issues several indexed draws at once, whose parameters are read from the currently bound draw indirect buffer.
+  /// \note Requires OpenGL 4.3+.
+  /// \param type Type of the primitives to be drawn.
+  /// \param dataType Type of the indices.
+  /// \param commandsOffset Offset of the first command in the indirect buffer, in bytes.
+  /// \param drawCount Number of commands to be executed.
+  /// \param stride Distance between two consecutive commands in bytes; 0 if tightly packed.
+  /// \see DrawElementsIndirectCommand
+  static void multiDrawElementsIndirect(PrimitiveType type, ElementDataType dataType, std::ptrdiff_t commandsOffset,
+                                        unsigned int drawCount, unsigned int stride = 0);
+#endif
   static void dispatchCompute(unsigned int groupCountX, unsigned int groupCountY = 1, unsigned int groupCountZ = 1);
   /// Sets a memory synchronization barrier.
   /// \note Requires OpenGL 4.2+ or ES 3.1+.
@@ -1491,12 +1605,27 @@ public:
   static void generateQuery(unsigned int& index) { generateQueries(1, &index); }
   static void beginQuery(QueryType type, unsigned int index);
   static void endQuery(QueryType type);
+  /// Checks if the result of a query is available, without waiting for it to be.
+  /// \param index Index of the query to be checked.
+  /// \return True if the query's result can be recovered without stalling, false otherwise.
+  static bool isQueryResultAvailable(unsigned int index);
 #if !defined (USE_OPENGL_ES)
   static void recoverQueryResult(unsigned int index, int64_t& result);
   static void recoverQueryResult(unsigned int index, uint64_t& result);
 #endif
   static void deleteQueries(unsigned int count, const unsigned int* indices);
   static void deleteQuery(unsigned int index) { deleteQueries(1, &index); }
+  /// Inserts a fence into the command stream, signaled once all the commands issued before it have been completed.
+  /// \return Opaque handle to the created sync object.
+  static void* createFenceSync();
+  /// Checks if a sync object has been signaled, without waiting for it to be.
+  /// \param sync Sync object to be checked.
+  /// \return True if the commands preceding the fence have been completed, false otherwise.
+  static bool isSyncSignaled(void* sync);
+  /// Blocks until a sync object has been signaled.
+  /// \param sync Sync object to wait for.
+  static void waitSync(void* sync);
+  static void deleteSync(void* sync);
 #if !defined (USE_OPENGL_ES)
   /// Assigns a label to a graphic object.
   /// \note Requires OpenGL 4.3+.
@@ -1553,6 +1682,7 @@ private:
   static inline int s_majorVersion {};
   static inline int s_minorVersion {};
   static inline std::unordered_set<std::string> s_extensions {};
+  static inline bool s_isParallelShaderCompileEnabled = false;
   static inline TextureInternalFormat s_defaultFramebufferColor {};
   static inline TextureInternalFormat s_defaultFramebufferDepth {};
 };
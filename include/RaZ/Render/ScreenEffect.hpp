@@ -0,0 +1,38 @@
+#pragma once
+
+#ifndef RAZ_SCREENEFFECT_HPP
+#define RAZ_SCREENEFFECT_HPP
+
+#include <string>
+#include <vector>
+
+namespace Raz {
+
+/// Screen-space effect, processing each pixel of an input buffer bound to the 'uniBuffer' uniform.
+/// Its source must declare its uniforms & define one of the following functions:
+/// - 'vec3 applyEffect(vec3 color, vec2 uv)', returning the processed color of the input buffer at the given coordinates;
+/// - 'vec3 applyEffect(vec2 uv)', if the effect needs to sample the input buffer at arbitrary coordinates.
+/// Chains of effects can be fused by the render graph into a single pass, avoiding writing & reading back the intermediate buffers.
+/// \note As an effect may be fused several times into the same shader, its helper functions & uniform blocks must be guarded
+///   by preprocessor macros against being defined more than once.
+/// \see RenderGraph::compile()
+struct ScreenEffect {
+  std::string source {};     ///< GLSL source declaring the effect's uniforms & defining its applyEffect() function.
+  bool samplesInput = false; ///< Whether the effect samples its input at arbitrary coordinates; if so, it can only start a fused chain.
+
+  /// Generates the source of a fragment shader applying the given effects one after the other, reading the input buffer only once.
+  /// \note If several effects are given, their uniforms are renamed to be kept apart.
+  /// \param effects Effects to be applied, in order; only the first one may sample its input.
+  /// \return Fragment shader source.
+  /// \see recoverFusedName()
+  static std::string generateShaderSource(const std::vector<const ScreenEffect*>& effects);
+  /// Recovers the name that a uniform of an effect takes in a shader generated from several ones.
+  /// \param name Original name of the uniform.
+  /// \param effectIndex Index of the effect in the fused chain.
+  /// \return Name of the uniform in the fused shader.
+  static std::string recoverFusedName(const std::string& name, std::size_t effectIndex);
+};
+
+} // namespace Raz
+
+#endif // RAZ_SCREENEFFECT_HPP
@@ -25,6 +25,9 @@ public:
   void load() const;
   void compile() const;
   bool isCompiled() const noexcept;
+  /// Checks if the shader's source has been loaded since the shader has last been compiled.
+  /// \return True if the shader needs to be compiled, false otherwise.
+  bool isCompilationPending() const noexcept { return m_isCompilationPending; }
   void destroy();
 
   Shader& operator=(const Shader&) = delete;
@@ -39,6 +42,7 @@ protected:
 
   OwnerValue<unsigned int> m_index {};
   FilePath m_path {};
+  mutable bool m_isCompilationPending = false;
 };
 
 class VertexShader final : public Shader {
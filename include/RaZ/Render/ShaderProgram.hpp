@@ -34,6 +34,12 @@ enum class ImageTextureUsage {
   READ_WRITE
 };
 
+/// Handle to an attribute of a shader program, letting it be accessed without looking it up by its uniform name.
+/// \note Handles are invalidated when removing attributes from their program.
+struct AttributeHandle {
+  std::size_t index {};
+};
+
 /// ShaderProgram class, holding shaders & handling data transmission to the graphics card with uniforms.
 class ShaderProgram {
 public:
@@ -42,10 +48,11 @@ public:
   ShaderProgram(ShaderProgram&&) noexcept = default;
 
   unsigned int getIndex() const { return m_index; }
+  static const FilePath& getBinaryCacheDirectory() noexcept { return s_binaryCacheDirectory; }
   /// Checks if an attribute has been set with the given uniform name.
   /// \param uniformName Uniform name to be checked.
   /// \return True if an attribute exists with the given name, false otherwise.
-  bool hasAttribute(const std::string& uniformName) const noexcept { return m_attributes.contains(uniformName); }
+  bool hasAttribute(const std::string& uniformName) const noexcept { return (findAttribute(uniformName) != nullptr); }
   /// Checks if an attribute has been set with the given uniform name and type.
   /// \tparam T Type to be checked.
   /// \param uniformName Uniform name to be checked.
@@ -57,6 +64,22 @@ public:
   /// \param uniformName Uniform name of the attribute to get.
   /// \return Attribute found.
   template <typename T> const T& getAttribute(const std::string& uniformName) const noexcept;
+  /// Fetches an attribute's value from its handle.
+  /// \tparam T Type of the attribute to get. It MUST be the same type the uniform has been set with.
+  /// \param handle Handle of the attribute to get.
+  /// \return Attribute found.
+  template <typename T> const T& getAttribute(AttributeHandle handle) const noexcept;
+  /// Recovers the handle of an attribute, letting it be accessed without looking it up by its uniform name.
+  /// \param uniformName Uniform name of the attribute to recover the handle of.
+  /// \return Handle of the attribute.
+  AttributeHandle recoverAttributeHandle(const std::string& uniformName) const;
+  /// Gets the uniform name of an attribute from its handle.
+  /// \param handle Handle of the attribute to get the uniform name of.
+  /// \return Attribute's uniform name.
+  const std::string& getAttributeName(AttributeHandle handle) const noexcept {
+    assert("Error: The given attribute handle is invalid." && handle.index < m_attributes.size());
+    return m_attributes[handle.index].uniformName;
+  }
   /// Checks if there is a texture entry with the given texture.
   /// \param texture Texture to find.
   /// \return True if an entry has been found, false otherwise.
@@ -88,10 +111,29 @@ public:
   /// \param attribVal Attribute to set.
   /// \param uniformName Uniform name of the attribute to set.
   template <typename T> void setAttribute(T&& attribVal, const std::string& uniformName);
+  /// Sets the value of an existing attribute from its handle.
+  /// \tparam T Type of the attribute to set. Must be a type handled by ShaderProgram::sendUniform().
+  /// \param attribVal Attribute to set.
+  /// \param handle Handle of the attribute to set.
+  /// \see recoverAttributeHandle()
+  template <typename T> void setAttribute(T&& attribVal, AttributeHandle handle);
+  /// Sets an attribute to the value of another program's attribute. If the uniform name already exists, replaces the attribute's value,
+  ///   which is only to be sent again if it differs.
+  /// \param program Program to copy the attribute from.
+  /// \param handle Handle of the attribute to copy in the given program.
+  /// \param uniformName Uniform name of the attribute to set.
+  void copyAttribute(const ShaderProgram& program, AttributeHandle handle, const std::string& uniformName);
   /// Sets a texture to be bound to the shaders. If the uniform name already exists, replaces the texture.
   /// \param texture Texture to set.
   /// \param uniformName Uniform name to bind the texture to.
   void setTexture(TexturePtr texture, const std::string& uniformName);
+  /// Sets the directory in which the programs' binaries are cached, creating it if it doesn't exist.
+  /// Once set, linking a program loads its binary from the cache if available, avoiding compiling its shaders altogether;
+  ///   otherwise, its shaders are compiled & the resulting binary is saved for the next links.
+  /// \note Binaries are identified by the source of all the program's shaders & the driver used. Any mismatch falls back to compiling the shaders.
+  /// \note Requires OpenGL 4.1+, OpenGL ES 3.0+ or the 'GL_ARB_get_program_binary' extension; if not supported, programs are always linked from their shaders.
+  /// \param directory Directory to cache the binaries into; if empty, disables the cache.
+  static void setBinaryCacheDirectory(FilePath directory);
 #if !defined(USE_WEBGL)
   /// Sets an image texture to be bound to the shaders. If the uniform name already exists, replaces the texture.
   /// \param texture Texture to set.
@@ -103,12 +145,21 @@ public:
 
   /// Loads all the shaders contained by the program.
   virtual void loadShaders() const = 0;
-  /// Compiles all the shaders contained by the program.
+  /// Compiles all the shaders contained by the program whose source has changed since they have last been compiled.
   virtual void compileShaders() const = 0;
-  /// Links the program to the graphics card.
+  /// Links the program to the graphics card, compiling its shaders if needed.
   /// \note Linking a program resets all its attributes' values and textures' bindings;
   ///   you may want to call sendAttributes(), initTextures() & initImageTextures() afterward.
-  void link();
+  /// \see setBinaryCacheDirectory()
+  void link() { startLink(); completeLink(); }
+  /// Starts linking the program, either by loading its cached binary or by compiling its shaders & linking them.
+  /// \note If parallel shader compilation is enabled, this doesn't wait for the driver; starting to link several programs
+  ///   before completing any lets them be compiled concurrently.
+  /// \see completeLink()
+  void startLink();
+  /// Waits for the program's link to finish, reporting errors, caching its binary if needed & updating its attributes' locations.
+  /// \see startLink()
+  void completeLink();
   /// Checks if the program has been successfully linked.
   /// \return True if the program is linked, false otherwise.
   bool isLinked() const;
@@ -119,6 +170,7 @@ public:
   /// Checks if the program is currently defined as used.
   bool isUsed() const;
   /// Sends the program's attributes as uniforms.
+  /// \note Only the attributes set since they have last been sent are sent again, unless the program has been linked in the meantime.
   void sendAttributes() const;
   /// Removes an attribute given its uniform name.
   /// \param uniformName Uniform name of the attribute to remove.
@@ -153,6 +205,7 @@ public:
 #endif
   /// Gets the uniform's location (ID) corresponding to the given name.
   /// \note Location will be -1 if the name is incorrect or if the uniform isn't used in the shader(s) (will be optimized out).
+  /// \note Locations are cached until the program is linked again, the driver only being queried once per uniform.
   /// \param name Name of the uniform to recover the location from.
   /// \return Location (ID) of the uniform.
   int recoverUniformLocation(const std::string& name) const;
@@ -338,11 +391,13 @@ public:
 
 protected:
   struct Attribute {
+    std::string uniformName {};
     int location = -1;
     std::variant<int, unsigned int, float,
                  Vec2i, Vec3i, Vec4i, Vec2u, Vec3u, Vec4u, Vec2f, Vec3f, Vec4f,
                  Mat2f, Mat3f, Mat4f,
                  std::vector<int>, std::vector<unsigned int>, std::vector<float>> value {};
+    mutable bool isDirty = true; ///< Whether the value has yet to be sent.
   };
 
   struct ImageTextureAttachment {
@@ -353,15 +408,28 @@ protected:
 
   OwnerValue<unsigned int> m_index {};
 
-  std::unordered_map<std::string, Attribute> m_attributes {};
+  std::vector<Attribute> m_attributes {};
   std::vector<std::pair<TexturePtr, std::string>> m_textures {};
 #if !defined(USE_WEBGL)
   std::vector<std::pair<TexturePtr, ImageTextureAttachment>> m_imageTextures {};
 #endif
 
-private:
-  /// Updates all attributes' uniform locations.
+  /// Updates all attributes' uniform locations, marking them to be sent again.
   void updateAttributesLocations();
+
+private:
+  static inline FilePath s_binaryCacheDirectory {};
+
+  FilePath m_binaryCachePath {}; ///< Path to which the program's binary is to be saved once linked; empty if it has been loaded from the cache.
+  mutable std::unordered_map<std::string, int> m_uniformLocations {}; ///< Uniform locations already queried since the program has last been linked.
+
+  /// Finds an attribute from its uniform name.
+  /// \param uniformName Uniform name of the attribute to find.
+  /// \return Pointer to the attribute if found, nullptr otherwise.
+  const Attribute* findAttribute(const std::string& uniformName) const noexcept;
+  Attribute* findAttribute(const std::string& uniformName) noexcept {
+    return const_cast<Attribute*>(static_cast<const ShaderProgram*>(this)->findAttribute(uniformName));
+  }
 };
 
 class RenderShaderProgram final : public ShaderProgram {
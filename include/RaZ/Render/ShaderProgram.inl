@@ -2,7 +2,8 @@ namespace Raz {
 
 template <typename T>
 bool ShaderProgram::hasAttribute(const std::string& uniformName) const noexcept {
-  return (hasAttribute(uniformName) && std::holds_alternative<T>(m_attributes.find(uniformName)->second.value));
+  const Attribute* attrib = findAttribute(uniformName);
+  return (attrib != nullptr && std::holds_alternative<T>(attrib->value));
 }
 
 template <typename T>
@@ -10,19 +11,36 @@ const T& ShaderProgram::getAttribute(const std::string& uniformName) const noexc
   assert("Error: The given attribute uniform name does not exist." && hasAttribute(uniformName));
   assert("Error: The fetched attribute is not of the asked type." && hasAttribute<T>(uniformName));
 
-  return std::get<T>(m_attributes.find(uniformName)->second.value);
+  return std::get<T>(findAttribute(uniformName)->value);
 }
 
 template <typename T>
-void ShaderProgram::setAttribute(T&& attribVal, const std::string& uniformName) {
-  const auto attrIt = m_attributes.find(uniformName);
+const T& ShaderProgram::getAttribute(AttributeHandle handle) const noexcept {
+  assert("Error: The given attribute handle is invalid." && handle.index < m_attributes.size());
+  assert("Error: The fetched attribute is not of the asked type." && std::holds_alternative<T>(m_attributes[handle.index].value));
+
+  return std::get<T>(m_attributes[handle.index].value);
+}
 
-  if (attrIt != m_attributes.end()) {
-    attrIt->second.value = std::forward<T>(attribVal);
-  } else {
-    const int locationIndex = (isLinked() ? recoverUniformLocation(uniformName) : -1);
-    m_attributes.emplace(uniformName, Attribute{ locationIndex, std::forward<T>(attribVal) });
+template <typename T>
+void ShaderProgram::setAttribute(T&& attribVal, const std::string& uniformName) {
+  if (Attribute* attrib = findAttribute(uniformName)) {
+    attrib->value   = std::forward<T>(attribVal);
+    attrib->isDirty = true;
+    return;
   }
+
+  const int locationIndex = (isLinked() ? recoverUniformLocation(uniformName) : -1);
+  m_attributes.emplace_back(Attribute{ uniformName, locationIndex, std::forward<T>(attribVal) });
+}
+
+template <typename T>
+void ShaderProgram::setAttribute(T&& attribVal, AttributeHandle handle) {
+  assert("Error: The given attribute handle is invalid." && handle.index < m_attributes.size());
+
+  Attribute& attrib = m_attributes[handle.index];
+  attrib.value      = std::forward<T>(attribVal);
+  attrib.isDirty    = true;
 }
 
 } // namespace Raz
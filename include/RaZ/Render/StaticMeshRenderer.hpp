@@ -0,0 +1,114 @@
+#pragma once
+
+#ifndef RAZ_STATICMESHRENDERER_HPP
+#define RAZ_STATICMESHRENDERER_HPP
+
+#include "RaZ/Component.hpp"
+#include "RaZ/Data/Submesh.hpp"
+#include "RaZ/Render/GraphicObjects.hpp"
+#include "RaZ/Render/Material.hpp"
+#include "RaZ/Render/Renderer.hpp"
+#include "RaZ/Render/SubmeshRenderer.hpp"
+
+namespace Raz {
+
+class Mesh;
+
+/// Renderer of static geometry, merging many submeshes into shared vertex & index buffers.
+/// Every frame, the submeshes are culled against the view frustum on the CPU; the visible ones are grouped by material into arrays of draw commands,
+///   each group being drawn with a single multi-draw indirect call. This replaces one draw call per submesh by one per material.
+/// \note The submeshes are transformed when being added; the geometry being static, they can't be moved individually afterward.
+///   If the entity has a Transform component, it is applied to the whole geometry.
+/// \note Multi-draw indirect requires OpenGL 4.3+; otherwise, each command is drawn separately, still benefiting from the merged buffers & culling.
+class StaticMeshRenderer final : public Component {
+public:
+  StaticMeshRenderer() = default;
+  StaticMeshRenderer(const StaticMeshRenderer&) = delete;
+  StaticMeshRenderer(StaticMeshRenderer&&) noexcept = default;
+
+  bool isEnabled() const noexcept { return m_enabled; }
+  const std::vector<Material>& getMaterials() const { return m_materials; }
+  std::vector<Material>& getMaterials() { return m_materials; }
+  std::size_t getSubmeshCount() const noexcept { return m_submeshes.size(); }
+  /// Gets the number of submeshes found visible by the last update of the draw commands.
+  /// \see updateDrawCommands()
+  std::size_t getVisibleSubmeshCount() const noexcept { return m_visibleSubmeshCount; }
+  /// Gets the draw commands computed by the last update, grouped by material.
+  /// \note Visible submeshes which are contiguous in the index buffer are merged into a single command.
+  /// \see updateDrawCommands()
+  const std::vector<DrawElementsIndirectCommand>& getDrawCommands() const noexcept { return m_drawCommands; }
+  /// Gets the number of draw calls issued when drawing, which is the number of materials having at least one visible submesh.
+  std::size_t getDrawCallCount() const noexcept { return m_drawRanges.size(); }
+
+  /// Changes the static mesh renderer's state.
+  /// \note Only the rendering will be affected, not the entity itself.
+  /// \param enabled True if the geometry should be rendered, false otherwise.
+  void enable(bool enabled = true) noexcept { m_enabled = enabled; }
+  /// Disables the rendering of the geometry.
+  /// \note Only the rendering will be affected, not the entity itself.
+  void disable() noexcept { enable(false); }
+  /// Adds a given material into the static mesh renderer.
+  /// \param material Material to be added.
+  /// \return Reference to the newly added material.
+  Material& addMaterial(Material&& material = Material()) { return m_materials.emplace_back(std::move(material)); }
+  /// Adds a submesh to be merged into the geometry.
+  /// \note The submesh is only sent to the GPU when calling load().
+  /// \param submesh Submesh to be added.
+  /// \param transform Transformation to be applied to the submesh's vertices.
+  /// \param materialIndex Index of the material to render the submesh with.
+  void addSubmesh(const Submesh& submesh, const Mat4f& transform = Mat4f::identity(), std::size_t materialIndex = 0);
+  /// Adds all the submeshes of a mesh to be merged into the geometry.
+  /// \note The submeshes are only sent to the GPU when calling load().
+  /// \param mesh Mesh to be added.
+  /// \param transform Transformation to be applied to the mesh's vertices.
+  /// \param materialIndex Index of the material to render the mesh with.
+  void addMesh(const Mesh& mesh, const Mat4f& transform = Mat4f::identity(), std::size_t materialIndex = 0);
+  /// Sends the merged geometry to the GPU, the submeshes sharing a material being stored contiguously.
+  /// \note If no material exists, a default one is created.
+  /// \note The geometry is kept on the CPU, so that more submeshes can be added & loaded afterward.
+  void load();
+  /// Culls the submeshes against the given view frustum, computing the draw commands of the visible ones.
+  /// \param modelViewProjMat Matrix transforming the geometry into clip space.
+  void updateDrawCommands(const Mat4f& modelViewProjMat);
+  /// Renders the visible submeshes, as computed by the last update of the draw commands.
+  /// \see updateDrawCommands()
+  void draw() const;
+
+  StaticMeshRenderer& operator=(const StaticMeshRenderer&) = delete;
+  StaticMeshRenderer& operator=(StaticMeshRenderer&&) noexcept = default;
+
+private:
+  /// Range of the merged indices belonging to a submesh.
+  struct MergedSubmesh {
+    unsigned int firstIndex {};
+    unsigned int indexCount {};
+    AABB boundingBox = AABB(Vec3f(0.f), Vec3f(0.f)); ///< Bounding box of the transformed submesh.
+    std::size_t materialIndex {};
+  };
+
+  /// Range of draw commands rendered with the same material.
+  struct DrawRange {
+    std::size_t materialIndex {};
+    std::size_t firstCommand {};
+    std::size_t commandCount {};
+  };
+
+  bool m_enabled = true;
+
+  Submesh m_mergedGeometry {};
+  std::vector<MergedSubmesh> m_submeshes {};
+  SubmeshRenderer m_submeshRenderer {};
+#if !defined(USE_OPENGL_ES)
+  IndirectBuffer m_indirectBuffer {};
+#endif
+
+  std::vector<Material> m_materials {};
+
+  std::vector<DrawElementsIndirectCommand> m_drawCommands {};
+  std::vector<DrawRange> m_drawRanges {};
+  std::size_t m_visibleSubmeshCount {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_STATICMESHRENDERER_HPP
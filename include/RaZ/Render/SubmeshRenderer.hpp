@@ -41,6 +41,8 @@ public:
   /// \param submesh Submesh to load the data from.
   /// \param renderMode Primitive type to render the submesh with.
   void load(const Submesh& submesh, RenderMode renderMode = RenderMode::TRIANGLE);
+  /// Binds the submesh's vertex array & index buffer, to draw ranges of it manually.
+  void bind() const;
   /// Draws the submesh in the scene.
   void draw() const;
 
@@ -11,6 +11,7 @@
 namespace Raz {
 
 class Color;
+class CompressedImage;
 class Image;
 class Texture;
 class Texture1D;
@@ -140,6 +141,9 @@ public:
   Texture2D(unsigned int width, unsigned int height, TextureColorspace colorspace) : Texture2D(colorspace) { resize(width, height); }
   Texture2D(unsigned int width, unsigned int height, TextureColorspace colorspace, TextureDataType dataType);
   explicit Texture2D(const Image& image, bool createMipmaps = true, bool shouldUseSrgb = false) : Texture2D() { load(image, createMipmaps, shouldUseSrgb); }
+  /// Constructs a texture from a block-compressed image, whose data is sent as is to the graphics card.
+  /// \param image Compressed image to load the data & mipmaps from.
+  explicit Texture2D(const CompressedImage& image) : Texture2D() { load(image); }
   /// Constructs a plain colored texture.
   /// \param color Color to fill the texture with.
   /// \param width Width of the texture to create.
@@ -161,6 +165,10 @@ public:
   /// \param createMipmaps True to generate texture mipmaps, false otherwise.
   /// \param shouldUseSrgb True to set an sRGB(A) colorspace if the image has an RGB(A) one, false to keep it as is.
   void load(const Image& image, bool createMipmaps = true, bool shouldUseSrgb = false);
+  /// Loads a block-compressed image's data onto the graphics card. No conversion is made on the CPU, & the image's mipmaps are used instead of being generated.
+  /// \note The block compression formats must be supported by the GPU; BC1 & BC3 require S3TC support, & BC7 requires BPTC.
+  /// \param image Compressed image to load the data & mipmaps from.
+  void load(const CompressedImage& image);
   /// Fills the texture with a single color.
   /// \param color Color to fill the texture with.
   void fill(const Color& color);
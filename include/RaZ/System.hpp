@@ -35,6 +35,10 @@ public:
   /// \param entity Entity to be checked.
   /// \return True if the system contains the entity, false otherwise.
   bool containsEntity(const Entity& entity) const noexcept;
+  /// Checks if the system must be updated on the main thread, for instance because it relies on a context bound to it.
+  /// A world containing such a system is never updated on another thread.
+  /// \return True if the system must be updated on the main thread, false otherwise.
+  virtual bool requiresMainThread() const noexcept { return false; }
   /// Updates the system.
   /// \param timeInfo Time-related frame information.
   /// \return True if the system is still active, false otherwise.
@@ -0,0 +1,138 @@
+#pragma once
+
+#ifndef RAZ_ALLOCATOR_HPP
+#define RAZ_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+namespace Raz {
+
+struct AllocationStats {
+  std::size_t allocationCount {};    ///< Number of allocations made.
+  std::size_t deallocationCount {};  ///< Number of deallocations made.
+  std::size_t allocatedByteCount {}; ///< Total number of bytes requested by the allocations.
+};
+
+/// Linear (bump) memory resource, allocating from large blocks by simply advancing an offset.
+/// Deallocating does nothing; all the memory is reclaimed at once when resetting the arena, which makes it ideal for short-lived data, such as
+///  per-frame allocations. Being a polymorphic memory resource, it can be used with any std::pmr container.
+/// \note This resource is not thread-safe.
+class LinearArena final : public std::pmr::memory_resource {
+public:
+  /// Creates a linear arena; no memory is allocated until the first allocation is made.
+  /// \param blockSize Minimal size of each block allocated from the upstream resource, in bytes; must not be 0.
+  /// \param upstream Resource to allocate the blocks from.
+  explicit LinearArena(std::size_t blockSize = 65536, std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+  LinearArena(const LinearArena&) = delete;
+  /// Moves the other arena's blocks into this one; the moved-from arena is left empty, but remains usable.
+  /// \note As resources compare equal only to themselves, containers using the moved-from arena must not be used with the new one.
+  /// \param arena Arena to be moved.
+  LinearArena(LinearArena&& arena) noexcept;
+
+  std::size_t getBlockSize() const noexcept { return m_blockSize; }
+  /// Gets the number of blocks currently allocated from the upstream resource.
+  /// \return Allocated block count.
+  std::size_t getBlockCount() const noexcept { return m_blocks.size(); }
+  /// Gets the total size of the blocks currently allocated from the upstream resource.
+  /// \return Arena capacity, in bytes.
+  std::size_t getCapacity() const noexcept;
+  /// Gets the number of bytes used by the allocations made since the last reset, including their alignment padding.
+  /// \return Used byte count.
+  std::size_t getUsedByteCount() const noexcept { return m_usedByteCount; }
+  /// Gets the statistics of the allocations made since the last reset.
+  /// \return Allocation statistics.
+  const AllocationStats& getStats() const noexcept { return m_stats; }
+
+  /// Makes all the arena's memory available again, invalidating every allocation made from it.
+  /// If several blocks were needed, they are merged into a single one large enough to hold them all, so that the next cycles can be served
+  ///  from a contiguous block.
+  void reset();
+  /// Releases all the blocks back to the upstream resource, invalidating every allocation made from the arena.
+  void release();
+
+  LinearArena& operator=(const LinearArena&) = delete;
+  LinearArena& operator=(LinearArena&& arena) noexcept;
+
+  ~LinearArena() override { release(); }
+
+private:
+  struct Block {
+    std::byte* data {};
+    std::size_t size {};
+  };
+
+  void* do_allocate(std::size_t byteCount, std::size_t alignment) override;
+  void do_deallocate(void*, std::size_t, std::size_t) override { ++m_stats.deallocationCount; }
+  bool do_is_equal(const std::pmr::memory_resource& resource) const noexcept override { return (this == &resource); }
+
+  std::size_t m_blockSize {};
+  std::pmr::memory_resource* m_upstream {};
+  std::vector<Block> m_blocks {};
+  std::size_t m_currentBlockIndex {};
+  std::size_t m_currentOffset {};
+  std::size_t m_usedByteCount {};
+  AllocationStats m_stats {};
+};
+
+namespace Allocator {
+
+/// Gets the thread-safe pool resource dedicated to the given type. Its free lists are segregated by size, so that all the objects of the same size
+///  share the same pool, making allocations & deallocations much cheaper than the global ones, and avoiding heap fragmentation.
+/// \note The resource is never destroyed, so that objects can be freely released during static destruction.
+/// \tparam T Type to get the pool resource of.
+/// \return Pool resource of the given type.
+template <typename T>
+std::pmr::memory_resource& getPoolResource() {
+  static auto* poolResource = new std::pmr::synchronized_pool_resource(); // Intentionally leaked
+  return *poolResource;
+}
+
+#if defined(RAZ_USE_PROFILING)
+/// Registers an allocation made from the global operator new.
+/// \param byteCount Number of bytes allocated.
+void registerAllocation(std::size_t byteCount) noexcept;
+/// Registers a deallocation made from the global operator delete.
+void registerDeallocation() noexcept;
+/// Gets the statistics of the allocations made from the global operator new since the application started.
+/// \note The global operators are only instrumented when profiling is enabled, hence this function only being available then.
+/// \return Global allocation statistics.
+AllocationStats getGlobalStats() noexcept;
+#endif
+
+} // namespace Allocator
+
+/// Base class making all instances of the derived type dynamically allocated from its dedicated pool resource.
+/// As the operators are looked up from the dynamic type, all types deriving from a polymorphic class inheriting from it share the same pool.
+/// \tparam T Type whose pool resource is used.
+/// \see Allocator::getPoolResource()
+template <typename T>
+class PoolAllocated {
+public:
+  static void* operator new(std::size_t size) { return Allocator::getPoolResource<T>().allocate(size, alignof(std::max_align_t)); }
+  static void* operator new(std::size_t size, std::align_val_t alignment) {
+    return Allocator::getPoolResource<T>().allocate(size, static_cast<std::size_t>(alignment));
+  }
+  static void* operator new(std::size_t, void* ptr) noexcept { return ptr; } // Class-level operators hide the global placement new
+  static void operator delete(void* ptr, std::size_t size) noexcept { Allocator::getPoolResource<T>().deallocate(ptr, size, alignof(std::max_align_t)); }
+  static void operator delete(void* ptr, std::size_t size, std::align_val_t alignment) noexcept {
+    Allocator::getPoolResource<T>().deallocate(ptr, size, static_cast<std::size_t>(alignment));
+  }
+  static void operator delete(void*, void*) noexcept {}
+
+protected:
+  PoolAllocated() = default;
+  PoolAllocated(const PoolAllocated&) = default;
+  PoolAllocated(PoolAllocated&&) noexcept = default;
+
+  PoolAllocated& operator=(const PoolAllocated&) = default;
+  PoolAllocated& operator=(PoolAllocated&&) noexcept = default;
+
+  ~PoolAllocated() = default;
+};
+
+} // namespace Raz
+
+#endif // RAZ_ALLOCATOR_HPP
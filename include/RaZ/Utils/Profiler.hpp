@@ -0,0 +1,147 @@
+#pragma once
+
+#ifndef RAZ_PROFILER_HPP
+#define RAZ_PROFILER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <string_view>
+#include <vector>
+
+namespace Raz {
+
+class FilePath;
+
+struct ProfileEvent {
+  std::string_view name {};     ///< Name of the profiled scope.
+  std::int64_t startTime {};    ///< Time at which the scope started, in nanoseconds since the profiler's epoch.
+  std::int64_t duration {};     ///< Time taken by the scope, in nanoseconds.
+  std::uint32_t threadIndex {}; ///< Index of the thread the scope has been executed on, in order of first recording.
+};
+
+struct TimingStats {
+  std::size_t sampleCount {}; ///< Number of samples the statistics have been computed from.
+  float average {};           ///< Average time, in milliseconds.
+  float median {};            ///< 50th percentile, in milliseconds.
+  float percentile95 {};      ///< 95th percentile, in milliseconds.
+  float percentile99 {};      ///< 99th percentile, in milliseconds.
+  float maximum {};           ///< Maximum time, in milliseconds.
+};
+
+/// Sliding window of time samples, from which statistics over the latest measures can be computed.
+class TimingWindow {
+public:
+  /// Creates a timing window.
+  /// \param capacity Maximum number of samples to be kept; older ones are discarded once reached. Must not be 0.
+  explicit TimingWindow(std::size_t capacity = 240);
+
+  std::size_t getCapacity() const noexcept { return m_capacity; }
+  std::size_t getSampleCount() const noexcept { return m_samples.size(); }
+  /// Gets the latest sample added.
+  /// \return Latest sample, or 0 if none has been added.
+  float getLatestSample() const noexcept { return (m_samples.empty() ? 0.f : m_samples[(m_nextIndex + m_samples.size() - 1) % m_samples.size()]); }
+
+  /// Adds a sample, replacing the oldest one if the window is full.
+  /// \param time Time to be added, in milliseconds.
+  void addSample(float time);
+  /// Computes the statistics of the samples currently in the window. Percentiles are computed with the nearest-rank method.
+  /// \return Timing statistics.
+  TimingStats computeStats() const;
+  void clear() noexcept;
+
+private:
+  std::size_t m_capacity {};
+  std::vector<float> m_samples {};
+  std::size_t m_nextIndex {};
+};
+
+/// Lightweight built-in CPU profiler, available even when Tracy is disabled.
+/// Scopes are recorded into per-thread lock-free ring buffers, which can be collected at any time & exported to the Chrome trace format. Timings
+///  can also be aggregated by name into sliding windows; the world's systems, the render graph's passes & the application's cycles are.
+/// \note Nothing is recorded until the profiler is enabled.
+class Profiler {
+public:
+  static constexpr std::size_t eventBufferCapacity = 8192; ///< Maximum number of events each thread can hold before they are collected.
+
+  Profiler() = delete;
+
+  static bool isEnabled() noexcept { return s_enabled.load(std::memory_order_relaxed); }
+  /// Gets the number of events which could not be recorded because their thread's buffer was full.
+  /// \return Dropped event count.
+  static std::size_t getDroppedEventCount() noexcept;
+
+  static void enable(bool enabled = true) noexcept { s_enabled.store(enabled, std::memory_order_relaxed); }
+  static void disable() noexcept { enable(false); }
+  /// Sets the number of samples kept for each aggregated timing. Existing timings are cleared.
+  /// \param sampleCount Number of samples in each sliding window; must not be 0.
+  static void setTimingWindowSize(std::size_t sampleCount);
+  /// Stores a name for it to be usable by profiled scopes, which require their name to remain valid until their events are collected.
+  /// \param name Name to be stored.
+  /// \return View on the stored name, valid until the end of the program.
+  static std::string_view storeName(std::string_view name);
+  /// Records an event into the current thread's buffer. Does nothing if the profiler is disabled.
+  /// \param name Name of the event; must remain valid until the event is collected.
+  /// \param startTime Time at which the event started.
+  /// \param endTime Time at which the event ended.
+  static void recordEvent(std::string_view name, std::chrono::steady_clock::time_point startTime, std::chrono::steady_clock::time_point endTime);
+  /// Adds a time sample to the sliding window of the given name. Does nothing if the profiler is disabled.
+  /// \param name Name of the timing to add the sample to.
+  /// \param time Time to be added, in milliseconds.
+  static void recordTiming(std::string_view name, float time);
+  /// Computes the statistics of the timing of the given name.
+  /// \param name Name of the timing to compute the statistics of.
+  /// \return Timing statistics; their sample count is 0 if no timing exists with this name.
+  static TimingStats computeTimingStats(std::string_view name);
+  /// Removes the events of all threads' buffers.
+  /// \return Collected events, sorted by start time.
+  static std::vector<ProfileEvent> collectEvents();
+  /// Writes events in the [Chrome trace format](https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nEY5rm1LIBQ), which can be
+  ///  loaded in about:tracing or [Perfetto](https://ui.perfetto.dev).
+  /// \param events Events to be written.
+  /// \param stream Stream to write the events into.
+  static void exportChromeTrace(const std::vector<ProfileEvent>& events, std::ostream& stream);
+  /// Collects all events & saves them in the Chrome trace format.
+  /// \param filePath File in which to save the events.
+  /// \see exportChromeTrace()
+  static void saveChromeTrace(const FilePath& filePath);
+  /// Removes all events & aggregated timings.
+  static void clear();
+
+  ~Profiler() = delete;
+
+private:
+  static inline std::atomic<bool> s_enabled = false;
+};
+
+/// Profiles the enclosing scope, recording its execution into the profiler when destroyed.
+class ProfileScope {
+public:
+  /// Starts profiling a scope.
+  /// \param name Name of the scope; must remain valid until the events are collected (string literal, type name or stored name).
+  /// \param aggregateTiming True if the scope's duration should also be added to the timing of the same name, false otherwise.
+  /// \see Profiler::storeName()
+  explicit ProfileScope(std::string_view name, bool aggregateTiming = false) noexcept
+    : m_name{ name }, m_aggregateTiming{ aggregateTiming }, m_isEnabled{ Profiler::isEnabled() } {
+    if (m_isEnabled)
+      m_startTime = std::chrono::steady_clock::now();
+  }
+  ProfileScope(const ProfileScope&) = delete;
+  ProfileScope(ProfileScope&&) = delete;
+
+  ProfileScope& operator=(const ProfileScope&) = delete;
+  ProfileScope& operator=(ProfileScope&&) = delete;
+
+  ~ProfileScope();
+
+private:
+  std::string_view m_name {};
+  bool m_aggregateTiming {};
+  bool m_isEnabled {};
+  std::chrono::steady_clock::time_point m_startTime {};
+};
+
+} // namespace Raz
+
+#endif // RAZ_PROFILER_HPP
@@ -35,7 +35,9 @@ enum class ShapeType {
   TRIANGLE,
   QUAD,
   AABB,
-  OBB
+  OBB,
+  CONVEX_HULL,
+  TRIANGLE_MESH
 };
 
 class Shape {
@@ -4,23 +4,80 @@
 #define RAZ_TRIGGERSYSTEM_HPP
 
 #include "RaZ/System.hpp"
+#include "RaZ/Math/Vector.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
 
 namespace Raz {
 
-class Transform;
 class TriggerVolume;
 
+/// System handling the interactions between triggerers & trigger volumes.
+/// Volumes are stored into a uniform spatial hash grid, updated only when they move or change, so that each triggerer is only tested against the volumes
+///  overlapping its own cell.
+/// \see Triggerer, TriggerVolume
 class TriggerSystem final : public System {
 public:
+  static constexpr int maxVolumeCellCount = 64; ///< Number of cells above which a volume is not stored in the grid but tested by all triggerers.
+
   TriggerSystem();
 
+  float getCellSize() const noexcept { return m_cellSize; }
+
+  /// Sets the size of the grid's cells. Ideally, it should be close to the size of most trigger volumes.
+  /// \param cellSize Size of a cell along each axis; must be strictly positive.
+  void setCellSize(float cellSize);
   bool update(const FrameTimeInfo& timeInfo) override;
 
 private:
+  struct VolumeCells {
+    Entity* entity {};
+    Vec3f position {};
+    AABB boundingBox = AABB(Vec3f(0.f), Vec3f(0.f)); ///< Bounding box of the volume in world space.
+    Vec3i minCell {};
+    Vec3i maxCell {};
+    bool isLarge {};
+
+    constexpr bool contains(const Vec3i& cell) const noexcept {
+      return (isLarge || (cell.x() >= minCell.x() && cell.x() <= maxCell.x()
+                       && cell.y() >= minCell.y() && cell.y() <= maxCell.y()
+                       && cell.z() >= minCell.z() && cell.z() <= maxCell.z()));
+    }
+  };
+
+  struct TriggererInfo {
+    Entity* entity {};
+    Vec3f position {};
+    Vec3i cell {};
+  };
+
+  /// Unlinks the entity from the system and removes its volume from the grid.
+  /// \param entity Entity to be unlinked.
+  void unlinkEntity(const EntityPtr& entity) override;
+  Vec3i computeCell(const Vec3f& position) const noexcept;
+  /// Computes the world space bounding box of a trigger volume.
+  /// \param triggerVolume Trigger volume to compute the bounding box of.
+  /// \param position Absolute position of the volume.
+  /// \return Volume's world space bounding box.
+  static AABB computeBoundingBox(const TriggerVolume& triggerVolume, const Vec3f& position);
+  void insertVolume(Entity& entity, const Vec3f& position, const AABB& boundingBox);
+  void removeVolume(const Entity& entity);
   static void processTrigger(TriggerVolume& triggerVolume,
                              Entity& triggererEntity,
                              const Vec3f& triggererPos,
-                             const Transform& triggerVolumeTransform);
+                             const Vec3f& triggerVolumePos);
+
+  float m_cellSize = 5.f;
+  std::unordered_map<std::uint64_t, std::vector<Entity*>> m_grid {};
+  std::unordered_map<const Entity*, VolumeCells> m_volumeCells {};
+  std::vector<Entity*> m_largeVolumes {};
+
+  std::vector<TriggererInfo> m_triggerers {};
+  std::unordered_map<const Entity*, std::size_t> m_triggererIndices {};
+  std::vector<std::size_t> m_leavingEntities {};
 };
 
 } // namespace Raz
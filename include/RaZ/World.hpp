@@ -6,6 +6,7 @@
 #include "RaZ/Entity.hpp"
 #include "RaZ/System.hpp"
 
+#include <string_view>
 #include <unordered_set>
 
 namespace Raz {
@@ -24,6 +25,10 @@ public:
 
   const std::vector<SystemPtr>& getSystems() const { return m_systems; }
   const std::vector<EntityPtr>& getEntities() const { return m_entities; }
+  /// Checks if any of the world's systems must be updated on the main thread.
+  /// \return True if the world must be updated on the main thread, false otherwise.
+  /// \see System::requiresMainThread()
+  bool requiresMainThread() const noexcept;
 
   /// Adds a given system to the world.
   /// \tparam SysT Type of the system to be added.
@@ -91,6 +96,7 @@ private:
   void cleanEntities();
 
   std::vector<SystemPtr> m_systems {};
+  std::vector<std::string_view> m_systemNames {}; ///< Names of the systems' types, used to profile their update.
   Bitset m_activeSystems {};
 
   std::vector<EntityPtr> m_entities {};
@@ -1,3 +1,5 @@
+#include "RaZ/Utils/TypeUtils.hpp"
+
 #include <algorithm>
 
 namespace Raz {
@@ -8,10 +10,13 @@ SysT& World::addSystem(Args&&... args) {
 
   const std::size_t systemId = System::getId<SysT>();
 
-  if (systemId >= m_systems.size())
+  if (systemId >= m_systems.size()) {
     m_systems.resize(systemId + 1);
+    m_systemNames.resize(systemId + 1);
+  }
 
-  m_systems[systemId] = std::make_unique<SysT>(std::forward<Args>(args)...);
+  m_systems[systemId]     = std::make_unique<SysT>(std::forward<Args>(args)...);
+  m_systemNames[systemId] = TypeUtils::getTypeStr<SysT>();
   m_activeSystems.setBit(systemId);
 
   return static_cast<SysT&>(*m_systems[systemId]);
@@ -23,6 +23,8 @@ public:
   unsigned int getOptimalViewWidth() const { return m_optimalViewWidth; }
   unsigned int getOptimalViewHeight() const { return m_optimalViewHeight; }
 
+  /// The XR session is tied to the rendering context, which is bound to the main thread.
+  bool requiresMainThread() const noexcept override { return true; }
   bool update(const FrameTimeInfo&) override;
 
   ~XrSystem() override;
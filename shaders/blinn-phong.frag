@@ -1,4 +1,7 @@
-#define MAX_LIGHT_COUNT 100
+#define LIGHT_CLUSTER_COUNT_X 16
+#define LIGHT_CLUSTER_COUNT_Y 9
+#define LIGHT_CLUSTER_COUNT_Z 24
+#define LIGHT_TEXTURE_WIDTH 1024
 
 struct Light {
   vec4 position;
@@ -39,16 +42,56 @@ layout(std140) uniform uboCameraInfo {
 };
 
 layout(std140) uniform uboLightsInfo {
-  Light uniLights[MAX_LIGHT_COUNT];
+  float uniLightClusterNear;
+  float uniLightClusterDepthScale;
+  uint uniDirLightCount;
   uint uniLightCount;
 };
 
+uniform sampler2D uniLightsData;    // Each light is represented by 4 texels: position, direction, color & (energy, angle)
+uniform sampler2D uniLightClusters; // Offset & count in the light indices of each cluster
+uniform sampler2D uniLightIndices;  // Indices of the lights affecting each cluster
+
 uniform Material uniMaterial;
 
 layout(location = 0) out vec4 fragColor;
 layout(location = 1) out vec3 fragNormal;
 layout(location = 2) out vec4 fragSpecular;
 
+ivec2 computeLightTexelCoords(uint texelIndex) {
+  return ivec2(int(texelIndex % uint(LIGHT_TEXTURE_WIDTH)), int(texelIndex / uint(LIGHT_TEXTURE_WIDTH)));
+}
+
+Light fetchLight(uint lightIndex) {
+  uint firstTexelIndex = lightIndex * 4u;
+  vec4 lightParams     = texelFetch(uniLightsData, computeLightTexelCoords(firstTexelIndex + 3u), 0);
+
+  return Light(texelFetch(uniLightsData, computeLightTexelCoords(firstTexelIndex), 0),
+               texelFetch(uniLightsData, computeLightTexelCoords(firstTexelIndex + 1u), 0),
+               texelFetch(uniLightsData, computeLightTexelCoords(firstTexelIndex + 2u), 0),
+               lightParams.x,
+               lightParams.y);
+}
+
+// Recovers the offset & count in the light indices of the cluster containing the given world position
+uvec2 fetchLightCluster(vec3 position) {
+  vec4 viewPos = uniViewMat * vec4(position, 1.0);
+  vec4 clipPos = uniProjectionMat * viewPos;
+  vec2 ndcPos  = clipPos.xy / clipPos.w;
+
+  ivec2 screenSlices = clamp(ivec2(floor((ndcPos * 0.5 + 0.5) * vec2(LIGHT_CLUSTER_COUNT_X, LIGHT_CLUSTER_COUNT_Y))),
+                             ivec2(0),
+                             ivec2(LIGHT_CLUSTER_COUNT_X - 1, LIGHT_CLUSTER_COUNT_Y - 1));
+  float depth        = max(-viewPos.z, uniLightClusterNear);
+  int depthSlice     = min(int(floor(log(depth / uniLightClusterNear) * uniLightClusterDepthScale)), LIGHT_CLUSTER_COUNT_Z - 1);
+
+  return uvec2(texelFetch(uniLightClusters, ivec2(screenSlices.x + screenSlices.y * LIGHT_CLUSTER_COUNT_X, depthSlice), 0).rg);
+}
+
+uint fetchLightIndex(uint index) {
+  return uint(texelFetch(uniLightIndices, computeLightTexelCoords(index), 0).r);
+}
+
 void main() {
   vec4 baseColor = texture(uniMaterial.baseColorMap, vertMeshInfo.vertTexcoords).rgba;
   float opacity  = texture(uniMaterial.opacityMap, vertMeshInfo.vertTexcoords).r;
@@ -65,21 +108,26 @@ void main() {
   vec3 diffuse  = vec3(0.0);
   vec3 specular = vec3(0.0);
 
-  for (uint lightIndex = 0u; lightIndex < uniLightCount; ++lightIndex) {
+  uvec2 lightCluster = fetchLightCluster(vertMeshInfo.vertPosition);
+  uint lightCount    = uniDirLightCount + lightCluster.y;
+
+  // Directional lights are evaluated first, then only those affecting the fragment's cluster
+  for (uint i = 0u; i < lightCount; ++i) {
+    Light light = fetchLight(i < uniDirLightCount ? i : fetchLightIndex(lightCluster.x + i - uniDirLightCount));
     vec3 fullLightDir;
-    float attenuation = uniLights[lightIndex].energy;
+    float attenuation = light.energy;
 
-    if (uniLights[lightIndex].position.w != 0.0) {
-      fullLightDir = uniLights[lightIndex].position.xyz - vertMeshInfo.vertPosition;
+    if (light.position.w != 0.0) {
+      fullLightDir = light.position.xyz - vertMeshInfo.vertPosition;
 
       float sqDist = dot(fullLightDir, fullLightDir);
       attenuation /= sqDist;
     } else {
-      fullLightDir = -uniLights[lightIndex].direction.xyz;
+      fullLightDir = -light.direction.xyz;
     }
 
     vec3 lightDir = normalize(fullLightDir);
-    vec3 radiance = uniLights[lightIndex].color.rgb * attenuation;
+    vec3 radiance = light.color.rgb * attenuation;
 
     // Diffuse
     float lightAngle = max(dot(lightDir, normal), 0.0);
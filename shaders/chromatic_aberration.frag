@@ -1,22 +1,17 @@
-in vec2 fragTexcoords;
-
-uniform sampler2D uniBuffer;
 uniform vec2 uniInvBufferSize;
 uniform float uniStrength;
 uniform vec2 uniDirection;
 uniform sampler2D uniMask;
 
-layout(location = 0) out vec4 fragColor;
-
-void main() {
-  vec3 color  = texture(uniBuffer, fragTexcoords).rgb;
+vec3 applyEffect(vec2 uv) {
+  vec3 color  = texture(uniBuffer, uv).rgb;
   vec2 offset = uniDirection * uniInvBufferSize * uniStrength;
 
-  float red   = texture(uniBuffer, fragTexcoords - offset).r;
+  float red   = texture(uniBuffer, uv - offset).r;
   float green = color.g;
-  float blue  = texture(uniBuffer, fragTexcoords + offset).b;
+  float blue  = texture(uniBuffer, uv + offset).b;
 
-  vec3 mask = texture(uniMask, fragTexcoords).rgb;
+  vec3 mask = texture(uniMask, uv).rgb;
 
-  fragColor = vec4(mix(color, vec3(red, green, blue), mask), 1.0);
+  return mix(color, vec3(red, green, blue), mask);
 }
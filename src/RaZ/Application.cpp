@@ -1,8 +1,13 @@
 #include "RaZ/Application.hpp"
 #include "RaZ/Utils/Logger.hpp"
+#include "RaZ/Utils/Profiler.hpp"
 
 #include "tracy/Tracy.hpp"
 
+#include <cmath>
+#include <future>
+#include <thread>
+
 #if defined(RAZ_PLATFORM_EMSCRIPTEN)
 #include <emscripten.h>
 #endif
@@ -28,9 +33,21 @@ void Application::run() {
 }
 
 bool Application::runOnce() {
+#if !defined(RAZ_PLATFORM_EMSCRIPTEN)
+  // Waiting at the beginning of the cycle allows taking into account what may have been executed between two calls, like a callback.
+  //  This is done before starting to profile the cycle, so that its timings & allocations only reflect the actual work
+  waitForNextCycle();
+#endif
+
   ZoneScopedN("Application::runOnce");
+  const ProfileScope cycleScope("Application::runOnce", true);
+
+  m_frameArena.reset();
+#if defined(RAZ_USE_PROFILING)
+  const AllocationStats initialStats = Allocator::getGlobalStats();
+#endif
 
-  const auto currentTime = std::chrono::system_clock::now();
+  const auto currentTime = std::chrono::steady_clock::now();
   m_timeInfo.deltaTime   = std::chrono::duration<float>(currentTime - m_lastFrameTime).count();
   m_timeInfo.globalTime += m_timeInfo.deltaTime;
   m_lastFrameTime        = currentTime;
@@ -41,16 +58,35 @@ bool Application::runOnce() {
   while (m_remainingTime >= m_timeInfo.substepTime) {
     ++m_timeInfo.substepCount;
     m_remainingTime -= m_timeInfo.substepTime;
+
+    if (m_timeInfo.substepCount == m_maxSubstepCount) {
+      // Too much time has passed to be caught up with; the simulation is slowed down instead, only keeping the time of a partial step
+      m_remainingTime = std::fmod(m_remainingTime, m_timeInfo.substepTime);
+      break;
+    }
   }
 
-  for (std::size_t worldIndex = 0; worldIndex < m_worlds.size(); ++worldIndex) {
-    if (!m_activeWorlds[worldIndex])
-      continue;
+  m_timeInfo.interpolationAlpha = m_remainingTime / m_timeInfo.substepTime;
 
-    if (!m_worlds[worldIndex]->update(m_timeInfo))
-      m_activeWorlds.setBit(worldIndex, false);
+  if (m_worldUpdateMode == WorldUpdateMode::PARALLEL) {
+    updateWorldsInParallel();
+  } else {
+    for (std::size_t worldIndex = 0; worldIndex < m_worlds.size(); ++worldIndex) {
+      if (!m_activeWorlds[worldIndex])
+        continue;
+
+      if (!m_worlds[worldIndex]->update(m_timeInfo))
+        m_activeWorlds.setBit(worldIndex, false);
+    }
   }
 
+#if defined(RAZ_USE_PROFILING)
+  const AllocationStats finalStats = Allocator::getGlobalStats();
+  m_frameAllocationStats.allocationCount    = finalStats.allocationCount - initialStats.allocationCount;
+  m_frameAllocationStats.deallocationCount  = finalStats.deallocationCount - initialStats.deallocationCount;
+  m_frameAllocationStats.allocatedByteCount = finalStats.allocatedByteCount - initialStats.allocatedByteCount;
+#endif
+
   // Adding a frame mark registers the past frame
   // TODO: the application setup (everything up until Application::run() is called, hence including the main function) is merged with the very first frame
   //  A "fix" would be to add another FrameMark at the top of the run function, but the currently templated callback overload being in a header,
@@ -60,4 +96,79 @@ bool Application::runOnce() {
   return (m_isRunning && !m_activeWorlds.isEmpty());
 }
 
+void Application::updateWorldsInParallel() {
+  ZoneScopedN("Application::updateWorldsInParallel");
+
+  if (m_worldThreadPool == nullptr)
+    m_worldThreadPool = std::make_unique<ThreadPool>("World worker");
+
+  // std::vector<bool> is avoided, since its elements can't be written concurrently
+  std::vector<uint8_t> worldStates(m_worlds.size(), true);
+  std::vector<std::promise<void>> promises(m_worlds.size());
+  std::vector<std::future<void>> futures;
+  futures.reserve(m_worlds.size());
+
+  for (std::size_t worldIndex = 0; worldIndex < m_worlds.size(); ++worldIndex) {
+    if (!m_activeWorlds[worldIndex] || m_worlds[worldIndex]->requiresMainThread())
+      continue;
+
+    futures.emplace_back(promises[worldIndex].get_future());
+
+    m_worldThreadPool->addTask([this, &worldStates, &promises, worldIndex] () {
+      try {
+        worldStates[worldIndex] = m_worlds[worldIndex]->update(m_timeInfo);
+        promises[worldIndex].set_value();
+      } catch (...) {
+        promises[worldIndex].set_exception(std::current_exception());
+      }
+    });
+  }
+
+  // The worlds requiring the main thread are updated while the others are processed by the thread pool
+  std::exception_ptr mainThreadException;
+
+  try {
+    for (std::size_t worldIndex = 0; worldIndex < m_worlds.size(); ++worldIndex) {
+      if (m_activeWorlds[worldIndex] && m_worlds[worldIndex]->requiresMainThread())
+        worldStates[worldIndex] = m_worlds[worldIndex]->update(m_timeInfo);
+    }
+  } catch (...) {
+    mainThreadException = std::current_exception();
+  }
+
+  // All tasks must be finished before leaving, since they reference local data
+  for (const std::future<void>& future : futures)
+    future.wait();
+
+  if (mainThreadException)
+    std::rethrow_exception(mainThreadException);
+
+  for (std::future<void>& future : futures)
+    future.get(); // Rethrows any exception thrown by a world's update
+
+  for (std::size_t worldIndex = 0; worldIndex < m_worlds.size(); ++worldIndex) {
+    if (!worldStates[worldIndex])
+      m_activeWorlds.setBit(worldIndex, false);
+  }
+}
+
+void Application::waitForNextCycle() const {
+  if (m_targetFrameTime <= 0.f)
+    return;
+
+  ZoneScopedN("Application::waitForNextCycle");
+
+  // Sleeping is only precise to about a millisecond depending on the platform; the last part of the wait is made by actively spinning
+  constexpr std::chrono::steady_clock::duration spinDuration = std::chrono::milliseconds(1);
+
+  const auto cycleEndTime = m_lastFrameTime + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float>(m_targetFrameTime));
+  const auto sleepEndTime = cycleEndTime - spinDuration;
+
+  if (std::chrono::steady_clock::now() < sleepEndTime)
+    std::this_thread::sleep_until(sleepEndTime);
+
+  while (std::chrono::steady_clock::now() < cycleEndTime)
+    std::this_thread::yield();
+}
+
 } // namespace Raz
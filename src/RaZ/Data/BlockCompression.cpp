@@ -0,0 +1,686 @@
+#include "RaZ/Data/BlockCompression.hpp"
+#include "RaZ/Data/Image.hpp"
+#include "RaZ/Data/ImageUtils.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include "tracy/Tracy.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace Raz {
+
+namespace {
+
+template <std::size_t N>
+using Texel = std::array<float, N>;
+
+template <std::size_t N>
+using TexelBlock = std::array<Texel<N>, 16>;
+
+using IndexBlock = std::array<uint8_t, 16>;
+
+// Interpolation weights of BC7's 4-bit indices, out of 64
+constexpr std::array<uint8_t, 16> bc7Weights = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+constexpr bool isSrgb(ImageColorspace colorspace) noexcept {
+  return (colorspace == ImageColorspace::SRGB || colorspace == ImageColorspace::SRGBA);
+}
+
+/// Fetches the 4x4 block of pixels starting at the given position, replicating the last row/column for blocks overlapping the image's edges.
+/// \param image Image to fetch the pixels from.
+/// \param blockX Horizontal index of the block.
+/// \param blockY Vertical index of the block.
+/// \param expandGray True to replicate a gray value into RGB & move the alpha channel to the fourth position, false to keep the channels as they are.
+/// \return RGBA values of the block's pixels between 0 & 255, the missing color channels being 0 & the alpha 255.
+TexelBlock<4> fetchBlock(const Image& image, std::size_t blockX, std::size_t blockY, bool expandGray) noexcept {
+  const uint8_t channelCount = image.getChannelCount();
+  const bool isFloat         = (image.getDataType() == ImageDataType::FLOAT);
+  const auto* byteData       = static_cast<const uint8_t*>(image.getDataPtr());
+  const auto* floatData      = static_cast<const float*>(image.getDataPtr());
+
+  TexelBlock<4> texels {};
+
+  for (std::size_t y = 0; y < 4; ++y) {
+    const std::size_t pixelY = std::min(blockY * 4 + y, static_cast<std::size_t>(image.getHeight() - 1));
+
+    for (std::size_t x = 0; x < 4; ++x) {
+      const std::size_t pixelX     = std::min(blockX * 4 + x, static_cast<std::size_t>(image.getWidth() - 1));
+      const std::size_t valueIndex = (pixelY * image.getWidth() + pixelX) * channelCount;
+
+      Texel<4>& texel = texels[y * 4 + x];
+      texel = { 0.f, 0.f, 0.f, 255.f };
+
+      for (uint8_t channelIndex = 0; channelIndex < channelCount; ++channelIndex) {
+        texel[channelIndex] = (isFloat ? std::round(std::clamp(floatData[valueIndex + channelIndex], 0.f, 1.f) * 255.f)
+                                       : static_cast<float>(byteData[valueIndex + channelIndex]));
+      }
+
+      if (expandGray && channelCount <= 2)
+        texel = { texel[0], texel[0], texel[0], (channelCount == 2 ? texel[1] : 255.f) };
+    }
+  }
+
+  return texels;
+}
+
+template <std::size_t N>
+float computeSquaredDistance(const Texel<N>& first, const Texel<N>& second) noexcept {
+  float distance = 0.f;
+
+  for (std::size_t i = 0; i < N; ++i)
+    distance += (first[i] - second[i]) * (first[i] - second[i]);
+
+  return distance;
+}
+
+/// Finds the two extreme texels of a block along its principal axis, which make a good first guess for the block's endpoints.
+/// \tparam N Number of channels to be considered.
+/// \param texels Texels of the block.
+/// \return Extreme values along the principal axis, respectively the lowest & highest.
+template <std::size_t N>
+std::pair<Texel<N>, Texel<N>> computePrincipalEndpoints(const TexelBlock<N>& texels) noexcept {
+  Texel<N> mean {};
+
+  for (const Texel<N>& texel : texels) {
+    for (std::size_t i = 0; i < N; ++i)
+      mean[i] += texel[i] / 16.f;
+  }
+
+  std::array<Texel<N>, N> covariance {};
+
+  for (const Texel<N>& texel : texels) {
+    for (std::size_t i = 0; i < N; ++i) {
+      for (std::size_t j = 0; j < N; ++j)
+        covariance[i][j] += (texel[i] - mean[i]) * (texel[j] - mean[j]);
+    }
+  }
+
+  // Power iteration, giving an approximation of the covariance matrix's dominant eigenvector
+  Texel<N> axis {};
+  axis.fill(1.f);
+
+  for (int iteration = 0; iteration < 8; ++iteration) {
+    Texel<N> newAxis {};
+
+    for (std::size_t i = 0; i < N; ++i) {
+      for (std::size_t j = 0; j < N; ++j)
+        newAxis[i] += covariance[i][j] * axis[j];
+    }
+
+    float maxComponent = 0.f;
+    for (const float component : newAxis)
+      maxComponent = std::max(maxComponent, std::abs(component));
+
+    if (maxComponent == 0.f)
+      break; // All texels are identical
+
+    for (std::size_t i = 0; i < N; ++i)
+      axis[i] = newAxis[i] / maxComponent;
+  }
+
+  float minProj = std::numeric_limits<float>::max();
+  float maxProj = std::numeric_limits<float>::lowest();
+  std::size_t minIndex = 0;
+  std::size_t maxIndex = 0;
+
+  for (std::size_t texelIndex = 0; texelIndex < texels.size(); ++texelIndex) {
+    float proj = 0.f;
+    for (std::size_t i = 0; i < N; ++i)
+      proj += (texels[texelIndex][i] - mean[i]) * axis[i];
+
+    if (proj < minProj) {
+      minProj  = proj;
+      minIndex = texelIndex;
+    }
+
+    if (proj > maxProj) {
+      maxProj  = proj;
+      maxIndex = texelIndex;
+    }
+  }
+
+  return { texels[minIndex], texels[maxIndex] };
+}
+
+/// Assigns to each texel the index of its closest palette entry.
+/// \return Total squared error of the block.
+template <std::size_t N, std::size_t PaletteSize>
+float fitIndices(const TexelBlock<N>& texels, const std::array<Texel<N>, PaletteSize>& palette, IndexBlock& indices) noexcept {
+  float totalError = 0.f;
+
+  for (std::size_t texelIndex = 0; texelIndex < texels.size(); ++texelIndex) {
+    float bestError = std::numeric_limits<float>::max();
+
+    for (std::size_t paletteIndex = 0; paletteIndex < PaletteSize; ++paletteIndex) {
+      const float error = computeSquaredDistance(texels[texelIndex], palette[paletteIndex]);
+
+      if (error < bestError) {
+        bestError = error;
+        indices[texelIndex] = static_cast<uint8_t>(paletteIndex);
+      }
+    }
+
+    totalError += bestError;
+  }
+
+  return totalError;
+}
+
+/// Computes the endpoints best fitting the texels in the least squares sense, the interpolation factor of each being given by its index.
+/// \param texels Texels of the block.
+/// \param indices Palette index of each texel.
+/// \param factors Interpolation factor from the first to the second endpoint of each palette entry.
+/// \param firstEndpoint First endpoint to be refined; left untouched if the system is degenerate.
+/// \param secondEndpoint Second endpoint to be refined; left untouched if the system is degenerate.
+template <std::size_t N, std::size_t PaletteSize>
+void refineEndpoints(const TexelBlock<N>& texels, const IndexBlock& indices, const std::array<float, PaletteSize>& factors,
+                     Texel<N>& firstEndpoint, Texel<N>& secondEndpoint) noexcept {
+  float firstSqSum  = 0.f;
+  float crossSum    = 0.f;
+  float secondSqSum = 0.f;
+  Texel<N> firstWeightedSum {};
+  Texel<N> secondWeightedSum {};
+
+  for (std::size_t texelIndex = 0; texelIndex < texels.size(); ++texelIndex) {
+    const float secondWeight = factors[indices[texelIndex]];
+    const float firstWeight  = 1.f - secondWeight;
+
+    firstSqSum  += firstWeight * firstWeight;
+    crossSum    += firstWeight * secondWeight;
+    secondSqSum += secondWeight * secondWeight;
+
+    for (std::size_t i = 0; i < N; ++i) {
+      firstWeightedSum[i]  += firstWeight * texels[texelIndex][i];
+      secondWeightedSum[i] += secondWeight * texels[texelIndex][i];
+    }
+  }
+
+  const float determinant = firstSqSum * secondSqSum - crossSum * crossSum;
+
+  if (std::abs(determinant) < 0.0001f)
+    return;
+
+  for (std::size_t i = 0; i < N; ++i) {
+    firstEndpoint[i]  = std::clamp((secondSqSum * firstWeightedSum[i] - crossSum * secondWeightedSum[i]) / determinant, 0.f, 255.f);
+    secondEndpoint[i] = std::clamp((firstSqSum * secondWeightedSum[i] - crossSum * firstWeightedSum[i]) / determinant, 0.f, 255.f);
+  }
+}
+
+//////////////////
+// BC1 (colors) //
+//////////////////
+
+uint16_t packRgb565(const Texel<3>& color) noexcept {
+  const auto red   = static_cast<uint16_t>(std::round(std::clamp(color[0], 0.f, 255.f) * 31.f / 255.f));
+  const auto green = static_cast<uint16_t>(std::round(std::clamp(color[1], 0.f, 255.f) * 63.f / 255.f));
+  const auto blue  = static_cast<uint16_t>(std::round(std::clamp(color[2], 0.f, 255.f) * 31.f / 255.f));
+  return static_cast<uint16_t>((red << 11u) | (green << 5u) | blue);
+}
+
+constexpr std::array<int, 3> unpackRgb565(uint16_t color) noexcept {
+  const int red   = (color >> 11u) & 31;
+  const int green = (color >> 5u) & 63;
+  const int blue  = color & 31;
+  return { (red << 3) | (red >> 2), (green << 2) | (green >> 4), (blue << 3) | (blue >> 2) };
+}
+
+/// Computes the palette of a BC1 color block.
+/// \param firstColor First packed endpoint.
+/// \param secondColor Second packed endpoint.
+/// \param forceFourColors True to always interpolate 4 colors (as done in BC3), false to use the 3 colors & black mode when the first endpoint is not greater.
+std::array<Texel<3>, 4> computeBc1Palette(uint16_t firstColor, uint16_t secondColor, bool forceFourColors) noexcept {
+  const std::array<int, 3> first  = unpackRgb565(firstColor);
+  const std::array<int, 3> second = unpackRgb565(secondColor);
+
+  std::array<Texel<3>, 4> palette {};
+
+  for (std::size_t i = 0; i < 3; ++i) {
+    palette[0][i] = static_cast<float>(first[i]);
+    palette[1][i] = static_cast<float>(second[i]);
+
+    if (forceFourColors || firstColor > secondColor) {
+      palette[2][i] = static_cast<float>((2 * first[i] + second[i] + 1) / 3);
+      palette[3][i] = static_cast<float>((first[i] + 2 * second[i] + 1) / 3);
+    } else {
+      palette[2][i] = static_cast<float>((first[i] + second[i] + 1) / 2);
+      palette[3][i] = 0.f;
+    }
+  }
+
+  return palette;
+}
+
+void encodeBc1Block(const TexelBlock<4>& rgbaTexels, uint8_t* block) noexcept {
+  TexelBlock<3> texels {};
+  for (std::size_t texelIndex = 0; texelIndex < texels.size(); ++texelIndex)
+    texels[texelIndex] = { rgbaTexels[texelIndex][0], rgbaTexels[texelIndex][1], rgbaTexels[texelIndex][2] };
+
+  // Interpolation factor from the first to the second endpoint for each index, in 4 colors mode
+  constexpr std::array<float, 4> factors = { 0.f, 1.f, 1.f / 3.f, 2.f / 3.f };
+
+  auto [secondEndpoint, firstEndpoint] = computePrincipalEndpoints(texels);
+
+  uint16_t firstColor  = packRgb565(firstEndpoint);
+  uint16_t secondColor = packRgb565(secondEndpoint);
+  IndexBlock indices {};
+  float error = fitIndices(texels, computeBc1Palette(firstColor, secondColor, true), indices);
+
+  for (int iteration = 0; iteration < 2 && error > 0.f; ++iteration) {
+    refineEndpoints(texels, indices, factors, firstEndpoint, secondEndpoint);
+
+    const uint16_t refinedFirstColor  = packRgb565(firstEndpoint);
+    const uint16_t refinedSecondColor = packRgb565(secondEndpoint);
+    IndexBlock refinedIndices {};
+    const float refinedError = fitIndices(texels, computeBc1Palette(refinedFirstColor, refinedSecondColor, true), refinedIndices);
+
+    if (refinedError >= error)
+      break;
+
+    firstColor  = refinedFirstColor;
+    secondColor = refinedSecondColor;
+    indices     = refinedIndices;
+    error       = refinedError;
+  }
+
+  // The first endpoint must be strictly greater for the block to be decoded in 4 colors mode
+  if (firstColor < secondColor) {
+    std::swap(firstColor, secondColor);
+
+    for (uint8_t& index : indices)
+      index ^= 1u; // Swapping 0 & 1, as well as 2 & 3
+  } else if (firstColor == secondColor) {
+    indices.fill(0);
+  }
+
+  uint32_t packedIndices = 0;
+  for (std::size_t texelIndex = 0; texelIndex < indices.size(); ++texelIndex)
+    packedIndices |= static_cast<uint32_t>(indices[texelIndex]) << (texelIndex * 2);
+
+  block[0] = static_cast<uint8_t>(firstColor & 255u);
+  block[1] = static_cast<uint8_t>(firstColor >> 8u);
+  block[2] = static_cast<uint8_t>(secondColor & 255u);
+  block[3] = static_cast<uint8_t>(secondColor >> 8u);
+
+  for (std::size_t i = 0; i < 4; ++i)
+    block[4 + i] = static_cast<uint8_t>((packedIndices >> (i * 8)) & 255u);
+}
+
+void decodeBc1Block(const uint8_t* block, bool forceFourColors, TexelBlock<4>& texels) noexcept {
+  const auto firstColor  = static_cast<uint16_t>(block[0] | (block[1] << 8u));
+  const auto secondColor = static_cast<uint16_t>(block[2] | (block[3] << 8u));
+  const std::array<Texel<3>, 4> palette = computeBc1Palette(firstColor, secondColor, forceFourColors);
+
+  for (std::size_t texelIndex = 0; texelIndex < texels.size(); ++texelIndex) {
+    const uint8_t index = (block[4 + texelIndex / 4] >> ((texelIndex % 4) * 2)) & 3u;
+    texels[texelIndex][0] = palette[index][0];
+    texels[texelIndex][1] = palette[index][1];
+    texels[texelIndex][2] = palette[index][2];
+  }
+}
+
+//////////////////////////
+// BC4 (single channel) //
+//////////////////////////
+
+std::array<Texel<1>, 8> computeBc4Palette(uint8_t firstValue, uint8_t secondValue) noexcept {
+  std::array<Texel<1>, 8> palette {};
+  palette[0][0] = firstValue;
+  palette[1][0] = secondValue;
+
+  if (firstValue > secondValue) {
+    for (int i = 1; i < 7; ++i)
+      palette[static_cast<std::size_t>(i + 1)][0] = static_cast<float>(((7 - i) * firstValue + i * secondValue + 3) / 7);
+  } else {
+    for (int i = 1; i < 5; ++i)
+      palette[static_cast<std::size_t>(i + 1)][0] = static_cast<float>(((5 - i) * firstValue + i * secondValue + 2) / 5);
+
+    palette[6][0] = 0.f;
+    palette[7][0] = 255.f;
+  }
+
+  return palette;
+}
+
+void encodeBc4Block(const TexelBlock<4>& rgbaTexels, std::size_t channelIndex, uint8_t* block) noexcept {
+  TexelBlock<1> texels {};
+  for (std::size_t texelIndex = 0; texelIndex < texels.size(); ++texelIndex)
+    texels[texelIndex][0] = rgbaTexels[texelIndex][channelIndex];
+
+  const auto [minIt, maxIt] = std::minmax_element(texels.cbegin(), texels.cend());
+  const auto firstValue     = static_cast<uint8_t>((*maxIt)[0]);
+  const auto secondValue    = static_cast<uint8_t>((*minIt)[0]);
+
+  IndexBlock indices {};
+  if (firstValue != secondValue)
+    fitIndices(texels, computeBc4Palette(firstValue, secondValue), indices);
+
+  uint64_t packedIndices = 0;
+  for (std::size_t texelIndex = 0; texelIndex < indices.size(); ++texelIndex)
+    packedIndices |= static_cast<uint64_t>(indices[texelIndex]) << (texelIndex * 3);
+
+  block[0] = firstValue;
+  block[1] = secondValue;
+
+  for (std::size_t i = 0; i < 6; ++i)
+    block[2 + i] = static_cast<uint8_t>((packedIndices >> (i * 8)) & 255u);
+}
+
+void decodeBc4Block(const uint8_t* block, std::size_t channelIndex, TexelBlock<4>& texels) noexcept {
+  const std::array<Texel<1>, 8> palette = computeBc4Palette(block[0], block[1]);
+
+  uint64_t packedIndices = 0;
+  for (std::size_t i = 0; i < 6; ++i)
+    packedIndices |= static_cast<uint64_t>(block[2 + i]) << (i * 8);
+
+  for (std::size_t texelIndex = 0; texelIndex < texels.size(); ++texelIndex)
+    texels[texelIndex][channelIndex] = palette[(packedIndices >> (texelIndex * 3)) & 7u][0];
+}
+
+///////////////////////
+// BC7 (mode 6 only) //
+///////////////////////
+
+void writeBits(uint8_t* block, std::size_t& bitIndex, uint32_t value, std::size_t bitCount) noexcept {
+  for (std::size_t i = 0; i < bitCount; ++i, ++bitIndex) {
+    if ((value >> i) & 1u)
+      block[bitIndex / 8] |= static_cast<uint8_t>(1u << (bitIndex % 8));
+  }
+}
+
+uint32_t readBits(const uint8_t* block, std::size_t& bitIndex, std::size_t bitCount) noexcept {
+  uint32_t value = 0;
+
+  for (std::size_t i = 0; i < bitCount; ++i, ++bitIndex)
+    value |= ((block[bitIndex / 8] >> (bitIndex % 8)) & 1u) << i;
+
+  return value;
+}
+
+/// Quantized BC7 mode 6 endpoint: 7 bits per channel & a shared lowest bit.
+struct Bc7Endpoint {
+  std::array<uint8_t, 4> values {};
+  uint8_t pBit {};
+
+  Texel<4> expand() const noexcept {
+    return { static_cast<float>((values[0] << 1u) | pBit), static_cast<float>((values[1] << 1u) | pBit),
+             static_cast<float>((values[2] << 1u) | pBit), static_cast<float>((values[3] << 1u) | pBit) };
+  }
+};
+
+Bc7Endpoint quantizeBc7Endpoint(const Texel<4>& endpoint) noexcept {
+  Bc7Endpoint bestEndpoint {};
+  float bestError = std::numeric_limits<float>::max();
+
+  for (uint8_t pBit = 0; pBit < 2; ++pBit) {
+    Bc7Endpoint quantized { {}, pBit };
+
+    for (std::size_t i = 0; i < 4; ++i)
+      quantized.values[i] = static_cast<uint8_t>(std::clamp(std::round((endpoint[i] - pBit) / 2.f), 0.f, 127.f));
+
+    const float error = computeSquaredDistance(quantized.expand(), endpoint);
+
+    if (error < bestError) {
+      bestError    = error;
+      bestEndpoint = quantized;
+    }
+  }
+
+  return bestEndpoint;
+}
+
+std::array<Texel<4>, 16> computeBc7Palette(const Bc7Endpoint& firstEndpoint, const Bc7Endpoint& secondEndpoint) noexcept {
+  const Texel<4> first  = firstEndpoint.expand();
+  const Texel<4> second = secondEndpoint.expand();
+
+  std::array<Texel<4>, 16> palette {};
+
+  for (std::size_t paletteIndex = 0; paletteIndex < palette.size(); ++paletteIndex) {
+    const int weight = bc7Weights[paletteIndex];
+
+    for (std::size_t i = 0; i < 4; ++i)
+      palette[paletteIndex][i] = static_cast<float>(((64 - weight) * static_cast<int>(first[i]) + weight * static_cast<int>(second[i]) + 32) >> 6);
+  }
+
+  return palette;
+}
+
+void encodeBc7Block(const TexelBlock<4>& texels, uint8_t* block) noexcept {
+  std::array<float, 16> factors {};
+  for (std::size_t i = 0; i < factors.size(); ++i)
+    factors[i] = static_cast<float>(bc7Weights[i]) / 64.f;
+
+  auto [firstEndpoint, secondEndpoint] = computePrincipalEndpoints(texels);
+
+  Bc7Endpoint firstQuantized  = quantizeBc7Endpoint(firstEndpoint);
+  Bc7Endpoint secondQuantized = quantizeBc7Endpoint(secondEndpoint);
+  IndexBlock indices {};
+  float error = fitIndices(texels, computeBc7Palette(firstQuantized, secondQuantized), indices);
+
+  for (int iteration = 0; iteration < 2 && error > 0.f; ++iteration) {
+    refineEndpoints(texels, indices, factors, firstEndpoint, secondEndpoint);
+
+    const Bc7Endpoint refinedFirst  = quantizeBc7Endpoint(firstEndpoint);
+    const Bc7Endpoint refinedSecond = quantizeBc7Endpoint(secondEndpoint);
+    IndexBlock refinedIndices {};
+    const float refinedError = fitIndices(texels, computeBc7Palette(refinedFirst, refinedSecond), refinedIndices);
+
+    if (refinedError >= error)
+      break;
+
+    firstQuantized  = refinedFirst;
+    secondQuantized = refinedSecond;
+    indices         = refinedIndices;
+    error           = refinedError;
+  }
+
+  // The first index's highest bit is implicitly 0; the endpoints are swapped otherwise
+  if (indices[0] >= 8) {
+    std::swap(firstQuantized, secondQuantized);
+
+    for (uint8_t& index : indices)
+      index = static_cast<uint8_t>(15 - index);
+  }
+
+  std::fill_n(block, 16, 0);
+  std::size_t bitIndex = 0;
+
+  writeBits(block, bitIndex, 1u << 6u, 7); // Mode 6
+
+  for (std::size_t i = 0; i < 4; ++i) {
+    writeBits(block, bitIndex, firstQuantized.values[i], 7);
+    writeBits(block, bitIndex, secondQuantized.values[i], 7);
+  }
+
+  writeBits(block, bitIndex, firstQuantized.pBit, 1);
+  writeBits(block, bitIndex, secondQuantized.pBit, 1);
+
+  writeBits(block, bitIndex, indices[0], 3);
+  for (std::size_t texelIndex = 1; texelIndex < indices.size(); ++texelIndex)
+    writeBits(block, bitIndex, indices[texelIndex], 4);
+}
+
+void decodeBc7Block(const uint8_t* block, TexelBlock<4>& texels) {
+  if ((block[0] & 127u) != 64u)
+    throw std::invalid_argument("[BlockCompression] Only BC7 blocks encoded with mode 6 can be decompressed");
+
+  std::size_t bitIndex = 7;
+
+  Bc7Endpoint firstEndpoint {};
+  Bc7Endpoint secondEndpoint {};
+
+  for (std::size_t i = 0; i < 4; ++i) {
+    firstEndpoint.values[i]  = static_cast<uint8_t>(readBits(block, bitIndex, 7));
+    secondEndpoint.values[i] = static_cast<uint8_t>(readBits(block, bitIndex, 7));
+  }
+
+  firstEndpoint.pBit  = static_cast<uint8_t>(readBits(block, bitIndex, 1));
+  secondEndpoint.pBit = static_cast<uint8_t>(readBits(block, bitIndex, 1));
+
+  const std::array<Texel<4>, 16> palette = computeBc7Palette(firstEndpoint, secondEndpoint);
+
+  for (std::size_t texelIndex = 0; texelIndex < texels.size(); ++texelIndex)
+    texels[texelIndex] = palette[readBits(block, bitIndex, (texelIndex == 0 ? 3 : 4))];
+}
+
+void encodeBlock(const TexelBlock<4>& texels, BlockCompressionFormat format, uint8_t* block) noexcept {
+  switch (format) {
+    case BlockCompressionFormat::BC1:
+      encodeBc1Block(texels, block);
+      break;
+
+    case BlockCompressionFormat::BC3:
+      encodeBc4Block(texels, 3, block);
+      encodeBc1Block(texels, block + 8);
+      break;
+
+    case BlockCompressionFormat::BC4:
+      encodeBc4Block(texels, 0, block);
+      break;
+
+    case BlockCompressionFormat::BC5:
+      encodeBc4Block(texels, 0, block);
+      encodeBc4Block(texels, 1, block + 8);
+      break;
+
+    case BlockCompressionFormat::BC7:
+      encodeBc7Block(texels, block);
+      break;
+  }
+}
+
+void decodeBlock(const uint8_t* block, BlockCompressionFormat format, TexelBlock<4>& texels) {
+  switch (format) {
+    case BlockCompressionFormat::BC1:
+      decodeBc1Block(block, false, texels);
+      break;
+
+    case BlockCompressionFormat::BC3:
+      decodeBc4Block(block, 3, texels);
+      decodeBc1Block(block + 8, true, texels);
+      break;
+
+    case BlockCompressionFormat::BC4:
+      decodeBc4Block(block, 0, texels);
+      break;
+
+    case BlockCompressionFormat::BC5:
+      decodeBc4Block(block, 0, texels);
+      decodeBc4Block(block + 8, 1, texels);
+      break;
+
+    case BlockCompressionFormat::BC7:
+      decodeBc7Block(block, texels);
+      break;
+  }
+}
+
+std::vector<uint8_t> compressLevel(const Image& image, BlockCompressionFormat format) {
+  ZoneScopedN("[BlockCompression]::compressLevel");
+
+  const std::size_t blockCountX = (image.getWidth() + 3) / 4;
+  const std::size_t blockCountY = (image.getHeight() + 3) / 4;
+  const std::size_t blockSize   = CompressedImage::getBlockSize(format);
+  const bool expandGray         = (format != BlockCompressionFormat::BC4 && format != BlockCompressionFormat::BC5);
+
+  std::vector<uint8_t> data(blockCountX * blockCountY * blockSize);
+
+  Threading::parallelize(0, blockCountY, [&image, format, &data, blockCountX, blockSize, expandGray] (const Threading::IndexRange& range) noexcept {
+    for (std::size_t blockY = range.beginIndex; blockY < range.endIndex; ++blockY) {
+      for (std::size_t blockX = 0; blockX < blockCountX; ++blockX)
+        encodeBlock(fetchBlock(image, blockX, blockY, expandGray), format, data.data() + (blockY * blockCountX + blockX) * blockSize);
+    }
+  });
+
+  return data;
+}
+
+} // namespace
+
+namespace BlockCompression {
+
+CompressedImage compress(const Image& image, BlockCompressionFormat format, bool generateMipmaps) {
+  ZoneScopedN("BlockCompression::compress");
+
+  if (image.isEmpty())
+    throw std::invalid_argument("[BlockCompression] Cannot compress an empty image");
+
+  const bool isSrgbImage = (isSrgb(image.getColorspace()) && format != BlockCompressionFormat::BC4 && format != BlockCompressionFormat::BC5);
+  CompressedImage compressedImage(format, isSrgbImage);
+
+  compressedImage.addLevel(image.getWidth(), image.getHeight(), compressLevel(image, format));
+
+  if (!generateMipmaps)
+    return compressedImage;
+
+  for (const Image& mipmap : ImageUtils::generateMipmaps(image))
+    compressedImage.addLevel(mipmap.getWidth(), mipmap.getHeight(), compressLevel(mipmap, format));
+
+  return compressedImage;
+}
+
+Image decompress(const CompressedImage& image, std::size_t levelIndex) {
+  ZoneScopedN("BlockCompression::decompress");
+
+  if (levelIndex >= image.getLevelCount())
+    throw std::invalid_argument("[BlockCompression] The level to decompress does not exist");
+
+  const CompressedImageLevel& level = image.getLevel(levelIndex);
+
+  ImageColorspace colorspace {};
+  switch (image.getFormat()) {
+    case BlockCompressionFormat::BC1:
+      colorspace = (image.isSrgb() ? ImageColorspace::SRGB : ImageColorspace::RGB);
+      break;
+
+    case BlockCompressionFormat::BC3:
+    case BlockCompressionFormat::BC7:
+      colorspace = (image.isSrgb() ? ImageColorspace::SRGBA : ImageColorspace::RGBA);
+      break;
+
+    case BlockCompressionFormat::BC4:
+      colorspace = ImageColorspace::GRAY;
+      break;
+
+    case BlockCompressionFormat::BC5:
+      colorspace = ImageColorspace::GRAY_ALPHA;
+      break;
+  }
+
+  Image decompressedImage(level.width, level.height, colorspace);
+  auto* imgData = static_cast<uint8_t*>(decompressedImage.getDataPtr());
+
+  const std::size_t blockCountX  = (level.width + 3) / 4;
+  const std::size_t blockSize    = CompressedImage::getBlockSize(image.getFormat());
+  const uint8_t channelCount     = decompressedImage.getChannelCount();
+
+  for (std::size_t blockIndex = 0; blockIndex < level.data.size() / blockSize; ++blockIndex) {
+    TexelBlock<4> texels {};
+    decodeBlock(level.data.data() + blockIndex * blockSize, image.getFormat(), texels);
+
+    const std::size_t blockX = blockIndex % blockCountX;
+    const std::size_t blockY = blockIndex / blockCountX;
+
+    for (std::size_t texelIndex = 0; texelIndex < texels.size(); ++texelIndex) {
+      const std::size_t pixelX = blockX * 4 + texelIndex % 4;
+      const std::size_t pixelY = blockY * 4 + texelIndex / 4;
+
+      if (pixelX >= level.width || pixelY >= level.height)
+        continue;
+
+      const std::size_t valueIndex = (pixelY * level.width + pixelX) * channelCount;
+      for (uint8_t channelIndex = 0; channelIndex < channelCount; ++channelIndex)
+        imgData[valueIndex + channelIndex] = static_cast<uint8_t>(texels[texelIndex][channelIndex]);
+    }
+  }
+
+  return decompressedImage;
+}
+
+} // namespace BlockCompression
+
+} // namespace Raz
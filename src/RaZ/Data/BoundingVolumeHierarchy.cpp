@@ -6,6 +6,8 @@
 
 #include "tracy/Tracy.hpp"
 
+#include <cmath>
+
 namespace Raz {
 
 namespace {
@@ -50,6 +52,20 @@ Entity* BoundingVolumeHierarchyNode::query(const Ray& ray, RayHit* hit) const {
   return (leftEntity != nullptr ? leftEntity : rightEntity);
 }
 
+Entity* BoundingVolumeHierarchyNode::queryClosest(const Vec3f& point, float maxDistance, RayHit* hit) const {
+  // Triangles lying exactly at the maximum distance must be found
+  float closestSquaredDist = (maxDistance < std::sqrt(std::numeric_limits<float>::max()) ? maxDistance * maxDistance : std::numeric_limits<float>::max());
+  closestSquaredDist       = std::nextafter(closestSquaredDist, std::numeric_limits<float>::infinity());
+  RayHit closestHit;
+
+  Entity* closestEntity = findClosest(point, closestSquaredDist, closestHit);
+
+  if (closestEntity != nullptr && hit)
+    *hit = closestHit;
+
+  return closestEntity;
+}
+
 void BoundingVolumeHierarchyNode::build(std::vector<TriangleInfo>& trianglesInfo, std::size_t beginIndex, std::size_t endIndex) {
   // The following call can produce way too many zones, *drastically* increasing the profiling time & memory consumption
   //ZoneScopedN("BoundingVolumeHierarchyNode::build");
@@ -109,6 +125,50 @@ void BoundingVolumeHierarchyNode::build(std::vector<TriangleInfo>& trianglesInfo
   m_rightChild->build(trianglesInfo, midIndex, endIndex);
 }
 
+Entity* BoundingVolumeHierarchyNode::findClosest(const Vec3f& point, float& closestSquaredDist, RayHit& hit) const {
+  // The following call can produce way too many zones, *drastically* increasing the profiling time & memory consumption
+  //ZoneScopedN("BoundingVolumeHierarchyNode::findClosest");
+
+  if (isLeaf()) {
+    if (m_triangleInfo.entity == nullptr)
+      return nullptr; // The BVH is empty
+
+    const Vec3f projectedPoint = m_triangleInfo.triangle.computeProjection(point);
+    const float squaredDist    = (projectedPoint - point).computeSquaredLength();
+
+    if (squaredDist >= closestSquaredDist)
+      return nullptr;
+
+    closestSquaredDist = squaredDist;
+    hit.position       = projectedPoint;
+    hit.normal         = m_triangleInfo.triangle.computeNormal();
+    hit.distance       = std::sqrt(squaredDist);
+
+    return m_triangleInfo.entity;
+  }
+
+  if ((m_boundingBox.computeProjection(point) - point).computeSquaredLength() >= closestSquaredDist)
+    return nullptr;
+
+  // Visiting the closest child first, so that the other one can more likely be skipped
+  const BoundingVolumeHierarchyNode* firstChild  = m_leftChild.get();
+  const BoundingVolumeHierarchyNode* secondChild = m_rightChild.get();
+
+  if (firstChild && secondChild) {
+    const float leftSquaredDist  = (firstChild->m_boundingBox.computeProjection(point) - point).computeSquaredLength();
+    const float rightSquaredDist = (secondChild->m_boundingBox.computeProjection(point) - point).computeSquaredLength();
+
+    if (rightSquaredDist < leftSquaredDist)
+      std::swap(firstChild, secondChild);
+  }
+
+  Entity* firstEntity  = (firstChild != nullptr ? firstChild->findClosest(point, closestSquaredDist, hit) : nullptr);
+  Entity* secondEntity = (secondChild != nullptr ? secondChild->findClosest(point, closestSquaredDist, hit) : nullptr);
+
+  // The second child's entity, if any, is necessarily closer than the first one's
+  return (secondEntity != nullptr ? secondEntity : firstEntity);
+}
+
 void BoundingVolumeHierarchy::build(const std::vector<Entity*>& entities) {
   ZoneScopedN("BoundingVolumeHierarchy::build");
 
@@ -0,0 +1,18 @@
+#include "RaZ/Data/CompressedImage.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+namespace Raz {
+
+void CompressedImage::addLevel(unsigned int width, unsigned int height, std::vector<uint8_t> data) {
+  if (width == 0 || height == 0)
+    throw std::invalid_argument("[CompressedImage] A level's dimensions must be strictly positive");
+
+  if (data.size() != computeLevelSize(m_format, width, height))
+    throw std::invalid_argument("[CompressedImage] A level's data size does not match its dimensions");
+
+  m_levels.push_back(CompressedImageLevel{ width, height, std::move(data) });
+}
+
+} // namespace Raz
@@ -0,0 +1,162 @@
+#include "RaZ/Data/CompressedImage.hpp"
+#include "RaZ/Data/DdsFormat.hpp"
+#include "RaZ/Utils/FilePath.hpp"
+#include "RaZ/Utils/FileUtils.hpp"
+#include "RaZ/Utils/Logger.hpp"
+
+#include "tracy/Tracy.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <string_view>
+
+namespace Raz::DdsFormat {
+
+namespace {
+
+constexpr std::size_t headerSize     = 4 + 124; // Magic number & header
+constexpr std::size_t dx10HeaderSize = 20;
+
+constexpr uint32_t fromLittleEndian(const uint8_t* bytes) {
+  return static_cast<uint32_t>((bytes[0] << 0u) | (bytes[1] << 8u) | (bytes[2] << 16u) | (bytes[3] << 24u));
+}
+
+constexpr bool isFourCC(const uint8_t* bytes, std::string_view code) {
+  return std::equal(code.cbegin(), code.cend(), bytes, [] (char codeChar, uint8_t byte) { return (static_cast<uint8_t>(codeChar) == byte); });
+}
+
+void recoverFormat(uint32_t dxgiFormat, BlockCompressionFormat& format, bool& isSrgb) {
+  isSrgb = false;
+
+  switch (dxgiFormat) {
+    case 72: // DXGI_FORMAT_BC1_UNORM_SRGB
+      isSrgb = true;
+      [[fallthrough]];
+    case 70: // DXGI_FORMAT_BC1_TYPELESS
+    case 71: // DXGI_FORMAT_BC1_UNORM
+      format = BlockCompressionFormat::BC1;
+      break;
+
+    case 78: // DXGI_FORMAT_BC3_UNORM_SRGB
+      isSrgb = true;
+      [[fallthrough]];
+    case 76: // DXGI_FORMAT_BC3_TYPELESS
+    case 77: // DXGI_FORMAT_BC3_UNORM
+      format = BlockCompressionFormat::BC3;
+      break;
+
+    case 79: // DXGI_FORMAT_BC4_TYPELESS
+    case 80: // DXGI_FORMAT_BC4_UNORM
+      format = BlockCompressionFormat::BC4;
+      break;
+
+    case 82: // DXGI_FORMAT_BC5_TYPELESS
+    case 83: // DXGI_FORMAT_BC5_UNORM
+      format = BlockCompressionFormat::BC5;
+      break;
+
+    case 99: // DXGI_FORMAT_BC7_UNORM_SRGB
+      isSrgb = true;
+      [[fallthrough]];
+    case 97: // DXGI_FORMAT_BC7_TYPELESS
+    case 98: // DXGI_FORMAT_BC7_UNORM
+      format = BlockCompressionFormat::BC7;
+      break;
+
+    default:
+      throw std::invalid_argument(std::format("[DdsLoad] Unsupported DXGI format ({})", dxgiFormat));
+  }
+}
+
+} // namespace
+
+CompressedImage load(const FilePath& filePath) {
+  ZoneScopedN("DdsFormat::load");
+  ZoneTextF("Path: %s", filePath.toUtf8().c_str());
+
+  Logger::debug("[DdsLoad] Loading DDS file ('{}')...", filePath);
+
+  const std::vector<unsigned char> bytes = FileUtils::readFileToArray(filePath);
+
+  if (bytes.size() < headerSize || !isFourCC(bytes.data(), "DDS ") || fromLittleEndian(bytes.data() + 4) != 124)
+    throw std::invalid_argument(std::format("[DdsLoad] '{}' is not a valid DDS file", filePath));
+
+  const uint32_t height = fromLittleEndian(bytes.data() + 12);
+  const uint32_t width  = fromLittleEndian(bytes.data() + 16);
+  const uint32_t depth  = fromLittleEndian(bytes.data() + 24);
+  const uint32_t caps2  = fromLittleEndian(bytes.data() + 112);
+
+  if (width == 0 || height == 0)
+    throw std::invalid_argument(std::format("[DdsLoad] '{}' has invalid dimensions ({}x{})", filePath, width, height));
+
+  // Cubemaps & volume textures are flagged in the second capabilities field
+  if (caps2 != 0 || depth > 1)
+    throw std::invalid_argument("[DdsLoad] Only 2D DDS textures are supported");
+
+  // The mipmap chain cannot have more levels than needed to reach a 1x1 one, whatever the file may declare
+  const uint32_t maxMipCount = std::bit_width(std::max(width, height));
+  uint32_t mipCount          = std::max(fromLittleEndian(bytes.data() + 28), 1u);
+
+  if (mipCount > maxMipCount) {
+    Logger::warn("[DdsLoad] '{}' declares {} mipmap levels, while at most {} can exist; the exceeding ones are ignored", filePath, mipCount, maxMipCount);
+    mipCount = maxMipCount;
+  }
+
+  // The pixel format starts at byte 76; its FourCC code is at byte 84
+  const uint8_t* fourCC = bytes.data() + 84;
+
+  if ((fromLittleEndian(bytes.data() + 80) & 4u) == 0) // DDPF_FOURCC
+    throw std::invalid_argument("[DdsLoad] Only block-compressed DDS files are supported");
+
+  BlockCompressionFormat format {};
+  bool isSrgb = false;
+  std::size_t dataOffset = headerSize;
+
+  if (isFourCC(fourCC, "DX10")) {
+    if (bytes.size() < headerSize + dx10HeaderSize)
+      throw std::invalid_argument(std::format("[DdsLoad] '{}' is not a valid DDS file", filePath));
+
+    if (fromLittleEndian(bytes.data() + headerSize + 4) != 3 || fromLittleEndian(bytes.data() + headerSize + 12) > 1) // Texture 2D & array size
+      throw std::invalid_argument("[DdsLoad] Only 2D DDS textures are supported");
+
+    recoverFormat(fromLittleEndian(bytes.data() + headerSize), format, isSrgb);
+    dataOffset += dx10HeaderSize;
+  } else if (isFourCC(fourCC, "DXT1")) {
+    format = BlockCompressionFormat::BC1;
+  } else if (isFourCC(fourCC, "DXT5")) {
+    format = BlockCompressionFormat::BC3;
+  } else if (isFourCC(fourCC, "ATI1") || isFourCC(fourCC, "BC4U")) {
+    format = BlockCompressionFormat::BC4;
+  } else if (isFourCC(fourCC, "ATI2") || isFourCC(fourCC, "BC5U")) {
+    format = BlockCompressionFormat::BC5;
+  } else {
+    throw std::invalid_argument("[DdsLoad] Unsupported DDS compression format");
+  }
+
+  CompressedImage image(format, isSrgb);
+
+  for (uint32_t levelIndex = 0; levelIndex < mipCount; ++levelIndex) {
+    const unsigned int levelWidth  = std::max(width >> levelIndex, 1u);
+    const unsigned int levelHeight = std::max(height >> levelIndex, 1u);
+
+    // The level's size is checked against the remaining data before being computed, as it could overflow with huge dimensions
+    const uint64_t blockCount       = ((static_cast<uint64_t>(levelWidth) + 3) / 4) * ((static_cast<uint64_t>(levelHeight) + 3) / 4);
+    const std::size_t remainingSize = bytes.size() - dataOffset;
+
+    if (blockCount > remainingSize / CompressedImage::getBlockSize(format))
+      throw std::invalid_argument(std::format("[DdsLoad] '{}' is truncated", filePath));
+
+    const auto levelSize = static_cast<std::size_t>(blockCount) * CompressedImage::getBlockSize(format);
+
+    const auto levelBegin = bytes.cbegin() + static_cast<std::ptrdiff_t>(dataOffset);
+    image.addLevel(levelWidth, levelHeight, std::vector<uint8_t>(levelBegin, levelBegin + static_cast<std::ptrdiff_t>(levelSize)));
+
+    dataOffset += levelSize;
+  }
+
+  Logger::debug("[DdsLoad] Loaded DDS file ({}x{}, {} level(s))", width, height, mipCount);
+
+  return image;
+}
+
+} // namespace Raz::DdsFormat
@@ -0,0 +1,103 @@
+#include "RaZ/Data/CompressedImage.hpp"
+#include "RaZ/Data/DdsFormat.hpp"
+#include "RaZ/Utils/FilePath.hpp"
+#include "RaZ/Utils/Logger.hpp"
+
+#include "tracy/Tracy.hpp"
+
+#include <array>
+#include <fstream>
+
+namespace Raz::DdsFormat {
+
+namespace {
+
+constexpr std::array<char, 4> toLittleEndian32(uint32_t val) {
+  return { static_cast<char>(val & 0xFFu), static_cast<char>((val >> 8u) & 0xFFu), static_cast<char>((val >> 16u) & 0xFFu), static_cast<char>(val >> 24u) };
+}
+
+constexpr uint32_t recoverDxgiFormat(BlockCompressionFormat format, bool isSrgb) {
+  switch (format) {
+    case BlockCompressionFormat::BC1: return (isSrgb ? 72 /* DXGI_FORMAT_BC1_UNORM_SRGB */ : 71 /* DXGI_FORMAT_BC1_UNORM */);
+    case BlockCompressionFormat::BC3: return (isSrgb ? 78 /* DXGI_FORMAT_BC3_UNORM_SRGB */ : 77 /* DXGI_FORMAT_BC3_UNORM */);
+    case BlockCompressionFormat::BC4: return 80 /* DXGI_FORMAT_BC4_UNORM */;
+    case BlockCompressionFormat::BC5: return 83 /* DXGI_FORMAT_BC5_UNORM */;
+    case BlockCompressionFormat::BC7: return (isSrgb ? 99 /* DXGI_FORMAT_BC7_UNORM_SRGB */ : 98 /* DXGI_FORMAT_BC7_UNORM */);
+    default: break;
+  }
+
+  throw std::invalid_argument("[DdsSave] Unhandled compression format");
+}
+
+} // namespace
+
+void save(const FilePath& filePath, const CompressedImage& image) {
+  ZoneScopedN("DdsFormat::save");
+  ZoneTextF("Path: %s", filePath.toUtf8().c_str());
+
+  Logger::debug("[DdsSave] Saving DDS file ('{}')...", filePath);
+
+  if (image.isEmpty())
+    throw std::invalid_argument("[DdsSave] Cannot save an empty image");
+
+  std::ofstream file(filePath, std::ios_base::binary);
+
+  if (!file)
+    throw std::invalid_argument(std::format("[DdsSave] Unable to create a DDS file as '{}'; path to file must exist", filePath));
+
+  const auto levelCount = static_cast<uint32_t>(image.getLevelCount());
+
+  ////////////
+  // Header //
+  ////////////
+
+  file << "DDS ";
+  file.write(toLittleEndian32(124).data(), 4); // Header size
+  file.write(toLittleEndian32(0x1u | 0x2u | 0x4u | 0x1000u | 0x20000u | 0x80000u).data(), 4); // Caps, height, width, pixel format, mipmap count & linear size
+  file.write(toLittleEndian32(image.getHeight()).data(), 4);
+  file.write(toLittleEndian32(image.getWidth()).data(), 4);
+  file.write(toLittleEndian32(static_cast<uint32_t>(image.getLevel(0).data.size())).data(), 4); // Linear size
+  file.write(toLittleEndian32(0).data(), 4); // Depth
+  file.write(toLittleEndian32(levelCount).data(), 4);
+
+  for (int i = 0; i < 11; ++i)
+    file.write(toLittleEndian32(0).data(), 4); // Reserved
+
+  //////////////////
+  // Pixel format //
+  //////////////////
+
+  file.write(toLittleEndian32(32).data(), 4); // Pixel format size
+  file.write(toLittleEndian32(0x4u).data(), 4); // FourCC flag
+  file << "DX10";
+
+  for (int i = 0; i < 5; ++i)
+    file.write(toLittleEndian32(0).data(), 4); // Bit count & RGBA masks
+
+  const uint32_t caps = 0x1000u | (levelCount > 1 ? 0x8u | 0x400000u : 0u); // Texture, complex & mipmap
+  file.write(toLittleEndian32(caps).data(), 4);
+
+  for (int i = 0; i < 4; ++i)
+    file.write(toLittleEndian32(0).data(), 4); // Capabilities 2, 3 & 4, reserved
+
+  /////////////////
+  // DX10 header //
+  /////////////////
+
+  file.write(toLittleEndian32(recoverDxgiFormat(image.getFormat(), image.isSrgb())).data(), 4);
+  file.write(toLittleEndian32(3).data(), 4); // Texture 2D
+  file.write(toLittleEndian32(0).data(), 4); // Misc flags
+  file.write(toLittleEndian32(1).data(), 4); // Array size
+  file.write(toLittleEndian32(0).data(), 4); // Alpha mode
+
+  //////////
+  // Data //
+  //////////
+
+  for (const CompressedImageLevel& level : image.getLevels())
+    file.write(reinterpret_cast<const char*>(level.data.data()), static_cast<std::streamsize>(level.data.size()));
+
+  Logger::debug("[DdsSave] Saved DDS file");
+}
+
+} // namespace Raz::DdsFormat
@@ -66,6 +66,20 @@ Image::Image(unsigned int width, unsigned int height, ImageColorspace colorspace
     m_data = ImageDataB::create(imgDataSize);
 }
 
+Image::Image(unsigned int width, unsigned int height, ImageColorspace colorspace, ImageDataPtr data)
+  : Image(colorspace, (data ? data->getDataType() : ImageDataType::BYTE)) {
+  if (data == nullptr)
+    throw std::invalid_argument("[Image] The data to create an image from cannot be null");
+
+  m_width  = width;
+  m_height = height;
+
+  if (data->getSize() != static_cast<std::size_t>(m_width) * m_height * m_channelCount)
+    throw std::invalid_argument("[Image] The data size does not match the image's dimensions");
+
+  m_data = std::move(data);
+}
+
 Image::Image(const Image& img) : m_width{ img.m_width },
                                  m_height{ img.m_height },
                                  m_colorspace{ img.m_colorspace },
@@ -58,17 +58,21 @@ FileFormat recoverFileFormat(const std::string& fileExt) {
   return FileFormat::UNKNOWN;
 }
 
-Image createImageFromData(int width, int height, int channelCount, bool isHdr, const std::unique_ptr<void, ImageDataDeleter>& data) {
-  const std::size_t valueCount = width * height * channelCount;
+Image createImageFromData(int width, int height, int channelCount, bool isHdr, std::unique_ptr<void, ImageDataDeleter>&& data) {
+  const std::size_t valueCount     = static_cast<std::size_t>(width) * height * channelCount;
+  const ImageColorspace colorspace = recoverColorspace(channelCount);
 
-  Image img(width, height, recoverColorspace(channelCount), (isHdr ? ImageDataType::FLOAT : ImageDataType::BYTE));
+  // The decoded memory is directly adopted by the image, avoiding both a second allocation & a full copy
+  ImageDataPtr imgData;
 
   if (isHdr)
-    std::copy_n(static_cast<float*>(data.get()), valueCount, static_cast<float*>(img.getDataPtr()));
+    imgData = ImageDataF::create(static_cast<float*>(data.get()), valueCount, [] (float* ptr) noexcept { stbi_image_free(ptr); });
   else
-    std::copy_n(static_cast<uint8_t*>(data.get()), valueCount, static_cast<uint8_t*>(img.getDataPtr()));
+    imgData = ImageDataB::create(static_cast<uint8_t*>(data.get()), valueCount, [] (uint8_t* ptr) noexcept { stbi_image_free(ptr); });
 
-  return img;
+  static_cast<void>(data.release());
+
+  return Image(static_cast<unsigned int>(width), static_cast<unsigned int>(height), colorspace, std::move(imgData));
 }
 
 } // namespace
@@ -97,7 +101,7 @@ Image load(const FilePath& filePath, bool flipVertically) {
   if (data == nullptr)
     throw std::invalid_argument(std::format("[ImageFormat] Cannot load image '{}': {}", filePath, stbi_failure_reason()));
 
-  Image img = createImageFromData(width, height, channelCount, isHdr, data);
+  Image img = createImageFromData(width, height, channelCount, isHdr, std::move(data));
 
   Logger::debug("[ImageFormat] Loaded image");
 
@@ -105,17 +109,22 @@ Image load(const FilePath& filePath, bool flipVertically) {
 }
 
 Image loadFromData(const std::vector<unsigned char>& imgData, bool flipVertically) {
-  return loadFromData(imgData.data(), imgData.size(), flipVertically);
+  return loadFromData(std::span<const unsigned char>(imgData), flipVertically);
 }
 
 Image loadFromData(const unsigned char* imgData, std::size_t dataSize, bool flipVertically) {
+  return loadFromData(std::span<const unsigned char>(imgData, dataSize), flipVertically);
+}
+
+Image loadFromData(std::span<const unsigned char> imgData, bool flipVertically) {
   ZoneScopedN("ImageFormat::loadFromData");
 
   Logger::debug("[ImageFormat] Loading image from data...");
 
   stbi_set_flip_vertically_on_load(flipVertically);
 
-  const bool isHdr = (stbi_is_hdr_from_memory(imgData, static_cast<int>(dataSize)) != 0);
+  const auto dataSize = static_cast<int>(imgData.size());
+  const bool isHdr    = (stbi_is_hdr_from_memory(imgData.data(), dataSize) != 0);
 
   int width {};
   int height {};
@@ -123,14 +132,14 @@ Image loadFromData(const unsigned char* imgData, std::size_t dataSize, bool flip
   std::unique_ptr<void, ImageDataDeleter> data;
 
   if (isHdr)
-    data.reset(stbi_loadf_from_memory(imgData, static_cast<int>(dataSize), &width, &height, &channelCount, 0));
+    data.reset(stbi_loadf_from_memory(imgData.data(), dataSize, &width, &height, &channelCount, 0));
   else
-    data.reset(stbi_load_from_memory(imgData, static_cast<int>(dataSize), &width, &height, &channelCount, 0));
+    data.reset(stbi_load_from_memory(imgData.data(), dataSize, &width, &height, &channelCount, 0));
 
   if (data == nullptr)
     throw std::invalid_argument(std::format("[ImageFormat] Cannot load image from data: {}", stbi_failure_reason()));
 
-  Image img = createImageFromData(width, height, static_cast<uint8_t>(channelCount), isHdr, data);
+  Image img = createImageFromData(width, height, channelCount, isHdr, std::move(data));
 
   Logger::debug("[ImageFormat] Loaded image from data");
 
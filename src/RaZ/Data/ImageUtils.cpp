@@ -12,6 +12,310 @@
 
 namespace Raz {
 
+namespace {
+
+// Amount of data each tile should hold, so that a tile and its working set fit in the L1/L2 caches
+constexpr std::size_t tileByteSize = 32768;
+// Amount of float values accumulated at once by the vertical resize pass
+constexpr std::size_t tileValueCount = 1024;
+
+/// Processes rows in parallel, grouped in tiles of roughly tileByteSize bytes.
+/// \param rowCount Total number of rows to process.
+/// \param rowByteSize Size in bytes of a single row.
+/// \param action Action to be executed on each tile, taking its begin & past-the-end row indices.
+template <typename FuncT>
+void parallelizeRowTiles(std::size_t rowCount, std::size_t rowByteSize, const FuncT& action) {
+  const std::size_t tileRowCount = std::max(tileByteSize / std::max(rowByteSize, std::size_t(1)), std::size_t(1));
+  const std::size_t tileCount    = (rowCount + tileRowCount - 1) / tileRowCount;
+
+  Threading::parallelize(0, tileCount, [&action, rowCount, tileRowCount] (const Threading::IndexRange& range) noexcept(std::is_nothrow_invocable_v<FuncT, std::size_t, std::size_t>) {
+    for (std::size_t tileIndex = range.beginIndex; tileIndex < range.endIndex; ++tileIndex) {
+      const std::size_t beginRow = tileIndex * tileRowCount;
+      action(beginRow, std::min(beginRow + tileRowCount, rowCount));
+    }
+  });
+}
+
+template <typename T>
+constexpr T convertValue(float value) noexcept {
+  if constexpr (std::is_same_v<T, uint8_t>)
+    return static_cast<uint8_t>(std::clamp(std::round(value), 0.f, 255.f));
+  else
+    return value;
+}
+
+constexpr bool hasAlpha(ImageColorspace colorspace) noexcept {
+  return (colorspace == ImageColorspace::GRAY_ALPHA || colorspace == ImageColorspace::RGBA || colorspace == ImageColorspace::SRGBA);
+}
+
+float computeFilterRadius(ImageUtils::ResizeFilter filter) noexcept {
+  switch (filter) {
+    case ImageUtils::ResizeFilter::BOX:      return 0.5f;
+    case ImageUtils::ResizeFilter::BILINEAR: return 1.f;
+    case ImageUtils::ResizeFilter::LANCZOS:  return 3.f;
+    default: break;
+  }
+
+  return 0.f;
+}
+
+float computeFilterWeight(ImageUtils::ResizeFilter filter, float distance) noexcept {
+  switch (filter) {
+    case ImageUtils::ResizeFilter::BOX:
+      return (distance >= -0.5f && distance < 0.5f ? 1.f : 0.f);
+
+    case ImageUtils::ResizeFilter::BILINEAR:
+      return std::max(1.f - std::abs(distance), 0.f);
+
+    case ImageUtils::ResizeFilter::LANCZOS:
+    {
+      constexpr float lobeCount = 3.f;
+
+      if (distance == 0.f)
+        return 1.f;
+
+      if (std::abs(distance) >= lobeCount)
+        return 0.f;
+
+      const float piDist = std::numbers::pi_v<float> * distance;
+      return lobeCount * std::sin(piDist) * std::sin(piDist / lobeCount) / (piDist * piDist);
+    }
+
+    default:
+      break;
+  }
+
+  return 0.f;
+}
+
+/// Weights to be applied to source values to compute each destination one along a single axis.
+struct FilterWeights {
+  std::vector<std::size_t> firstIndices {}; ///< First source index contributing to each destination index.
+  std::vector<std::size_t> counts {};       ///< Number of source values contributing to each destination index.
+  std::vector<float> weights {};            ///< Normalized weights, maxCount per destination index.
+  std::size_t maxCount {};
+};
+
+FilterWeights computeFilterWeights(std::size_t srcSize, std::size_t dstSize, ImageUtils::ResizeFilter filter) {
+  const float scale       = static_cast<float>(srcSize) / static_cast<float>(dstSize);
+  const float filterScale = std::max(scale, 1.f); // When downscaling, the filter is widened to cover every source pixel
+  const float radius      = computeFilterRadius(filter) * filterScale;
+
+  FilterWeights filterWeights;
+  filterWeights.maxCount = static_cast<std::size_t>(std::ceil(radius * 2.f)) + 2;
+  filterWeights.firstIndices.resize(dstSize);
+  filterWeights.counts.resize(dstSize);
+  filterWeights.weights.resize(dstSize * filterWeights.maxCount);
+
+  for (std::size_t dstIndex = 0; dstIndex < dstSize; ++dstIndex) {
+    const float center = (static_cast<float>(dstIndex) + 0.5f) * scale;
+    const auto firstIndex = static_cast<std::size_t>(std::max(std::floor(center - radius), 0.f));
+    const std::size_t lastIndex = std::min({ static_cast<std::size_t>(std::ceil(center + radius)), srcSize - 1,
+                                             firstIndex + filterWeights.maxCount - 1 });
+
+    float* weights  = filterWeights.weights.data() + dstIndex * filterWeights.maxCount;
+    float weightSum = 0.f;
+
+    for (std::size_t srcIndex = firstIndex; srcIndex <= lastIndex; ++srcIndex) {
+      const float weight = computeFilterWeight(filter, (static_cast<float>(srcIndex) + 0.5f - center) / filterScale);
+      weights[srcIndex - firstIndex] = weight;
+      weightSum += weight;
+    }
+
+    std::size_t count = lastIndex - firstIndex + 1;
+
+    if (weightSum == 0.f) {
+      // Can only happen with a box filter, whose support may fall between samples; taking the nearest one
+      std::fill_n(weights, count, 0.f);
+      weights[std::min(static_cast<std::size_t>(center), srcSize - 1) - firstIndex] = 1.f;
+      weightSum = 1.f;
+    }
+
+    const float invWeightSum = 1.f / weightSum;
+
+    for (std::size_t weightIndex = 0; weightIndex < count; ++weightIndex)
+      weights[weightIndex] *= invWeightSum;
+
+    // Trimming null trailing weights, which would otherwise be needlessly applied
+    while (count > 1 && weights[count - 1] == 0.f)
+      --count;
+
+    filterWeights.firstIndices[dstIndex] = firstIndex;
+    filterWeights.counts[dstIndex]       = count;
+  }
+
+  return filterWeights;
+}
+
+template <typename T>
+void resizeImage(const Image& srcImg, Image& dstImg, ImageUtils::ResizeFilter filter) {
+  const std::size_t channelCount = srcImg.getChannelCount();
+  const std::size_t srcWidth     = srcImg.getWidth();
+  const std::size_t srcHeight    = srcImg.getHeight();
+  const std::size_t dstWidth     = dstImg.getWidth();
+  const std::size_t dstHeight    = dstImg.getHeight();
+  const std::size_t dstRowSize   = dstWidth * channelCount;
+
+  const FilterWeights horizWeights = computeFilterWeights(srcWidth, dstWidth, filter);
+  const FilterWeights vertWeights  = computeFilterWeights(srcHeight, dstHeight, filter);
+
+  const auto* srcData = static_cast<const T*>(srcImg.getDataPtr());
+  auto* dstData       = static_cast<T*>(dstImg.getDataPtr());
+
+  // Horizontal pass, from the source image to an intermediate float buffer having the destination's width & the source's height
+  std::vector<float> horizData(dstRowSize * srcHeight);
+
+  parallelizeRowTiles(srcHeight, srcWidth * channelCount * sizeof(T), [&] (std::size_t beginRow, std::size_t endRow) noexcept {
+    for (std::size_t rowIndex = beginRow; rowIndex < endRow; ++rowIndex) {
+      const T* srcRow = srcData + rowIndex * srcWidth * channelCount;
+      float* horizRow = horizData.data() + rowIndex * dstRowSize;
+
+      for (std::size_t dstIndex = 0; dstIndex < dstWidth; ++dstIndex) {
+        const T* srcValues   = srcRow + horizWeights.firstIndices[dstIndex] * channelCount;
+        const float* weights = horizWeights.weights.data() + dstIndex * horizWeights.maxCount;
+        float* horizValues   = horizRow + dstIndex * channelCount;
+
+        for (std::size_t weightIndex = 0; weightIndex < horizWeights.counts[dstIndex]; ++weightIndex) {
+          for (std::size_t channelIndex = 0; channelIndex < channelCount; ++channelIndex)
+            horizValues[channelIndex] += weights[weightIndex] * static_cast<float>(srcValues[weightIndex * channelCount + channelIndex]);
+        }
+      }
+    }
+  });
+
+  // Vertical pass, accumulating whole contiguous rows at once; each row is split in tiles so that the accumulator remains in cache
+  parallelizeRowTiles(dstHeight, dstRowSize * sizeof(T), [&] (std::size_t beginRow, std::size_t endRow) noexcept {
+    std::array<float, tileValueCount> accumulator {};
+
+    for (std::size_t rowIndex = beginRow; rowIndex < endRow; ++rowIndex) {
+      const std::size_t firstIndex = vertWeights.firstIndices[rowIndex];
+      const std::size_t count      = vertWeights.counts[rowIndex];
+      const float* weights         = vertWeights.weights.data() + rowIndex * vertWeights.maxCount;
+      T* dstRow                    = dstData + rowIndex * dstRowSize;
+
+      for (std::size_t tileBegin = 0; tileBegin < dstRowSize; tileBegin += tileValueCount) {
+        const std::size_t tileSize = std::min(tileValueCount, dstRowSize - tileBegin);
+        std::fill_n(accumulator.begin(), tileSize, 0.f);
+
+        for (std::size_t weightIndex = 0; weightIndex < count; ++weightIndex) {
+          const float weight     = weights[weightIndex];
+          const float* horizTile = horizData.data() + (firstIndex + weightIndex) * dstRowSize + tileBegin;
+
+          for (std::size_t valueIndex = 0; valueIndex < tileSize; ++valueIndex)
+            accumulator[valueIndex] += weight * horizTile[valueIndex];
+        }
+
+        for (std::size_t valueIndex = 0; valueIndex < tileSize; ++valueIndex)
+          dstRow[tileBegin + valueIndex] = convertValue<T>(accumulator[valueIndex]);
+      }
+    }
+  });
+}
+
+template <typename T>
+void addAlphaChannel(const Image& srcImg, Image& dstImg, T alphaValue) {
+  const std::size_t width = srcImg.getWidth();
+  const auto* srcData     = static_cast<const T*>(srcImg.getDataPtr());
+  auto* dstData           = static_cast<T*>(dstImg.getDataPtr());
+
+  parallelizeRowTiles(srcImg.getHeight(), width * 4 * sizeof(T), [&] (std::size_t beginRow, std::size_t endRow) noexcept {
+    for (std::size_t pixelIndex = beginRow * width; pixelIndex < endRow * width; ++pixelIndex) {
+      dstData[pixelIndex * 4]     = srcData[pixelIndex * 3];
+      dstData[pixelIndex * 4 + 1] = srcData[pixelIndex * 3 + 1];
+      dstData[pixelIndex * 4 + 2] = srcData[pixelIndex * 3 + 2];
+      dstData[pixelIndex * 4 + 3] = alphaValue;
+    }
+  });
+}
+
+template <typename T>
+void removeAlphaChannel(const Image& srcImg, Image& dstImg) {
+  const std::size_t width = srcImg.getWidth();
+  const auto* srcData     = static_cast<const T*>(srcImg.getDataPtr());
+  auto* dstData           = static_cast<T*>(dstImg.getDataPtr());
+
+  parallelizeRowTiles(srcImg.getHeight(), width * 4 * sizeof(T), [&] (std::size_t beginRow, std::size_t endRow) noexcept {
+    for (std::size_t pixelIndex = beginRow * width; pixelIndex < endRow * width; ++pixelIndex) {
+      dstData[pixelIndex * 3]     = srcData[pixelIndex * 4];
+      dstData[pixelIndex * 3 + 1] = srcData[pixelIndex * 4 + 1];
+      dstData[pixelIndex * 3 + 2] = srcData[pixelIndex * 4 + 2];
+    }
+  });
+}
+
+template <typename T>
+void swizzleImage(Image& img, const std::array<uint8_t, 4>& channelMapping) {
+  const std::size_t channelCount = img.getChannelCount();
+  const std::size_t rowSize      = img.getWidth() * channelCount;
+  auto* data                     = static_cast<T*>(img.getDataPtr());
+
+  parallelizeRowTiles(img.getHeight(), rowSize * sizeof(T), [&] (std::size_t beginRow, std::size_t endRow) noexcept {
+    T* values = data + beginRow * rowSize;
+
+    for (std::size_t pixelIndex = 0; pixelIndex < (endRow - beginRow) * img.getWidth(); ++pixelIndex, values += channelCount) {
+      std::array<T, 4> pixel {};
+      std::copy_n(values, channelCount, pixel.begin());
+
+      for (std::size_t channelIndex = 0; channelIndex < channelCount; ++channelIndex)
+        values[channelIndex] = pixel[channelMapping[channelIndex]];
+    }
+  });
+}
+
+template <typename T>
+void flipImageHorizontally(Image& img) {
+  const std::size_t width        = img.getWidth();
+  const std::size_t channelCount = img.getChannelCount();
+  const std::size_t rowSize      = width * channelCount;
+  auto* data                     = static_cast<T*>(img.getDataPtr());
+
+  parallelizeRowTiles(img.getHeight(), rowSize * sizeof(T), [&] (std::size_t beginRow, std::size_t endRow) noexcept {
+    for (std::size_t rowIndex = beginRow; rowIndex < endRow; ++rowIndex) {
+      T* row = data + rowIndex * rowSize;
+
+      for (std::size_t widthIndex = 0; widthIndex < width / 2; ++widthIndex)
+        std::swap_ranges(row + widthIndex * channelCount, row + (widthIndex + 1) * channelCount, row + (width - widthIndex - 1) * channelCount);
+    }
+  });
+}
+
+template <typename T>
+void multiplyAlpha(Image& img, bool divide) {
+  const std::size_t channelCount = img.getChannelCount();
+  const std::size_t rowSize      = img.getWidth() * channelCount;
+  const std::size_t alphaIndex   = channelCount - 1;
+  auto* data                     = static_cast<T*>(img.getDataPtr());
+
+  parallelizeRowTiles(img.getHeight(), rowSize * sizeof(T), [&] (std::size_t beginRow, std::size_t endRow) noexcept {
+    for (T* values = data + beginRow * rowSize; values < data + endRow * rowSize; values += channelCount) {
+      float alpha = static_cast<float>(values[alphaIndex]);
+
+      if constexpr (std::is_same_v<T, uint8_t>)
+        alpha /= 255.f;
+
+      if (divide) {
+        if (alpha == 0.f)
+          continue;
+
+        alpha = 1.f / alpha;
+      }
+
+      for (std::size_t channelIndex = 0; channelIndex < alphaIndex; ++channelIndex)
+        values[channelIndex] = convertValue<T>(static_cast<float>(values[channelIndex]) * alpha);
+    }
+  });
+}
+
+float convertSrgbValueToLinear(float value) noexcept {
+  return (value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f));
+}
+
+float convertLinearValueToSrgb(float value) noexcept {
+  return (value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.f / 2.4f) - 0.055f);
+}
+
+} // namespace
+
 std::array<Image, 6> ImageUtils::convertEquirectangularToCubemap(const Image& equirectangularImg) {
   ZoneScopedN("ImageUtils::convertEquirectangularToCubemap");
 
@@ -102,4 +406,248 @@ std::array<Image, 6> ImageUtils::convertEquirectangularToCubemap(const Image& eq
   return faces;
 }
 
+Image ImageUtils::resize(const Image& img, unsigned int width, unsigned int height, ResizeFilter filter) {
+  ZoneScopedN("ImageUtils::resize");
+
+  if (img.isEmpty())
+    throw std::invalid_argument("[ImageUtils] Empty image given to be resized");
+
+  if (width == 0 || height == 0)
+    throw std::invalid_argument("[ImageUtils] The resized image's dimensions must be strictly positive");
+
+  Image resizedImg(width, height, img.getColorspace(), img.getDataType());
+
+  if (img.getDataType() == ImageDataType::FLOAT)
+    resizeImage<float>(img, resizedImg, filter);
+  else
+    resizeImage<uint8_t>(img, resizedImg, filter);
+
+  return resizedImg;
+}
+
+std::vector<Image> ImageUtils::generateMipmaps(const Image& img, ResizeFilter filter) {
+  ZoneScopedN("ImageUtils::generateMipmaps");
+
+  if (img.isEmpty())
+    throw std::invalid_argument("[ImageUtils] Empty image given to generate mipmaps from");
+
+  std::vector<Image> mipmaps;
+  mipmaps.reserve(static_cast<std::size_t>(std::log2(std::max(img.getWidth(), img.getHeight()))));
+
+  const Image* prevLevel = &img;
+
+  while (prevLevel->getWidth() > 1 || prevLevel->getHeight() > 1) {
+    // Each level is computed from the previous one, which is 4 times smaller than the original image
+    Image level = resize(*prevLevel, std::max(prevLevel->getWidth() / 2, 1u), std::max(prevLevel->getHeight() / 2, 1u), filter);
+    mipmaps.emplace_back(std::move(level));
+    prevLevel = &mipmaps.back();
+  }
+
+  return mipmaps;
+}
+
+Image ImageUtils::convertSrgbToLinear(const Image& img) {
+  ZoneScopedN("ImageUtils::convertSrgbToLinear");
+
+  if (img.getColorspace() != ImageColorspace::SRGB && img.getColorspace() != ImageColorspace::SRGBA)
+    throw std::invalid_argument("[ImageUtils] The image to be converted to linear must have an sRGB(A) colorspace");
+
+  const bool isRgba = (img.getColorspace() == ImageColorspace::SRGBA);
+  Image linearImg(img.getWidth(), img.getHeight(), (isRgba ? ImageColorspace::RGBA : ImageColorspace::RGB), ImageDataType::FLOAT);
+
+  if (img.isEmpty())
+    return linearImg;
+
+  const std::size_t channelCount = img.getChannelCount();
+  const std::size_t rowSize      = img.getWidth() * channelCount;
+  auto* dstData                  = static_cast<float*>(linearImg.getDataPtr());
+
+  if (img.getDataType() == ImageDataType::BYTE) {
+    std::array<float, 256> linearValues {};
+    for (std::size_t i = 0; i < linearValues.size(); ++i)
+      linearValues[i] = convertSrgbValueToLinear(static_cast<float>(i) / 255.f);
+
+    const auto* srcData = static_cast<const uint8_t*>(img.getDataPtr());
+
+    parallelizeRowTiles(img.getHeight(), rowSize * sizeof(float), [&] (std::size_t beginRow, std::size_t endRow) noexcept {
+      for (std::size_t valueIndex = beginRow * rowSize; valueIndex < endRow * rowSize; ++valueIndex) {
+        const uint8_t value = srcData[valueIndex];
+        dstData[valueIndex] = (isRgba && valueIndex % channelCount == 3 ? static_cast<float>(value) / 255.f : linearValues[value]);
+      }
+    });
+  } else {
+    const auto* srcData = static_cast<const float*>(img.getDataPtr());
+
+    parallelizeRowTiles(img.getHeight(), rowSize * sizeof(float), [&] (std::size_t beginRow, std::size_t endRow) noexcept {
+      for (std::size_t valueIndex = beginRow * rowSize; valueIndex < endRow * rowSize; ++valueIndex) {
+        const float value   = std::clamp(srcData[valueIndex], 0.f, 1.f);
+        dstData[valueIndex] = (isRgba && valueIndex % channelCount == 3 ? value : convertSrgbValueToLinear(value));
+      }
+    });
+  }
+
+  return linearImg;
+}
+
+Image ImageUtils::convertLinearToSrgb(const Image& img) {
+  ZoneScopedN("ImageUtils::convertLinearToSrgb");
+
+  if (img.getColorspace() != ImageColorspace::RGB && img.getColorspace() != ImageColorspace::RGBA)
+    throw std::invalid_argument("[ImageUtils] The image to be converted to sRGB must have a RGB(A) colorspace");
+
+  const bool isRgba = (img.getColorspace() == ImageColorspace::RGBA);
+  Image srgbImg(img.getWidth(), img.getHeight(), (isRgba ? ImageColorspace::SRGBA : ImageColorspace::SRGB), ImageDataType::BYTE);
+
+  if (img.isEmpty())
+    return srgbImg;
+
+  const std::size_t channelCount = img.getChannelCount();
+  const std::size_t rowSize      = img.getWidth() * channelCount;
+  auto* dstData                  = static_cast<uint8_t*>(srgbImg.getDataPtr());
+
+  if (img.getDataType() == ImageDataType::BYTE) {
+    std::array<uint8_t, 256> srgbValues {};
+    for (std::size_t i = 0; i < srgbValues.size(); ++i)
+      srgbValues[i] = convertValue<uint8_t>(convertLinearValueToSrgb(static_cast<float>(i) / 255.f) * 255.f);
+
+    const auto* srcData = static_cast<const uint8_t*>(img.getDataPtr());
+
+    parallelizeRowTiles(img.getHeight(), rowSize, [&] (std::size_t beginRow, std::size_t endRow) noexcept {
+      for (std::size_t valueIndex = beginRow * rowSize; valueIndex < endRow * rowSize; ++valueIndex) {
+        const uint8_t value = srcData[valueIndex];
+        dstData[valueIndex] = (isRgba && valueIndex % channelCount == 3 ? value : srgbValues[value]);
+      }
+    });
+  } else {
+    const auto* srcData = static_cast<const float*>(img.getDataPtr());
+
+    parallelizeRowTiles(img.getHeight(), rowSize * sizeof(float), [&] (std::size_t beginRow, std::size_t endRow) noexcept {
+      for (std::size_t valueIndex = beginRow * rowSize; valueIndex < endRow * rowSize; ++valueIndex) {
+        const float value   = std::clamp(srcData[valueIndex], 0.f, 1.f);
+        dstData[valueIndex] = convertValue<uint8_t>((isRgba && valueIndex % channelCount == 3 ? value : convertLinearValueToSrgb(value)) * 255.f);
+      }
+    });
+  }
+
+  return srgbImg;
+}
+
+Image ImageUtils::convertRgbToRgba(const Image& img, float alphaValue) {
+  ZoneScopedN("ImageUtils::convertRgbToRgba");
+
+  if (img.getColorspace() != ImageColorspace::RGB && img.getColorspace() != ImageColorspace::SRGB)
+    throw std::invalid_argument("[ImageUtils] The image to add an alpha channel to must have a RGB or sRGB colorspace");
+
+  const ImageColorspace colorspace = (img.getColorspace() == ImageColorspace::SRGB ? ImageColorspace::SRGBA : ImageColorspace::RGBA);
+  Image rgbaImg(img.getWidth(), img.getHeight(), colorspace, img.getDataType());
+
+  if (img.isEmpty())
+    return rgbaImg;
+
+  if (img.getDataType() == ImageDataType::FLOAT)
+    addAlphaChannel<float>(img, rgbaImg, alphaValue);
+  else
+    addAlphaChannel<uint8_t>(img, rgbaImg, convertValue<uint8_t>(alphaValue * 255.f));
+
+  return rgbaImg;
+}
+
+Image ImageUtils::convertRgbaToRgb(const Image& img) {
+  ZoneScopedN("ImageUtils::convertRgbaToRgb");
+
+  if (img.getColorspace() != ImageColorspace::RGBA && img.getColorspace() != ImageColorspace::SRGBA)
+    throw std::invalid_argument("[ImageUtils] The image to remove the alpha channel from must have a RGBA or sRGBA colorspace");
+
+  const ImageColorspace colorspace = (img.getColorspace() == ImageColorspace::SRGBA ? ImageColorspace::SRGB : ImageColorspace::RGB);
+  Image rgbImg(img.getWidth(), img.getHeight(), colorspace, img.getDataType());
+
+  if (img.isEmpty())
+    return rgbImg;
+
+  if (img.getDataType() == ImageDataType::FLOAT)
+    removeAlphaChannel<float>(img, rgbImg);
+  else
+    removeAlphaChannel<uint8_t>(img, rgbImg);
+
+  return rgbImg;
+}
+
+void ImageUtils::swizzleChannels(Image& img, const std::array<uint8_t, 4>& channelMapping) {
+  ZoneScopedN("ImageUtils::swizzleChannels");
+
+  for (uint8_t channelIndex = 0; channelIndex < img.getChannelCount(); ++channelIndex) {
+    if (channelMapping[channelIndex] >= img.getChannelCount())
+      throw std::invalid_argument("[ImageUtils] The channel mapping references a channel the image does not have");
+  }
+
+  if (img.isEmpty())
+    return;
+
+  if (img.getDataType() == ImageDataType::FLOAT)
+    swizzleImage<float>(img, channelMapping);
+  else
+    swizzleImage<uint8_t>(img, channelMapping);
+}
+
+void ImageUtils::flipHorizontally(Image& img) {
+  ZoneScopedN("ImageUtils::flipHorizontally");
+
+  if (img.isEmpty())
+    return;
+
+  if (img.getDataType() == ImageDataType::FLOAT)
+    flipImageHorizontally<float>(img);
+  else
+    flipImageHorizontally<uint8_t>(img);
+}
+
+void ImageUtils::flipVertically(Image& img) {
+  ZoneScopedN("ImageUtils::flipVertically");
+
+  if (img.isEmpty())
+    return;
+
+  const std::size_t rowByteSize = img.getWidth() * img.getChannelCount() * (img.getDataType() == ImageDataType::FLOAT ? sizeof(float) : sizeof(uint8_t));
+  const std::size_t height      = img.getHeight();
+  auto* data                    = static_cast<uint8_t*>(img.getDataPtr());
+
+  // Only the upper half is iterated over, each row being swapped with its counterpart in the lower half
+  parallelizeRowTiles(std::max(height / 2, std::size_t(1)), rowByteSize * 2, [&] (std::size_t beginRow, std::size_t endRow) noexcept {
+    for (std::size_t rowIndex = beginRow; rowIndex < std::min(endRow, height / 2); ++rowIndex) {
+      uint8_t* row = data + rowIndex * rowByteSize;
+      std::swap_ranges(row, row + rowByteSize, data + (height - rowIndex - 1) * rowByteSize);
+    }
+  });
+}
+
+void ImageUtils::premultiplyAlpha(Image& img) {
+  ZoneScopedN("ImageUtils::premultiplyAlpha");
+
+  if (!hasAlpha(img.getColorspace()))
+    throw std::invalid_argument("[ImageUtils] The image to be premultiplied must have an alpha channel");
+
+  if (img.isEmpty())
+    return;
+
+  if (img.getDataType() == ImageDataType::FLOAT)
+    multiplyAlpha<float>(img, false);
+  else
+    multiplyAlpha<uint8_t>(img, false);
+}
+
+void ImageUtils::unpremultiplyAlpha(Image& img) {
+  ZoneScopedN("ImageUtils::unpremultiplyAlpha");
+
+  if (!hasAlpha(img.getColorspace()))
+    throw std::invalid_argument("[ImageUtils] The image to be unpremultiplied must have an alpha channel");
+
+  if (img.isEmpty())
+    return;
+
+  if (img.getDataType() == ImageDataType::FLOAT)
+    multiplyAlpha<float>(img, true);
+  else
+    multiplyAlpha<uint8_t>(img, true);
+}
+
 } // namespace Raz
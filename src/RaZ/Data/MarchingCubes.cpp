@@ -1,11 +1,18 @@
 #include "RaZ/Data/Grid3.hpp"
 #include "RaZ/Data/MarchingCubes.hpp"
 #include "RaZ/Data/Mesh.hpp"
+#include "RaZ/Data/SparseGrid3.hpp"
+#include "RaZ/Math/MathUtils.hpp"
 #include "RaZ/Utils/Threading.hpp"
 
 #include "tracy/Tracy.hpp"
 
+#include <algorithm>
+#include <limits>
 #include <numeric>
+#include <ranges>
+#include <set>
+#include <unordered_map>
 
 namespace Raz {
 
@@ -303,7 +310,8 @@ constexpr std::array<std::array<int8_t, 15>, 256> trianglesIndices = {{
   { NONE, NONE, NONE, NONE, NONE, NONE, NONE, NONE, NONE, NONE, NONE, NONE, NONE, NONE, NONE }
 }};
 
-uint8_t computeCellConfiguration(const Grid3b& grid, std::size_t widthIndex, std::size_t heightIndex, std::size_t depthIndex) {
+template <typename GridT>
+uint8_t computeCellConfiguration(const GridT& grid, std::size_t widthIndex, std::size_t heightIndex, std::size_t depthIndex) {
   // TODO: the following configuration feels more logical, matches the marching squares', and should ideally be used in the future
 
   // Computing a single number according to the corners' values:
@@ -349,6 +357,410 @@ uint8_t computeCellConfiguration(const Grid3b& grid, std::size_t widthIndex, std
        | static_cast<uint8_t>(grid.getValue(widthIndex,     heightIndex + 1, depthIndex    ) << 7u); // Top-left front
 }
 
+/// Values of a chunk of a sparse grid & of the first layer of its upper neighbors, which are needed to compute all its cells.
+class ChunkValues {
+public:
+  ChunkValues(const SparseGrid3b& grid, std::size_t chunkIndex) {
+    const std::size_t chunkSize = grid.getChunkSize();
+    const std::array<std::size_t, 3> chunkCoords = grid.recoverChunkCoordinates(chunkIndex);
+    const std::array<std::size_t, 3> gridSize    = { grid.getWidth(), grid.getHeight(), grid.getDepth() };
+
+    for (std::size_t i = 0; i < 3; ++i) {
+      m_begin[i] = chunkCoords[i] * chunkSize;
+      // The chunk's cells span from its first value to the first one of the next chunk, which is the last cell's upper corner
+      m_size[i] = (m_begin[i] + 1 < gridSize[i] ? std::min(chunkSize + 1, gridSize[i] - m_begin[i]) : 0);
+    }
+
+    if (m_size[0] == 0 || m_size[1] == 0 || m_size[2] == 0)
+      return; // The chunk is on the grid's upper border & holds no cell
+
+    m_values.resize(m_size[0] * m_size[1] * m_size[2], grid.getDefaultValue());
+
+    bool hasTrueValue  = false;
+    bool hasFalseValue = false;
+    std::size_t copiedValueCount = 0;
+
+    // Copying the values from the chunk & its upper neighbors, if allocated
+    for (std::size_t neighborZ = 0; neighborZ < 2; ++neighborZ) {
+      for (std::size_t neighborY = 0; neighborY < 2; ++neighborY) {
+        for (std::size_t neighborX = 0; neighborX < 2; ++neighborX) {
+          const std::array<std::size_t, 3> neighborBegin = { m_begin[0] + neighborX * chunkSize,
+                                                             m_begin[1] + neighborY * chunkSize,
+                                                             m_begin[2] + neighborZ * chunkSize };
+
+          if (neighborBegin[0] >= m_begin[0] + m_size[0] || neighborBegin[1] >= m_begin[1] + m_size[1] || neighborBegin[2] >= m_begin[2] + m_size[2])
+            continue;
+
+          const SparseGrid3b::Chunk* chunk = grid.findChunk(grid.computeChunkIndex(neighborBegin[0], neighborBegin[1], neighborBegin[2]));
+
+          if (chunk == nullptr)
+            continue;
+
+          const std::size_t endX = std::min(neighborBegin[0] + chunkSize, m_begin[0] + m_size[0]);
+          const std::size_t endY = std::min(neighborBegin[1] + chunkSize, m_begin[1] + m_size[1]);
+          const std::size_t endZ = std::min(neighborBegin[2] + chunkSize, m_begin[2] + m_size[2]);
+
+          for (std::size_t depthIndex = neighborBegin[2]; depthIndex < endZ; ++depthIndex) {
+            for (std::size_t heightIndex = neighborBegin[1]; heightIndex < endY; ++heightIndex) {
+              for (std::size_t widthIndex = neighborBegin[0]; widthIndex < endX; ++widthIndex) {
+                const bool value = (*chunk)[((depthIndex - neighborBegin[2]) * chunkSize + heightIndex - neighborBegin[1]) * chunkSize + widthIndex - neighborBegin[0]];
+                m_values[computeIndex(widthIndex - m_begin[0], heightIndex - m_begin[1], depthIndex - m_begin[2])] = value;
+
+                hasTrueValue  |= value;
+                hasFalseValue |= !value;
+                ++copiedValueCount;
+              }
+            }
+          }
+        }
+      }
+    }
+
+    // Values which have not been copied are the default one
+    if (copiedValueCount < m_values.size()) {
+      hasTrueValue  |= grid.getDefaultValue();
+      hasFalseValue |= !grid.getDefaultValue();
+    }
+
+    m_isUniform = !(hasTrueValue && hasFalseValue);
+  }
+
+  const std::array<std::size_t, 3>& getBegin() const noexcept { return m_begin; }
+  const std::array<std::size_t, 3>& getSize() const noexcept { return m_size; }
+  /// Checks if the chunk can produce no triangle, either because it holds no cell or because all its values are identical.
+  /// \return True if the chunk would produce an empty mesh, false otherwise.
+  bool isEmpty() const noexcept { return (m_values.empty() || m_isUniform); }
+
+  bool getValue(std::size_t widthIndex, std::size_t heightIndex, std::size_t depthIndex) const noexcept {
+    return m_values[computeIndex(widthIndex, heightIndex, depthIndex)];
+  }
+
+private:
+  std::size_t computeIndex(std::size_t widthIndex, std::size_t heightIndex, std::size_t depthIndex) const noexcept {
+    return (depthIndex * m_size[1] + heightIndex) * m_size[0] + widthIndex;
+  }
+
+  std::array<std::size_t, 3> m_begin {};
+  std::array<std::size_t, 3> m_size {};
+  std::vector<uint8_t> m_values {};
+  bool m_isUniform = true;
+};
+
+MarchingCubes::IncrementalMesher::ChunkMesh computeChunkMesh(const SparseGrid3b& grid, std::size_t chunkIndex) {
+  ZoneScopedN("[MarchingCubes]::computeChunkMesh");
+
+  MarchingCubes::IncrementalMesher::ChunkMesh chunkMesh;
+
+  const ChunkValues chunkValues(grid, chunkIndex);
+
+  if (chunkValues.isEmpty())
+    return chunkMesh;
+
+  const Vec3f globalOffset(static_cast<float>(grid.getWidth() - 1) * 0.5f,
+                           static_cast<float>(grid.getHeight() - 1) * 0.5f,
+                           static_cast<float>(grid.getDepth() - 1) * 0.5f);
+
+  const std::array<std::size_t, 3>& begin = chunkValues.getBegin();
+  const std::array<std::size_t, 3>& size  = chunkValues.getSize();
+
+  // Vertices lying on the same grid edge are shared; their key is computed from the edge's lower point & direction
+  std::unordered_map<uint64_t, unsigned int> vertexIndices;
+
+  for (std::size_t depthIndex = 0; depthIndex < size[2] - 1; ++depthIndex) {
+    for (std::size_t heightIndex = 0; heightIndex < size[1] - 1; ++heightIndex) {
+      for (std::size_t widthIndex = 0; widthIndex < size[0] - 1; ++widthIndex) {
+        const std::array<int8_t, 15>& edgeIndices = trianglesIndices[computeCellConfiguration(chunkValues, widthIndex, heightIndex, depthIndex)];
+
+        if (edgeIndices.front() == NONE)
+          continue;
+
+        const std::array<std::size_t, 3> cellCoords = { begin[0] + widthIndex, begin[1] + heightIndex, begin[2] + depthIndex };
+        const Vec3f localOffset(static_cast<float>(cellCoords[0]), static_cast<float>(cellCoords[1]), static_cast<float>(cellCoords[2]));
+
+        for (const int8_t edgeIndex : edgeIndices) {
+          if (edgeIndex == NONE)
+            break;
+
+          const Vec3f& edgeVertex = edgeVertices[edgeIndex];
+
+          uint64_t edgeAxis = 0;
+          std::array<std::size_t, 3> edgeCoords = cellCoords;
+
+          for (std::size_t i = 0; i < 3; ++i) {
+            if (edgeVertex[i] == 0.5f)
+              edgeAxis = i;
+            else if (edgeVertex[i] == 1.f)
+              ++edgeCoords[i];
+          }
+
+          const uint64_t edgeKey = ((edgeCoords[2] * grid.getHeight() + edgeCoords[1]) * grid.getWidth() + edgeCoords[0]) * 3 + edgeAxis;
+          const auto [vertexIt, isNewVertex] = vertexIndices.try_emplace(edgeKey, static_cast<unsigned int>(chunkMesh.positions.size()));
+
+          if (isNewVertex) {
+            chunkMesh.positions.emplace_back(edgeVertex - globalOffset + localOffset);
+            chunkMesh.edgeKeys.emplace_back(edgeKey);
+          }
+
+          chunkMesh.indices.emplace_back(vertexIt->second);
+        }
+      }
+    }
+  }
+
+  return chunkMesh;
+}
+
+std::vector<MarchingCubes::IncrementalMesher::ChunkMesh> computeChunkMeshes(const SparseGrid3b& grid, const std::vector<std::size_t>& chunkIndices) {
+  ZoneScopedN("[MarchingCubes]::computeChunkMeshes");
+
+  std::vector<MarchingCubes::IncrementalMesher::ChunkMesh> chunkMeshes(chunkIndices.size());
+
+  if (chunkIndices.empty())
+    return chunkMeshes;
+
+  Threading::parallelize(0, chunkIndices.size(), [&grid, &chunkIndices, &chunkMeshes] (const Threading::IndexRange& range) {
+    for (std::size_t i = range.beginIndex; i < range.endIndex; ++i)
+      chunkMeshes[i] = computeChunkMesh(grid, chunkIndices[i]);
+  });
+
+  return chunkMeshes;
+}
+
+/// Recovers the chunks whose cells depend on the given one's values: the chunk itself & its lower neighbors.
+template <typename FuncT>
+void forEachDependentChunk(const SparseGrid3b& grid, std::size_t chunkIndex, const FuncT& action) {
+  const std::array<std::size_t, 3> chunkCoords = grid.recoverChunkCoordinates(chunkIndex);
+
+  for (std::size_t offsetZ = 0; offsetZ <= std::min(chunkCoords[2], std::size_t(1)); ++offsetZ) {
+    for (std::size_t offsetY = 0; offsetY <= std::min(chunkCoords[1], std::size_t(1)); ++offsetY) {
+      for (std::size_t offsetX = 0; offsetX <= std::min(chunkCoords[0], std::size_t(1)); ++offsetX)
+        action(((chunkCoords[2] - offsetZ) * grid.getChunkCountY() + chunkCoords[1] - offsetY) * grid.getChunkCountX() + chunkCoords[0] - offsetX);
+    }
+  }
+}
+
+/// Builds a mesh from several chunk meshes, merging the vertices lying on the same edge & averaging their normals.
+template <typename ChunkMeshRangeT>
+Mesh buildWeldedMesh(const ChunkMeshRangeT& chunkMeshes) {
+  ZoneScopedN("[MarchingCubes]::buildWeldedMesh");
+
+  Mesh mesh;
+  Submesh& submesh = mesh.addSubmesh();
+  std::vector<Vertex>& vertices      = submesh.getVertices();
+  std::vector<unsigned int>& indices = submesh.getTriangleIndices();
+
+  std::unordered_map<uint64_t, unsigned int> vertexIndices;
+  std::vector<unsigned int> chunkToMeshIndices;
+
+  for (const MarchingCubes::IncrementalMesher::ChunkMesh& chunkMesh : chunkMeshes) {
+    chunkToMeshIndices.resize(chunkMesh.positions.size());
+
+    for (std::size_t vertexIndex = 0; vertexIndex < chunkMesh.positions.size(); ++vertexIndex) {
+      const auto [vertexIt, isNewVertex] = vertexIndices.try_emplace(chunkMesh.edgeKeys[vertexIndex], static_cast<unsigned int>(vertices.size()));
+
+      if (isNewVertex)
+        vertices.emplace_back(Vertex{ chunkMesh.positions[vertexIndex], Vec2f(), Vec3f(0.f) });
+
+      chunkToMeshIndices[vertexIndex] = vertexIt->second;
+    }
+
+    for (const unsigned int index : chunkMesh.indices)
+      indices.emplace_back(chunkToMeshIndices[index]);
+  }
+
+  for (std::size_t triangleIndex = 0; triangleIndex < indices.size(); triangleIndex += 3) {
+    Vertex& firstVert  = vertices[indices[triangleIndex]];
+    Vertex& secondVert = vertices[indices[triangleIndex + 1]];
+    Vertex& thirdVert  = vertices[indices[triangleIndex + 2]];
+
+    // The normals are weighted by the triangles' areas
+    const Vec3f normal = (secondVert.position - firstVert.position).cross(thirdVert.position - firstVert.position);
+    firstVert.normal  += normal;
+    secondVert.normal += normal;
+    thirdVert.normal  += normal;
+  }
+
+  for (Vertex& vertex : vertices)
+    vertex.normal = vertex.normal.normalize();
+
+  return mesh;
+}
+
+void checkGridSize(const SparseGrid3b& grid) {
+  if (grid.getWidth() < 2 || grid.getHeight() < 2 || grid.getDepth() < 2)
+    throw std::invalid_argument("[MarchingCubes] The input grid's width, height & depth must be at least 2.");
+}
+
+constexpr unsigned int invalidVertexIndex = std::numeric_limits<unsigned int>::max();
+
+/// Boolean view of a scalar grid, whose points are considered set when their value is lower than the iso-level.
+class IsoGrid {
+public:
+  IsoGrid(const Grid3f& grid, float isoLevel) noexcept : m_grid{ grid }, m_isoLevel{ isoLevel } {}
+
+  bool getValue(std::size_t widthIndex, std::size_t heightIndex, std::size_t depthIndex) const noexcept {
+    return (m_grid.getValue(widthIndex, heightIndex, depthIndex) < m_isoLevel);
+  }
+
+private:
+  const Grid3f& m_grid;
+  float m_isoLevel {};
+};
+
+/// Indexed mesh computed from consecutive layers of cells of a scalar grid.
+struct SlabMesh {
+  std::vector<Vertex> vertices {};
+  std::vector<unsigned int> indices {};
+  /// Indices of the vertices lying on the X & Y edges of the slab's first & last planes, from which adjacent slabs are welded.
+  std::vector<unsigned int> firstPlaneIndices {};
+  std::vector<unsigned int> lastPlaneIndices {};
+};
+
+Vec3f computeGradient(const Grid3f& grid, const std::array<std::size_t, 3>& coords) {
+  const std::array<std::size_t, 3> gridSize = { grid.getWidth(), grid.getHeight(), grid.getDepth() };
+  Vec3f gradient;
+
+  // Central differences are used inside the grid, & one-sided ones on its borders
+  for (std::size_t i = 0; i < 3; ++i) {
+    std::array<std::size_t, 3> lowerCoords = coords;
+    std::array<std::size_t, 3> upperCoords = coords;
+
+    if (lowerCoords[i] > 0)
+      --lowerCoords[i];
+
+    if (upperCoords[i] + 1 < gridSize[i])
+      ++upperCoords[i];
+
+    gradient[i] = (grid.getValue(upperCoords[0], upperCoords[1], upperCoords[2]) - grid.getValue(lowerCoords[0], lowerCoords[1], lowerCoords[2]))
+                / static_cast<float>(upperCoords[i] - lowerCoords[i]);
+  }
+
+  return gradient;
+}
+
+Vertex computeEdgeVertex(const Grid3f& grid, float isoLevel, const std::array<std::size_t, 3>& edgeCoords, std::size_t edgeAxis, const Vec3f& globalOffset) {
+  std::array<std::size_t, 3> upperCoords = edgeCoords;
+  ++upperCoords[edgeAxis];
+
+  const float lowerValue = grid.getValue(edgeCoords[0], edgeCoords[1], edgeCoords[2]);
+  const float valueDiff  = grid.getValue(upperCoords[0], upperCoords[1], upperCoords[2]) - lowerValue;
+  const float coeff      = (std::abs(valueDiff) > std::numeric_limits<float>::epsilon() ? std::clamp((isoLevel - lowerValue) / valueDiff, 0.f, 1.f) : 0.5f);
+
+  Vec3f position(static_cast<float>(edgeCoords[0]), static_cast<float>(edgeCoords[1]), static_cast<float>(edgeCoords[2]));
+  position[edgeAxis] += coeff;
+
+  const Vec3f normal = MathUtils::lerp(computeGradient(grid, edgeCoords), computeGradient(grid, upperCoords), coeff).normalize();
+
+  return Vertex{ position - globalOffset, Vec2f(), normal };
+}
+
+/// Computes the mesh of the cells in the given depth range. The vertices are shared through caches holding the indices of those lying on the edges of the
+/// cells' lower & upper planes & in between; the upper plane's cache becomes the lower one for the next layer.
+SlabMesh computeSlabMesh(const Grid3f& grid, float isoLevel, const Vec3f& globalOffset, std::size_t beginDepthIndex, std::size_t endDepthIndex) {
+  ZoneScopedN("[MarchingCubes]::computeSlabMesh");
+
+  const IsoGrid isoGrid(grid, isoLevel);
+  const std::size_t width  = grid.getWidth();
+  const std::size_t height = grid.getHeight();
+
+  SlabMesh slabMesh;
+
+  std::vector<unsigned int> lowerPlaneIndices(width * height * 2, invalidVertexIndex);
+  std::vector<unsigned int> upperPlaneIndices(width * height * 2);
+  std::vector<unsigned int> depthEdgeIndices(width * height);
+
+  for (std::size_t depthIndex = beginDepthIndex; depthIndex < endDepthIndex; ++depthIndex) {
+    std::fill(upperPlaneIndices.begin(), upperPlaneIndices.end(), invalidVertexIndex);
+    std::fill(depthEdgeIndices.begin(), depthEdgeIndices.end(), invalidVertexIndex);
+
+    for (std::size_t heightIndex = 0; heightIndex < height - 1; ++heightIndex) {
+      for (std::size_t widthIndex = 0; widthIndex < width - 1; ++widthIndex) {
+        const std::array<int8_t, 15>& edgeIndices = trianglesIndices[computeCellConfiguration(isoGrid, widthIndex, heightIndex, depthIndex)];
+
+        if (edgeIndices.front() == NONE)
+          continue;
+
+        for (std::size_t triangleIndex = 0; triangleIndex < edgeIndices.size(); triangleIndex += 3) {
+          if (edgeIndices[triangleIndex] == NONE)
+            break;
+
+          // The edge vertices' depth being mirrored (see the TODO above them), the triangles' winding is reversed so that they face increasing values
+          for (const std::size_t vertexOffset : { 0, 2, 1 }) {
+            const Vec3f& edgeVertex = edgeVertices[edgeIndices[triangleIndex + vertexOffset]];
+
+            std::size_t edgeAxis = 0;
+            std::array<std::size_t, 3> edgeCoords = { widthIndex, heightIndex, depthIndex };
+
+            for (std::size_t i = 0; i < 3; ++i) {
+              if (edgeVertex[i] == 0.5f)
+                edgeAxis = i;
+              else if (edgeVertex[i] == 1.f)
+                ++edgeCoords[i];
+            }
+
+            const std::size_t planeIndex = edgeCoords[1] * width + edgeCoords[0];
+            unsigned int& vertexIndex = (edgeAxis == 2 ? depthEdgeIndices[planeIndex]
+                                                       : (edgeCoords[2] == depthIndex ? lowerPlaneIndices : upperPlaneIndices)[planeIndex * 2 + edgeAxis]);
+
+            if (vertexIndex == invalidVertexIndex) {
+              vertexIndex = static_cast<unsigned int>(slabMesh.vertices.size());
+              slabMesh.vertices.emplace_back(computeEdgeVertex(grid, isoLevel, edgeCoords, edgeAxis, globalOffset));
+            }
+
+            slabMesh.indices.emplace_back(vertexIndex);
+          }
+        }
+      }
+    }
+
+    if (depthIndex == beginDepthIndex)
+      slabMesh.firstPlaneIndices = lowerPlaneIndices;
+
+    std::swap(lowerPlaneIndices, upperPlaneIndices);
+  }
+
+  slabMesh.lastPlaneIndices = std::move(lowerPlaneIndices);
+
+  return slabMesh;
+}
+
+/// Appends a slab's mesh to the one of the slab right before it, merging the vertices lying on the plane they share.
+SlabMesh mergeSlabMeshes(SlabMesh&& result, SlabMesh&& slabMesh) {
+  ZoneScopedN("[MarchingCubes]::mergeSlabMeshes");
+
+  std::vector<unsigned int> slabToResultIndices(slabMesh.vertices.size(), invalidVertexIndex);
+
+  for (std::size_t planeIndex = 0; planeIndex < slabMesh.firstPlaneIndices.size(); ++planeIndex) {
+    const unsigned int slabIndex = slabMesh.firstPlaneIndices[planeIndex];
+
+    if (slabIndex != invalidVertexIndex)
+      slabToResultIndices[slabIndex] = result.lastPlaneIndices[planeIndex];
+  }
+
+  result.vertices.reserve(result.vertices.size() + slabMesh.vertices.size());
+
+  for (std::size_t vertexIndex = 0; vertexIndex < slabMesh.vertices.size(); ++vertexIndex) {
+    if (slabToResultIndices[vertexIndex] != invalidVertexIndex)
+      continue;
+
+    slabToResultIndices[vertexIndex] = static_cast<unsigned int>(result.vertices.size());
+    result.vertices.emplace_back(std::move(slabMesh.vertices[vertexIndex]));
+  }
+
+  result.indices.reserve(result.indices.size() + slabMesh.indices.size());
+  for (const unsigned int index : slabMesh.indices)
+    result.indices.emplace_back(slabToResultIndices[index]);
+
+  for (unsigned int& index : slabMesh.lastPlaneIndices) {
+    if (index != invalidVertexIndex)
+      index = slabToResultIndices[index];
+  }
+
+  result.lastPlaneIndices = std::move(slabMesh.lastPlaneIndices);
+
+  return std::move(result);
+}
+
 } // namespace
 
 Mesh MarchingCubes::compute(const Grid3b& grid) {
@@ -395,9 +807,9 @@ Mesh MarchingCubes::compute(const Grid3b& grid) {
     }
 
     return vertices;
-  }, [] (std::vector<Vertex>&& result, const std::vector<Vertex>& vertices) {
+  }, [] (std::vector<Vertex>&& result, std::vector<Vertex>&& vertices) {
     ZoneScopedN("Reduce");
-    result.insert(result.end(), vertices.begin(), vertices.end());
+    result.insert(result.end(), std::make_move_iterator(vertices.begin()), std::make_move_iterator(vertices.end()));
     return std::move(result);
   });
 
@@ -408,4 +820,70 @@ Mesh MarchingCubes::compute(const Grid3b& grid) {
   return mesh;
 }
 
+Mesh MarchingCubes::compute(const Grid3f& grid, float isoLevel) {
+  ZoneScopedN("MarchingCubes::compute(Grid3f)");
+
+  if (grid.getWidth() < 2 || grid.getHeight() < 2 || grid.getDepth() < 2)
+    throw std::invalid_argument("[MarchingCubes] The input grid's width, height & depth must be at least 2.");
+
+  const Vec3f globalOffset(static_cast<float>(grid.getWidth() - 1) * 0.5f,
+                           static_cast<float>(grid.getHeight() - 1) * 0.5f,
+                           static_cast<float>(grid.getDepth() - 1) * 0.5f);
+
+  // Each task meshes contiguous layers of cells; the tasks being reduced in order, each slab is welded to the previous one
+  SlabMesh slabMesh = Threading::parallelizeReduce(0, grid.getDepth() - 1, [&grid, isoLevel, globalOffset] (const Threading::IndexRange& range) {
+    return computeSlabMesh(grid, isoLevel, globalOffset, range.beginIndex, range.endIndex);
+  }, mergeSlabMeshes);
+
+  Mesh mesh;
+  Submesh& submesh = mesh.addSubmesh();
+  submesh.getVertices()        = std::move(slabMesh.vertices);
+  submesh.getTriangleIndices() = std::move(slabMesh.indices);
+
+  return mesh;
+}
+
+Mesh MarchingCubes::compute(const SparseGrid3b& grid) {
+  ZoneScopedN("MarchingCubes::compute(SparseGrid3b)");
+
+  checkGridSize(grid);
+
+  // Unallocated chunks can still hold cells touching allocated ones; every chunk depending on an allocated one must be meshed
+  std::set<std::size_t> chunkIndices;
+  for (const auto& [chunkIndex, chunk] : grid.getChunks())
+    forEachDependentChunk(grid, chunkIndex, [&chunkIndices] (std::size_t dependentIndex) { chunkIndices.emplace(dependentIndex); });
+
+  return buildWeldedMesh(computeChunkMeshes(grid, std::vector<std::size_t>(chunkIndices.cbegin(), chunkIndices.cend())));
+}
+
+std::size_t MarchingCubes::IncrementalMesher::update(SparseGrid3b& grid) {
+  ZoneScopedN("MarchingCubes::IncrementalMesher::update");
+
+  checkGridSize(grid);
+
+  std::set<std::size_t> chunkIndices;
+  for (const std::size_t dirtyIndex : grid.getDirtyChunks())
+    forEachDependentChunk(grid, dirtyIndex, [&chunkIndices] (std::size_t dependentIndex) { chunkIndices.emplace(dependentIndex); });
+
+  const std::vector<std::size_t> remeshedIndices(chunkIndices.cbegin(), chunkIndices.cend());
+  std::vector<ChunkMesh> chunkMeshes = computeChunkMeshes(grid, remeshedIndices);
+
+  for (std::size_t i = 0; i < remeshedIndices.size(); ++i) {
+    if (chunkMeshes[i].indices.empty())
+      m_chunkMeshes.erase(remeshedIndices[i]);
+    else
+      m_chunkMeshes.insert_or_assign(remeshedIndices[i], std::move(chunkMeshes[i]));
+  }
+
+  grid.clearDirtyChunks();
+
+  return remeshedIndices.size();
+}
+
+Mesh MarchingCubes::IncrementalMesher::buildMesh() const {
+  ZoneScopedN("MarchingCubes::IncrementalMesher::buildMesh");
+
+  return buildWeldedMesh(std::views::values(m_chunkMeshes));
+}
+
 } // namespace Raz
@@ -7,8 +7,88 @@
 
 #include "tracy/Tracy.hpp"
 
+#include <algorithm>
+
 namespace Raz {
 
+namespace {
+
+constexpr Vec3f invalidClosestPoint(std::numeric_limits<float>::max());
+
+/// Computes the edge function of a 2D point relative to the oriented edge [firstPos; secondPos].
+/// The computation is always made in the same order for a given pair of points, so that the results for both orientations are exactly opposite.
+float computeEdgeFunction(const Vec2f& firstPos, const Vec2f& secondPos, const Vec2f& point) {
+  const bool isReversed = (secondPos.x() < firstPos.x() || (secondPos.x() == firstPos.x() && secondPos.y() < firstPos.y()));
+  const Vec2f& edgeBegin = (isReversed ? secondPos : firstPos);
+  const Vec2f& edgeEnd   = (isReversed ? firstPos : secondPos);
+
+  const float edgeFunction = (edgeEnd.x() - edgeBegin.x()) * (point.y() - edgeBegin.y()) - (edgeEnd.y() - edgeBegin.y()) * (point.x() - edgeBegin.x());
+  return (isReversed ? -edgeFunction : edgeFunction);
+}
+
+/// Checks if a point lying exactly on a counterclockwise triangle's edge is considered inside it. Exactly one of two adjacent triangles owns their shared
+/// edge, the same way rasterizers handle it, so that a line going through an edge or a vertex of a closed mesh crosses its surface the right number of times.
+constexpr bool isEdgeOwned(const Vec2f& firstPos, const Vec2f& secondPos) noexcept {
+  const Vec2f edgeDir = secondPos - firstPos;
+  return (edgeDir.y() < 0.f || (edgeDir.y() == 0.f && edgeDir.x() > 0.f));
+}
+
+/// Finds the X coordinates at which the line parallel to the X axis & going through the given Y & Z coordinates crosses the triangles.
+void findRowCrossings(const BoundingVolumeHierarchyNode& node, float heightPos, float depthPos, std::vector<float>& crossings) {
+  const AABB& boundingBox = node.getBoundingBox();
+
+  if (heightPos < boundingBox.getMinPosition().y() || heightPos > boundingBox.getMaxPosition().y()
+   || depthPos < boundingBox.getMinPosition().z() || depthPos > boundingBox.getMaxPosition().z()) {
+    return;
+  }
+
+  if (!node.isLeaf()) {
+    if (node.hasLeftChild())
+      findRowCrossings(node.getLeftChild(), heightPos, depthPos, crossings);
+
+    if (node.hasRightChild())
+      findRowCrossings(node.getRightChild(), heightPos, depthPos, crossings);
+
+    return;
+  }
+
+  const Triangle& triangle = node.getTriangle();
+  const Vec2f point(heightPos, depthPos);
+
+  // Projecting the triangle onto the Y/Z plane, making it counterclockwise
+  std::array<Vec3f, 3> trianglePoints = { triangle.getFirstPos(), triangle.getSecondPos(), triangle.getThirdPos() };
+  std::array<Vec2f, 3> projectedPoints = { Vec2f(trianglePoints[0].y(), trianglePoints[0].z()),
+                                           Vec2f(trianglePoints[1].y(), trianglePoints[1].z()),
+                                           Vec2f(trianglePoints[2].y(), trianglePoints[2].z()) };
+
+  const float area = computeEdgeFunction(projectedPoints[0], projectedPoints[1], projectedPoints[2]);
+
+  if (area == 0.f)
+    return; // The triangle is parallel to the row, which thus can't cross it
+
+  if (area < 0.f) {
+    std::swap(trianglePoints[1], trianglePoints[2]);
+    std::swap(projectedPoints[1], projectedPoints[2]);
+  }
+
+  // Each point's weight is given by the edge opposite to it
+  std::array<float, 3> weights {};
+
+  for (std::size_t i = 0; i < 3; ++i) {
+    const Vec2f& edgeBegin = projectedPoints[(i + 1) % 3];
+    const Vec2f& edgeEnd   = projectedPoints[(i + 2) % 3];
+    weights[i] = computeEdgeFunction(edgeBegin, edgeEnd, point);
+
+    if (weights[i] < 0.f || (weights[i] == 0.f && !isEdgeOwned(edgeBegin, edgeEnd)))
+      return;
+  }
+
+  const float weightSum = weights[0] + weights[1] + weights[2];
+  crossings.emplace_back((trianglePoints[0].x() * weights[0] + trianglePoints[1].x() * weights[1] + trianglePoints[2].x() * weights[2]) / weightSum);
+}
+
+} // namespace
+
 MeshDistanceField::MeshDistanceField(const AABB& area, std::size_t width, std::size_t height, std::size_t depth)
   : Grid3f(width, height, depth, std::numeric_limits<float>::max()), m_area{ area } {
   if (m_width < 2 || m_height < 2 || m_depth < 2)
@@ -28,7 +108,9 @@ void MeshDistanceField::compute(std::size_t sampleCount) {
   const float heightStep  = areaExtents.y() / static_cast<float>(m_height - 1);
   const float depthStep   = areaExtents.z() / static_cast<float>(m_depth - 1);
 
-  Threading::parallelize(0, m_depth, [this, widthStep, heightStep, depthStep, sampleCount] (const Threading::IndexRange& range) {
+  const std::vector<Vec3f> rayDirections = MathUtils::computeFibonacciSpherePoints(sampleCount);
+
+  Threading::parallelize(0, m_depth, [this, widthStep, heightStep, depthStep, &rayDirections] (const Threading::IndexRange& range) {
     ZoneScopedN("MeshDistanceField::compute");
 
     for (std::size_t depthIndex = range.beginIndex; depthIndex < range.endIndex; ++depthIndex) {
@@ -39,7 +121,7 @@ void MeshDistanceField::compute(std::size_t sampleCount) {
                                                                static_cast<float>(depthIndex) * depthStep);
           float& distance = m_values[computeIndex(widthIndex, heightIndex, depthIndex)];
 
-          for (const Vec3f& rayDir : MathUtils::computeFibonacciSpherePoints(sampleCount)) {
+          for (const Vec3f& rayDir : rayDirections) {
             RayHit hit {};
 
             if (!m_bvh->query(Ray(rayPos, rayDir), &hit))
@@ -57,6 +139,149 @@ void MeshDistanceField::compute(std::size_t sampleCount) {
   }, Threading::getDefaultThreadPool(), Threading::getSystemThreadCount() * 2);
 }
 
+void MeshDistanceField::computeExact(std::size_t narrowBandWidth, bool propagateBeyondBand) {
+  ZoneScopedN("MeshDistanceField::computeExact");
+
+  if (m_bvh == nullptr)
+    throw std::runtime_error("[MeshDistanceField] Computing a mesh distance field requires having given a BVH.");
+
+  if (narrowBandWidth == 0)
+    throw std::invalid_argument("[MeshDistanceField] The narrow band width must not be 0.");
+
+  const Vec3f areaExtents = m_area.getMaxPosition() - m_area.getMinPosition();
+  const float maxStep     = std::max({ areaExtents.x() / static_cast<float>(m_width - 1),
+                                       areaExtents.y() / static_cast<float>(m_height - 1),
+                                       areaExtents.z() / static_cast<float>(m_depth - 1) });
+  const float bandDistance = static_cast<float>(narrowBandWidth) * maxStep;
+
+  // Each point holds the closest point found on the mesh's surface so far
+  std::vector<Vec3f> closestPoints(m_values.size());
+
+  {
+    ZoneScopedN("MeshDistanceField::computeExact::narrowBand");
+
+    Threading::parallelize(0, m_depth, [this, bandDistance, &closestPoints] (const Threading::IndexRange& range) {
+      for (std::size_t depthIndex = range.beginIndex; depthIndex < range.endIndex; ++depthIndex) {
+        for (std::size_t heightIndex = 0; heightIndex < m_height; ++heightIndex) {
+          for (std::size_t widthIndex = 0; widthIndex < m_width; ++widthIndex) {
+            RayHit hit;
+            const bool isInBand = (m_bvh->queryClosest(computePoint(widthIndex, heightIndex, depthIndex), bandDistance, &hit) != nullptr);
+            closestPoints[computeIndex(widthIndex, heightIndex, depthIndex)] = (isInBand ? hit.position : invalidClosestPoint);
+          }
+        }
+      }
+    });
+  }
+
+  if (propagateBeyondBand) {
+    ZoneScopedN("MeshDistanceField::computeExact::jumpFlooding");
+
+    // Jump flooding: each point looks at its neighbors at a decreasing distance, keeping the closest of their closest points. A last pass with a distance
+    //  of 1 corrects most of the remaining errors; see: https://www.comp.nus.edu.sg/~tants/jfa.html
+    std::vector<Vec3f> nextClosestPoints(closestPoints.size());
+
+    std::size_t stepCount = 1;
+    while (stepCount < std::max({ m_width, m_height, m_depth }))
+      stepCount *= 2;
+
+    std::vector<std::size_t> steps;
+    for (std::size_t step = stepCount / 2; step > 0; step /= 2)
+      steps.emplace_back(step);
+    steps.emplace_back(1);
+
+    for (const std::size_t step : steps) {
+      Threading::parallelize(0, m_depth, [this, step, &closestPoints, &nextClosestPoints] (const Threading::IndexRange& range) noexcept {
+        const auto offset = static_cast<std::ptrdiff_t>(step);
+
+        for (std::size_t depthIndex = range.beginIndex; depthIndex < range.endIndex; ++depthIndex) {
+          for (std::size_t heightIndex = 0; heightIndex < m_height; ++heightIndex) {
+            for (std::size_t widthIndex = 0; widthIndex < m_width; ++widthIndex) {
+              const Vec3f point = computePoint(widthIndex, heightIndex, depthIndex);
+              const std::size_t valueIndex = computeIndex(widthIndex, heightIndex, depthIndex);
+
+              Vec3f closestPoint = closestPoints[valueIndex];
+              float closestSquaredDist = (!closestPoint.strictlyEquals(invalidClosestPoint) ? (closestPoint - point).computeSquaredLength() : std::numeric_limits<float>::max());
+
+              for (std::ptrdiff_t neighborDepth = -offset; neighborDepth <= offset; neighborDepth += offset) {
+                const std::ptrdiff_t neighborDepthIndex = static_cast<std::ptrdiff_t>(depthIndex) + neighborDepth;
+
+                if (neighborDepthIndex < 0 || neighborDepthIndex >= static_cast<std::ptrdiff_t>(m_depth))
+                  continue;
+
+                for (std::ptrdiff_t neighborHeight = -offset; neighborHeight <= offset; neighborHeight += offset) {
+                  const std::ptrdiff_t neighborHeightIndex = static_cast<std::ptrdiff_t>(heightIndex) + neighborHeight;
+
+                  if (neighborHeightIndex < 0 || neighborHeightIndex >= static_cast<std::ptrdiff_t>(m_height))
+                    continue;
+
+                  for (std::ptrdiff_t neighborWidth = -offset; neighborWidth <= offset; neighborWidth += offset) {
+                    const std::ptrdiff_t neighborWidthIndex = static_cast<std::ptrdiff_t>(widthIndex) + neighborWidth;
+
+                    if (neighborWidthIndex < 0 || neighborWidthIndex >= static_cast<std::ptrdiff_t>(m_width))
+                      continue;
+
+                    const Vec3f& neighborClosestPoint = closestPoints[computeIndex(static_cast<std::size_t>(neighborWidthIndex),
+                                                                                   static_cast<std::size_t>(neighborHeightIndex),
+                                                                                   static_cast<std::size_t>(neighborDepthIndex))];
+
+                    if (neighborClosestPoint.strictlyEquals(invalidClosestPoint))
+                      continue;
+
+                    const float squaredDist = (neighborClosestPoint - point).computeSquaredLength();
+
+                    if (squaredDist < closestSquaredDist) {
+                      closestPoint       = neighborClosestPoint;
+                      closestSquaredDist = squaredDist;
+                    }
+                  }
+                }
+              }
+
+              nextClosestPoints[valueIndex] = closestPoint;
+            }
+          }
+        }
+      });
+
+      std::swap(closestPoints, nextClosestPoints);
+    }
+  }
+
+  {
+    ZoneScopedN("MeshDistanceField::computeExact::sign");
+
+    // Points are inside the mesh if the part of their row before them crosses its surface an odd number of times
+    Threading::parallelize(0, m_depth, [this, &closestPoints] (const Threading::IndexRange& range) {
+      std::vector<float> crossings;
+
+      for (std::size_t depthIndex = range.beginIndex; depthIndex < range.endIndex; ++depthIndex) {
+        for (std::size_t heightIndex = 0; heightIndex < m_height; ++heightIndex) {
+          const Vec3f rowPoint = computePoint(0, heightIndex, depthIndex);
+
+          crossings.clear();
+          findRowCrossings(m_bvh->getRootNode(), rowPoint.y(), rowPoint.z(), crossings);
+          std::sort(crossings.begin(), crossings.end());
+
+          std::size_t crossingCount = 0;
+
+          for (std::size_t widthIndex = 0; widthIndex < m_width; ++widthIndex) {
+            const Vec3f point = computePoint(widthIndex, heightIndex, depthIndex);
+
+            while (crossingCount < crossings.size() && crossings[crossingCount] < point.x())
+              ++crossingCount;
+
+            const std::size_t valueIndex = computeIndex(widthIndex, heightIndex, depthIndex);
+            const Vec3f& closestPoint    = closestPoints[valueIndex];
+            const float distance         = (!closestPoint.strictlyEquals(invalidClosestPoint) ? (closestPoint - point).computeLength() : std::numeric_limits<float>::max());
+
+            m_values[valueIndex] = (crossingCount % 2 == 1 ? -distance : distance);
+          }
+        }
+      }
+    });
+  }
+}
+
 std::vector<Image> MeshDistanceField::recoverSlices() const {
   ZoneScopedN("MeshDistanceField::recoverSlices");
 
@@ -77,4 +302,32 @@ std::vector<Image> MeshDistanceField::recoverSlices() const {
   return slices;
 }
 
+SparseGrid3f MeshDistanceField::recoverNarrowBand(float maxDistance, std::size_t chunkSize) const {
+  ZoneScopedN("MeshDistanceField::recoverNarrowBand");
+
+  SparseGrid3f narrowBand(m_width, m_height, m_depth, maxDistance, chunkSize);
+
+  for (std::size_t depthIndex = 0; depthIndex < m_depth; ++depthIndex) {
+    for (std::size_t heightIndex = 0; heightIndex < m_height; ++heightIndex) {
+      for (std::size_t widthIndex = 0; widthIndex < m_width; ++widthIndex) {
+        const float distance = getValue(widthIndex, heightIndex, depthIndex);
+
+        if (distance < maxDistance)
+          narrowBand.setValue(widthIndex, heightIndex, depthIndex, std::max(distance, -maxDistance));
+      }
+    }
+  }
+
+  narrowBand.clearDirtyChunks();
+
+  return narrowBand;
+}
+
+Vec3f MeshDistanceField::computePoint(std::size_t widthIndex, std::size_t heightIndex, std::size_t depthIndex) const noexcept {
+  const Vec3f areaExtents = m_area.getMaxPosition() - m_area.getMinPosition();
+  return m_area.getMinPosition() + Vec3f(static_cast<float>(widthIndex) * areaExtents.x() / static_cast<float>(m_width - 1),
+                                         static_cast<float>(heightIndex) * areaExtents.y() / static_cast<float>(m_height - 1),
+                                         static_cast<float>(depthIndex) * areaExtents.z() / static_cast<float>(m_depth - 1));
+}
+
 } // namespace Raz
@@ -0,0 +1,120 @@
+#include "RaZ/Data/Grid2.hpp"
+#include "RaZ/Data/Grid3.hpp"
+#include "RaZ/Data/Image.hpp"
+#include "RaZ/Data/NoiseField.hpp"
+#include "RaZ/Math/PerlinNoise.hpp"
+#include "RaZ/Math/SimplexNoise.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include "tracy/Tracy.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace Raz::NoiseField {
+
+namespace {
+
+template <std::size_t Size>
+void computeNoise(NoiseType type, std::span<const Vector<float, Size>> points, std::span<float> values, const NoiseSettings& settings) {
+  if constexpr (Size == 2) {
+    if (type == NoiseType::SIMPLEX)
+      SimplexNoise::compute2D(points, values, settings);
+    else
+      PerlinNoise::compute2D(points, values, settings);
+  } else {
+    if (type == NoiseType::SIMPLEX)
+      SimplexNoise::compute3D(points, values, settings);
+    else
+      PerlinNoise::compute3D(points, values, settings);
+  }
+}
+
+} // namespace
+
+void fill(Grid2f& grid, NoiseType type, const NoiseSettings& settings, const Vec2f& offset) {
+  ZoneScopedN("NoiseField::fill(Grid2f)");
+
+  const std::size_t width = grid.getWidth();
+
+  Threading::parallelize(0, grid.getHeight(), [&grid, type, &settings, &offset, width] (const Threading::IndexRange& range) {
+    std::vector<Vec2f> points(width);
+    std::vector<float> values(width);
+
+    for (std::size_t heightIndex = range.beginIndex; heightIndex < range.endIndex; ++heightIndex) {
+      for (std::size_t widthIndex = 0; widthIndex < width; ++widthIndex)
+        points[widthIndex] = Vec2f(static_cast<float>(widthIndex), static_cast<float>(heightIndex)) + offset;
+
+      computeNoise<2>(type, points, values, settings);
+
+      for (std::size_t widthIndex = 0; widthIndex < width; ++widthIndex)
+        grid.setValue(widthIndex, heightIndex, values[widthIndex]);
+    }
+  });
+}
+
+void fill(Grid3f& grid, NoiseType type, const NoiseSettings& settings, const Vec3f& offset) {
+  ZoneScopedN("NoiseField::fill(Grid3f)");
+
+  const std::size_t width  = grid.getWidth();
+  const std::size_t height = grid.getHeight();
+
+  Threading::parallelize(0, grid.getDepth(), [&grid, type, &settings, &offset, width, height] (const Threading::IndexRange& range) {
+    std::vector<Vec3f> points(width * height);
+    std::vector<float> values(width * height);
+
+    for (std::size_t depthIndex = range.beginIndex; depthIndex < range.endIndex; ++depthIndex) {
+      for (std::size_t heightIndex = 0; heightIndex < height; ++heightIndex) {
+        for (std::size_t widthIndex = 0; widthIndex < width; ++widthIndex) {
+          points[heightIndex * width + widthIndex] = Vec3f(static_cast<float>(widthIndex),
+                                                           static_cast<float>(heightIndex),
+                                                           static_cast<float>(depthIndex)) + offset;
+        }
+      }
+
+      computeNoise<3>(type, points, values, settings);
+
+      for (std::size_t heightIndex = 0; heightIndex < height; ++heightIndex) {
+        for (std::size_t widthIndex = 0; widthIndex < width; ++widthIndex)
+          grid.setValue(widthIndex, heightIndex, depthIndex, values[heightIndex * width + widthIndex]);
+      }
+    }
+  });
+}
+
+void fill(Image& image, NoiseType type, const NoiseSettings& settings, const Vec2f& offset) {
+  ZoneScopedN("NoiseField::fill(Image)");
+
+  if (image.isEmpty())
+    throw std::invalid_argument("[NoiseField] Cannot fill an empty image.");
+
+  const bool isByteImage = (image.getDataType() == ImageDataType::BYTE);
+
+  NoiseSettings imageSettings = settings;
+  imageSettings.normalize     = (settings.normalize || isByteImage);
+
+  const std::size_t width = image.getWidth();
+
+  Threading::parallelize(0, image.getHeight(), [&image, type, &imageSettings, &offset, width, isByteImage] (const Threading::IndexRange& range) {
+    std::vector<Vec2f> points(width);
+    std::vector<float> values(width);
+
+    for (std::size_t heightIndex = range.beginIndex; heightIndex < range.endIndex; ++heightIndex) {
+      for (std::size_t widthIndex = 0; widthIndex < width; ++widthIndex)
+        points[widthIndex] = Vec2f(static_cast<float>(widthIndex), static_cast<float>(heightIndex)) + offset;
+
+      computeNoise<2>(type, points, values, imageSettings);
+
+      for (std::size_t widthIndex = 0; widthIndex < width; ++widthIndex) {
+        for (uint8_t channelIndex = 0; channelIndex < image.getChannelCount(); ++channelIndex) {
+          if (isByteImage)
+            image.setByteValue(widthIndex, heightIndex, channelIndex, static_cast<uint8_t>(std::clamp(values[widthIndex], 0.f, 1.f) * 255.f + 0.5f));
+          else
+            image.setFloatValue(widthIndex, heightIndex, channelIndex, values[widthIndex]);
+        }
+      }
+    }
+  });
+}
+
+} // namespace Raz::NoiseField
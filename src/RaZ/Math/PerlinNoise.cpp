@@ -2,6 +2,12 @@
 #include "RaZ/Math/PerlinNoise.hpp"
 #include "RaZ/Math/Vector.hpp"
 
+#include "tracy/Tracy.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
 namespace Raz::PerlinNoise {
 
 namespace {
@@ -196,6 +202,200 @@ constexpr float computeValue(float x, float y, float z) {
   return MathUtils::lerp(backCoeff, frontCoeff, smoothZ);
 }
 
+/////////////////////
+// Batch computing //
+/////////////////////
+
+// Points are processed by blocks, each of their coordinates being stored contiguously so that the computations are performed on SIMD lanes
+constexpr std::size_t laneCount = 8;
+
+template <typename T>
+using Lanes = std::array<T, laneCount>;
+
+using Permutations = std::array<unsigned int, 512>;
+
+// Unlike std::floor, which is not branchless without SSE4.1, this allows the loops using it to be vectorized
+constexpr int computeFloor(float value) noexcept {
+  const auto truncatedValue = static_cast<int>(value);
+  return truncatedValue - static_cast<int>(static_cast<float>(truncatedValue) > value);
+}
+
+constexpr Permutations computePermutations(uint32_t seed) {
+  if (seed == 0)
+    return permutations;
+
+  Permutations seededPermutations {};
+  std::iota(seededPermutations.begin(), seededPermutations.begin() + 256, 0u);
+
+  // Shuffling with a xorshift generator, which gives the same results on all platforms
+  uint32_t state = seed;
+
+  for (unsigned int i = 255; i > 0; --i) {
+    state ^= state << 13u;
+    state ^= state >> 17u;
+    state ^= state << 5u;
+    std::swap(seededPermutations[i], seededPermutations[state % (i + 1)]);
+  }
+
+  std::copy_n(seededPermutations.cbegin(), 256, seededPermutations.begin() + 256);
+  return seededPermutations;
+}
+
+void computeLanes(const Permutations& perms, const Lanes<float>& xs, const Lanes<float>& ys, Lanes<float>& values) noexcept {
+  Lanes<unsigned int> x0s {};
+  Lanes<unsigned int> y0s {};
+  Lanes<float> xWeights {};
+  Lanes<float> yWeights {};
+
+  for (std::size_t lane = 0; lane < laneCount; ++lane) {
+    const int floorX = computeFloor(xs[lane]);
+    const int floorY = computeFloor(ys[lane]);
+
+    x0s[lane] = static_cast<unsigned int>(floorX) & 255u;
+    y0s[lane] = static_cast<unsigned int>(floorY) & 255u;
+
+    xWeights[lane] = xs[lane] - static_cast<float>(floorX);
+    yWeights[lane] = ys[lane] - static_cast<float>(floorY);
+  }
+
+  // Fetching the gradients cannot be vectorized; only this part is computed for each lane separately
+  Lanes<float> leftBotDots {};
+  Lanes<float> rightBotDots {};
+  Lanes<float> leftTopDots {};
+  Lanes<float> rightTopDots {};
+
+  for (std::size_t lane = 0; lane < laneCount; ++lane) {
+    const unsigned int x0 = x0s[lane];
+    const unsigned int y0 = y0s[lane];
+
+    const Vec2f& leftBotGrad  = gradients2D[perms[perms[x0    ] + y0    ] % gradients2D.size()];
+    const Vec2f& rightBotGrad = gradients2D[perms[perms[x0 + 1] + y0    ] % gradients2D.size()];
+    const Vec2f& leftTopGrad  = gradients2D[perms[perms[x0    ] + y0 + 1] % gradients2D.size()];
+    const Vec2f& rightTopGrad = gradients2D[perms[perms[x0 + 1] + y0 + 1] % gradients2D.size()];
+
+    const float xWeight = xWeights[lane];
+    const float yWeight = yWeights[lane];
+
+    leftBotDots[lane]  = xWeight       * leftBotGrad.x()  + yWeight       * leftBotGrad.y();
+    rightBotDots[lane] = (xWeight - 1) * rightBotGrad.x() + yWeight       * rightBotGrad.y();
+    leftTopDots[lane]  = xWeight       * leftTopGrad.x()  + (yWeight - 1) * leftTopGrad.y();
+    rightTopDots[lane] = (xWeight - 1) * rightTopGrad.x() + (yWeight - 1) * rightTopGrad.y();
+  }
+
+  for (std::size_t lane = 0; lane < laneCount; ++lane) {
+    const float smoothX = MathUtils::smootherstep(xWeights[lane]);
+    const float smoothY = MathUtils::smootherstep(yWeights[lane]);
+
+    const float botCoeff = MathUtils::lerp(leftBotDots[lane], rightBotDots[lane], smoothX);
+    const float topCoeff = MathUtils::lerp(leftTopDots[lane], rightTopDots[lane], smoothX);
+
+    values[lane] = MathUtils::lerp(botCoeff, topCoeff, smoothY);
+  }
+}
+
+void computeLanes(const Permutations& perms, const Lanes<float>& xs, const Lanes<float>& ys, const Lanes<float>& zs, Lanes<float>& values) noexcept {
+  Lanes<unsigned int> x0s {};
+  Lanes<unsigned int> y0s {};
+  Lanes<unsigned int> z0s {};
+  Lanes<float> xWeights {};
+  Lanes<float> yWeights {};
+  Lanes<float> zWeights {};
+
+  for (std::size_t lane = 0; lane < laneCount; ++lane) {
+    const int floorX = computeFloor(xs[lane]);
+    const int floorY = computeFloor(ys[lane]);
+    const int floorZ = computeFloor(zs[lane]);
+
+    x0s[lane] = static_cast<unsigned int>(floorX) & 255u;
+    y0s[lane] = static_cast<unsigned int>(floorY) & 255u;
+    z0s[lane] = static_cast<unsigned int>(floorZ) & 255u;
+
+    xWeights[lane] = xs[lane] - static_cast<float>(floorX);
+    yWeights[lane] = ys[lane] - static_cast<float>(floorY);
+    zWeights[lane] = zs[lane] - static_cast<float>(floorZ);
+  }
+
+  // Fetching the gradients cannot be vectorized; only this part is computed for each lane separately
+  std::array<Lanes<float>, 8> cornerDots {};
+
+  for (std::size_t lane = 0; lane < laneCount; ++lane) {
+    const unsigned int x0 = x0s[lane];
+    const unsigned int y0 = y0s[lane];
+    const unsigned int z0 = z0s[lane];
+
+    for (unsigned int cornerIndex = 0; cornerIndex < 8; ++cornerIndex) {
+      // Corners are ordered so that the X offset changes first, then the Y one, and lastly the Z one
+      const unsigned int xOffset = cornerIndex & 1u;
+      const unsigned int yOffset = (cornerIndex >> 1u) & 1u;
+      const unsigned int zOffset = cornerIndex >> 2u;
+
+      const Vec3f& gradient = gradients3D[perms[perms[perms[x0 + xOffset] + y0 + yOffset] + z0 + zOffset] % gradients3D.size()];
+      cornerDots[cornerIndex][lane] = (xWeights[lane] - static_cast<float>(xOffset)) * gradient.x()
+                                    + (yWeights[lane] - static_cast<float>(yOffset)) * gradient.y()
+                                    + (zWeights[lane] - static_cast<float>(zOffset)) * gradient.z();
+    }
+  }
+
+  for (std::size_t lane = 0; lane < laneCount; ++lane) {
+    const float smoothX = MathUtils::smootherstep(xWeights[lane]);
+    const float smoothY = MathUtils::smootherstep(yWeights[lane]);
+    const float smoothZ = MathUtils::smootherstep(zWeights[lane]);
+
+    const float botBackCoeff  = MathUtils::lerp(cornerDots[0][lane], cornerDots[1][lane], smoothX);
+    const float topBackCoeff  = MathUtils::lerp(cornerDots[2][lane], cornerDots[3][lane], smoothX);
+    const float botFrontCoeff = MathUtils::lerp(cornerDots[4][lane], cornerDots[5][lane], smoothX);
+    const float topFrontCoeff = MathUtils::lerp(cornerDots[6][lane], cornerDots[7][lane], smoothX);
+
+    const float backCoeff  = MathUtils::lerp(botBackCoeff,  topBackCoeff,  smoothY);
+    const float frontCoeff = MathUtils::lerp(botFrontCoeff, topFrontCoeff, smoothY);
+
+    values[lane] = MathUtils::lerp(backCoeff, frontCoeff, smoothZ);
+  }
+}
+
+template <std::size_t Size>
+void computeBlock(const Permutations& perms, const Vector<float, Size>* points, float* values, std::size_t pointCount, const NoiseSettings& settings) noexcept {
+  // Unused lanes keep null coordinates; their values are computed but ignored
+  std::array<Lanes<float>, Size> coords {};
+  Lanes<float> octaveValues {};
+  Lanes<float> totals {};
+
+  float frequency = settings.frequency;
+  float amplitude = 1.f;
+
+  for (uint8_t i = 0; i < settings.octaveCount; ++i) {
+    for (std::size_t lane = 0; lane < pointCount; ++lane) {
+      for (std::size_t coordIndex = 0; coordIndex < Size; ++coordIndex)
+        coords[coordIndex][lane] = points[lane][coordIndex] * frequency;
+    }
+
+    if constexpr (Size == 2)
+      computeLanes(perms, coords[0], coords[1], octaveValues);
+    else
+      computeLanes(perms, coords[0], coords[1], coords[2], octaveValues);
+
+    for (std::size_t lane = 0; lane < laneCount; ++lane)
+      totals[lane] += octaveValues[lane] * amplitude;
+
+    amplitude *= settings.persistence;
+    frequency *= settings.lacunarity;
+  }
+
+  for (std::size_t lane = 0; lane < pointCount; ++lane)
+    values[lane] = (settings.normalize ? (totals[lane] + 1) / 2 : totals[lane]); // Scaling between [0; 1] if asked
+}
+
+template <std::size_t Size>
+void computeBatch(std::span<const Vector<float, Size>> points, std::span<float> values, const NoiseSettings& settings) {
+  if (values.size() != points.size())
+    throw std::invalid_argument("[PerlinNoise] The number of values must be equal to the number of points.");
+
+  const Permutations perms = computePermutations(settings.seed);
+
+  for (std::size_t firstIndex = 0; firstIndex < points.size(); firstIndex += laneCount)
+    computeBlock(perms, points.data() + firstIndex, values.data() + firstIndex, std::min(laneCount, points.size() - firstIndex), settings);
+}
+
 } // namespace
 
 float compute1D(float x, uint8_t octaveCount, bool normalize) {
@@ -252,4 +452,14 @@ float compute3D(float x, float y, float z, uint8_t octaveCount, bool normalize)
   return total;
 }
 
+void compute2D(std::span<const Vec2f> points, std::span<float> values, const NoiseSettings& settings) {
+  ZoneScopedN("PerlinNoise::compute2D");
+  computeBatch(points, values, settings);
+}
+
+void compute3D(std::span<const Vec3f> points, std::span<float> values, const NoiseSettings& settings) {
+  ZoneScopedN("PerlinNoise::compute3D");
+  computeBatch(points, values, settings);
+}
+
 } // namespace Raz::PerlinNoise
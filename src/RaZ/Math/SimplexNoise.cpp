@@ -0,0 +1,333 @@
+#include "RaZ/Math/SimplexNoise.hpp"
+#include "RaZ/Math/Vector.hpp"
+
+#include "tracy/Tracy.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+namespace Raz::SimplexNoise {
+
+namespace {
+
+using Permutations = std::array<unsigned int, 512>;
+
+constexpr Permutations computePermutations(uint32_t seed) {
+  Permutations permutations {};
+  std::iota(permutations.begin(), permutations.begin() + 256, 0u);
+
+  // Shuffling with a xorshift generator, which gives the same results on all platforms. Its state must never be 0
+  uint32_t state = seed ^ 0x9E3779B9u;
+
+  for (unsigned int i = 255; i > 0; --i) {
+    state ^= state << 13u;
+    state ^= state >> 17u;
+    state ^= state << 5u;
+    std::swap(permutations[i], permutations[state % (i + 1)]);
+  }
+
+  std::copy_n(permutations.cbegin(), 256, permutations.begin() + 256);
+  return permutations;
+}
+
+constexpr Permutations defaultPermutations = computePermutations(0);
+
+constexpr std::array<Vec2f, 8> gradients2D = {
+  Vec2f(          1.f,            0.f), Vec2f(          -1.f,            0.f),
+  Vec2f(          0.f,            1.f), Vec2f(           0.f,           -1.f),
+  Vec2f(0.7071067691f,  0.7071067691f), Vec2f(-0.7071067691f,  0.7071067691f),
+  Vec2f(0.7071067691f, -0.7071067691f), Vec2f(-0.7071067691f, -0.7071067691f)
+};
+
+// Only 12 gradients are necessary; however, 16 are defined to avoid dividing by 12
+constexpr std::array<Vec3f, 16> gradients3D = {
+  Vec3f(0.7071067691f,  0.7071067691f,            0.f), Vec3f(-0.7071067691f,  0.7071067691f,            0.f),
+  Vec3f(0.7071067691f, -0.7071067691f,            0.f), Vec3f(-0.7071067691f, -0.7071067691f,            0.f),
+  Vec3f(0.7071067691f,            0.f,  0.7071067691f), Vec3f(-0.7071067691f,            0.f,  0.7071067691f),
+  Vec3f(0.7071067691f,            0.f, -0.7071067691f), Vec3f(-0.7071067691f,            0.f, -0.7071067691f),
+  Vec3f(          0.f,  0.7071067691f,  0.7071067691f), Vec3f(           0.f, -0.7071067691f,  0.7071067691f),
+  Vec3f(          0.f,  0.7071067691f, -0.7071067691f), Vec3f(           0.f, -0.7071067691f, -0.7071067691f),
+  Vec3f(0.7071067691f,  0.7071067691f,            0.f), Vec3f(-0.7071067691f,  0.7071067691f,            0.f),
+  Vec3f(          0.f, -0.7071067691f,  0.7071067691f), Vec3f(           0.f, -0.7071067691f, -0.7071067691f)
+};
+
+// Factors to skew the space into a grid of squares or cubes & back, respectively (sqrt(N + 1) - 1) / N & (N + 1 - sqrt(N + 1)) / (N * (N + 1))
+constexpr float skewFactor2D   = 0.36602540378f;
+constexpr float unskewFactor2D = 0.21132486540f;
+constexpr float skewFactor3D   = 1.f / 3.f;
+constexpr float unskewFactor3D = 1.f / 6.f;
+
+// Each corner only influences the points within this squared distance, which avoids any discontinuity
+constexpr float squaredRadius = 0.5f;
+
+// Factors scaling the values to the [-1; 1] range
+constexpr float scaleFactor2D = 99.204334582f;
+constexpr float scaleFactor3D = 108.73798f;
+
+// Points are processed by blocks, each of their coordinates being stored contiguously so that the computations are performed on SIMD lanes
+constexpr std::size_t laneCount = 8;
+
+template <std::size_t LaneCount, typename T = float>
+using Lanes = std::array<T, LaneCount>;
+
+// Unlike std::floor, which is not branchless without SSE4.1, this allows the loops using it to be vectorized
+constexpr int computeFloor(float value) noexcept {
+  const auto truncatedValue = static_cast<int>(value);
+  return truncatedValue - static_cast<int>(static_cast<float>(truncatedValue) > value);
+}
+
+constexpr float computeCornerContribution(float distX, float distY, float distZ, float gradX, float gradY, float gradZ) noexcept {
+  // Clamping negative values to 0 without std::max, which is not branchless either
+  const float distance = squaredRadius - distX * distX - distY * distY - distZ * distZ;
+  const float falloff  = (distance + std::abs(distance)) * 0.5f;
+  const float squaredFalloff = falloff * falloff;
+  return squaredFalloff * squaredFalloff * (distX * gradX + distY * gradY + distZ * gradZ);
+}
+
+template <std::size_t LaneCount>
+void computeLanes(const Permutations& perms, const Lanes<LaneCount>& xs, const Lanes<LaneCount>& ys, Lanes<LaneCount>& values) noexcept {
+  // Skewing the space to find the triangle containing each point, then recovering the distances to its corners
+  //
+  //   x0+1/y0+1           y0+1______x0+1/y0+1
+  //        /|                |     /
+  //       / |                |  X /
+  //      / X|       or       |   /
+  //     /___|                |  /
+  //  x0/y0   x0+1            | /
+  //                       x0/y0
+
+  Lanes<LaneCount, unsigned int> x0s {};
+  Lanes<LaneCount, unsigned int> y0s {};
+  Lanes<LaneCount, unsigned int> middleXOffsets {};
+  std::array<Lanes<LaneCount>, 3> distXs {};
+  std::array<Lanes<LaneCount>, 3> distYs {};
+
+  for (std::size_t lane = 0; lane < LaneCount; ++lane) {
+    const float skew  = (xs[lane] + ys[lane]) * skewFactor2D;
+    const int cellX   = computeFloor(xs[lane] + skew);
+    const int cellY   = computeFloor(ys[lane] + skew);
+
+    const float unskew = static_cast<float>(cellX + cellY) * unskewFactor2D;
+    const float distX  = xs[lane] - (static_cast<float>(cellX) - unskew);
+    const float distY  = ys[lane] - (static_cast<float>(cellY) - unskew);
+
+    // The middle corner is either on the right or on the top of the first one, depending on which triangle contains the point
+    const auto middleXOffset = static_cast<float>(distX > distY);
+
+    distXs[0][lane] = distX;
+    distYs[0][lane] = distY;
+    distXs[1][lane] = distX - middleXOffset + unskewFactor2D;
+    distYs[1][lane] = distY - (1.f - middleXOffset) + unskewFactor2D;
+    distXs[2][lane] = distX - 1.f + 2.f * unskewFactor2D;
+    distYs[2][lane] = distY - 1.f + 2.f * unskewFactor2D;
+
+    x0s[lane]            = static_cast<unsigned int>(cellX) & 255u;
+    y0s[lane]            = static_cast<unsigned int>(cellY) & 255u;
+    middleXOffsets[lane] = static_cast<unsigned int>(middleXOffset);
+  }
+
+  // Fetching the gradients cannot be vectorized; only this part is computed for each lane separately
+  std::array<Lanes<LaneCount>, 3> gradXs {};
+  std::array<Lanes<LaneCount>, 3> gradYs {};
+
+  for (std::size_t lane = 0; lane < LaneCount; ++lane) {
+    const unsigned int x0 = x0s[lane];
+    const unsigned int y0 = y0s[lane];
+    const unsigned int middleXOffset = middleXOffsets[lane];
+
+    const std::array<const Vec2f*, 3> gradients = {
+      &gradients2D[perms[perms[x0                ] + y0                    ] % gradients2D.size()],
+      &gradients2D[perms[perms[x0 + middleXOffset] + y0 + 1 - middleXOffset] % gradients2D.size()],
+      &gradients2D[perms[perms[x0 + 1            ] + y0 + 1                ] % gradients2D.size()]
+    };
+
+    for (std::size_t cornerIndex = 0; cornerIndex < 3; ++cornerIndex) {
+      gradXs[cornerIndex][lane] = gradients[cornerIndex]->x();
+      gradYs[cornerIndex][lane] = gradients[cornerIndex]->y();
+    }
+  }
+
+  for (std::size_t lane = 0; lane < LaneCount; ++lane) {
+    const float total = computeCornerContribution(distXs[0][lane], distYs[0][lane], 0.f, gradXs[0][lane], gradYs[0][lane], 0.f)
+                      + computeCornerContribution(distXs[1][lane], distYs[1][lane], 0.f, gradXs[1][lane], gradYs[1][lane], 0.f)
+                      + computeCornerContribution(distXs[2][lane], distYs[2][lane], 0.f, gradXs[2][lane], gradYs[2][lane], 0.f);
+
+    values[lane] = total * scaleFactor2D;
+  }
+}
+
+template <std::size_t LaneCount>
+void computeLanes(const Permutations& perms, const Lanes<LaneCount>& xs, const Lanes<LaneCount>& ys, const Lanes<LaneCount>& zs,
+                  Lanes<LaneCount>& values) noexcept {
+  // Skewing the space to find the tetrahedron containing each point, then recovering the distances to its corners
+
+  Lanes<LaneCount, unsigned int> x0s {};
+  Lanes<LaneCount, unsigned int> y0s {};
+  Lanes<LaneCount, unsigned int> z0s {};
+  std::array<Lanes<LaneCount, unsigned int>, 2> cornerXOffsets {};
+  std::array<Lanes<LaneCount, unsigned int>, 2> cornerYOffsets {};
+  std::array<Lanes<LaneCount, unsigned int>, 2> cornerZOffsets {};
+  std::array<Lanes<LaneCount>, 4> distXs {};
+  std::array<Lanes<LaneCount>, 4> distYs {};
+  std::array<Lanes<LaneCount>, 4> distZs {};
+
+  for (std::size_t lane = 0; lane < LaneCount; ++lane) {
+    const float skew  = (xs[lane] + ys[lane] + zs[lane]) * skewFactor3D;
+    const int cellX   = computeFloor(xs[lane] + skew);
+    const int cellY   = computeFloor(ys[lane] + skew);
+    const int cellZ   = computeFloor(zs[lane] + skew);
+
+    const float unskew = static_cast<float>(cellX + cellY + cellZ) * unskewFactor3D;
+    const float distX  = xs[lane] - (static_cast<float>(cellX) - unskew);
+    const float distY  = ys[lane] - (static_cast<float>(cellY) - unskew);
+    const float distZ  = zs[lane] - (static_cast<float>(cellZ) - unskew);
+
+    // The tetrahedron's middle corners are found by ranking the distances: the second corner moves along the greatest one's axis,
+    //  & the third one along the two greatest ones' axes
+    const bool isXGreaterThanY = (distX >= distY);
+    const bool isXGreaterThanZ = (distX >= distZ);
+    const bool isYGreaterThanZ = (distY >= distZ);
+
+    // Bitwise operators are used instead of logical ones, whose short-circuiting would introduce unpredictable branches
+    const auto secondXOffset = static_cast<float>(isXGreaterThanY & isXGreaterThanZ);
+    const auto secondYOffset = static_cast<float>(!isXGreaterThanY & isYGreaterThanZ);
+    const auto secondZOffset = static_cast<float>(!isXGreaterThanZ & !isYGreaterThanZ);
+    const auto thirdXOffset  = static_cast<float>(isXGreaterThanY | isXGreaterThanZ);
+    const auto thirdYOffset  = static_cast<float>(!isXGreaterThanY | isYGreaterThanZ);
+    const auto thirdZOffset  = static_cast<float>(!isXGreaterThanZ | !isYGreaterThanZ);
+
+    distXs[0][lane] = distX;
+    distYs[0][lane] = distY;
+    distZs[0][lane] = distZ;
+    distXs[1][lane] = distX - secondXOffset + unskewFactor3D;
+    distYs[1][lane] = distY - secondYOffset + unskewFactor3D;
+    distZs[1][lane] = distZ - secondZOffset + unskewFactor3D;
+    distXs[2][lane] = distX - thirdXOffset + 2.f * unskewFactor3D;
+    distYs[2][lane] = distY - thirdYOffset + 2.f * unskewFactor3D;
+    distZs[2][lane] = distZ - thirdZOffset + 2.f * unskewFactor3D;
+    distXs[3][lane] = distX - 1.f + 3.f * unskewFactor3D;
+    distYs[3][lane] = distY - 1.f + 3.f * unskewFactor3D;
+    distZs[3][lane] = distZ - 1.f + 3.f * unskewFactor3D;
+
+    x0s[lane] = static_cast<unsigned int>(cellX) & 255u;
+    y0s[lane] = static_cast<unsigned int>(cellY) & 255u;
+    z0s[lane] = static_cast<unsigned int>(cellZ) & 255u;
+
+    cornerXOffsets[0][lane] = static_cast<unsigned int>(secondXOffset);
+    cornerYOffsets[0][lane] = static_cast<unsigned int>(secondYOffset);
+    cornerZOffsets[0][lane] = static_cast<unsigned int>(secondZOffset);
+    cornerXOffsets[1][lane] = static_cast<unsigned int>(thirdXOffset);
+    cornerYOffsets[1][lane] = static_cast<unsigned int>(thirdYOffset);
+    cornerZOffsets[1][lane] = static_cast<unsigned int>(thirdZOffset);
+  }
+
+  // Fetching the gradients cannot be vectorized; only this part is computed for each lane separately
+  std::array<Lanes<LaneCount>, 4> gradXs {};
+  std::array<Lanes<LaneCount>, 4> gradYs {};
+  std::array<Lanes<LaneCount>, 4> gradZs {};
+
+  for (std::size_t lane = 0; lane < LaneCount; ++lane) {
+    const unsigned int x0 = x0s[lane];
+    const unsigned int y0 = y0s[lane];
+    const unsigned int z0 = z0s[lane];
+
+    const std::array<const Vec3f*, 4> gradients = {
+      &gradients3D[perms[perms[perms[x0] + y0] + z0] % gradients3D.size()],
+      &gradients3D[perms[perms[perms[x0 + cornerXOffsets[0][lane]] + y0 + cornerYOffsets[0][lane]] + z0 + cornerZOffsets[0][lane]] % gradients3D.size()],
+      &gradients3D[perms[perms[perms[x0 + cornerXOffsets[1][lane]] + y0 + cornerYOffsets[1][lane]] + z0 + cornerZOffsets[1][lane]] % gradients3D.size()],
+      &gradients3D[perms[perms[perms[x0 + 1] + y0 + 1] + z0 + 1] % gradients3D.size()]
+    };
+
+    for (std::size_t cornerIndex = 0; cornerIndex < 4; ++cornerIndex) {
+      gradXs[cornerIndex][lane] = gradients[cornerIndex]->x();
+      gradYs[cornerIndex][lane] = gradients[cornerIndex]->y();
+      gradZs[cornerIndex][lane] = gradients[cornerIndex]->z();
+    }
+  }
+
+  for (std::size_t lane = 0; lane < LaneCount; ++lane) {
+    const float total = computeCornerContribution(distXs[0][lane], distYs[0][lane], distZs[0][lane], gradXs[0][lane], gradYs[0][lane], gradZs[0][lane])
+                      + computeCornerContribution(distXs[1][lane], distYs[1][lane], distZs[1][lane], gradXs[1][lane], gradYs[1][lane], gradZs[1][lane])
+                      + computeCornerContribution(distXs[2][lane], distYs[2][lane], distZs[2][lane], gradXs[2][lane], gradYs[2][lane], gradZs[2][lane])
+                      + computeCornerContribution(distXs[3][lane], distYs[3][lane], distZs[3][lane], gradXs[3][lane], gradYs[3][lane], gradZs[3][lane]);
+
+    values[lane] = total * scaleFactor3D;
+  }
+}
+
+template <std::size_t LaneCount, std::size_t Size>
+void computeBlock(const Permutations& perms, const Vector<float, Size>* points, float* values, std::size_t pointCount, const NoiseSettings& settings) noexcept {
+  // Unused lanes keep null coordinates; their values are computed but ignored
+  std::array<Lanes<LaneCount>, Size> coords {};
+  Lanes<LaneCount> octaveValues {};
+  Lanes<LaneCount> totals {};
+
+  float frequency = settings.frequency;
+  float amplitude = 1.f;
+
+  for (uint8_t i = 0; i < settings.octaveCount; ++i) {
+    for (std::size_t lane = 0; lane < pointCount; ++lane) {
+      for (std::size_t coordIndex = 0; coordIndex < Size; ++coordIndex)
+        coords[coordIndex][lane] = points[lane][coordIndex] * frequency;
+    }
+
+    if constexpr (Size == 2)
+      computeLanes<LaneCount>(perms, coords[0], coords[1], octaveValues);
+    else
+      computeLanes<LaneCount>(perms, coords[0], coords[1], coords[2], octaveValues);
+
+    for (std::size_t lane = 0; lane < LaneCount; ++lane)
+      totals[lane] += octaveValues[lane] * amplitude;
+
+    amplitude *= settings.persistence;
+    frequency *= settings.lacunarity;
+  }
+
+  for (std::size_t lane = 0; lane < pointCount; ++lane)
+    values[lane] = (settings.normalize ? (totals[lane] + 1) / 2 : totals[lane]); // Scaling between [0; 1] if asked
+}
+
+template <std::size_t Size>
+void computeBatch(std::span<const Vector<float, Size>> points, std::span<float> values, const NoiseSettings& settings) {
+  if (values.size() != points.size())
+    throw std::invalid_argument("[SimplexNoise] The number of values must be equal to the number of points.");
+
+  const Permutations perms = (settings.seed == 0 ? defaultPermutations : computePermutations(settings.seed));
+
+  for (std::size_t firstIndex = 0; firstIndex < points.size(); firstIndex += laneCount) {
+    computeBlock<laneCount>(perms, points.data() + firstIndex, values.data() + firstIndex,
+                            std::min(laneCount, points.size() - firstIndex), settings);
+  }
+}
+
+} // namespace
+
+float compute2D(float x, float y, uint8_t octaveCount, bool normalize) {
+  const Vec2f point(x, y);
+  float value {};
+  computeBlock<1>(defaultPermutations, &point, &value, 1, NoiseSettings{ .octaveCount = octaveCount, .normalize = normalize });
+
+  return value;
+}
+
+float compute3D(float x, float y, float z, uint8_t octaveCount, bool normalize) {
+  const Vec3f point(x, y, z);
+  float value {};
+  computeBlock<1>(defaultPermutations, &point, &value, 1, NoiseSettings{ .octaveCount = octaveCount, .normalize = normalize });
+
+  return value;
+}
+
+void compute2D(std::span<const Vec2f> points, std::span<float> values, const NoiseSettings& settings) {
+  ZoneScopedN("SimplexNoise::compute2D");
+  computeBatch(points, values, settings);
+}
+
+void compute3D(std::span<const Vec3f> points, std::span<float> values, const NoiseSettings& settings) {
+  ZoneScopedN("SimplexNoise::compute3D");
+  computeBatch(points, values, settings);
+}
+
+} // namespace Raz::SimplexNoise
@@ -1,4 +1,7 @@
 #include "RaZ/Physics/Collider.hpp"
+#include "RaZ/Physics/ConvexHull.hpp"
+#include "RaZ/Physics/NarrowPhase.hpp"
+#include "RaZ/Physics/TriangleMesh.hpp"
 #include "RaZ/Utils/Shape.hpp"
 
 namespace Raz {
@@ -39,6 +42,14 @@ void Collider::setShape(Shape&& shape) {
       m_colliderShape = std::make_unique<OBB>(static_cast<OBB&&>(shape));
       break;
 
+    case ShapeType::CONVEX_HULL:
+      m_colliderShape = std::make_unique<ConvexHull>(static_cast<ConvexHull&&>(shape));
+      break;
+
+    case ShapeType::TRIANGLE_MESH:
+      m_colliderShape = std::make_unique<TriangleMesh>(static_cast<TriangleMesh&&>(shape));
+      break;
+
     default:
       throw std::invalid_argument("[Collider] Unhandled shape type to create a collider from");
   }
@@ -67,6 +78,10 @@ bool Collider::intersects(const Shape& shape) const {
     case ShapeType::OBB:
       return shape.intersects(static_cast<const OBB&>(*m_colliderShape));
 
+    case ShapeType::CONVEX_HULL:
+    case ShapeType::TRIANGLE_MESH:
+      return NarrowPhase::intersects(shape, *m_colliderShape);
+
     default:
       break;
   }
@@ -100,6 +115,10 @@ bool Collider::intersects(const Ray& ray, RayHit* hit) const {
       //return ray.intersects(static_cast<const OBB&>(*m_colliderShape), hit);
       break;
 
+    case ShapeType::CONVEX_HULL:
+    case ShapeType::TRIANGLE_MESH:
+      return m_colliderShape->intersects(ray, hit);
+
     default:
       break;
   }
@@ -107,4 +126,8 @@ bool Collider::intersects(const Ray& ray, RayHit* hit) const {
   throw std::invalid_argument("[Collider] Unhandled shape type to check an intersection with");
 }
 
+bool Collider::computeContact(const Shape& shape, ContactManifold& manifold) const {
+  return NarrowPhase::computeContact(shape, *m_colliderShape, manifold);
+}
+
 } // namespace Raz
@@ -0,0 +1,309 @@
+#include "RaZ/Data/Mesh.hpp"
+#include "RaZ/Physics/ConvexHull.hpp"
+#include "RaZ/Physics/NarrowPhase.hpp"
+
+#include "tracy/Tracy.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace Raz {
+
+namespace {
+
+constexpr float containmentTolerance = 0.00001f;
+
+std::vector<Vec3f> recoverPositions(const Mesh& mesh) {
+  std::vector<Vec3f> positions;
+  positions.reserve(mesh.recoverVertexCount());
+
+  for (const Submesh& submesh : mesh.getSubmeshes()) {
+    for (const Vertex& vertex : submesh.getVertices())
+      positions.emplace_back(vertex.position);
+  }
+
+  return positions;
+}
+
+/// Creates a face from three points, oriented so that its normal points away from the given interior point.
+ConvexHull::Face createFace(const std::vector<Vec3f>& points, std::uint32_t index1, std::uint32_t index2, std::uint32_t index3, const Vec3f& interiorPoint) {
+  ConvexHull::Face face { { index1, index2, index3 } };
+  face.normal   = (points[index2] - points[index1]).cross(points[index3] - points[index1]).normalize();
+  face.distance = face.normal.dot(points[index1]);
+
+  if (face.normal.dot(interiorPoint) > face.distance) {
+    std::swap(face.indices[1], face.indices[2]);
+    face.normal   = -face.normal;
+    face.distance = -face.distance;
+  }
+
+  return face;
+}
+
+} // namespace
+
+ConvexHull::ConvexHull(const std::vector<Vec3f>& points) {
+  ZoneScopedN("ConvexHull::ConvexHull");
+
+  if (points.size() < 4)
+    throw std::invalid_argument("[ConvexHull] At least 4 points are required to create a convex hull");
+
+  // The initial hull is a tetrahedron made of extreme points: the two farthest apart along the axis of largest extent,
+  //  the farthest from the line they form, & the farthest from the plane of these three
+  std::array<std::uint32_t, 3> minIndices {};
+  std::array<std::uint32_t, 3> maxIndices {};
+
+  for (std::uint32_t pointIndex = 0; pointIndex < points.size(); ++pointIndex) {
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+      if (points[pointIndex][axis] < points[minIndices[axis]][axis])
+        minIndices[axis] = pointIndex;
+
+      if (points[pointIndex][axis] > points[maxIndices[axis]][axis])
+        maxIndices[axis] = pointIndex;
+    }
+  }
+
+  std::size_t largestAxis = 0;
+
+  for (std::size_t axis = 1; axis < 3; ++axis) {
+    if (points[maxIndices[axis]][axis] - points[minIndices[axis]][axis] > points[maxIndices[largestAxis]][largestAxis] - points[minIndices[largestAxis]][largestAxis])
+      largestAxis = axis;
+  }
+
+  const float extent    = (points[maxIndices[largestAxis]] - points[minIndices[largestAxis]]).computeLength();
+  const float tolerance = std::max(extent, 1.f) * containmentTolerance;
+
+  const std::uint32_t firstIndex  = minIndices[largestAxis];
+  const std::uint32_t secondIndex = maxIndices[largestAxis];
+  const Vec3f lineDir = (points[secondIndex] - points[firstIndex]).normalize();
+
+  const auto findFarthest = [&points] (const auto& computeDistance) {
+    std::uint32_t farthestIndex = 0;
+    float farthestDist = 0.f;
+
+    for (std::uint32_t pointIndex = 0; pointIndex < points.size(); ++pointIndex) {
+      const float dist = computeDistance(points[pointIndex]);
+
+      if (dist > farthestDist) {
+        farthestIndex = pointIndex;
+        farthestDist  = dist;
+      }
+    }
+
+    return std::make_pair(farthestIndex, farthestDist);
+  };
+
+  const auto [thirdIndex, lineDist] = findFarthest([&points, firstIndex, &lineDir] (const Vec3f& point) {
+    const Vec3f offset = point - points[firstIndex];
+    return (offset - lineDir * offset.dot(lineDir)).computeLength();
+  });
+
+  const Vec3f planeNormal = (points[secondIndex] - points[firstIndex]).cross(points[thirdIndex] - points[firstIndex]).normalize();
+  const auto [fourthIndex, planeDist] = findFarthest([&points, firstIndex, &planeNormal] (const Vec3f& point) {
+    return std::abs(planeNormal.dot(point - points[firstIndex]));
+  });
+
+  if (extent <= tolerance || lineDist <= tolerance || planeDist <= tolerance)
+    throw std::invalid_argument("[ConvexHull] The points to create a convex hull from must not all be coplanar");
+
+  const Vec3f interiorPoint = (points[firstIndex] + points[secondIndex] + points[thirdIndex] + points[fourthIndex]) * 0.25f;
+
+  std::vector<Face> faces = {
+    createFace(points, firstIndex, secondIndex, thirdIndex, interiorPoint),
+    createFace(points, firstIndex, thirdIndex, fourthIndex, interiorPoint),
+    createFace(points, firstIndex, fourthIndex, secondIndex, interiorPoint),
+    createFace(points, secondIndex, fourthIndex, thirdIndex, interiorPoint)
+  };
+
+  // Each remaining point outside of the current hull replaces the faces it sees by new ones joining it to their boundary (the horizon)
+  std::vector<std::pair<std::uint32_t, std::uint32_t>> horizonEdges;
+
+  const auto addEdge = [&horizonEdges] (std::uint32_t index1, std::uint32_t index2) {
+    const auto edgeIt = std::ranges::find(horizonEdges, std::make_pair(index2, index1));
+
+    if (edgeIt != horizonEdges.end())
+      horizonEdges.erase(edgeIt);
+    else
+      horizonEdges.emplace_back(index1, index2);
+  };
+
+  // The points are processed from the farthest to the closest to the tetrahedron's center, so that those lying on the final hull's faces
+  //  or inside of it are in most cases skipped, instead of becoming superfluous vertices
+  std::vector<std::uint32_t> pointIndices(points.size());
+  std::iota(pointIndices.begin(), pointIndices.end(), 0);
+  std::ranges::sort(pointIndices, std::ranges::greater(), [&points, &interiorPoint] (std::uint32_t pointIndex) noexcept {
+    return (points[pointIndex] - interiorPoint).computeSquaredLength();
+  });
+
+  for (const std::uint32_t pointIndex : pointIndices) {
+    const Vec3f& point = points[pointIndex];
+
+    horizonEdges.clear();
+
+    std::erase_if(faces, [&point, tolerance, &addEdge] (const Face& face) {
+      if (face.normal.dot(point) - face.distance <= tolerance)
+        return false;
+
+      addEdge(face.indices[0], face.indices[1]);
+      addEdge(face.indices[1], face.indices[2]);
+      addEdge(face.indices[2], face.indices[0]);
+      return true;
+    });
+
+    for (const auto& [index1, index2] : horizonEdges)
+      faces.emplace_back(createFace(points, index1, index2, pointIndex, interiorPoint));
+  }
+
+  // Only keeping the points actually used by the faces, remapping their indices accordingly
+  std::vector<std::uint32_t> vertexIndices(points.size(), std::numeric_limits<std::uint32_t>::max());
+
+  for (Face& face : faces) {
+    for (std::uint32_t& index : face.indices) {
+      if (vertexIndices[index] == std::numeric_limits<std::uint32_t>::max()) {
+        vertexIndices[index] = static_cast<std::uint32_t>(m_vertices.size());
+        m_vertices.emplace_back(points[index]);
+      }
+
+      index = vertexIndices[index];
+    }
+  }
+
+  m_faces = std::move(faces);
+}
+
+ConvexHull::ConvexHull(const Mesh& mesh) : ConvexHull(recoverPositions(mesh)) {}
+
+bool ConvexHull::contains(const Vec3f& point) const {
+  return std::ranges::all_of(m_faces, [&point] (const Face& face) noexcept { return (face.normal.dot(point) - face.distance <= containmentTolerance); });
+}
+
+bool ConvexHull::intersects(const Line& line) const {
+  return NarrowPhase::intersects(*this, line);
+}
+
+bool ConvexHull::intersects(const Plane& plane) const {
+  return NarrowPhase::intersects(*this, plane);
+}
+
+bool ConvexHull::intersects(const Sphere& sphere) const {
+  return NarrowPhase::intersects(*this, sphere);
+}
+
+bool ConvexHull::intersects(const Triangle& triangle) const {
+  return NarrowPhase::intersects(*this, triangle);
+}
+
+bool ConvexHull::intersects(const Quad& quad) const {
+  return NarrowPhase::intersects(*this, quad);
+}
+
+bool ConvexHull::intersects(const AABB& aabb) const {
+  return NarrowPhase::intersects(*this, aabb);
+}
+
+bool ConvexHull::intersects(const OBB& obb) const {
+  return NarrowPhase::intersects(*this, obb);
+}
+
+bool ConvexHull::intersects(const Ray& ray, RayHit* hit) const {
+  // The ray is clipped by each face's plane; it hits the hull if it enters all of them before exiting any
+  float minHitDist = std::numeric_limits<float>::lowest();
+  float maxHitDist = std::numeric_limits<float>::max();
+  Vec3f hitNormal;
+
+  for (const Face& face : m_faces) {
+    const float dirAngle   = face.normal.dot(ray.getDirection());
+    const float originDist = face.distance - face.normal.dot(ray.getOrigin());
+
+    if (dirAngle == 0.f) {
+      if (originDist < 0.f)
+        return false; // The ray is parallel to & outside of the face's plane
+
+      continue;
+    }
+
+    const float hitDist = originDist / dirAngle;
+
+    if (dirAngle < 0.f) {
+      if (hitDist > minHitDist) {
+        minHitDist = hitDist;
+        hitNormal  = face.normal;
+      }
+    } else {
+      maxHitDist = std::min(maxHitDist, hitDist);
+    }
+
+    if (maxHitDist < std::max(minHitDist, 0.f))
+      return false;
+  }
+
+  // As with boxes, a negative distance means that the ray's origin is inside the hull, the hit position being behind the ray
+  if (hit) {
+    hit->position = ray.getOrigin() + ray.getDirection() * minHitDist;
+    hit->normal   = hitNormal;
+    hit->distance = minHitDist;
+  }
+
+  return true;
+}
+
+void ConvexHull::translate(const Vec3f& displacement) noexcept {
+  for (Vec3f& vertex : m_vertices)
+    vertex += displacement;
+
+  for (Face& face : m_faces)
+    face.distance += face.normal.dot(displacement);
+}
+
+Vec3f ConvexHull::computeProjection(const Vec3f& point) const {
+  if (contains(point))
+    return point;
+
+  Vec3f closestPoint;
+  float closestSqDist = std::numeric_limits<float>::max();
+
+  for (const Face& face : m_faces) {
+    // Only the faces the point is in front of can hold its projection
+    if (face.normal.dot(point) - face.distance <= 0.f)
+      continue;
+
+    const Vec3f projection = Triangle(m_vertices[face.indices[0]], m_vertices[face.indices[1]], m_vertices[face.indices[2]]).computeProjection(point);
+    const float sqDist     = (projection - point).computeSquaredLength();
+
+    if (sqDist < closestSqDist) {
+      closestPoint  = projection;
+      closestSqDist = sqDist;
+    }
+  }
+
+  return closestPoint;
+}
+
+Vec3f ConvexHull::computeCentroid() const {
+  Vec3f centroid;
+
+  for (const Vec3f& vertex : m_vertices)
+    centroid += vertex;
+
+  return centroid / static_cast<float>(m_vertices.size());
+}
+
+AABB ConvexHull::computeBoundingBox() const {
+  Vec3f minPos(std::numeric_limits<float>::max());
+  Vec3f maxPos(std::numeric_limits<float>::lowest());
+
+  for (const Vec3f& vertex : m_vertices) {
+    minPos = Vec3f(std::min(minPos.x(), vertex.x()), std::min(minPos.y(), vertex.y()), std::min(minPos.z(), vertex.z()));
+    maxPos = Vec3f(std::max(maxPos.x(), vertex.x()), std::max(maxPos.y(), vertex.y()), std::max(maxPos.z(), vertex.z()));
+  }
+
+  return AABB(minPos, maxPos);
+}
+
+Vec3f ConvexHull::computeSupport(const Vec3f& direction) const noexcept {
+  return *std::ranges::max_element(m_vertices, {}, [&direction] (const Vec3f& vertex) noexcept { return vertex.dot(direction); });
+}
+
+} // namespace Raz
@@ -0,0 +1,641 @@
+#include "RaZ/Physics/ConvexHull.hpp"
+#include "RaZ/Physics/NarrowPhase.hpp"
+#include "RaZ/Physics/TriangleMesh.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace Raz::NarrowPhase {
+
+namespace {
+
+constexpr int maxGjkIterationCount = 64;
+constexpr int maxEpaIterationCount = 64;
+constexpr float epaTolerance       = 0.0001f;
+constexpr float degeneracyEpsilon  = 0.000001f;
+
+/// Point of the Minkowski difference between two shapes, keeping the first shape's support point it has been computed from.
+struct SupportPoint {
+  Vec3f point {};
+  Vec3f firstPoint {};
+};
+
+struct Simplex {
+  std::array<SupportPoint, 4> points {};
+  std::size_t pointCount {};
+
+  void assign(std::initializer_list<SupportPoint> newPoints) {
+    std::ranges::copy(newPoints, points.begin());
+    pointCount = newPoints.size();
+  }
+};
+
+struct PolytopeFace {
+  std::array<std::size_t, 3> indices {};
+  Vec3f normal {};
+  float distance {};
+};
+
+bool isSolid(ShapeType shapeType) noexcept {
+  return (shapeType == ShapeType::SPHERE || shapeType == ShapeType::AABB || shapeType == ShapeType::OBB || shapeType == ShapeType::CONVEX_HULL);
+}
+
+/// Checks if a point penetrating a shape is inside of it, or right under its surface if it is a triangle.
+/// \param shape Shape to be checked.
+/// \param point Point to be checked.
+/// \param surfacePoint Point brought back onto the shape's surface along the contact normal.
+/// \return True if the point penetrates the shape, false otherwise.
+bool isPenetrating(const Shape& shape, const Vec3f& point, const Vec3f& surfacePoint) {
+  if (isSolid(shape.getType()))
+    return shape.contains(point);
+
+  return (shape.getType() == ShapeType::TRIANGLE && shape.contains(surfacePoint));
+}
+
+/// Recovers the vertices of a polyhedral shape.
+/// \param shape Shape to recover the vertices of.
+/// \return Shape's vertices; empty if the shape is not polyhedral.
+std::vector<Vec3f> recoverVertices(const Shape& shape) {
+  const auto getCorners = [] (const BoxCorners& corners) {
+    return std::vector<Vec3f>{ corners.minMinMin, corners.minMinMax, corners.minMaxMin, corners.minMaxMax,
+                               corners.maxMinMin, corners.maxMinMax, corners.maxMaxMin, corners.maxMaxMax };
+  };
+
+  switch (shape.getType()) {
+    case ShapeType::LINE:
+    {
+      const auto& line = static_cast<const Line&>(shape);
+      return { line.getBeginPos(), line.getEndPos() };
+    }
+
+    case ShapeType::TRIANGLE:
+    {
+      const auto& triangle = static_cast<const Triangle&>(shape);
+      return { triangle.getFirstPos(), triangle.getSecondPos(), triangle.getThirdPos() };
+    }
+
+    case ShapeType::QUAD:
+    {
+      const auto& quad = static_cast<const Quad&>(shape);
+      return { quad.getLeftTopPos(), quad.getRightTopPos(), quad.getRightBottomPos(), quad.getLeftBottomPos() };
+    }
+
+    case ShapeType::AABB:
+      return getCorners(static_cast<const AABB&>(shape).computeCorners());
+
+    case ShapeType::OBB:
+      return getCorners(static_cast<const OBB&>(shape).computeRotatedCorners());
+
+    case ShapeType::CONVEX_HULL:
+      return static_cast<const ConvexHull&>(shape).getVertices();
+
+    default:
+      return {};
+  }
+}
+
+/// Adds a contact point to a manifold, keeping only the deepest ones.
+/// \param manifold Manifold to add the point to.
+/// \param contactPoint Contact point to be added.
+void addContactPoint(ContactManifold& manifold, const ContactPoint& contactPoint) {
+  for (std::size_t pointIndex = 0; pointIndex < manifold.pointCount; ++pointIndex) {
+    if ((manifold.points[pointIndex].position - contactPoint.position).computeSquaredLength() <= epaTolerance * epaTolerance)
+      return;
+  }
+
+  const auto endIt    = manifold.points.begin() + static_cast<std::ptrdiff_t>(manifold.pointCount);
+  const auto insertIt = std::ranges::find_if(manifold.points.begin(), endIt, [&contactPoint] (const ContactPoint& point) noexcept {
+    return (point.penetrationDepth < contactPoint.penetrationDepth);
+  });
+
+  if (insertIt == manifold.points.end())
+    return;
+
+  std::move_backward(insertIt, (manifold.pointCount < ContactManifold::maxPointCount ? endIt : endIt - 1),
+                     (manifold.pointCount < ContactManifold::maxPointCount ? endIt + 1 : endIt));
+  *insertIt = contactPoint;
+  manifold.pointCount = std::min(manifold.pointCount + 1, ContactManifold::maxPointCount);
+}
+
+/// Swaps the roles of both shapes in a manifold, making it relative to the other shape.
+/// \param manifold Manifold to be swapped.
+void swapManifold(ContactManifold& manifold) {
+  for (std::size_t pointIndex = 0; pointIndex < manifold.pointCount; ++pointIndex) {
+    ContactPoint& point = manifold.points[pointIndex];
+    point.position += manifold.normal * point.penetrationDepth;
+  }
+
+  manifold.normal = -manifold.normal;
+}
+
+SupportPoint computeMinkowskiSupport(const Shape& shape1, const Shape& shape2, const Vec3f& direction) {
+  const Vec3f firstPoint = computeSupport(shape1, direction);
+  return { firstPoint - computeSupport(shape2, -direction), firstPoint };
+}
+
+bool isSameDirection(const Vec3f& direction1, const Vec3f& direction2) noexcept {
+  return (direction1.dot(direction2) > 0.f);
+}
+
+/// Updates the simplex to its feature closest to the origin, & computes the next search direction.
+/// \param simplex Simplex to be updated, whose first point is the last one added.
+/// \param direction Next search direction.
+/// \return True if the simplex contains the origin, false otherwise.
+bool updateSimplex(Simplex& simplex, Vec3f& direction) {
+  const SupportPoint a = simplex.points[0];
+  const Vec3f toOrigin = -a.point;
+
+  switch (simplex.pointCount) {
+    case 2:
+    {
+      const Vec3f ab = simplex.points[1].point - a.point;
+
+      if (isSameDirection(ab, toOrigin)) {
+        direction = ab.cross(toOrigin).cross(ab);
+      } else {
+        simplex.assign({ a });
+        direction = toOrigin;
+      }
+
+      break;
+    }
+
+    case 3:
+    {
+      const SupportPoint b = simplex.points[1];
+      const SupportPoint c = simplex.points[2];
+
+      const Vec3f ab  = b.point - a.point;
+      const Vec3f ac  = c.point - a.point;
+      const Vec3f abc = ab.cross(ac);
+
+      if (isSameDirection(abc.cross(ac), toOrigin)) {
+        if (isSameDirection(ac, toOrigin)) {
+          simplex.assign({ a, c });
+          direction = ac.cross(toOrigin).cross(ac);
+        } else {
+          simplex.assign({ a, b });
+          return updateSimplex(simplex, direction);
+        }
+      } else if (isSameDirection(ab.cross(abc), toOrigin)) {
+        simplex.assign({ a, b });
+        return updateSimplex(simplex, direction);
+      } else if (isSameDirection(abc, toOrigin)) {
+        direction = abc;
+      } else if (isSameDirection(-abc, toOrigin)) {
+        simplex.assign({ a, c, b });
+        direction = -abc;
+      } else {
+        return true; // The origin lies on the triangle
+      }
+
+      break;
+    }
+
+    case 4:
+    {
+      const SupportPoint b = simplex.points[1];
+      const SupportPoint c = simplex.points[2];
+      const SupportPoint d = simplex.points[3];
+
+      const Vec3f ab = b.point - a.point;
+      const Vec3f ac = c.point - a.point;
+      const Vec3f ad = d.point - a.point;
+
+      if (isSameDirection(ab.cross(ac), toOrigin)) {
+        simplex.assign({ a, b, c });
+        return updateSimplex(simplex, direction);
+      }
+
+      if (isSameDirection(ac.cross(ad), toOrigin)) {
+        simplex.assign({ a, c, d });
+        return updateSimplex(simplex, direction);
+      }
+
+      if (isSameDirection(ad.cross(ab), toOrigin)) {
+        simplex.assign({ a, d, b });
+        return updateSimplex(simplex, direction);
+      }
+
+      return true;
+    }
+
+    default:
+      direction = toOrigin;
+      break;
+  }
+
+  // A null direction means that the origin lies on the simplex
+  return (direction.computeSquaredLength() <= degeneracyEpsilon * degeneracyEpsilon);
+}
+
+/// Checks if the Minkowski difference of two convex shapes contains the origin, using the GJK algorithm.
+/// \param shape1 First shape to be checked.
+/// \param shape2 Second shape to be checked.
+/// \param simplex Final simplex, which contains the origin if both shapes intersect.
+/// \return True if both shapes intersect each other, false otherwise.
+bool runGjk(const Shape& shape1, const Shape& shape2, Simplex& simplex) {
+  Vec3f direction = shape1.computeCentroid() - shape2.computeCentroid();
+
+  if (direction.computeSquaredLength() <= degeneracyEpsilon * degeneracyEpsilon)
+    direction = Axis::X;
+
+  simplex.assign({ computeMinkowskiSupport(shape1, shape2, direction) });
+  direction = -simplex.points[0].point;
+
+  if (direction.computeSquaredLength() <= degeneracyEpsilon * degeneracyEpsilon)
+    return true;
+
+  for (int iterationIndex = 0; iterationIndex < maxGjkIterationCount; ++iterationIndex) {
+    const SupportPoint support = computeMinkowskiSupport(shape1, shape2, direction);
+
+    // If the new point did not get past the origin, the Minkowski difference cannot contain it
+    if (support.point.dot(direction) < 0.f)
+      return false;
+
+    std::move_backward(simplex.points.begin(), simplex.points.begin() + static_cast<std::ptrdiff_t>(simplex.pointCount),
+                       simplex.points.begin() + static_cast<std::ptrdiff_t>(simplex.pointCount) + 1);
+    simplex.points[0] = support;
+    ++simplex.pointCount;
+
+    if (updateSimplex(simplex, direction))
+      return true;
+  }
+
+  return false;
+}
+
+/// Completes a degenerate simplex into a tetrahedron, as required by EPA.
+/// \param shape1 First shape whose Minkowski difference the simplex belongs to.
+/// \param shape2 Second shape whose Minkowski difference the simplex belongs to.
+/// \param simplex Simplex to be completed.
+/// \return True if the simplex has been completed, false if the Minkowski difference is flat.
+bool completeSimplex(const Shape& shape1, const Shape& shape2, Simplex& simplex) {
+  constexpr std::array<Vec3f, 6> axes = { Axis::X, -Axis::X, Axis::Y, -Axis::Y, Axis::Z, -Axis::Z };
+
+  if (simplex.pointCount == 1) {
+    for (const Vec3f& axis : axes) {
+      const SupportPoint support = computeMinkowskiSupport(shape1, shape2, axis);
+
+      if ((support.point - simplex.points[0].point).computeSquaredLength() > degeneracyEpsilon) {
+        simplex.points[simplex.pointCount++] = support;
+        break;
+      }
+    }
+  }
+
+  if (simplex.pointCount == 2) {
+    const Vec3f lineDir = (simplex.points[1].point - simplex.points[0].point).normalize();
+    const Vec3f firstDir = lineDir.cross(std::abs(lineDir.x()) < 0.5f ? Axis::X : Axis::Y).normalize();
+    const Vec3f secondDir = lineDir.cross(firstDir);
+
+    for (const Vec3f& direction : { firstDir, -firstDir, secondDir, -secondDir }) {
+      const SupportPoint support = computeMinkowskiSupport(shape1, shape2, direction);
+      const Vec3f offset = support.point - simplex.points[0].point;
+
+      if ((offset - lineDir * offset.dot(lineDir)).computeSquaredLength() > degeneracyEpsilon) {
+        simplex.points[simplex.pointCount++] = support;
+        break;
+      }
+    }
+  }
+
+  if (simplex.pointCount == 3) {
+    const Vec3f normal = (simplex.points[1].point - simplex.points[0].point).cross(simplex.points[2].point - simplex.points[0].point).normalize();
+
+    for (const Vec3f& direction : { normal, -normal }) {
+      const SupportPoint support = computeMinkowskiSupport(shape1, shape2, direction);
+
+      if (std::abs(normal.dot(support.point - simplex.points[0].point)) > degeneracyEpsilon) {
+        simplex.points[simplex.pointCount++] = support;
+        break;
+      }
+    }
+  }
+
+  return (simplex.pointCount == 4);
+}
+
+PolytopeFace computeFace(const std::vector<SupportPoint>& vertices, std::size_t index1, std::size_t index2, std::size_t index3) {
+  PolytopeFace face { { index1, index2, index3 } };
+
+  const Vec3f& firstPoint = vertices[index1].point;
+  const Vec3f normal      = (vertices[index2].point - firstPoint).cross(vertices[index3].point - firstPoint);
+  const float normalLength = normal.computeLength();
+
+  if (normalLength <= degeneracyEpsilon) {
+    // A degenerate face can never be the closest one
+    face.distance = std::numeric_limits<float>::max();
+    return face;
+  }
+
+  face.normal   = normal / normalLength;
+  face.distance = face.normal.dot(firstPoint);
+
+  return face;
+}
+
+/// Computes the penetration of two convex shapes from the simplex enclosing the origin, using the EPA algorithm.
+/// \param shape1 First shape to compute the contact of.
+/// \param shape2 Second shape to compute the contact of.
+/// \param simplex Tetrahedron enclosing the origin, as found by GJK.
+/// \param manifold Computed contact manifold.
+void runEpa(const Shape& shape1, const Shape& shape2, const Simplex& simplex, ContactManifold& manifold) {
+  std::vector<SupportPoint> vertices(simplex.points.cbegin(), simplex.points.cend());
+
+  // The origin may lie on the simplex's boundary, hence the faces being oriented relatively to its center; the faces created afterward
+  //  are given the same winding as the ones they replace
+  if ((vertices[1].point - vertices[0].point).cross(vertices[2].point - vertices[0].point).dot(vertices[3].point - vertices[0].point) > 0.f)
+    std::swap(vertices[1], vertices[2]);
+
+  std::vector<PolytopeFace> faces = { computeFace(vertices, 0, 1, 2), computeFace(vertices, 0, 3, 1),
+                                      computeFace(vertices, 0, 2, 3), computeFace(vertices, 1, 3, 2) };
+  std::vector<std::pair<std::size_t, std::size_t>> horizonEdges;
+
+  auto closestFaceIt = faces.begin();
+
+  for (int iterationIndex = 0; iterationIndex < maxEpaIterationCount; ++iterationIndex) {
+    closestFaceIt = std::ranges::min_element(faces, {}, &PolytopeFace::distance);
+    const PolytopeFace closestFace = *closestFaceIt;
+
+    const SupportPoint support = computeMinkowskiSupport(shape1, shape2, closestFace.normal);
+
+    // If the polytope cannot be expanded further in this direction, its closest face is on the Minkowski difference's boundary
+    if (closestFace.normal.dot(support.point) - closestFace.distance <= epaTolerance)
+      break;
+
+    // Removing all faces seen by the new point, keeping the edges of the hole they leave
+    horizonEdges.clear();
+
+    const auto addEdge = [&horizonEdges] (std::size_t index1, std::size_t index2) {
+      const auto edgeIt = std::ranges::find(horizonEdges, std::make_pair(index2, index1));
+
+      if (edgeIt != horizonEdges.end())
+        horizonEdges.erase(edgeIt);
+      else
+        horizonEdges.emplace_back(index1, index2);
+    };
+
+    std::erase_if(faces, [&vertices, &support, &addEdge] (const PolytopeFace& face) {
+      if (face.normal.dot(support.point - vertices[face.indices[0]].point) <= 0.f)
+        return false;
+
+      addEdge(face.indices[0], face.indices[1]);
+      addEdge(face.indices[1], face.indices[2]);
+      addEdge(face.indices[2], face.indices[0]);
+      return true;
+    });
+
+    if (horizonEdges.empty()) {
+      faces.emplace_back(closestFace);
+      closestFaceIt = faces.end() - 1;
+      break;
+    }
+
+    const std::size_t supportIndex = vertices.size();
+    vertices.emplace_back(support);
+
+    for (const auto& [index1, index2] : horizonEdges)
+      faces.emplace_back(computeFace(vertices, index1, index2, supportIndex));
+
+    closestFaceIt = std::ranges::min_element(faces, {}, &PolytopeFace::distance);
+  }
+
+  const PolytopeFace& closestFace = *closestFaceIt;
+
+  // The contact point is found from the barycentric coordinates of the origin's projection onto the closest face
+  const SupportPoint& a = vertices[closestFace.indices[0]];
+  const SupportPoint& b = vertices[closestFace.indices[1]];
+  const SupportPoint& c = vertices[closestFace.indices[2]];
+
+  const Vec3f projection = closestFace.normal * closestFace.distance;
+  const Vec3f ab = b.point - a.point;
+  const Vec3f ac = c.point - a.point;
+  const Vec3f ap = projection - a.point;
+
+  const float abDotAb = ab.dot(ab);
+  const float abDotAc = ab.dot(ac);
+  const float acDotAc = ac.dot(ac);
+  const float denominator = abDotAb * acDotAc - abDotAc * abDotAc;
+
+  Vec3f contactPos = a.firstPoint;
+
+  if (std::abs(denominator) > degeneracyEpsilon * degeneracyEpsilon) {
+    const float v = (acDotAc * ap.dot(ab) - abDotAc * ap.dot(ac)) / denominator;
+    const float w = (abDotAb * ap.dot(ac) - abDotAc * ap.dot(ab)) / denominator;
+    contactPos = a.firstPoint * (1.f - v - w) + b.firstPoint * v + c.firstPoint * w;
+  }
+
+  // The Minkowski difference's normal points towards the second shape, which the first must be moved away from
+  manifold.normal     = -closestFace.normal;
+  manifold.pointCount = 0;
+  addContactPoint(manifold, ContactPoint{ contactPos, closestFace.distance });
+
+  // Polyhedra in contact along a face or an edge have several contact points; these are approximated by their vertices inside the other shape
+  const Vec3f& penetrationDir = closestFace.normal;
+  const Vec3f secondContactPos = contactPos - penetrationDir * closestFace.distance;
+
+  for (const Vec3f& vertex : recoverVertices(shape1)) {
+    const float depth = closestFace.distance - (contactPos - vertex).dot(penetrationDir);
+
+    if (depth > 0.f && isPenetrating(shape2, vertex, vertex - penetrationDir * depth))
+      addContactPoint(manifold, ContactPoint{ vertex, depth });
+  }
+
+  for (const Vec3f& vertex : recoverVertices(shape2)) {
+    const float depth = closestFace.distance - (vertex - secondContactPos).dot(penetrationDir);
+
+    if (depth > 0.f && isPenetrating(shape1, vertex, vertex + penetrationDir * depth))
+      addContactPoint(manifold, ContactPoint{ vertex + penetrationDir * depth, depth });
+  }
+}
+
+/// Computes the contact between a bounded convex shape & a plane.
+/// \param shape Convex shape to compute the contact of.
+/// \param plane Plane to compute the contact with.
+/// \param manifold Computed contact manifold, whose normal is the plane's.
+/// \return True if the shape is in contact with the plane, false otherwise.
+bool computePlaneContact(const Shape& shape, const Plane& plane, ContactManifold& manifold) {
+  const Vec3f deepestPoint = computeSupport(shape, -plane.getNormal());
+  const float deepestDepth = plane.getDistance() - plane.getNormal().dot(deepestPoint);
+
+  if (deepestDepth < 0.f)
+    return false;
+
+  manifold.normal     = plane.getNormal();
+  manifold.pointCount = 0;
+  addContactPoint(manifold, ContactPoint{ deepestPoint, deepestDepth });
+
+  for (const Vec3f& vertex : recoverVertices(shape)) {
+    const float depth = plane.getDistance() - plane.getNormal().dot(vertex);
+
+    if (depth >= 0.f)
+      addContactPoint(manifold, ContactPoint{ vertex, depth });
+  }
+
+  return true;
+}
+
+/// Computes the contact between a triangle mesh & another shape, merging the contacts of all triangles.
+/// \param mesh Triangle mesh to compute the contact of.
+/// \param shape Shape to compute the contact with.
+/// \param isMeshFirst True if the mesh is the first shape of the contact, false otherwise.
+/// \param manifold Computed contact manifold.
+/// \return True if any triangle is in contact with the shape, false otherwise.
+bool computeMeshContact(const TriangleMesh& mesh, const Shape& shape, bool isMeshFirst, ContactManifold& manifold) {
+  std::vector<std::size_t> triangleIndices;
+
+  if (shape.getType() == ShapeType::PLANE)
+    mesh.findTriangles(mesh.computeBoundingBox(), triangleIndices);
+  else
+    mesh.findTriangles(shape.computeBoundingBox(), triangleIndices);
+
+  ContactManifold mergedManifold;
+
+  for (const std::size_t triangleIndex : triangleIndices) {
+    const Triangle& triangle = mesh.getTriangles()[triangleIndex];
+
+    ContactManifold triangleManifold;
+
+    if (!(isMeshFirst ? computeContact(triangle, shape, triangleManifold) : computeContact(shape, triangle, triangleManifold)))
+      continue;
+
+    if (mergedManifold.pointCount == 0 || triangleManifold.points[0].penetrationDepth > mergedManifold.points[0].penetrationDepth)
+      mergedManifold.normal = triangleManifold.normal;
+
+    for (std::size_t pointIndex = 0; pointIndex < triangleManifold.pointCount; ++pointIndex)
+      addContactPoint(mergedManifold, triangleManifold.points[pointIndex]);
+  }
+
+  if (mergedManifold.pointCount == 0)
+    return false;
+
+  manifold = mergedManifold;
+  return true;
+}
+
+} // namespace
+
+Vec3f computeSupport(const Shape& shape, const Vec3f& direction) {
+  const auto findFarthest = [&direction] (const auto& points) {
+    return *std::ranges::max_element(points, {}, [&direction] (const Vec3f& point) noexcept { return point.dot(direction); });
+  };
+
+  switch (shape.getType()) {
+    case ShapeType::LINE:
+    {
+      const auto& line = static_cast<const Line&>(shape);
+      return findFarthest(std::array<Vec3f, 2>{ line.getBeginPos(), line.getEndPos() });
+    }
+
+    case ShapeType::SPHERE:
+    {
+      const auto& sphere = static_cast<const Sphere&>(shape);
+      const float dirLength = direction.computeLength();
+      return (dirLength > 0.f ? sphere.getCenter() + direction * (sphere.getRadius() / dirLength) : sphere.getCenter());
+    }
+
+    case ShapeType::TRIANGLE:
+    {
+      const auto& triangle = static_cast<const Triangle&>(shape);
+      return findFarthest(std::array<Vec3f, 3>{ triangle.getFirstPos(), triangle.getSecondPos(), triangle.getThirdPos() });
+    }
+
+    case ShapeType::QUAD:
+    {
+      const auto& quad = static_cast<const Quad&>(shape);
+      return findFarthest(std::array<Vec3f, 4>{ quad.getLeftTopPos(), quad.getRightTopPos(), quad.getRightBottomPos(), quad.getLeftBottomPos() });
+    }
+
+    case ShapeType::AABB:
+    {
+      const auto& aabb = static_cast<const AABB&>(shape);
+      return Vec3f(direction.x() >= 0.f ? aabb.getMaxPosition().x() : aabb.getMinPosition().x(),
+                   direction.y() >= 0.f ? aabb.getMaxPosition().y() : aabb.getMinPosition().y(),
+                   direction.z() >= 0.f ? aabb.getMaxPosition().z() : aabb.getMinPosition().z());
+    }
+
+    case ShapeType::OBB:
+    {
+      // The support point is found in the box's local space, then rotated back around its centroid
+      const auto& obb = static_cast<const OBB&>(shape);
+      const Vec3f centroid = obb.computeCentroid();
+      return centroid + obb.getRotation() * (computeSupport(obb.getOriginalBox(), obb.getInverseRotation() * direction) - centroid);
+    }
+
+    case ShapeType::CONVEX_HULL:
+      return static_cast<const ConvexHull&>(shape).computeSupport(direction);
+
+    default:
+      break;
+  }
+
+  throw std::invalid_argument("[NarrowPhase] Support points can only be computed for bounded convex shapes");
+}
+
+bool intersects(const Shape& shape1, const Shape& shape2) {
+  if (shape1.getType() == ShapeType::TRIANGLE_MESH || shape2.getType() == ShapeType::TRIANGLE_MESH) {
+    const bool isMeshFirst   = (shape1.getType() == ShapeType::TRIANGLE_MESH);
+    const auto& mesh         = static_cast<const TriangleMesh&>(isMeshFirst ? shape1 : shape2);
+    const Shape& otherShape  = (isMeshFirst ? shape2 : shape1);
+
+    std::vector<std::size_t> triangleIndices;
+    mesh.findTriangles((otherShape.getType() == ShapeType::PLANE ? mesh.computeBoundingBox() : otherShape.computeBoundingBox()), triangleIndices);
+
+    return std::ranges::any_of(triangleIndices, [&mesh, &otherShape] (std::size_t triangleIndex) {
+      return intersects(mesh.getTriangles()[triangleIndex], otherShape);
+    });
+  }
+
+  if (shape1.getType() == ShapeType::PLANE || shape2.getType() == ShapeType::PLANE) {
+    if (shape1.getType() == shape2.getType())
+      return static_cast<const Plane&>(shape1).intersects(static_cast<const Plane&>(shape2));
+
+    const bool isPlaneFirst = (shape1.getType() == ShapeType::PLANE);
+    const auto& plane       = static_cast<const Plane&>(isPlaneFirst ? shape1 : shape2);
+    const Shape& otherShape = (isPlaneFirst ? shape2 : shape1);
+
+    // The shape intersects the plane if its extremities along the plane's normal are on both sides of it
+    const float minDist = plane.getNormal().dot(computeSupport(otherShape, -plane.getNormal()));
+    const float maxDist = plane.getNormal().dot(computeSupport(otherShape, plane.getNormal()));
+    return (minDist <= plane.getDistance() && maxDist >= plane.getDistance());
+  }
+
+  Simplex simplex;
+  return runGjk(shape1, shape2, simplex);
+}
+
+bool computeContact(const Shape& shape1, const Shape& shape2, ContactManifold& manifold) {
+  if (shape1.getType() == ShapeType::TRIANGLE_MESH)
+    return computeMeshContact(static_cast<const TriangleMesh&>(shape1), shape2, true, manifold);
+
+  if (shape2.getType() == ShapeType::TRIANGLE_MESH)
+    return computeMeshContact(static_cast<const TriangleMesh&>(shape2), shape1, false, manifold);
+
+  if (shape1.getType() == ShapeType::PLANE && shape2.getType() == ShapeType::PLANE)
+    return false;
+
+  if (shape2.getType() == ShapeType::PLANE)
+    return computePlaneContact(shape1, static_cast<const Plane&>(shape2), manifold);
+
+  if (shape1.getType() == ShapeType::PLANE) {
+    if (!computePlaneContact(shape2, static_cast<const Plane&>(shape1), manifold))
+      return false;
+
+    swapManifold(manifold);
+    return true;
+  }
+
+  Simplex simplex;
+
+  if (!runGjk(shape1, shape2, simplex) || !completeSimplex(shape1, shape2, simplex))
+    return false;
+
+  runEpa(shape1, shape2, simplex, manifold);
+  return true;
+}
+
+} // namespace Raz::NarrowPhase
@@ -1,21 +1,242 @@
 #include "RaZ/Application.hpp"
 #include "RaZ/Math/Transform.hpp"
 #include "RaZ/Physics/Collider.hpp"
+#include "RaZ/Physics/ConvexHull.hpp"
+#include "RaZ/Physics/NarrowPhase.hpp"
 #include "RaZ/Physics/RigidBody.hpp"
 #include "RaZ/Physics/PhysicsSystem.hpp"
 #include "RaZ/Utils/Shape.hpp"
+#include "RaZ/Utils/Threading.hpp"
 
 #include "tracy/Tracy.hpp"
 
+#include <algorithm>
+#include <array>
+
 namespace Raz {
 
+namespace {
+
+constexpr std::size_t maxLeafColliderCount = 4;
+constexpr float contactMargin = 0.01f; ///< Distance under which a rigid body is considered touching a collider.
+
+bool isQueryable(const Entity& entity, std::uint32_t layerMask) {
+  // The collider may have been removed since the query structure's last update
+  if (!entity.isEnabled() || !entity.hasComponent<Collider>())
+    return false;
+
+  const auto& collider = entity.getComponent<Collider>();
+  return (collider.hasShape() && (collider.getLayerMask() & layerMask) != 0);
+}
+
+/// Checks if the collider's shape can be stored into the query structure, which requires it to have a bounding box.
+bool isBounded(const Collider& collider) {
+  return (collider.hasShape() && collider.getShapeType() != ShapeType::PLANE);
+}
+
+Vec3f computeColliderPosition(const Entity& entity) {
+  // Colliders are defined in local space, only translated by their entity's position
+  return (entity.hasComponent<Transform>() ? entity.getComponent<Transform>().getPosition() : Vec3f(0.f));
+}
+
+AABB computeColliderBox(const Entity& entity) {
+  AABB box = entity.getComponent<Collider>().getShape().computeBoundingBox();
+  box.translate(computeColliderPosition(entity));
+  return box;
+}
+
+AABB mergeBoxes(const AABB& box1, const AABB& box2) {
+  return AABB(Vec3f(std::min(box1.getMinPosition().x(), box2.getMinPosition().x()),
+                    std::min(box1.getMinPosition().y(), box2.getMinPosition().y()),
+                    std::min(box1.getMinPosition().z(), box2.getMinPosition().z())),
+              Vec3f(std::max(box1.getMaxPosition().x(), box2.getMaxPosition().x()),
+                    std::max(box1.getMaxPosition().y(), box2.getMaxPosition().y()),
+                    std::max(box1.getMaxPosition().z(), box2.getMaxPosition().z())));
+}
+
+/// Casts a ray onto an entity's collider.
+/// \param entity Entity holding the collider.
+/// \param ray Ray to be cast, in world space.
+/// \param hit Ray intersection's information, in world space.
+/// \return True if the collider has been hit in front of the ray, false otherwise.
+bool intersectsCollider(const Entity& entity, const Ray& ray, RayHit& hit) {
+  const auto& collider = entity.getComponent<Collider>();
+
+  switch (collider.getShapeType()) {
+    case ShapeType::PLANE:
+    case ShapeType::SPHERE:
+    case ShapeType::TRIANGLE:
+    case ShapeType::AABB:
+    case ShapeType::CONVEX_HULL:
+    case ShapeType::TRIANGLE_MESH:
+      break;
+
+    default:
+      return false; // Ray intersections are not available with other shapes
+  }
+
+  const Vec3f colliderPos = computeColliderPosition(entity);
+
+  if (!collider.intersects(Ray(ray.getOrigin() - colliderPos, ray.getDirection()), &hit) || hit.distance < 0.f)
+    return false;
+
+  hit.position += colliderPos;
+  return true;
+}
+
+/// Moves a sphere onto an entity's collider, by casting a ray from the sphere's center onto the collider's shape expanded by its radius.
+/// \param entity Entity holding the collider.
+/// \param ray Ray starting from the sphere's center, in world space.
+/// \param radius Radius of the sphere.
+/// \param hit Contact's information, in world space.
+/// \return True if the collider has been touched, false otherwise.
+bool sweepCollider(const Entity& entity, const Ray& ray, float radius, RayHit& hit) {
+  const auto& collider    = entity.getComponent<Collider>();
+  const Vec3f colliderPos = computeColliderPosition(entity);
+  const Ray localRay(ray.getOrigin() - colliderPos, ray.getDirection());
+
+  bool isHit = false;
+
+  switch (collider.getShapeType()) {
+    case ShapeType::PLANE:
+    {
+      const auto& plane = collider.getShape<Plane>();
+      isHit = localRay.intersects(Plane(plane.getDistance() + radius, plane.getNormal()), &hit);
+      break;
+    }
+
+    case ShapeType::SPHERE:
+    {
+      const auto& sphere = collider.getShape<Sphere>();
+      isHit = localRay.intersects(Sphere(sphere.getCenter(), sphere.getRadius() + radius), &hit);
+      break;
+    }
+
+    case ShapeType::AABB:
+    {
+      const auto& box = collider.getShape<AABB>();
+      isHit = localRay.intersects(AABB(box.getMinPosition() - radius, box.getMaxPosition() + radius), &hit);
+      break;
+    }
+
+    default:
+      break;
+  }
+
+  if (!isHit || hit.distance < 0.f)
+    return false;
+
+  // The hit position is the sphere's center at the time of contact; the contact point is on its surface
+  hit.position += colliderPos - hit.normal * radius;
+  return true;
+}
+
+/// Checks if a rigid body's collider can be moved & thus be separated from the others with a contact manifold, which requires it to be
+///  a solid convex shape.
+/// \param entity Entity holding the rigid body.
+/// \return True if the rigid body has such a collider, false otherwise.
+bool hasSolidCollider(const Entity& entity) {
+  if (!entity.hasComponent<Collider>() || !entity.getComponent<Collider>().hasShape())
+    return false;
+
+  const ShapeType shapeType = entity.getComponent<Collider>().getShapeType();
+  return (shapeType == ShapeType::SPHERE || shapeType == ShapeType::AABB || shapeType == ShapeType::OBB || shapeType == ShapeType::CONVEX_HULL);
+}
+
+/// Computes the contact between a rigid body's solid collider & another entity's collider.
+/// \param bodyEntity Entity holding the rigid body & its solid collider.
+/// \param colliderEntity Entity holding the other collider.
+/// \param manifold Computed contact manifold, whose normal points from the other collider towards the rigid body's.
+/// \return True if both colliders are in contact, false otherwise.
+bool computeBodyContact(const Entity& bodyEntity, const Entity& colliderEntity, ContactManifold& manifold) {
+  const auto& bodyCollider = bodyEntity.getComponent<Collider>();
+  const auto& collider     = colliderEntity.getComponent<Collider>();
+
+  // The contact is computed in the other collider's local space, into which the body's shape must be translated
+  const Vec3f offset = computeColliderPosition(bodyEntity) - computeColliderPosition(colliderEntity);
+
+  const auto computeContact = [&collider, &offset, &manifold] (auto shape) {
+    shape.translate(offset);
+    return collider.computeContact(shape, manifold);
+  };
+
+  switch (bodyCollider.getShapeType()) {
+    case ShapeType::SPHERE:
+      return computeContact(bodyCollider.getShape<Sphere>());
+
+    case ShapeType::AABB:
+      return computeContact(bodyCollider.getShape<AABB>());
+
+    case ShapeType::OBB:
+      return computeContact(bodyCollider.getShape<OBB>());
+
+    case ShapeType::CONVEX_HULL:
+      return computeContact(bodyCollider.getShape<ConvexHull>());
+
+    default:
+      break;
+  }
+
+  return false;
+}
+
+/// Checks if a rigid body touches a collider, according to their bounding boxes.
+/// \param entity Entity holding the rigid body, which is handled as a point if it has no collider.
+/// \param colliderBox Bounding box of the collider in world space; if none, the collider is unbounded & always considered touched.
+/// \return True if the rigid body touches the collider, false otherwise.
+bool isTouching(const Entity& entity, const std::optional<AABB>& colliderBox) {
+  if (!colliderBox)
+    return true;
+
+  const AABB expandedBox(colliderBox->getMinPosition() - contactMargin, colliderBox->getMaxPosition() + contactMargin);
+
+  if (entity.hasComponent<Collider>() && isBounded(entity.getComponent<Collider>()))
+    return expandedBox.intersects(computeColliderBox(entity));
+
+  return expandedBox.contains(computeColliderPosition(entity));
+}
+
+/// Checks if an entity's collider overlaps the given shape.
+/// \param entity Entity holding the collider.
+/// \param shape Shape to check the overlap with, in world space.
+/// \return True if both overlap, false otherwise.
+template <typename ShapeT>
+bool overlapsCollider(const Entity& entity, ShapeT shape) {
+  const auto& collider = entity.getComponent<Collider>();
+
+  shape.translate(-computeColliderPosition(entity));
+
+  // The pairs whose intersection is not implemented by the shapes themselves are checked by the narrow phase
+  const bool isHandledByShapes = (collider.getShapeType() != ShapeType::OBB
+                               && (std::is_same_v<ShapeT, Sphere> || (collider.getShapeType() != ShapeType::TRIANGLE && collider.getShapeType() != ShapeType::QUAD)));
+
+  return (isHandledByShapes ? collider.intersects(shape) : NarrowPhase::intersects(collider.getShape(), shape));
+}
+
+} // namespace
+
 PhysicsSystem::PhysicsSystem() {
   registerComponents<Collider, RigidBody>();
 }
 
+void PhysicsSystem::setGravity(const Vec3f& gravity) {
+  if (gravity.strictlyEquals(m_gravity))
+    return;
+
+  m_gravity = gravity;
+
+  // Bodies at rest may no longer be under a different gravity
+  for (Entity* entity : m_entities) {
+    if (entity->hasComponent<RigidBody>())
+      entity->getComponent<RigidBody>().wakeUp();
+  }
+}
+
 bool PhysicsSystem::update(const FrameTimeInfo& timeInfo) {
   ZoneScopedN("PhysicsSystem::update");
 
+  wakeDisturbedBodies();
+
   const float relativeFriction = std::pow(m_friction, timeInfo.substepTime);
 
   for (int i = 0; i < timeInfo.substepCount; ++i) {
@@ -25,14 +246,14 @@ bool PhysicsSystem::update(const FrameTimeInfo& timeInfo) {
 
       auto& rigidBody = entity->getComponent<RigidBody>();
 
-      if (rigidBody.getMass() <= 0.f)
+      if (rigidBody.getMass() <= 0.f || rigidBody.isSleeping())
         continue;
 
       const Vec3f acceleration = (rigidBody.getMass() * m_gravity + rigidBody.getForces()) * rigidBody.getInvMass();
       const Vec3f oldVelocity  = rigidBody.getVelocity();
 
       const Vec3f velocity = oldVelocity * relativeFriction + acceleration * timeInfo.substepTime;
-      rigidBody.setVelocity(velocity);
+      rigidBody.m_velocity = velocity;
 
       auto& transform = entity->getComponent<Transform>();
 
@@ -46,11 +267,268 @@ bool PhysicsSystem::update(const FrameTimeInfo& timeInfo) {
     }
 
     solveConstraints();
+    updateSleepingBodies(timeInfo.substepTime);
   }
 
+  updateQueryStructure();
+
   return true;
 }
 
+void PhysicsSystem::updateQueryStructure() {
+  ZoneScopedN("PhysicsSystem::updateQueryStructure");
+
+  // Colliders may have changed shape, in which case they may need to be moved from one list to the other, or have been removed from
+  //  entities which are still linked through their rigid body
+  m_queryStructureDirty = m_queryStructureDirty
+                       || std::ranges::any_of(m_queryColliders, [] (const Entity* entity) {
+                            return (!entity->hasComponent<Collider>() || !isBounded(entity->getComponent<Collider>()));
+                          })
+                       || std::ranges::any_of(m_unboundedColliders, [] (const Entity* entity) {
+                            return (!entity->hasComponent<Collider>() || isBounded(entity->getComponent<Collider>()));
+                          });
+
+  if (!m_queryStructureDirty) {
+    // Refitting the nodes' bounding boxes; children being stored after their parent, iterating in reverse guarantees them to be updated first
+    for (auto nodeIt = m_queryNodes.rbegin(); nodeIt != m_queryNodes.rend(); ++nodeIt) {
+      QueryNode& node = *nodeIt;
+
+      if (node.colliderCount == 0) {
+        node.boundingBox = mergeBoxes(m_queryNodes[node.firstIndex].boundingBox, m_queryNodes[node.firstIndex + 1].boundingBox);
+        continue;
+      }
+
+      node.boundingBox = computeColliderBox(*m_queryColliders[node.firstIndex]);
+
+      for (std::uint32_t colliderIndex = node.firstIndex + 1; colliderIndex < node.firstIndex + node.colliderCount; ++colliderIndex)
+        node.boundingBox = mergeBoxes(node.boundingBox, computeColliderBox(*m_queryColliders[colliderIndex]));
+    }
+
+    return;
+  }
+
+  m_queryNodes.clear();
+  m_queryColliders.clear();
+  m_unboundedColliders.clear();
+
+  std::vector<std::pair<Entity*, AABB>> colliderBoxes;
+
+  for (Entity* entity : m_entities) {
+    if (!entity->hasComponent<Collider>())
+      continue;
+
+    if (isBounded(entity->getComponent<Collider>()))
+      colliderBoxes.emplace_back(entity, computeColliderBox(*entity));
+    else
+      m_unboundedColliders.emplace_back(entity);
+  }
+
+  if (!colliderBoxes.empty()) {
+    m_queryNodes.reserve(2 * colliderBoxes.size() / maxLeafColliderCount + 1);
+    m_queryNodes.emplace_back();
+    buildQueryNode(colliderBoxes, 0, 0, colliderBoxes.size());
+
+    m_queryColliders.reserve(colliderBoxes.size());
+    for (const auto& [entity, box] : colliderBoxes)
+      m_queryColliders.emplace_back(entity);
+  }
+
+  m_queryStructureDirty = false;
+}
+
+Entity* PhysicsSystem::raycast(const Ray& ray, RayHit* hit, float maxDistance, std::uint32_t layerMask) const {
+  Entity* closestEntity = nullptr;
+  RayHit closestHit;
+  closestHit.distance = maxDistance;
+
+  traverseQueryStructure(ray, maxDistance, 0.f, layerMask, [&ray, &closestEntity, &closestHit] (Entity& entity) {
+    RayHit colliderHit;
+
+    if (intersectsCollider(entity, ray, colliderHit) && colliderHit.distance <= closestHit.distance) {
+      closestEntity = &entity;
+      closestHit    = colliderHit;
+    }
+
+    return closestHit.distance;
+  });
+
+  if (closestEntity && hit)
+    *hit = closestHit;
+
+  return closestEntity;
+}
+
+std::vector<ColliderHit> PhysicsSystem::raycastAll(const Ray& ray, float maxDistance, std::uint32_t layerMask) const {
+  std::vector<ColliderHit> hits;
+
+  traverseQueryStructure(ray, maxDistance, 0.f, layerMask, [&ray, maxDistance, &hits] (Entity& entity) {
+    RayHit colliderHit;
+
+    if (intersectsCollider(entity, ray, colliderHit) && colliderHit.distance <= maxDistance)
+      hits.emplace_back(ColliderHit{ &entity, colliderHit });
+
+    return maxDistance;
+  });
+
+  std::ranges::sort(hits, [] (const ColliderHit& hit1, const ColliderHit& hit2) noexcept { return (hit1.hit.distance < hit2.hit.distance); });
+
+  return hits;
+}
+
+std::vector<ColliderHit> PhysicsSystem::raycastBatch(const std::vector<Ray>& rays, float maxDistance, std::uint32_t layerMask) const {
+  ZoneScopedN("PhysicsSystem::raycastBatch");
+
+  std::vector<ColliderHit> hits(rays.size());
+
+  if (rays.empty())
+    return hits;
+
+  Threading::parallelize(0, rays.size(), [this, &rays, maxDistance, layerMask, &hits] (const Threading::IndexRange& range) {
+    for (std::size_t rayIndex = range.beginIndex; rayIndex < range.endIndex; ++rayIndex)
+      hits[rayIndex].entity = raycast(rays[rayIndex], &hits[rayIndex].hit, maxDistance, layerMask);
+  });
+
+  return hits;
+}
+
+std::vector<Entity*> PhysicsSystem::overlap(const Sphere& sphere, std::uint32_t layerMask) const {
+  std::vector<Entity*> entities;
+
+  traverseQueryStructure(sphere.computeBoundingBox(), layerMask, [&sphere, &entities] (Entity& entity) {
+    if (overlapsCollider(entity, sphere))
+      entities.emplace_back(&entity);
+  });
+
+  return entities;
+}
+
+std::vector<Entity*> PhysicsSystem::overlap(const AABB& box, std::uint32_t layerMask) const {
+  std::vector<Entity*> entities;
+
+  traverseQueryStructure(box, layerMask, [&box, &entities] (Entity& entity) {
+    if (overlapsCollider(entity, box))
+      entities.emplace_back(&entity);
+  });
+
+  return entities;
+}
+
+std::vector<std::vector<Entity*>> PhysicsSystem::overlapBatch(const std::vector<Sphere>& spheres, std::uint32_t layerMask) const {
+  ZoneScopedN("PhysicsSystem::overlapBatch");
+
+  std::vector<std::vector<Entity*>> entities(spheres.size());
+
+  if (spheres.empty())
+    return entities;
+
+  Threading::parallelize(0, spheres.size(), [this, &spheres, layerMask, &entities] (const Threading::IndexRange& range) {
+    for (std::size_t sphereIndex = range.beginIndex; sphereIndex < range.endIndex; ++sphereIndex)
+      entities[sphereIndex] = overlap(spheres[sphereIndex], layerMask);
+  });
+
+  return entities;
+}
+
+Entity* PhysicsSystem::sweep(const Sphere& sphere, const Vec3f& direction, RayHit* hit, float maxDistance, std::uint32_t layerMask) const {
+  const Ray ray(sphere.getCenter(), direction);
+
+  Entity* closestEntity = nullptr;
+  RayHit closestHit;
+  closestHit.distance = maxDistance;
+
+  traverseQueryStructure(ray, maxDistance, sphere.getRadius(), layerMask, [&ray, &sphere, &closestEntity, &closestHit] (Entity& entity) {
+    RayHit colliderHit;
+
+    if (sweepCollider(entity, ray, sphere.getRadius(), colliderHit) && colliderHit.distance <= closestHit.distance) {
+      closestEntity = &entity;
+      closestHit    = colliderHit;
+    }
+
+    return closestHit.distance;
+  });
+
+  if (closestEntity && hit)
+    *hit = closestHit;
+
+  return closestEntity;
+}
+
+void PhysicsSystem::linkEntity(const EntityPtr& entity) {
+  System::linkEntity(entity);
+  m_queryStructureDirty = true;
+}
+
+void PhysicsSystem::unlinkEntity(const EntityPtr& entity) {
+  System::unlinkEntity(entity);
+
+  // The structure must not keep any reference to the unlinked entity; it will be rebuilt on the next update
+  std::erase(m_unboundedColliders, entity.get());
+  std::ranges::replace(m_queryColliders, entity.get(), nullptr);
+  m_queryStructureDirty = true;
+
+  // The entity's collider may have been removed already; its last known state is used instead
+  if (const auto stateIt = m_colliderStates.find(entity.get()); stateIt != m_colliderStates.end()) {
+    m_disturbedColliders.emplace_back(stateIt->second);
+    m_colliderStates.erase(stateIt);
+  }
+}
+
+void PhysicsSystem::wakeDisturbedBodies() {
+  ZoneScopedN("PhysicsSystem::wakeDisturbedBodies");
+
+  for (Entity* entity : m_entities) {
+    const auto stateIt = m_colliderStates.find(entity);
+
+    if (!entity->isEnabled() || !entity->hasComponent<Collider>() || !entity->getComponent<Collider>().hasShape()) {
+      // A collider which has been disabled or removed no longer supports anything
+      if (stateIt != m_colliderStates.end()) {
+        m_disturbedColliders.emplace_back(stateIt->second);
+        m_colliderStates.erase(stateIt);
+      }
+
+      continue;
+    }
+
+    const bool hasAwakeBody = (entity->hasComponent<RigidBody>() && entity->getComponent<RigidBody>().getMass() > 0.f
+                            && !entity->getComponent<RigidBody>().isSleeping());
+    const ColliderState state { computeColliderPosition(*entity),
+                                (isBounded(entity->getComponent<Collider>()) ? std::make_optional(computeColliderBox(*entity)) : std::nullopt),
+                                hasAwakeBody };
+
+    if (stateIt == m_colliderStates.end()) {
+      m_colliderStates.emplace(entity, state);
+      continue;
+    }
+
+    // Awake bodies are moved by the simulation itself, the bodies they hit being woken up by the solver. A collider which was either static
+    //  or sleeping has however been moved externally, or has just been woken up & may let the bodies it supported fall in turn
+    const ColliderState& prevState = stateIt->second;
+
+    if (!prevState.isMovedBySimulation && (!state.position.strictlyEquals(prevState.position) || state.boundingBox != prevState.boundingBox))
+      m_disturbedColliders.emplace_back(prevState);
+
+    stateIt->second = state;
+  }
+
+  if (m_disturbedColliders.empty())
+    return;
+
+  for (Entity* entity : m_entities) {
+    if (!entity->isEnabled() || !entity->hasComponent<RigidBody>())
+      continue;
+
+    auto& rigidBody = entity->getComponent<RigidBody>();
+
+    if (!rigidBody.isSleeping())
+      continue;
+
+    if (std::ranges::any_of(m_disturbedColliders, [entity] (const ColliderState& state) { return isTouching(*entity, state.boundingBox); }))
+      rigidBody.wakeUp();
+  }
+
+  m_disturbedColliders.clear();
+}
+
 void PhysicsSystem::solveConstraints() {
   ZoneScopedN("PhysicsSystem::solveConstraints");
 
@@ -60,8 +538,14 @@ void PhysicsSystem::solveConstraints() {
 
     auto& rigidBody = entity->getComponent<RigidBody>();
 
-    if (rigidBody.getMass() <= 0.f)
+    if (rigidBody.getMass() <= 0.f || rigidBody.isSleeping())
+      continue;
+
+    // Rigid bodies having a solid collider are separated from the others with their contact manifolds; the others are handled as points
+    if (hasSolidCollider(*entity)) {
+      solveContacts(*entity);
       continue;
+    }
 
     const Vec3f velocity    = rigidBody.getVelocity();
     const Vec3f velocityDir = (velocity.computeSquaredLength() != 0.f ? velocity.normalize() : Vec3f(0.f));
@@ -109,11 +593,190 @@ void PhysicsSystem::solveConstraints() {
       const Vec3f paraVec = hit.normal * velocity.dot(hit.normal);
       const Vec3f perpVec = velocity - paraVec;
 
-      rigidBody.setVelocity(perpVec - paraVec * rigidBody.getBounciness());
+      rigidBody.m_velocity = perpVec - paraVec * rigidBody.getBounciness();
+
+      // A sleeping rigid body being hit must move again
+      if (collidableEntity->hasComponent<RigidBody>())
+        collidableEntity->getComponent<RigidBody>().wakeUp();
 
       break;
     }
   }
 }
 
+void PhysicsSystem::solveContacts(Entity& entity) {
+  auto& rigidBody = entity.getComponent<RigidBody>();
+  auto& transform = entity.getComponent<Transform>();
+
+  for (Entity* collidableEntity : m_entities) {
+    if (collidableEntity == &entity || !collidableEntity->isEnabled()
+     || !collidableEntity->hasComponent<Collider>() || !collidableEntity->getComponent<Collider>().hasShape())
+      continue;
+
+    ContactManifold manifold;
+    if (!computeBodyContact(entity, *collidableEntity, manifold))
+      continue;
+
+    // Moving the body along the contact normal by the deepest penetration separates it from the collider
+    transform.translate(manifold.normal * manifold.points[0].penetrationDepth);
+
+    // Only the velocity's component going into the collider is reflected; a body moving away from it is left as is
+    const float normalVelocity = rigidBody.m_velocity.dot(manifold.normal);
+
+    if (normalVelocity >= 0.f)
+      continue;
+
+    rigidBody.m_velocity -= manifold.normal * (normalVelocity * (1.f + rigidBody.getBounciness()));
+
+    // A sleeping rigid body being hit must move again
+    if (collidableEntity->hasComponent<RigidBody>())
+      collidableEntity->getComponent<RigidBody>().wakeUp();
+  }
+}
+
+void PhysicsSystem::updateSleepingBodies(float elapsedTime) {
+  ZoneScopedN("PhysicsSystem::updateSleepingBodies");
+
+  // The instantaneous velocity of a rigid body at rest on a collider is not reliable, since it is constantly pulled down by gravity
+  //  & pushed back up. Its average velocity over the time window is thus estimated from its distance to the position it started resting at
+  const float maxRestDistance = m_sleepVelocityThreshold * m_sleepTimeThreshold;
+
+  for (Entity* entity : m_entities) {
+    if (!entity->isEnabled() || !entity->hasComponent<RigidBody>())
+      continue;
+
+    auto& rigidBody = entity->getComponent<RigidBody>();
+
+    if (rigidBody.getMass() <= 0.f || rigidBody.isSleeping())
+      continue;
+
+    const Vec3f& position = entity->getComponent<Transform>().getPosition();
+
+    if ((position - rigidBody.m_restPosition).computeSquaredLength() >= maxRestDistance * maxRestDistance) {
+      rigidBody.m_restPosition = position;
+      rigidBody.m_sleepTime    = 0.f;
+      continue;
+    }
+
+    rigidBody.m_sleepTime += elapsedTime;
+
+    if (rigidBody.m_sleepTime >= m_sleepTimeThreshold)
+      rigidBody.putToSleep();
+  }
+}
+
+void PhysicsSystem::buildQueryNode(std::vector<std::pair<Entity*, AABB>>& colliderBoxes,
+                                   std::size_t nodeIndex,
+                                   std::size_t beginIndex,
+                                   std::size_t endIndex) {
+  AABB boundingBox = colliderBoxes[beginIndex].second;
+
+  for (std::size_t colliderIndex = beginIndex + 1; colliderIndex < endIndex; ++colliderIndex)
+    boundingBox = mergeBoxes(boundingBox, colliderBoxes[colliderIndex].second);
+
+  m_queryNodes[nodeIndex].boundingBox = boundingBox;
+
+  if (endIndex - beginIndex <= maxLeafColliderCount) {
+    m_queryNodes[nodeIndex].firstIndex    = static_cast<std::uint32_t>(beginIndex);
+    m_queryNodes[nodeIndex].colliderCount = static_cast<std::uint32_t>(endIndex - beginIndex);
+    return;
+  }
+
+  // Splitting the colliders in two halves along the longest axis, according to their centroid; the tree is thus always balanced
+  const Vec3f extents = boundingBox.getMaxPosition() - boundingBox.getMinPosition();
+  const std::size_t cutAxis = (extents.x() >= extents.y() ? (extents.x() >= extents.z() ? 0 : 2) : (extents.y() >= extents.z() ? 1 : 2));
+
+  const std::size_t midIndex = (beginIndex + endIndex) / 2;
+  std::nth_element(colliderBoxes.begin() + static_cast<std::ptrdiff_t>(beginIndex),
+                   colliderBoxes.begin() + static_cast<std::ptrdiff_t>(midIndex),
+                   colliderBoxes.begin() + static_cast<std::ptrdiff_t>(endIndex),
+                   [cutAxis] (const std::pair<Entity*, AABB>& colliderBox1, const std::pair<Entity*, AABB>& colliderBox2) {
+                     return (colliderBox1.second.computeCentroid()[cutAxis] < colliderBox2.second.computeCentroid()[cutAxis]);
+                   });
+
+  const auto firstChildIndex = static_cast<std::uint32_t>(m_queryNodes.size());
+  m_queryNodes[nodeIndex].firstIndex    = firstChildIndex;
+  m_queryNodes[nodeIndex].colliderCount = 0;
+  m_queryNodes.emplace_back();
+  m_queryNodes.emplace_back();
+
+  buildQueryNode(colliderBoxes, firstChildIndex, beginIndex, midIndex);
+  buildQueryNode(colliderBoxes, firstChildIndex + 1, midIndex, endIndex);
+}
+
+template <typename FuncT>
+void PhysicsSystem::traverseQueryStructure(const AABB& box, std::uint32_t layerMask, const FuncT& action) const {
+  for (Entity* entity : m_unboundedColliders) {
+    if (isQueryable(*entity, layerMask))
+      action(*entity);
+  }
+
+  if (m_queryNodes.empty())
+    return;
+
+  // The tree being balanced, its depth can never exceed the stack's size
+  std::array<std::uint32_t, 64> nodeStack {};
+  std::size_t stackSize = 0;
+  nodeStack[stackSize++] = 0;
+
+  while (stackSize > 0) {
+    const QueryNode& node = m_queryNodes[nodeStack[--stackSize]];
+
+    if (!node.boundingBox.intersects(box))
+      continue;
+
+    if (node.colliderCount == 0) {
+      nodeStack[stackSize++] = node.firstIndex;
+      nodeStack[stackSize++] = node.firstIndex + 1;
+      continue;
+    }
+
+    for (std::uint32_t colliderIndex = node.firstIndex; colliderIndex < node.firstIndex + node.colliderCount; ++colliderIndex) {
+      Entity* entity = m_queryColliders[colliderIndex];
+
+      if (entity && isQueryable(*entity, layerMask) && computeColliderBox(*entity).intersects(box))
+        action(*entity);
+    }
+  }
+}
+
+template <typename FuncT>
+void PhysicsSystem::traverseQueryStructure(const Ray& ray, float maxDistance, float boxExpansion, std::uint32_t layerMask, const FuncT& action) const {
+  for (Entity* entity : m_unboundedColliders) {
+    if (isQueryable(*entity, layerMask))
+      maxDistance = action(*entity);
+  }
+
+  if (m_queryNodes.empty())
+    return;
+
+  std::array<std::uint32_t, 64> nodeStack {};
+  std::size_t stackSize = 0;
+  nodeStack[stackSize++] = 0;
+
+  while (stackSize > 0) {
+    const QueryNode& node = m_queryNodes[nodeStack[--stackSize]];
+
+    RayHit boxHit;
+    const AABB nodeBox(node.boundingBox.getMinPosition() - boxExpansion, node.boundingBox.getMaxPosition() + boxExpansion);
+
+    // A negative distance means that the ray starts inside the box
+    if (!ray.intersects(nodeBox, &boxHit) || boxHit.distance > maxDistance)
+      continue;
+
+    if (node.colliderCount == 0) {
+      nodeStack[stackSize++] = node.firstIndex;
+      nodeStack[stackSize++] = node.firstIndex + 1;
+      continue;
+    }
+
+    for (std::uint32_t colliderIndex = node.firstIndex; colliderIndex < node.firstIndex + node.colliderCount; ++colliderIndex) {
+      Entity* entity = m_queryColliders[colliderIndex];
+
+      if (entity && isQueryable(*entity, layerMask))
+        maxDistance = action(*entity);
+    }
+  }
+}
+
 } // namespace Raz
@@ -0,0 +1,246 @@
+#include "RaZ/Data/Mesh.hpp"
+#include "RaZ/Physics/NarrowPhase.hpp"
+#include "RaZ/Physics/TriangleMesh.hpp"
+
+#include "tracy/Tracy.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+namespace Raz {
+
+namespace {
+
+constexpr std::size_t maxLeafTriangleCount = 4;
+
+std::vector<Triangle> recoverTriangles(const Mesh& mesh) {
+  std::vector<Triangle> triangles;
+  triangles.reserve(mesh.recoverTriangleCount());
+
+  for (const Submesh& submesh : mesh.getSubmeshes()) {
+    const std::vector<Vertex>& vertices       = submesh.getVertices();
+    const std::vector<unsigned int>& indices = submesh.getTriangleIndices();
+
+    for (std::size_t i = 0; i + 2 < indices.size(); i += 3)
+      triangles.emplace_back(vertices[indices[i]].position, vertices[indices[i + 1]].position, vertices[indices[i + 2]].position);
+  }
+
+  return triangles;
+}
+
+AABB mergeBoxes(const AABB& box1, const AABB& box2) {
+  return AABB(Vec3f(std::min(box1.getMinPosition().x(), box2.getMinPosition().x()),
+                    std::min(box1.getMinPosition().y(), box2.getMinPosition().y()),
+                    std::min(box1.getMinPosition().z(), box2.getMinPosition().z())),
+              Vec3f(std::max(box1.getMaxPosition().x(), box2.getMaxPosition().x()),
+                    std::max(box1.getMaxPosition().y(), box2.getMaxPosition().y()),
+                    std::max(box1.getMaxPosition().z(), box2.getMaxPosition().z())));
+}
+
+} // namespace
+
+TriangleMesh::TriangleMesh(std::vector<Triangle> triangles) : m_triangles{ std::move(triangles) } {
+  if (m_triangles.empty())
+    throw std::invalid_argument("[TriangleMesh] A triangle mesh must contain at least one triangle");
+
+  buildNodes();
+}
+
+TriangleMesh::TriangleMesh(const Mesh& mesh) : TriangleMesh(recoverTriangles(mesh)) {}
+
+bool TriangleMesh::contains(const Vec3f& point) const {
+  // A point is inside a closed mesh if a ray cast from it crosses its surface an odd number of times
+  // The direction is arbitrarily chosen so that the ray is unlikely to graze the triangles' edges, which would count twice
+  const Ray ray(point, Vec3f(0.5773f, 0.5774f, 0.5775f).normalize());
+  std::size_t hitCount = 0;
+
+  traverseNodes([&ray] (const AABB& box) { return ray.intersects(box); }, [this, &ray, &hitCount] (std::size_t triangleIndex) {
+    if (ray.intersects(m_triangles[triangleIndex]))
+      ++hitCount;
+  });
+
+  return (hitCount % 2 == 1);
+}
+
+bool TriangleMesh::intersects(const Line& line) const {
+  return NarrowPhase::intersects(*this, line);
+}
+
+bool TriangleMesh::intersects(const Plane& plane) const {
+  return NarrowPhase::intersects(*this, plane);
+}
+
+bool TriangleMesh::intersects(const Sphere& sphere) const {
+  return NarrowPhase::intersects(*this, sphere);
+}
+
+bool TriangleMesh::intersects(const Triangle& triangle) const {
+  return NarrowPhase::intersects(*this, triangle);
+}
+
+bool TriangleMesh::intersects(const Quad& quad) const {
+  return NarrowPhase::intersects(*this, quad);
+}
+
+bool TriangleMesh::intersects(const AABB& aabb) const {
+  return NarrowPhase::intersects(*this, aabb);
+}
+
+bool TriangleMesh::intersects(const OBB& obb) const {
+  return NarrowPhase::intersects(*this, obb);
+}
+
+bool TriangleMesh::intersects(const Ray& ray, RayHit* hit) const {
+  RayHit closestHit;
+  closestHit.distance = std::numeric_limits<float>::max();
+
+  const auto isBoxCloser = [&ray, &closestHit] (const AABB& box) {
+    RayHit boxHit;
+    return (ray.intersects(box, &boxHit) && boxHit.distance <= closestHit.distance);
+  };
+
+  traverseNodes(isBoxCloser, [this, &ray, &closestHit] (std::size_t triangleIndex) {
+    RayHit triangleHit;
+
+    if (ray.intersects(m_triangles[triangleIndex], &triangleHit) && triangleHit.distance < closestHit.distance)
+      closestHit = triangleHit;
+  });
+
+  if (closestHit.distance == std::numeric_limits<float>::max())
+    return false;
+
+  if (hit)
+    *hit = closestHit;
+
+  return true;
+}
+
+void TriangleMesh::translate(const Vec3f& displacement) noexcept {
+  for (Triangle& triangle : m_triangles)
+    triangle.translate(displacement);
+
+  for (Node& node : m_nodes)
+    node.boundingBox.translate(displacement);
+}
+
+Vec3f TriangleMesh::computeProjection(const Vec3f& point) const {
+  Vec3f closestPoint;
+  float closestSqDist = std::numeric_limits<float>::max();
+
+  const auto isBoxCloser = [&point, &closestSqDist] (const AABB& box) {
+    return ((box.computeProjection(point) - point).computeSquaredLength() <= closestSqDist);
+  };
+
+  traverseNodes(isBoxCloser, [this, &point, &closestPoint, &closestSqDist] (std::size_t triangleIndex) {
+    const Vec3f projection = m_triangles[triangleIndex].computeProjection(point);
+    const float sqDist     = (projection - point).computeSquaredLength();
+
+    if (sqDist < closestSqDist) {
+      closestPoint  = projection;
+      closestSqDist = sqDist;
+    }
+  });
+
+  return closestPoint;
+}
+
+Vec3f TriangleMesh::computeCentroid() const {
+  Vec3f centroid;
+
+  for (const Triangle& triangle : m_triangles)
+    centroid += triangle.computeCentroid();
+
+  return centroid / static_cast<float>(m_triangles.size());
+}
+
+void TriangleMesh::findTriangles(const AABB& box, std::vector<std::size_t>& triangleIndices) const {
+  traverseNodes([&box] (const AABB& nodeBox) { return nodeBox.intersects(box); }, [this, &box, &triangleIndices] (std::size_t triangleIndex) {
+    if (m_triangles[triangleIndex].computeBoundingBox().intersects(box))
+      triangleIndices.emplace_back(triangleIndex);
+  });
+}
+
+void TriangleMesh::buildNodes() {
+  ZoneScopedN("TriangleMesh::buildNodes");
+
+  std::vector<std::pair<Triangle, AABB>> triangleBoxes;
+  triangleBoxes.reserve(m_triangles.size());
+
+  for (const Triangle& triangle : m_triangles)
+    triangleBoxes.emplace_back(triangle, triangle.computeBoundingBox());
+
+  m_nodes.reserve(2 * m_triangles.size() / maxLeafTriangleCount + 1);
+  m_nodes.emplace_back();
+  buildNode(triangleBoxes, 0, 0, triangleBoxes.size());
+
+  // The triangles are stored in the order the leaves reference them
+  m_triangles.clear();
+  for (const auto& [triangle, box] : triangleBoxes)
+    m_triangles.emplace_back(triangle);
+}
+
+void TriangleMesh::buildNode(std::vector<std::pair<Triangle, AABB>>& triangleBoxes,
+                             std::size_t nodeIndex,
+                             std::size_t beginIndex,
+                             std::size_t endIndex) {
+  AABB boundingBox = triangleBoxes[beginIndex].second;
+
+  for (std::size_t triangleIndex = beginIndex + 1; triangleIndex < endIndex; ++triangleIndex)
+    boundingBox = mergeBoxes(boundingBox, triangleBoxes[triangleIndex].second);
+
+  m_nodes[nodeIndex].boundingBox = boundingBox;
+
+  if (endIndex - beginIndex <= maxLeafTriangleCount) {
+    m_nodes[nodeIndex].firstIndex    = static_cast<std::uint32_t>(beginIndex);
+    m_nodes[nodeIndex].triangleCount = static_cast<std::uint32_t>(endIndex - beginIndex);
+    return;
+  }
+
+  // Splitting the triangles in two halves along the longest axis, according to their centroid; the tree is thus always balanced
+  const Vec3f extents = boundingBox.getMaxPosition() - boundingBox.getMinPosition();
+  const std::size_t cutAxis = (extents.x() >= extents.y() ? (extents.x() >= extents.z() ? 0 : 2) : (extents.y() >= extents.z() ? 1 : 2));
+
+  const std::size_t midIndex = (beginIndex + endIndex) / 2;
+  std::nth_element(triangleBoxes.begin() + static_cast<std::ptrdiff_t>(beginIndex),
+                   triangleBoxes.begin() + static_cast<std::ptrdiff_t>(midIndex),
+                   triangleBoxes.begin() + static_cast<std::ptrdiff_t>(endIndex),
+                   [cutAxis] (const std::pair<Triangle, AABB>& triangleBox1, const std::pair<Triangle, AABB>& triangleBox2) {
+                     return (triangleBox1.second.computeCentroid()[cutAxis] < triangleBox2.second.computeCentroid()[cutAxis]);
+                   });
+
+  const auto firstChildIndex = static_cast<std::uint32_t>(m_nodes.size());
+  m_nodes[nodeIndex].firstIndex    = firstChildIndex;
+  m_nodes[nodeIndex].triangleCount = 0;
+  m_nodes.emplace_back();
+  m_nodes.emplace_back();
+
+  buildNode(triangleBoxes, firstChildIndex, beginIndex, midIndex);
+  buildNode(triangleBoxes, firstChildIndex + 1, midIndex, endIndex);
+}
+
+template <typename CheckFuncT, typename ActionFuncT>
+void TriangleMesh::traverseNodes(const CheckFuncT& checkBox, const ActionFuncT& action) const {
+  // The tree being balanced, its depth can never exceed the stack's size
+  std::array<std::uint32_t, 64> nodeStack {};
+  std::size_t stackSize = 0;
+  nodeStack[stackSize++] = 0;
+
+  while (stackSize > 0) {
+    const Node& node = m_nodes[nodeStack[--stackSize]];
+
+    if (!checkBox(node.boundingBox))
+      continue;
+
+    if (node.triangleCount == 0) {
+      nodeStack[stackSize++] = node.firstIndex;
+      nodeStack[stackSize++] = node.firstIndex + 1;
+      continue;
+    }
+
+    for (std::uint32_t triangleIndex = node.firstIndex; triangleIndex < node.firstIndex + node.triangleCount; ++triangleIndex)
+      action(triangleIndex);
+  }
+}
+
+} // namespace Raz
@@ -134,7 +134,8 @@ BloomRenderProcess::BloomRenderProcess(RenderGraph& renderGraph) : RenderProcess
   m_thresholdPass = &renderGraph.addNode(FragmentShader::loadFromSource(thresholdSource), "Bloom thresholding");
   setThresholdValue(0.75f); // Tone mapping is applied before the bloom, thus no value above 1 exist here. This value will be changed later
 
-  const auto thresholdBuffer = Texture2D::create(TextureColorspace::RGB, TextureDataType::FLOAT16);
+  // All intermediate buffers are transient, their memory being shared with other processes' whenever possible
+  const Texture2DPtr thresholdBuffer = renderGraph.addTransientTexture(TextureColorspace::RGB, TextureDataType::FLOAT16);
   m_thresholdPass->addWriteColorTexture(thresholdBuffer, 0);
 
 #if !defined(USE_OPENGL_ES)
@@ -143,7 +144,6 @@ BloomRenderProcess::BloomRenderProcess(RenderGraph& renderGraph) : RenderProcess
     Renderer::setLabel(RenderObjectType::SHADER, m_thresholdPass->getProgram().getVertexShader().getIndex(), "Bloom threshold vertex shader");
     Renderer::setLabel(RenderObjectType::SHADER, m_thresholdPass->getProgram().getFragmentShader().getIndex(), "Bloom threshold fragment shader");
     Renderer::setLabel(RenderObjectType::FRAMEBUFFER, m_thresholdPass->getFramebuffer().getIndex(), "Bloom threshold framebuffer");
-    Renderer::setLabel(RenderObjectType::TEXTURE, thresholdBuffer->getIndex(), "Bloom threshold buffer");
   }
 #endif
 
@@ -152,7 +152,7 @@ BloomRenderProcess::BloomRenderProcess(RenderGraph& renderGraph) : RenderProcess
   /////////////////
 
   m_downscalePasses.resize(passCount);
-  m_downscaleBuffers.resize(passCount);
+  std::vector<Texture2DPtr> downscaleBuffers(passCount);
 
   for (std::size_t downscalePassIndex = 0; downscalePassIndex < passCount; ++downscalePassIndex) {
     const std::string idStr = std::to_string(downscalePassIndex);
@@ -173,13 +173,15 @@ BloomRenderProcess::BloomRenderProcess(RenderGraph& renderGraph) : RenderProcess
     //      v prevDownscaledBuffer
     //     ...
 
-    downscalePass.addReadTexture((downscalePassIndex == 0 ? thresholdBuffer : m_downscaleBuffers[downscalePassIndex - 1].lock()), "uniPrevDownscaledBuffer");
+    downscalePass.addReadTexture((downscalePassIndex == 0 ? thresholdBuffer : downscaleBuffers[downscalePassIndex - 1]), "uniPrevDownscaledBuffer");
 
-    const auto downscaledBuffer = Texture2D::create(TextureColorspace::RGB, TextureDataType::FLOAT16);
+    // Each downscaled buffer is half the size of the previous one
+    const unsigned int sizeDivisor = 2u << downscalePassIndex;
+    Texture2DPtr downscaledBuffer  = renderGraph.addTransientTexture(TextureColorspace::RGB, TextureDataType::FLOAT16, sizeDivisor);
     downscalePass.addWriteColorTexture(downscaledBuffer, 0);
 
-    m_downscalePasses[downscalePassIndex]  = &downscalePass;
-    m_downscaleBuffers[downscalePassIndex] = downscaledBuffer;
+    m_downscalePasses[downscalePassIndex] = &downscalePass;
+    downscaleBuffers[downscalePassIndex]  = std::move(downscaledBuffer);
 
     downscalePass.addParents((downscalePassIndex == 0 ? *m_thresholdPass : *m_downscalePasses[downscalePassIndex - 1]));
 
@@ -189,7 +191,6 @@ BloomRenderProcess::BloomRenderProcess(RenderGraph& renderGraph) : RenderProcess
       Renderer::setLabel(RenderObjectType::SHADER, downscalePass.getProgram().getVertexShader().getIndex(), "Bloom downscale vertex shader #" + idStr);
       Renderer::setLabel(RenderObjectType::SHADER, downscalePass.getProgram().getFragmentShader().getIndex(), "Bloom downscale fragment shader #" + idStr);
       Renderer::setLabel(RenderObjectType::FRAMEBUFFER, downscalePass.getFramebuffer().getIndex(), "Bloom downscale framebuffer #" + idStr);
-      Renderer::setLabel(RenderObjectType::TEXTURE, downscaledBuffer->getIndex(), "Bloom downscale buffer #" + idStr);
     }
 #endif
   }
@@ -199,7 +200,7 @@ BloomRenderProcess::BloomRenderProcess(RenderGraph& renderGraph) : RenderProcess
   ///////////////
 
   m_upscalePasses.resize(passCount - 1);
-  m_upscaleBuffers.resize(passCount - 1);
+  std::vector<Texture2DPtr> upscaleBuffers(passCount - 1);
 
   for (std::size_t upscalePassIndex = 0; upscalePassIndex < passCount - 1; ++upscalePassIndex) {
     const std::string idStr = std::to_string(upscalePassIndex);
@@ -222,14 +223,16 @@ BloomRenderProcess::BloomRenderProcess(RenderGraph& renderGraph) : RenderProcess
 
     const std::size_t correspDownscalePassIndex = passCount - upscalePassIndex - 2;
 
-    upscalePass.addReadTexture(m_downscaleBuffers[correspDownscalePassIndex].lock(), "uniDownscaledBuffer");
-    upscalePass.addReadTexture((upscalePassIndex == 0 ? m_downscaleBuffers.back() : m_upscaleBuffers[upscalePassIndex - 1]).lock(), "uniPrevUpscaledBuffer");
+    upscalePass.addReadTexture(downscaleBuffers[correspDownscalePassIndex], "uniDownscaledBuffer");
+    upscalePass.addReadTexture((upscalePassIndex == 0 ? downscaleBuffers.back() : upscaleBuffers[upscalePassIndex - 1]), "uniPrevUpscaledBuffer");
 
-    const auto upscaledBuffer = Texture2D::create(TextureColorspace::RGB, TextureDataType::FLOAT16);
+    // Each upscaled buffer has the same size as its corresponding downscaled one
+    const unsigned int sizeDivisor = 2u << correspDownscalePassIndex;
+    Texture2DPtr upscaledBuffer    = renderGraph.addTransientTexture(TextureColorspace::RGB, TextureDataType::FLOAT16, sizeDivisor);
     upscalePass.addWriteColorTexture(upscaledBuffer, 0);
 
-    m_upscalePasses[upscalePassIndex]  = &upscalePass;
-    m_upscaleBuffers[upscalePassIndex] = upscaledBuffer;
+    m_upscalePasses[upscalePassIndex] = &upscalePass;
+    upscaleBuffers[upscalePassIndex]  = std::move(upscaledBuffer);
 
     // Although each upscaling pass is technically dependent on the matching downscaling one, the render graph only needs
     //  direct dependencies, that is, passes that can be executed anytime after their parents have been. In this case, we need
@@ -244,7 +247,6 @@ BloomRenderProcess::BloomRenderProcess(RenderGraph& renderGraph) : RenderProcess
       Renderer::setLabel(RenderObjectType::SHADER, upscalePass.getProgram().getVertexShader().getIndex(), "Bloom upscale vertex shader #" + idStr);
       Renderer::setLabel(RenderObjectType::SHADER, upscalePass.getProgram().getFragmentShader().getIndex(), "Bloom upscale fragment shader #" + idStr);
       Renderer::setLabel(RenderObjectType::FRAMEBUFFER, upscalePass.getFramebuffer().getIndex(), "Bloom upscale framebuffer #" + idStr);
-      Renderer::setLabel(RenderObjectType::TEXTURE, upscaledBuffer->getIndex(), "Bloom upscale buffer #" + idStr);
     }
 #endif
   }
@@ -256,7 +258,7 @@ BloomRenderProcess::BloomRenderProcess(RenderGraph& renderGraph) : RenderProcess
   m_finalPass = &renderGraph.addNode(FragmentShader::loadFromSource(finalSource), "Bloom final pass");
 
   m_finalPass->addParents(*m_upscalePasses.back());
-  m_finalPass->addReadTexture(m_upscaleBuffers.back().lock(), "uniFinalUpscaledBuffer");
+  m_finalPass->addReadTexture(upscaleBuffers.back(), "uniFinalUpscaledBuffer");
 
 #if !defined(USE_OPENGL_ES)
   if (Renderer::checkVersion(4, 3)) {
@@ -275,6 +277,14 @@ bool BloomRenderProcess::isEnabled() const noexcept {
   return m_thresholdPass->isEnabled();
 }
 
+const Texture2D& BloomRenderProcess::getDownscaleBuffer(std::size_t bufferIndex) const noexcept {
+  return m_downscalePasses[bufferIndex]->getFramebuffer().getColorBuffer(0);
+}
+
+const Texture2D& BloomRenderProcess::getUpscaleBuffer(std::size_t bufferIndex) const noexcept {
+  return m_upscalePasses[bufferIndex]->getFramebuffer().getColorBuffer(0);
+}
+
 void BloomRenderProcess::setState(bool enabled) {
   m_thresholdPass->enable(enabled);
 
@@ -304,26 +314,22 @@ void BloomRenderProcess::addChild(RenderProcess& childProcess) {
 }
 
 void BloomRenderProcess::resizeBuffers(unsigned int width, unsigned int height) {
-  m_thresholdPass->resizeWriteBuffers(width, height);
+  // The intermediate buffers are transient, thus resized by the render graph; only their sizes need to be sent to the passes
   m_finalPass->resizeWriteBuffers(width, height);
 
-  for (std::size_t i = 0; i < m_downscaleBuffers.size(); ++i) {
+  for (std::size_t i = 0; i < m_downscalePasses.size(); ++i) {
     width  /= 2;
     height /= 2;
 
     const Vec2f invBufferSize(1.f / static_cast<float>(width), 1.f / static_cast<float>(height));
 
-    m_downscalePasses[i]->resizeWriteBuffers(width, height);
-
     m_downscalePasses[i]->getProgram().setAttribute(invBufferSize, "uniInvBufferSize");
     m_downscalePasses[i]->getProgram().sendAttributes();
 
     if (i >= m_upscalePasses.size())
       break;
 
-    const std::size_t correspIndex = m_downscaleBuffers.size() - i - 2;
-
-    m_upscalePasses[correspIndex]->resizeWriteBuffers(width, height);
+    const std::size_t correspIndex = m_downscalePasses.size() - i - 2;
 
     m_upscalePasses[correspIndex]->getProgram().setAttribute(invBufferSize, "uniInvBufferSize");
     m_upscalePasses[correspIndex]->getProgram().sendAttributes();
@@ -15,7 +15,7 @@ constexpr std::string_view chromaticAberrationSource = {
 } // namespace
 
 ChromaticAberrationRenderProcess::ChromaticAberrationRenderProcess(RenderGraph& renderGraph)
-  : MonoPassRenderProcess(renderGraph, FragmentShader::loadFromSource(chromaticAberrationSource), "Chromatic aberration") {
+  : MonoPassRenderProcess(renderGraph, ScreenEffect{ std::string(chromaticAberrationSource), true }, "Chromatic aberration") {
   setStrength(0.f);
   setDirection(Vec2f(1.f, 0.f));
   setMaskTexture(Texture2D::create(ColorPreset::White));
@@ -14,7 +14,7 @@ constexpr std::string_view filmGrainSource = {
 } // namespace
 
 FilmGrainRenderProcess::FilmGrainRenderProcess(RenderGraph& renderGraph)
-  : MonoPassRenderProcess(renderGraph, FragmentShader::loadFromSource(filmGrainSource), "Film grain") { setStrength(0.05f); }
+  : MonoPassRenderProcess(renderGraph, ScreenEffect{ std::string(filmGrainSource), false }, "Film grain") { setStrength(0.05f); }
 
 void FilmGrainRenderProcess::setInputBuffer(Texture2DPtr colorBuffer) {
   MonoPassRenderProcess::setInputBuffer(std::move(colorBuffer), "uniBuffer");
@@ -0,0 +1,215 @@
+#include "RaZ/Data/Image.hpp"
+#include "RaZ/Render/FrameCapturer.hpp"
+#include "RaZ/Utils/ThreadPool.hpp"
+
+#include "tracy/Tracy.hpp"
+
+#include <cassert>
+#include <cstring>
+#include <stdexcept>
+
+namespace Raz {
+
+FrameCapturer::FrameCapturer(unsigned int width, unsigned int height, TextureFormat format, PixelDataType dataType, ThreadPool& threadPool)
+  : m_width{ width }, m_height{ height }, m_format{ format }, m_dataType{ (format == TextureFormat::DEPTH ? PixelDataType::FLOAT : dataType) },
+    m_threadPool{ &threadPool } {
+  allocateBuffers();
+}
+
+void FrameCapturer::resize(unsigned int width, unsigned int height) {
+  ZoneScopedN("FrameCapturer::resize");
+
+  flush();
+
+  m_width  = width;
+  m_height = height;
+
+  allocateBuffers();
+}
+
+void FrameCapturer::capture(FrameCaptureCallback callback) {
+  ZoneScopedN("FrameCapturer::capture");
+
+  assert("Error: A frame capture requires a callback." && callback);
+
+#if !defined(USE_WEBGL)
+  // The oldest capture's buffer is needed for this one; its data is waited for rather than being discarded
+  if (m_pendingCaptureCount == bufferCount && update() == 0) {
+    Renderer::waitSync(m_pendingCaptures[recoverOldestBufferIndex()].sync);
+    deliverOldestCapture();
+  }
+
+  Renderer::bindBuffer(BufferType::PIXEL_PACK_BUFFER, m_bufferIndices[m_nextBufferIndex]);
+  // With a pixel pack buffer bound, the frame is read into it & the GPU is not waited for
+  Renderer::recoverFrame(m_width, m_height, m_format, m_dataType, nullptr);
+  Renderer::unbindBuffer(BufferType::PIXEL_PACK_BUFFER);
+
+  PendingCapture& pendingCapture = m_pendingCaptures[m_nextBufferIndex];
+  pendingCapture.sync     = Renderer::createFenceSync();
+  pendingCapture.callback = std::move(callback);
+
+  m_nextBufferIndex = (m_nextBufferIndex + 1) % bufferCount;
+  ++m_pendingCaptureCount;
+#else
+  Image image = createImage();
+  Renderer::recoverFrame(m_width, m_height, m_format, m_dataType, image.getDataPtr());
+
+  executeCallback(std::move(callback), std::move(image));
+#endif
+}
+
+std::size_t FrameCapturer::update() {
+  std::size_t deliveredCount = 0;
+
+#if !defined(USE_WEBGL)
+  // Fences are signaled in the order they have been inserted; the first one not yet signaled ends the delivery
+  while (m_pendingCaptureCount > 0) {
+    if (!Renderer::isSyncSignaled(m_pendingCaptures[recoverOldestBufferIndex()].sync))
+      break;
+
+    deliverOldestCapture();
+    ++deliveredCount;
+  }
+#endif
+
+  return deliveredCount;
+}
+
+void FrameCapturer::flush() {
+  ZoneScopedN("FrameCapturer::flush");
+
+#if !defined(USE_WEBGL)
+  while (m_pendingCaptureCount > 0) {
+    Renderer::waitSync(m_pendingCaptures[recoverOldestBufferIndex()].sync);
+    deliverOldestCapture();
+  }
+#endif
+
+  waitForCallbacks();
+}
+
+FrameCapturer::~FrameCapturer() {
+  // The callbacks refer to the capturer, which must thus outlive them
+  flush();
+
+#if !defined(USE_WEBGL)
+  for (const auto& index : m_bufferIndices)
+    Renderer::deleteBuffer(index);
+#endif
+}
+
+Image FrameCapturer::createImage() const {
+  ImageColorspace colorspace {};
+
+  switch (m_format) {
+    case TextureFormat::RED:
+    case TextureFormat::GREEN:
+    case TextureFormat::BLUE:
+    case TextureFormat::DEPTH:
+      colorspace = ImageColorspace::GRAY;
+      break;
+
+    case TextureFormat::RG:
+      colorspace = ImageColorspace::GRAY_ALPHA;
+      break;
+
+    case TextureFormat::RGB:
+    case TextureFormat::BGR:
+      colorspace = ImageColorspace::RGB;
+      break;
+
+    case TextureFormat::RGBA:
+    case TextureFormat::BGRA:
+      colorspace = ImageColorspace::RGBA;
+      break;
+
+    default:
+      throw std::invalid_argument("[FrameCapturer] The given format cannot be captured into an image");
+  }
+
+  return Image(m_width, m_height, colorspace, (m_dataType == PixelDataType::FLOAT ? ImageDataType::FLOAT : ImageDataType::BYTE));
+}
+
+void FrameCapturer::allocateBuffers() {
+  // Creating an image also checks that the format can be represented by one
+  const uint8_t channelCount = createImage().getChannelCount();
+  m_frameDataSize = static_cast<std::size_t>(m_width) * m_height * channelCount * (m_dataType == PixelDataType::FLOAT ? sizeof(float) : sizeof(uint8_t));
+
+#if !defined(USE_WEBGL)
+  for (auto& index : m_bufferIndices) {
+    // The buffers are only created once the format has been validated, so that none is leaked if it isn't
+    if (!index.isValid())
+      Renderer::generateBuffer(index);
+
+    Renderer::bindBuffer(BufferType::PIXEL_PACK_BUFFER, index);
+    Renderer::sendBufferData(BufferType::PIXEL_PACK_BUFFER, static_cast<std::ptrdiff_t>(m_frameDataSize), nullptr, BufferDataUsage::STREAM_READ);
+  }
+
+  Renderer::unbindBuffer(BufferType::PIXEL_PACK_BUFFER);
+#endif
+}
+
+void FrameCapturer::deliverOldestCapture() {
+  ZoneScopedN("FrameCapturer::deliverOldestCapture");
+
+#if !defined(USE_WEBGL)
+  assert("Error: There is no pending capture to be delivered." && m_pendingCaptureCount > 0);
+
+  const std::size_t bufferIndex  = recoverOldestBufferIndex();
+  PendingCapture& pendingCapture = m_pendingCaptures[bufferIndex];
+
+  Renderer::deleteSync(pendingCapture.sync);
+  pendingCapture.sync = nullptr;
+  --m_pendingCaptureCount;
+
+  Image image = createImage();
+
+  // Only the copy into the image is made on the rendering thread, as the buffer can't be mapped on another one
+  Renderer::bindBuffer(BufferType::PIXEL_PACK_BUFFER, m_bufferIndices[bufferIndex]);
+
+  if (const void* data = Renderer::mapBufferRange(BufferType::PIXEL_PACK_BUFFER, 0, static_cast<std::ptrdiff_t>(m_frameDataSize),
+                                                   BufferMappingAccess::READ)) {
+    std::memcpy(image.getDataPtr(), data, m_frameDataSize);
+    Renderer::unmapBuffer(BufferType::PIXEL_PACK_BUFFER);
+  }
+
+  Renderer::unbindBuffer(BufferType::PIXEL_PACK_BUFFER);
+
+  executeCallback(std::move(pendingCapture.callback), std::move(image));
+  pendingCapture.callback = nullptr;
+#endif
+}
+
+void FrameCapturer::executeCallback(FrameCaptureCallback&& callback, Image&& image) {
+  {
+    // Were the callbacks slower than the rendering, the tasks would otherwise pile up indefinitely, each holding a frame
+    std::unique_lock<std::mutex> lock(m_callbacksMutex);
+    m_callbacksCondVar.wait(lock, [this] () noexcept { return (m_runningCallbackCount < bufferCount); });
+    ++m_runningCallbackCount;
+  }
+
+  m_threadPool->addTask([this, callback = std::move(callback), image = std::move(image)] () mutable {
+    // The callback is marked as finished even if it throws. The waiters are notified while the mutex is still held, as the capturer
+    //  may be destroyed as soon as the last one is woken up
+    struct CallbackGuard {
+      FrameCapturer& capturer;
+
+      ~CallbackGuard() {
+        const std::lock_guard<std::mutex> lock(capturer.m_callbacksMutex);
+        --capturer.m_runningCallbackCount;
+        capturer.m_callbacksCondVar.notify_all();
+      }
+    } callbackGuard { *this };
+
+    callback(std::move(image));
+  });
+}
+
+void FrameCapturer::waitForCallbacks() {
+  ZoneScopedN("FrameCapturer::waitForCallbacks");
+
+  std::unique_lock<std::mutex> lock(m_callbacksMutex);
+  m_callbacksCondVar.wait(lock, [this] () noexcept { return (m_runningCallbackCount == 0); });
+}
+
+} // namespace Raz
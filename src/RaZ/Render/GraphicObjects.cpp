@@ -73,4 +73,29 @@ IndexBuffer::~IndexBuffer() {
   Logger::debug("[IndexBuffer] Destroyed");
 }
 
+#if !defined(USE_OPENGL_ES)
+IndirectBuffer::IndirectBuffer() {
+  Logger::debug("[IndirectBuffer] Creating...");
+  Renderer::generateBuffer(m_index);
+  Logger::debug("[IndirectBuffer] Created (ID: {})", m_index.get());
+}
+
+void IndirectBuffer::bind() const {
+  Renderer::bindBuffer(BufferType::DRAW_INDIRECT_BUFFER, m_index);
+}
+
+void IndirectBuffer::unbind() const {
+  Renderer::unbindBuffer(BufferType::DRAW_INDIRECT_BUFFER);
+}
+
+IndirectBuffer::~IndirectBuffer() {
+  if (!m_index.isValid())
+    return;
+
+  Logger::debug("[IndirectBuffer] Destroying (ID: {})...", m_index.get());
+  Renderer::deleteBuffer(m_index);
+  Logger::debug("[IndirectBuffer] Destroyed");
+}
+#endif
+
 } // namespace Raz
@@ -0,0 +1,149 @@
+#include "RaZ/Render/LightClusterer.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include "tracy/Tracy.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Raz {
+
+namespace {
+
+constexpr std::size_t minParallelLightCount = 256;
+
+unsigned int computeScreenSlice(float ndcCoord, unsigned int sliceCount) {
+  const float slice = std::floor((ndcCoord * 0.5f + 0.5f) * static_cast<float>(sliceCount));
+  return static_cast<unsigned int>(std::clamp(slice, 0.f, static_cast<float>(sliceCount - 1)));
+}
+
+} // namespace
+
+float LightClusterer::computeDepthScale(float nearPlane, float farPlane) {
+  assert("Error: The near plane must be strictly positive." && nearPlane > 0.f);
+  assert("Error: The far plane must be farther than the near plane." && farPlane > nearPlane);
+
+  return static_cast<float>(clusterCountZ) / std::log(farPlane / nearPlane);
+}
+
+unsigned int LightClusterer::computeDepthSlice(float depth, float nearPlane, float depthScale) {
+  const float slice = std::floor(std::log(std::max(depth, nearPlane) / nearPlane) * depthScale);
+  return static_cast<unsigned int>(std::min(slice, static_cast<float>(clusterCountZ - 1)));
+}
+
+void LightClusterer::computeClusters(const std::vector<ClusteredLight>& lights, const Mat4f& viewMat, const Mat4f& projMat, float nearPlane, float farPlane) {
+  ZoneScopedN("LightClusterer::computeClusters");
+
+  const float depthScale   = computeDepthScale(nearPlane, farPlane);
+  const bool isPerspective = (projMat.getElement(3, 3) == 0.f);
+
+  m_lightRanges.resize(lights.size());
+
+  const auto computeLightRanges = [this, &lights, &viewMat, &projMat, nearPlane, farPlane, depthScale, isPerspective] (const Threading::IndexRange& range) noexcept {
+    for (std::size_t lightIndex = range.beginIndex; lightIndex < range.endIndex; ++lightIndex) {
+      const ClusteredLight& light = lights[lightIndex];
+      ClusterRange& clusterRange  = m_lightRanges[lightIndex];
+      clusterRange.isVisible      = false;
+
+      if (light.radius <= 0.f)
+        continue;
+
+      const Vec3f viewPos(viewMat * Vec4f(light.position, 1.f));
+      const float minDepth = -viewPos.z() - light.radius;
+      const float maxDepth = -viewPos.z() + light.radius;
+
+      // Lights entirely behind the camera or beyond the far plane can't affect any visible fragment
+      // With an orthographic projection, fragments may however lie behind the camera, being then all clamped into the first slice
+      if (minDepth > farPlane || (isPerspective && maxDepth < 0.f))
+        continue;
+
+      clusterRange.minZ = computeDepthSlice(minDepth, nearPlane, depthScale);
+      clusterRange.maxZ = computeDepthSlice(maxDepth, nearPlane, depthScale);
+
+      if (isPerspective && minDepth <= nearPlane) {
+        // The light's sphere crosses the near plane, its projection can't be bounded; it is thus considered covering the whole screen
+        clusterRange.minX      = 0;
+        clusterRange.maxX      = clusterCountX - 1;
+        clusterRange.minY      = 0;
+        clusterRange.maxY      = clusterCountY - 1;
+        clusterRange.isVisible = true;
+        continue;
+      }
+
+      // The sphere's screen-space bounds are conservatively estimated by projecting the corners of its view-space bounding box
+      Vec2f minNdc(std::numeric_limits<float>::max());
+      Vec2f maxNdc(std::numeric_limits<float>::lowest());
+
+      for (unsigned int cornerIndex = 0; cornerIndex < 8; ++cornerIndex) {
+        const Vec3f corner(viewPos.x() + ((cornerIndex & 1u) ? light.radius : -light.radius),
+                           viewPos.y() + ((cornerIndex & 2u) ? light.radius : -light.radius),
+                           viewPos.z() + ((cornerIndex & 4u) ? light.radius : -light.radius));
+        const Vec4f clipPos = projMat * Vec4f(corner, 1.f);
+        const Vec2f ndcPos(clipPos.x() / clipPos.w(), clipPos.y() / clipPos.w());
+
+        minNdc = Vec2f(std::min(minNdc.x(), ndcPos.x()), std::min(minNdc.y(), ndcPos.y()));
+        maxNdc = Vec2f(std::max(maxNdc.x(), ndcPos.x()), std::max(maxNdc.y(), ndcPos.y()));
+      }
+
+      if (maxNdc.x() < -1.f || minNdc.x() > 1.f || maxNdc.y() < -1.f || minNdc.y() > 1.f)
+        continue;
+
+      clusterRange.minX      = computeScreenSlice(minNdc.x(), clusterCountX);
+      clusterRange.maxX      = computeScreenSlice(maxNdc.x(), clusterCountX);
+      clusterRange.minY      = computeScreenSlice(minNdc.y(), clusterCountY);
+      clusterRange.maxY      = computeScreenSlice(maxNdc.y(), clusterCountY);
+      clusterRange.isVisible = true;
+    }
+  };
+
+  if (lights.size() >= minParallelLightCount)
+    Threading::parallelize(0, lights.size(), computeLightRanges);
+  else
+    computeLightRanges(Threading::IndexRange{ 0, lights.size() });
+
+  // Counting the lights affecting each cluster, then computing their offsets in the index list to fill it contiguously
+
+  for (LightCluster& cluster : m_clusters)
+    cluster = LightCluster{};
+
+  for (const ClusterRange& range : m_lightRanges) {
+    if (!range.isVisible)
+      continue;
+
+    for (unsigned int clusterZ = range.minZ; clusterZ <= range.maxZ; ++clusterZ) {
+      for (unsigned int clusterY = range.minY; clusterY <= range.maxY; ++clusterY) {
+        for (unsigned int clusterX = range.minX; clusterX <= range.maxX; ++clusterX)
+          ++m_clusters[computeClusterIndex(clusterX, clusterY, clusterZ)].count;
+      }
+    }
+  }
+
+  unsigned int lightIndexCount = 0;
+
+  for (LightCluster& cluster : m_clusters) {
+    cluster.offset   = lightIndexCount;
+    lightIndexCount += cluster.count;
+    cluster.count    = 0;
+  }
+
+  m_lightIndices.resize(lightIndexCount);
+
+  for (std::size_t lightIndex = 0; lightIndex < lights.size(); ++lightIndex) {
+    const ClusterRange& range = m_lightRanges[lightIndex];
+
+    if (!range.isVisible)
+      continue;
+
+    for (unsigned int clusterZ = range.minZ; clusterZ <= range.maxZ; ++clusterZ) {
+      for (unsigned int clusterY = range.minY; clusterY <= range.maxY; ++clusterY) {
+        for (unsigned int clusterX = range.minX; clusterX <= range.maxX; ++clusterX) {
+          LightCluster& cluster = m_clusters[computeClusterIndex(clusterX, clusterY, clusterZ)];
+          m_lightIndices[cluster.offset + cluster.count++] = lights[lightIndex].index;
+        }
+      }
+    }
+  }
+}
+
+} // namespace Raz
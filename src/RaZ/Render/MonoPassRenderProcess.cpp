@@ -7,7 +7,12 @@
 namespace Raz {
 
 MonoPassRenderProcess::MonoPassRenderProcess(RenderGraph& renderGraph, FragmentShader&& fragShader, std::string passName)
-  : RenderProcess(renderGraph), m_pass{ renderGraph.addNode(std::move(fragShader), std::move(passName)) } {
+  : MonoPassRenderProcess(renderGraph, renderGraph.addNode(std::move(fragShader), std::move(passName))) {}
+
+MonoPassRenderProcess::MonoPassRenderProcess(RenderGraph& renderGraph, ScreenEffect screenEffect, std::string passName)
+  : MonoPassRenderProcess(renderGraph, renderGraph.addNode(std::move(screenEffect), std::move(passName))) {}
+
+MonoPassRenderProcess::MonoPassRenderProcess(RenderGraph& renderGraph, RenderPass& pass) : RenderProcess(renderGraph), m_pass{ pass } {
 #if !defined(USE_OPENGL_ES)
   if (Renderer::checkVersion(4, 3)) {
     Renderer::setLabel(RenderObjectType::PROGRAM, m_pass.getProgram().getIndex(), m_pass.getName() + " program");
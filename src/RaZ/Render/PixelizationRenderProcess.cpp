@@ -14,7 +14,7 @@ constexpr std::string_view pixelizationSource = {
 } // namespace
 
 PixelizationRenderProcess::PixelizationRenderProcess(RenderGraph& renderGraph)
-  : MonoPassRenderProcess(renderGraph, FragmentShader::loadFromSource(pixelizationSource), "Pixelization") { setStrength(0.f); }
+  : MonoPassRenderProcess(renderGraph, ScreenEffect{ std::string(pixelizationSource), true }, "Pixelization") { setStrength(0.f); }
 
 void PixelizationRenderProcess::resizeBuffers(unsigned int width, unsigned int height) {
   const Vec2f bufferSize(static_cast<float>(width), static_cast<float>(height));
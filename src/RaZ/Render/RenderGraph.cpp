@@ -2,60 +2,522 @@
 #include "RaZ/Render/MeshRenderer.hpp"
 #include "RaZ/Render/RenderGraph.hpp"
 #include "RaZ/Render/RenderSystem.hpp"
+#include "RaZ/Render/StaticMeshRenderer.hpp"
+#include "RaZ/Utils/Profiler.hpp"
 
 #include "tracy/Tracy.hpp"
 #include "GL/glew.h" // Needed by TracyOpenGL.hpp
 #include "tracy/TracyOpenGL.hpp"
 
+#include <format>
+#include <ranges>
+#include <unordered_map>
+
 namespace Raz {
 
+namespace {
+
+bool hasWriteTexture(const Framebuffer& framebuffer, const Texture2D* texture) {
+  if (framebuffer.hasDepthBuffer() && &framebuffer.getDepthBuffer() == texture)
+    return true;
+
+  for (std::size_t bufferIndex = 0; bufferIndex < framebuffer.getColorBufferCount(); ++bufferIndex) {
+    if (&framebuffer.getColorBuffer(bufferIndex) == texture)
+      return true;
+  }
+
+  return false;
+}
+
+} // namespace
+
 bool RenderGraph::isValid() const {
   return std::ranges::all_of(m_nodes, [] (const std::unique_ptr<RenderPass>& renderPass) {
     return renderPass->isValid();
   });
 }
 
+bool RenderGraph::isTransientTexture(const Texture2D& texture) const noexcept {
+  return std::ranges::any_of(m_transientTexturePool, [&texture] (const PooledTexture& pooledTexture) noexcept {
+    return (pooledTexture.texture.get() == &texture);
+  }) || std::ranges::any_of(m_transientTextures, [&texture] (const TransientTexture& transientTexture) noexcept {
+    return (transientTexture.placeholder.lock().get() == &texture);
+  });
+}
+
+void RenderGraph::removeNode(RenderPass& renderPass) {
+  Graph::removeNode(renderPass);
+  m_isCompiled = false;
+}
+
+Texture2DPtr RenderGraph::addTransientTexture(TextureColorspace colorspace, TextureDataType dataType, unsigned int sizeDivisor) {
+  if (sizeDivisor == 0)
+    throw std::invalid_argument("[RenderGraph] The size divisor of a transient texture must be strictly positive");
+
+  Texture2DPtr placeholder = Texture2D::create(colorspace, dataType);
+  m_transientTextures.emplace_back(TransientTexture{ placeholder, colorspace, dataType, sizeDivisor });
+
+  m_isCompiled = false;
+
+  return placeholder;
+}
+
+void RenderGraph::compile() {
+  ZoneScopedN("RenderGraph::compile");
+
+  const std::vector<RenderPass*> passes = recoverExecutionOrder();
+
+  // Passes being sorted after their parents, iterating in reverse order makes a pass' children always be checked before it.
+  //  A pass is needed if it is enabled and either is a leaf, thus an output of the graph, or has at least one child that is needed
+  std::unordered_set<const RenderPass*> neededPasses;
+  neededPasses.reserve(passes.size());
+
+  for (const RenderPass* renderPass : passes | std::views::reverse) {
+    if (!renderPass->isEnabled())
+      continue;
+
+    if (renderPass->isLeaf() || std::ranges::any_of(renderPass->getChildren(), [&neededPasses] (const RenderPass* childPass) noexcept {
+      return neededPasses.contains(childPass);
+    })) {
+      neededPasses.emplace(renderPass);
+    }
+  }
+
+  // The geometry pass is always executed first & separately
+  m_executionList.clear();
+
+  for (const RenderPass* renderPass : passes | std::views::drop(1)) {
+    if (neededPasses.contains(renderPass))
+      m_executionList.emplace_back(renderPass);
+  }
+
+  const std::vector<EffectChain> effectChains = (m_isFusionEnabled ? recoverScreenEffectChains() : std::vector<EffectChain>());
+
+  // Transient textures are allocated according to all passes, so that enabling back a culled one does not require textures to be moved around.
+  //  Their lifetimes account for the fusion, which reads a chain's input when executing its last pass
+  allocateTransientTextures(passes, effectChains);
+
+  // Fusing effects is done after allocating the transient textures, for the fused passes to directly read & write the allocated ones
+  fuseScreenEffects(effectChains);
+
+  m_isCompiled = true;
+}
+
+void RenderGraph::allocateTransientTextures(const std::vector<RenderPass*>& passes, const std::vector<EffectChain>& effectChains) {
+  ZoneScopedN("RenderGraph::allocateTransientTextures");
+
+  std::unordered_map<const RenderPass*, std::size_t> passIndices;
+  passIndices.reserve(passes.size());
+
+  for (std::size_t passIndex = 0; passIndex < passes.size(); ++passIndex)
+    passIndices.emplace(passes[passIndex], passIndex);
+
+  // The passes of a fused chain are all executed at once, in place of the chain's last pass; their textures are thus used at this point
+  for (const EffectChain& effectChain : effectChains) {
+    const std::size_t tailIndex = passIndices.at(effectChain.back());
+
+    for (const RenderPass* chainedPass : effectChain)
+      passIndices[chainedPass] = tailIndex;
+  }
+
+  const auto isUsingTexture = [&passIndices] (const TransientTextureUse& use) {
+    if (!passIndices.contains(use.pass))
+      return false;
+
+    if (use.uniformName.empty())
+      return hasWriteTexture(use.pass->getFramebuffer(), use.texture);
+
+    return (use.pass->hasReadTexture(use.uniformName) && &use.pass->getReadTexture(use.uniformName) == use.texture);
+  };
+
+  for (TransientTexture& transientTexture : m_transientTextures) {
+    // Forgetting the uses whose pass has been removed from the graph, or which has since been given another texture
+    std::erase_if(transientTexture.uses, [&isUsingTexture] (const TransientTextureUse& use) { return !isUsingTexture(use); });
+
+    const Texture2DPtr placeholder = transientTexture.placeholder.lock();
+
+    if (placeholder == nullptr)
+      continue;
+
+    // Recording the passes which have been given the placeholder
+    for (RenderPass* pass : passes) {
+      for (const auto& [texture, uniformName] : pass->getProgram().getTextures()) {
+        if (texture == placeholder)
+          transientTexture.uses.emplace_back(TransientTextureUse{ pass, uniformName, placeholder.get() });
+      }
+
+      if (hasWriteTexture(pass->getFramebuffer(), placeholder.get()))
+        transientTexture.uses.emplace_back(TransientTextureUse{ pass, {}, placeholder.get() });
+    }
+  }
+
+  // Transient textures that are no longer used & cannot be given to any pass anymore can be forgotten
+  std::erase_if(m_transientTextures, [] (const TransientTexture& transientTexture) noexcept {
+    return (transientTexture.uses.empty() && transientTexture.placeholder.expired());
+  });
+
+  struct Lifetime {
+    TransientTexture* transientTexture {};
+    std::size_t firstUseIndex {};
+    std::size_t lastUseIndex {};
+  };
+
+  std::vector<Lifetime> lifetimes;
+  lifetimes.reserve(m_transientTextures.size());
+
+  for (TransientTexture& transientTexture : m_transientTextures) {
+    if (transientTexture.uses.empty())
+      continue;
+
+    const auto [firstUseIt, lastUseIt] = std::ranges::minmax_element(transientTexture.uses, {}, [&passIndices] (const TransientTextureUse& use) {
+      return passIndices.at(use.pass);
+    });
+    lifetimes.emplace_back(Lifetime{ &transientTexture, passIndices.at(firstUseIt->pass), passIndices.at(lastUseIt->pass) });
+  }
+
+  // Assigning the textures in the order they are first used, each taking any pooled texture which is compatible & no longer used at this point;
+  //  this gives the minimal amount of textures for each format & size
+  std::ranges::sort(lifetimes, {}, &Lifetime::firstUseIndex);
+
+  for (PooledTexture& pooledTexture : m_transientTexturePool)
+    pooledTexture.isAssigned = false;
+
+  for (const Lifetime& lifetime : lifetimes) {
+    TransientTexture& transientTexture = *lifetime.transientTexture;
+
+    auto pooledTextureIt = std::ranges::find_if(m_transientTexturePool, [&transientTexture, &lifetime] (const PooledTexture& pooledTexture) noexcept {
+      return (pooledTexture.texture->getColorspace() == transientTexture.colorspace
+           && pooledTexture.texture->getDataType() == transientTexture.dataType
+           && pooledTexture.sizeDivisor == transientTexture.sizeDivisor
+           && (!pooledTexture.isAssigned || pooledTexture.lastUseIndex < lifetime.firstUseIndex));
+    });
+
+    if (pooledTextureIt == m_transientTexturePool.end()) {
+      m_transientTexturePool.emplace_back(PooledTexture{ Texture2D::create(transientTexture.colorspace, transientTexture.dataType),
+                                                         transientTexture.sizeDivisor });
+      pooledTextureIt = std::prev(m_transientTexturePool.end());
+    }
+
+    pooledTextureIt->lastUseIndex = lifetime.lastUseIndex;
+    pooledTextureIt->isAssigned   = true;
+
+    const Texture2DPtr& texture = pooledTextureIt->texture;
+
+    for (TransientTextureUse& use : transientTexture.uses) {
+      if (use.texture == texture.get())
+        continue;
+
+      if (!use.uniformName.empty()) {
+        use.pass->getProgram().setTexture(texture, use.uniformName);
+      } else {
+        Framebuffer& framebuffer = use.pass->m_writeFramebuffer;
+
+        if (framebuffer.m_depthBuffer.get() == use.texture) {
+          framebuffer.m_depthBuffer = texture;
+        } else {
+          for (Texture2DPtr& colorBuffer : framebuffer.m_colorBuffers | std::views::keys) {
+            if (colorBuffer.get() == use.texture)
+              colorBuffer = texture;
+          }
+        }
+
+        framebuffer.mapBuffers();
+      }
+
+      use.texture = texture.get();
+    }
+  }
+
+  // Releasing the pooled textures which are not needed anymore
+  std::erase_if(m_transientTexturePool, [] (const PooledTexture& pooledTexture) noexcept { return !pooledTexture.isAssigned; });
+
+  resizeTransientTextures();
+}
+
 void RenderGraph::resizeViewport(unsigned int width, unsigned int height) {
   ZoneScopedN("RenderGraph::resizeViewport");
 
-  m_geometryPass.resizeWriteBuffers(width, height);
+  m_viewportWidth  = width;
+  m_viewportHeight = height;
+
+  // Transient textures are sized by the render graph itself, according to their size divisor
+  const auto resizeWriteBuffers = [this, width, height] (RenderPass& renderPass) {
+    Framebuffer& framebuffer = renderPass.m_writeFramebuffer;
+
+    if (framebuffer.m_depthBuffer && !isTransientTexture(*framebuffer.m_depthBuffer))
+      framebuffer.m_depthBuffer->resize(width, height);
+
+    for (const Texture2DPtr& colorBuffer : framebuffer.m_colorBuffers | std::views::keys) {
+      if (!isTransientTexture(*colorBuffer))
+        colorBuffer->resize(width, height); // TODO: resizing all write buffers will only work if they have all been created with equal dimensions
+    }
+  };
+
+  resizeWriteBuffers(m_geometryPass);
 
   for (const std::unique_ptr<RenderPass>& renderPass : m_nodes)
-    renderPass->resizeWriteBuffers(width, height); // TODO: resizing all write buffers will only work if they have all been created with equal dimensions
+    resizeWriteBuffers(*renderPass);
 
   for (const std::unique_ptr<RenderProcess>& renderProcess : m_renderProcesses)
     renderProcess->resizeBuffers(width, height);
+
+  resizeTransientTextures();
 }
 
 void RenderGraph::updateShaders() const {
   ZoneScopedN("RenderGraph::updateShaders");
 
+  // All programs start being linked before any is waited for, so that their shaders can be compiled in parallel
+  for (const std::unique_ptr<RenderPass>& renderPass : m_nodes) {
+    RenderShaderProgram& program = renderPass->getProgram();
+    program.loadShaders();
+    program.startLink();
+  }
+
+  for (const std::unique_ptr<RenderPass>& renderPass : m_nodes) {
+    RenderShaderProgram& program = renderPass->getProgram();
+    program.completeLink();
+    program.sendAttributes();
+    program.initTextures();
+#if !defined(USE_WEBGL)
+    program.initImageTextures();
+#endif
+  }
+}
+
+std::vector<RenderPass*> RenderGraph::recoverExecutionOrder() {
+  std::vector<RenderPass*> passes;
+  passes.reserve(m_nodes.size() + 1);
+
+  std::unordered_set<const RenderPass*> addedPasses;
+  addedPasses.reserve(m_nodes.size() + 1);
+
+  // Passes are ordered just like they are executed, each one after its parents
+  const auto addPass = [&passes, &addedPasses] (RenderPass& renderPass, const auto& addPassRef) -> void {
+    if (addedPasses.contains(&renderPass))
+      return;
+
+    for (RenderPass* parentPass : renderPass.m_parents)
+      addPassRef(*parentPass, addPassRef);
+
+    passes.emplace_back(&renderPass);
+    addedPasses.emplace(&renderPass);
+  };
+
+  addPass(m_geometryPass, addPass);
+
   for (const std::unique_ptr<RenderPass>& renderPass : m_nodes)
-    renderPass->getProgram().updateShaders();
+    addPass(*renderPass, addPass);
+
+  return passes;
+}
+
+std::vector<RenderGraph::EffectChain> RenderGraph::recoverScreenEffectChains() const {
+  ZoneScopedN("RenderGraph::recoverScreenEffectChains");
+
+  const std::unordered_set<const RenderPass*> executedPasses(m_executionList.cbegin(), m_executionList.cend());
+
+  const auto isFusable = [] (const RenderPass& renderPass) {
+    const Framebuffer& framebuffer = renderPass.getFramebuffer();
+    return (renderPass.hasScreenEffect() && renderPass.hasReadTexture("uniBuffer") && !framebuffer.hasDepthBuffer() && framebuffer.getColorBufferCount() <= 1);
+  };
+
+  // A pass can be fused with its child if the latter only processes the color at the current coordinates & is the only one to read the pass' output
+  const auto isFusableWithChild = [this, &executedPasses, &isFusable] (const RenderPass& renderPass) {
+    if (renderPass.getChildCount() != 1 || renderPass.getFramebuffer().getColorBufferCount() != 1)
+      return false;
+
+    const RenderPass& childPass = renderPass.getChild(0);
+
+    if (!executedPasses.contains(&childPass) || !isFusable(childPass) || childPass.getScreenEffect().samplesInput || childPass.getParentCount() != 1)
+      return false;
+
+    const Texture2D& outputBuffer = renderPass.getFramebuffer().getColorBuffer(0);
+
+    if (&childPass.getReadTexture("uniBuffer") != &outputBuffer)
+      return false;
+
+    return std::ranges::none_of(m_nodes, [&childPass, &outputBuffer] (const std::unique_ptr<RenderPass>& node) noexcept {
+      return (node.get() != &childPass && node->getProgram().hasTexture(outputBuffer));
+    });
+  };
+
+  std::vector<EffectChain> effectChains;
+  std::unordered_set<const RenderPass*> chainedPasses;
+
+  // Passes being sorted after their parents, a chain is always found starting from its first pass
+  for (const RenderPass* renderPass : m_executionList) {
+    if (chainedPasses.contains(renderPass) || !isFusable(*renderPass))
+      continue;
+
+    EffectChain chain = { renderPass };
+
+    while (isFusableWithChild(*chain.back()))
+      chain.emplace_back(&chain.back()->getChild(0));
+
+    if (chain.size() < 2)
+      continue;
+
+    chainedPasses.insert(chain.cbegin(), chain.cend());
+    effectChains.emplace_back(std::move(chain));
+  }
+
+  return effectChains;
+}
+
+void RenderGraph::fuseScreenEffects(const std::vector<EffectChain>& effectChains) {
+  ZoneScopedN("RenderGraph::fuseScreenEffects");
+
+  // The previously fused passes are kept aside to be reused if their chain remains the same, avoiding generating their program again
+  std::vector<FusedPass> previousFusedPasses = std::move(m_fusedPasses);
+  m_fusedPasses.clear();
+
+  std::unordered_set<const RenderPass*> chainedPasses;
+  std::unordered_map<const RenderPass*, std::size_t> chainTailIndices;
+
+  for (const EffectChain& chain : effectChains) {
+    std::vector<const ScreenEffect*> effects;
+    effects.reserve(chain.size());
+
+    for (const RenderPass* chainedPass : chain)
+      effects.emplace_back(&chainedPass->getScreenEffect());
+
+    std::string shaderSource = ScreenEffect::generateShaderSource(effects);
+
+    const auto previousFusedPassIt = std::ranges::find_if(previousFusedPasses, [&chain, &shaderSource] (const FusedPass& fusedPass) noexcept {
+      return (fusedPass.pass != nullptr && fusedPass.effectPasses == chain && fusedPass.shaderSource == shaderSource);
+    });
+
+    FusedPass fusedPass;
+
+    if (previousFusedPassIt != previousFusedPasses.end()) {
+      fusedPass = std::move(*previousFusedPassIt);
+    } else {
+      std::string passName;
+
+      for (const RenderPass* chainedPass : chain)
+        passName += (passName.empty() ? "" : " + ") + chainedPass->getName();
+
+      fusedPass.pass         = std::make_unique<RenderPass>(FragmentShader::loadFromSource(shaderSource), std::move(passName));
+      fusedPass.effectPasses = chain;
+      fusedPass.shaderSource = std::move(shaderSource);
+    }
+
+    // The fused pass reads the chain's input & writes its output; the intermediate buffers are left untouched
+    const auto& inputTextures = chain.front()->getProgram().getTextures();
+    fusedPass.pass->addReadTexture(std::ranges::find(inputTextures, "uniBuffer", &std::pair<TexturePtr, std::string>::second)->first, "uniBuffer");
+
+    fusedPass.pass->clearWriteTextures();
+    for (const auto& [colorBuffer, bufferIndex] : chain.back()->m_writeFramebuffer.m_colorBuffers)
+      fusedPass.pass->addWriteColorTexture(colorBuffer, bufferIndex);
+
+    chainedPasses.insert(chain.cbegin(), chain.cend());
+    chainTailIndices.emplace(chain.back(), m_fusedPasses.size());
+    m_fusedPasses.emplace_back(std::move(fusedPass));
+  }
+
+  if (m_fusedPasses.empty())
+    return;
+
+  // Each chain is replaced by its fused pass, executed in place of its last pass
+  std::vector<const RenderPass*> executionList;
+  executionList.reserve(m_executionList.size());
+
+  for (const RenderPass* renderPass : m_executionList) {
+    if (const auto tailIt = chainTailIndices.find(renderPass); tailIt != chainTailIndices.end())
+      executionList.emplace_back(m_fusedPasses[tailIt->second].pass.get());
+    else if (!chainedPasses.contains(renderPass))
+      executionList.emplace_back(renderPass);
+  }
+
+  m_executionList = std::move(executionList);
+
+  updateFusedPasses();
+}
+
+void RenderGraph::updateFusedPasses() const {
+  ZoneScopedN("RenderGraph::updateFusedPasses");
+
+  for (const FusedPass& fusedPass : m_fusedPasses) {
+    RenderShaderProgram& fusedProgram = fusedPass.pass->getProgram();
+    bool hasNewTexture = false;
+
+    for (std::size_t effectIndex = 0; effectIndex < fusedPass.effectPasses.size(); ++effectIndex) {
+      const RenderShaderProgram& effectProgram = fusedPass.effectPasses[effectIndex]->getProgram();
+
+      // Only the attributes whose value differs from the fused ones' are marked as to be sent
+      for (std::size_t attribIndex = 0; attribIndex < effectProgram.getAttributeCount(); ++attribIndex) {
+        const AttributeHandle attribHandle{ attribIndex };
+        fusedProgram.copyAttribute(effectProgram, attribHandle, ScreenEffect::recoverFusedName(effectProgram.getAttributeName(attribHandle), effectIndex));
+      }
+
+      for (const auto& [texture, uniformName] : effectProgram.getTextures()) {
+        // The input buffer is the chain's, only read by the first effect
+        if (uniformName == "uniBuffer")
+          continue;
+
+        const std::string fusedName = ScreenEffect::recoverFusedName(uniformName, effectIndex);
+        const bool hasTexture       = fusedProgram.hasTexture(fusedName);
+
+        if (hasTexture && &fusedProgram.getTexture(fusedName) == texture.get())
+          continue;
+
+        fusedProgram.setTexture(texture, fusedName);
+        hasNewTexture |= !hasTexture;
+      }
+    }
+
+    if (hasNewTexture)
+      fusedProgram.initTextures();
+
+    fusedProgram.sendAttributes();
+  }
+}
+
+void RenderGraph::resizeTransientTextures() const {
+  ZoneScopedN("RenderGraph::resizeTransientTextures");
+
+  for (const PooledTexture& pooledTexture : m_transientTexturePool) {
+    const unsigned int width  = m_viewportWidth / pooledTexture.sizeDivisor;
+    const unsigned int height = m_viewportHeight / pooledTexture.sizeDivisor;
+
+    if (pooledTexture.texture->getWidth() != width || pooledTexture.texture->getHeight() != height)
+      pooledTexture.texture->resize(width, height);
+  }
 }
 
 void RenderGraph::execute(const RenderSystem& renderSystem) {
   ZoneScopedN("RenderGraph::execute");
+  const ProfileScope executeScope("RenderGraph::execute", true);
+
+  if (!m_isCompiled)
+    compile();
+
+  updateFusedPasses();
 
   {
     ZoneScopedN("Renderer::clear");
     Renderer::clear(MaskType::COLOR | MaskType::DEPTH | MaskType::STENCIL);
   }
 
-  executeGeometryPass(renderSystem);
-  m_lastExecutedPass = &m_geometryPass;
+  m_frameTimings.clear();
 
-  m_executedPasses.reserve(m_nodes.size() + 1);
-  m_executedPasses.emplace(&m_geometryPass);
+  std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+  executeGeometryPass(renderSystem);
+  recordPassTiming(m_geometryPass, "Geometry pass", startTime);
 
-  for (const std::unique_ptr<RenderPass>& renderPass : m_nodes)
-    executePass(*renderPass);
+  for (const RenderPass* renderPass : m_executionList) {
+    startTime = std::chrono::steady_clock::now();
+    renderPass->execute();
+    recordPassTiming(*renderPass, (renderPass->getName().empty() ? "[Unnamed pass]" : renderPass->getName()), startTime);
+  }
 
-  m_executedPasses.clear();
+  m_lastExecutedPass = (m_executionList.empty() ? &m_geometryPass : m_executionList.back());
 }
 
 void RenderGraph::executeGeometryPass(const RenderSystem& renderSystem) const {
   ZoneScopedN("RenderGraph::executeGeometryPass");
+  const ProfileScope geometryScope("Geometry pass", true);
   TracyGpuZone("Geometry pass")
 
 #if !defined(USE_OPENGL_ES)
@@ -90,6 +552,24 @@ void RenderGraph::executeGeometryPass(const RenderSystem& renderSystem) const {
     meshRenderer.draw();
   }
 
+  for (Entity* entity : renderSystem.m_entities) {
+    if (!entity->isEnabled() || !entity->hasComponent<StaticMeshRenderer>())
+      continue;
+
+    auto& staticMeshRenderer = entity->getComponent<StaticMeshRenderer>();
+
+    if (!staticMeshRenderer.isEnabled())
+      continue;
+
+    // The static geometry is already in world space; a transform may however be applied to it as a whole
+    const Mat4f modelMat = (entity->hasComponent<Transform>() ? entity->getComponent<Transform>().computeTransformMatrix() : Mat4f::identity());
+
+    staticMeshRenderer.updateDrawCommands(renderSystem.m_viewProjMat * modelMat);
+
+    renderSystem.m_modelUbo.sendData(modelMat, 0);
+    staticMeshRenderer.draw();
+  }
+
   geometryFramebuffer.unbind();
 
 #if !defined(USE_OPENGL_ES)
@@ -102,17 +582,24 @@ void RenderGraph::executeGeometryPass(const RenderSystem& renderSystem) const {
 #endif
 }
 
-void RenderGraph::executePass(const RenderPass& renderPass) {
-  if (m_executedPasses.contains(&renderPass))
-    return;
+void RenderGraph::recordPassTiming(const RenderPass& renderPass, [[maybe_unused]] std::string_view timingName, std::chrono::steady_clock::time_point startTime) {
+  const float cpuTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+  float gpuTime       = 0.f;
 
-  for (const RenderPass* parentPass : renderPass.m_parents)
-    executePass(*parentPass);
+#if !defined(USE_OPENGL_ES)
+  // The GPU time is only recovered if the pass' execution has finished in a previous frame, never waiting for the current one
+  if (renderPass.m_timer.updateTime() && Profiler::isEnabled()) {
+    // The timing's name is only built once per pass, not on every frame
+    if (renderPass.m_gpuTimingName.empty())
+      renderPass.m_gpuTimingName = std::format("{} (GPU)", timingName);
 
-  renderPass.execute();
-  m_lastExecutedPass = &renderPass;
+    Profiler::recordTiming(renderPass.m_gpuTimingName, renderPass.m_timer.getTime());
+  }
+
+  gpuTime = renderPass.m_timer.getTime();
+#endif
 
-  m_executedPasses.emplace(&renderPass);
+  m_frameTimings.emplace_back(RenderPassTiming{ &renderPass, cpuTime, gpuTime });
 }
 
 } // namespace Raz
@@ -1,6 +1,8 @@
 #include "RaZ/Render/Renderer.hpp"
+#include "RaZ/Render/RenderGraph.hpp"
 #include "RaZ/Render/RenderPass.hpp"
 #include "RaZ/Render/Texture.hpp"
+#include "RaZ/Utils/Profiler.hpp"
 
 #include "tracy/Tracy.hpp"
 #include "GL/glew.h" // Needed by TracyOpenGL.hpp
@@ -10,6 +12,11 @@
 
 namespace Raz {
 
+RenderPass::RenderPass(ScreenEffect screenEffect, std::string passName)
+  : RenderPass(FragmentShader::loadFromSource(ScreenEffect::generateShaderSource({ &screenEffect })), std::move(passName)) {
+  m_screenEffect = std::move(screenEffect);
+}
+
 bool RenderPass::isValid() const {
   // Since a pass can get read & write buffers from other sources than the previous pass, one may have more or less
   //  buffers than its parent write to. Direct buffer compatibility is thus not checked
@@ -38,6 +45,8 @@ bool RenderPass::isValid() const {
 void RenderPass::addReadTexture(TexturePtr texture, const std::string& uniformName) {
   m_program.setTexture(std::move(texture), uniformName);
   m_program.initTextures();
+
+  invalidateRenderGraph();
 }
 
 void RenderPass::execute() const {
@@ -46,6 +55,12 @@ void RenderPass::execute() const {
   if (!m_enabled)
     return;
 
+  // The pass' name can be changed at any time, hence must be stored for the profiler to reference it; this is only done once until renamed
+  if (m_profileName.empty() && Profiler::isEnabled())
+    m_profileName = Profiler::storeName(m_name.empty() ? "[Unnamed pass]" : m_name);
+
+  const ProfileScope passScope(m_profileName, true);
+
   TracyGpuZoneTransient(_, (m_name.empty() ? "[Unnamed pass]" : m_name.c_str()), true)
 
 #if !defined(USE_OPENGL_ES)
@@ -75,4 +90,9 @@ void RenderPass::execute() const {
 #endif
 }
 
+void RenderPass::invalidateRenderGraph() noexcept {
+  if (m_renderGraph)
+    m_renderGraph->m_isCompiled = false;
+}
+
 } // namespace Raz
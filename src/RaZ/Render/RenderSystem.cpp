@@ -7,6 +7,7 @@
 #include "RaZ/Render/MeshRenderer.hpp"
 #include "RaZ/Render/Renderer.hpp"
 #include "RaZ/Render/RenderSystem.hpp"
+#include "RaZ/Render/StaticMeshRenderer.hpp"
 #if defined(RAZ_USE_XR)
 #include "RaZ/XR/XrSystem.hpp"
 #endif
@@ -15,8 +16,46 @@
 #include "GL/glew.h" // Needed by TracyOpenGL.hpp
 #include "tracy/TracyOpenGL.hpp"
 
+#include <algorithm>
+#include <limits>
+
 namespace Raz {
 
+namespace {
+
+// These values must match those defined in the lit materials' shaders
+constexpr unsigned int lightTextureWidth        = 1024; // Width of the lights' data & indices textures, which are filled row by row
+constexpr unsigned int lightsTextureUnit        = 13;
+constexpr unsigned int lightClustersTextureUnit = 14;
+constexpr unsigned int lightIndicesTextureUnit  = 15;
+
+template <typename T>
+void sendLightTextureData(Texture2D& texture, std::vector<T>& data, unsigned int width, TextureFormat format) {
+  // Each element represents a texel; the data is padded to fill whole rows, and the texture is reallocated only when its row count changes
+  const auto height = static_cast<unsigned int>(std::max<std::size_t>((data.size() + width - 1) / width, 1));
+  data.resize(static_cast<std::size_t>(width) * height);
+
+  if (texture.getWidth() != width || texture.getHeight() != height)
+    texture.resize(width, height);
+
+  texture.bind();
+  Renderer::sendImageSubData2D(TextureType::TEXTURE_2D, 0, 0, 0, width, height, format, PixelDataType::FLOAT, data.data());
+  texture.unbind();
+}
+
+void initLightTextures(const RenderShaderProgram& program) {
+  // Programs not making use of the lights don't declare the corresponding samplers
+  if (Renderer::recoverUniformBlockIndex(program.getIndex(), "uboLightsInfo") == std::numeric_limits<unsigned int>::max())
+    return;
+
+  program.use();
+  program.sendUniform("uniLightsData", static_cast<int>(lightsTextureUnit));
+  program.sendUniform("uniLightClusters", static_cast<int>(lightClustersTextureUnit));
+  program.sendUniform("uniLightIndices", static_cast<int>(lightIndicesTextureUnit));
+}
+
+} // namespace
+
 void RenderSystem::setCubemap(Cubemap&& cubemap) {
   m_cubemap = std::move(cubemap);
   m_cameraUbo.bindUniformBlock(m_cubemap->getProgram(), "uboCameraInfo", 0);
@@ -43,6 +82,9 @@ void RenderSystem::resizeViewport(unsigned int width, unsigned int height) {
     m_cameraEntity->getComponent<Camera>().resizeViewport(m_sceneWidth, m_sceneHeight);
 
   m_renderGraph.resizeViewport(m_sceneWidth, m_sceneHeight);
+
+  if (m_frameCapturer)
+    m_frameCapturer->resize(m_sceneWidth, m_sceneHeight);
 }
 
 bool RenderSystem::update(const FrameTimeInfo& timeInfo) {
@@ -54,6 +96,18 @@ bool RenderSystem::update(const FrameTimeInfo& timeInfo) {
   m_timeUbo.bindBase(2);
   m_modelUbo.bindBase(3);
 
+  Renderer::setActiveTexture(lightsTextureUnit);
+  m_lightsTexture.bind();
+  Renderer::setActiveTexture(lightClustersTextureUnit);
+  m_lightClustersTexture.bind();
+  Renderer::setActiveTexture(lightIndicesTextureUnit);
+  m_lightIndicesTexture.bind();
+  Renderer::setActiveTexture(0);
+
+  // The render graph is compiled beforehand so that the uniform blocks can be bound to the programs of the passes it may fuse
+  if (!m_renderGraph.isCompiled())
+    m_renderGraph.compile();
+
   // TODO: this should be made only once at the passes' shader programs' initialization (as is done when updating shaders), not every frame
   //   Forcing to update shaders when adding a new pass would not be ideal either, as it implies many operations. Find a better & user-friendly way
   for (std::size_t i = 0; i < m_renderGraph.getNodeCount(); ++i) {
@@ -63,10 +117,19 @@ bool RenderSystem::update(const FrameTimeInfo& timeInfo) {
     m_timeUbo.bindUniformBlock(passProgram, "uboTimeInfo", 2);
   }
 
+  for (const RenderGraph::FusedPass& fusedPass : m_renderGraph.m_fusedPasses) {
+    const RenderShaderProgram& passProgram = fusedPass.pass->getProgram();
+    m_cameraUbo.bindUniformBlock(passProgram, "uboCameraInfo", 0);
+    m_lightsUbo.bindUniformBlock(passProgram, "uboLightsInfo", 1);
+    m_timeUbo.bindUniformBlock(passProgram, "uboTimeInfo", 2);
+  }
+
   m_timeUbo.bind();
   m_timeUbo.sendData(timeInfo.deltaTime, 0);
   m_timeUbo.sendData(timeInfo.globalTime, sizeof(float));
 
+  updateModifiedLights();
+
 #if defined(RAZ_USE_XR)
   if (m_xrSystem) {
     renderXrFrame();
@@ -74,9 +137,18 @@ bool RenderSystem::update(const FrameTimeInfo& timeInfo) {
 #endif
   {
     sendCameraInfo();
+
+    const auto& camera = m_cameraEntity->getComponent<Camera>();
+    updateLightClusters(camera.getViewMatrix(), camera.getProjectionMatrix(), camera.getNearPlane(), camera.getFarPlane());
+
     m_renderGraph.execute(*this);
   }
 
+  if (m_frameCapturer) {
+    m_frameCapturer->capture(m_frameCaptureCallback);
+    m_frameCapturer->update();
+  }
+
 #if defined(RAZ_CONFIG_DEBUG) && !defined(SKIP_RENDERER_ERRORS)
   Renderer::printErrors();
 #endif
@@ -89,22 +161,38 @@ bool RenderSystem::update(const FrameTimeInfo& timeInfo) {
   return true;
 }
 
-void RenderSystem::updateLights() const {
+void RenderSystem::updateLights() {
   ZoneScopedN("RenderSystem::updateLights");
 
-  unsigned int lightCount = 0;
+  m_lightEntities.clear();
 
-  m_lightsUbo.bind();
+  // Directional lights affect every fragment and are thus stored first, so that shaders can evaluate them before those of their cluster
 
-  for (const Entity* entity : m_entities) {
-    if (!entity->isEnabled() || !entity->hasComponent<Light>())
-      continue;
+  for (Entity* entity : m_entities) {
+    if (entity->isEnabled() && entity->hasComponent<Light>() && entity->getComponent<Light>().getType() == LightType::DIRECTIONAL)
+      m_lightEntities.emplace_back(entity);
+  }
+
+  m_directionalLightCount = static_cast<unsigned int>(m_lightEntities.size());
 
-    updateLight(*entity, lightCount);
-    ++lightCount;
+  for (Entity* entity : m_entities) {
+    if (entity->isEnabled() && entity->hasComponent<Light>() && entity->getComponent<Light>().getType() != LightType::DIRECTIONAL)
+      m_lightEntities.emplace_back(entity);
   }
 
-  m_lightsUbo.sendData(lightCount, sizeof(Vec4f) * 4 * 100);
+  const auto lightCount = static_cast<unsigned int>(m_lightEntities.size());
+
+  m_lightsData.resize(static_cast<std::size_t>(lightCount) * 4);
+  m_clusteredLights.resize(lightCount - m_directionalLightCount);
+
+  for (unsigned int lightIndex = 0; lightIndex < lightCount; ++lightIndex)
+    updateLight(*m_lightEntities[lightIndex], lightIndex);
+
+  sendLightTextureData(m_lightsTexture, m_lightsData, lightTextureWidth, TextureFormat::RGBA);
+
+  m_lightsUbo.bind();
+  m_lightsUbo.sendData(m_directionalLightCount, sizeof(float) * 2);
+  m_lightsUbo.sendData(lightCount, sizeof(float) * 2 + sizeof(unsigned int));
 }
 
 void RenderSystem::updateShaders() const {
@@ -117,38 +205,61 @@ void RenderSystem::updateShaders() const {
     m_cameraUbo.bindUniformBlock(passProgram, "uboCameraInfo", 0);
     m_lightsUbo.bindUniformBlock(passProgram, "uboLightsInfo", 1);
     m_timeUbo.bindUniformBlock(passProgram, "uboTimeInfo", 2);
+    initLightTextures(passProgram);
   }
 
+  // As for the render passes, all materials' programs start being linked before any is waited for
   for (Entity* entity : m_entities) {
-    if (!entity->hasComponent<MeshRenderer>())
-      continue;
+    if (entity->hasComponent<MeshRenderer>()) {
+      for (Material& material : entity->getComponent<MeshRenderer>().getMaterials()) {
+        RenderShaderProgram& materialProgram = material.getProgram();
+        materialProgram.loadShaders();
+        materialProgram.startLink();
+      }
+    }
+
+    if (entity->hasComponent<StaticMeshRenderer>()) {
+      for (Material& material : entity->getComponent<StaticMeshRenderer>().getMaterials()) {
+        RenderShaderProgram& materialProgram = material.getProgram();
+        materialProgram.loadShaders();
+        materialProgram.startLink();
+      }
+    }
+  }
+
+  for (Entity* entity : m_entities) {
+    if (entity->hasComponent<MeshRenderer>()) {
+      auto& meshRenderer = entity->getComponent<MeshRenderer>();
+
+      for (Material& material : meshRenderer.getMaterials())
+        material.getProgram().completeLink();
+
+      updateMaterials(meshRenderer);
+    }
 
-    auto& meshRenderer = entity->getComponent<MeshRenderer>();
+    if (entity->hasComponent<StaticMeshRenderer>()) {
+      auto& staticMeshRenderer = entity->getComponent<StaticMeshRenderer>();
 
-    for (Material& material : meshRenderer.getMaterials())
-      material.getProgram().updateShaders();
+      for (Material& material : staticMeshRenderer.getMaterials())
+        material.getProgram().completeLink();
 
-    updateMaterials(meshRenderer);
+      updateMaterials(staticMeshRenderer);
+    }
   }
 }
 
 void RenderSystem::updateMaterials(const MeshRenderer& meshRenderer) const {
   ZoneScopedN("RenderSystem::updateMaterials(MeshRenderer)");
 
-  for (const Material& material : meshRenderer.getMaterials()) {
-    const RenderShaderProgram& materialProgram = material.getProgram();
+  for (const Material& material : meshRenderer.getMaterials())
+    updateMaterial(material);
+}
 
-    materialProgram.sendAttributes();
-    materialProgram.initTextures();
-#if !defined(USE_WEBGL)
-    materialProgram.initImageTextures();
-#endif
+void RenderSystem::updateMaterials(const StaticMeshRenderer& staticMeshRenderer) const {
+  ZoneScopedN("RenderSystem::updateMaterials(StaticMeshRenderer)");
 
-    m_cameraUbo.bindUniformBlock(materialProgram, "uboCameraInfo", 0);
-    m_lightsUbo.bindUniformBlock(materialProgram, "uboLightsInfo", 1);
-    m_timeUbo.bindUniformBlock(materialProgram, "uboTimeInfo", 2);
-    m_modelUbo.bindUniformBlock(materialProgram, "uboModelInfo", 3);
-  }
+  for (const Material& material : staticMeshRenderer.getMaterials())
+    updateMaterial(material);
 }
 
 void RenderSystem::updateMaterials() const {
@@ -157,6 +268,9 @@ void RenderSystem::updateMaterials() const {
   for (const Entity* entity : m_entities) {
     if (entity->hasComponent<MeshRenderer>())
       updateMaterials(entity->getComponent<MeshRenderer>());
+
+    if (entity->hasComponent<StaticMeshRenderer>())
+      updateMaterials(entity->getComponent<StaticMeshRenderer>());
   }
 }
 
@@ -187,6 +301,23 @@ void RenderSystem::saveToImage(const FilePath& filePath, TextureFormat format, P
   ImageFormat::save(filePath, img, true);
 }
 
+void RenderSystem::enableFrameCapture(FrameCaptureCallback callback, TextureFormat format, PixelDataType dataType) {
+  ZoneScopedN("RenderSystem::enableFrameCapture");
+
+  disableFrameCapture();
+
+  m_frameCapturer.emplace(m_sceneWidth, m_sceneHeight, format, dataType);
+  m_frameCaptureCallback = std::move(callback);
+}
+
+void RenderSystem::disableFrameCapture() {
+  ZoneScopedN("RenderSystem::disableFrameCapture");
+
+  // Destroying the capturer delivers its pending frames & waits for their callbacks to finish
+  m_frameCapturer.reset();
+  m_frameCaptureCallback = nullptr;
+}
+
 void RenderSystem::destroy() {
 #if !defined(RAZ_NO_WINDOW)
   if (m_window)
@@ -207,12 +338,41 @@ void RenderSystem::linkEntity(const EntityPtr& entity) {
 
   if (entity->hasComponent<MeshRenderer>())
     updateMaterials(entity->getComponent<MeshRenderer>());
+
+  if (entity->hasComponent<StaticMeshRenderer>())
+    updateMaterials(entity->getComponent<StaticMeshRenderer>());
+}
+
+void RenderSystem::unlinkEntity(const EntityPtr& entity) {
+  ZoneScopedN("RenderSystem::unlinkEntity");
+
+  System::unlinkEntity(entity);
+
+  // The light entities are referenced by their index in the lights' data, which must be recomputed
+  if (std::ranges::find(m_lightEntities, entity.get()) != m_lightEntities.end())
+    updateLights();
+}
+
+void RenderSystem::updateMaterial(const Material& material) const {
+  const RenderShaderProgram& materialProgram = material.getProgram();
+
+  materialProgram.sendAttributes();
+  materialProgram.initTextures();
+#if !defined(USE_WEBGL)
+  materialProgram.initImageTextures();
+#endif
+
+  m_cameraUbo.bindUniformBlock(materialProgram, "uboCameraInfo", 0);
+  m_lightsUbo.bindUniformBlock(materialProgram, "uboLightsInfo", 1);
+  m_timeUbo.bindUniformBlock(materialProgram, "uboTimeInfo", 2);
+  m_modelUbo.bindUniformBlock(materialProgram, "uboModelInfo", 3);
+  initLightTextures(materialProgram);
 }
 
 void RenderSystem::initialize() {
   ZoneScopedN("RenderSystem::initialize");
 
-  registerComponents<Camera, Light, MeshRenderer>();
+  registerComponents<Camera, Light, MeshRenderer, StaticMeshRenderer>();
 
   // TODO: this Renderer initialization is technically useless; the RenderSystem needs to have it initialized before construction
   //  (either manually or through the Window's initialization), since it constructs the RenderGraph's rendering objects
@@ -236,8 +396,18 @@ void RenderSystem::initialize() {
     Renderer::setLabel(RenderObjectType::BUFFER, m_lightsUbo.getIndex(), "Lights uniform buffer");
     Renderer::setLabel(RenderObjectType::BUFFER, m_timeUbo.getIndex(), "Time uniform buffer");
     Renderer::setLabel(RenderObjectType::BUFFER, m_modelUbo.getIndex(), "Model uniform buffer");
+    Renderer::setLabel(RenderObjectType::TEXTURE, m_lightsTexture.getIndex(), "Lights texture");
+    Renderer::setLabel(RenderObjectType::TEXTURE, m_lightClustersTexture.getIndex(), "Light clusters texture");
+    Renderer::setLabel(RenderObjectType::TEXTURE, m_lightIndicesTexture.getIndex(), "Light indices texture");
   }
 #endif
+
+  // The lights' textures are only read with texelFetch(); besides, 32-bit floating-point textures may not be filterable
+  m_lightsTexture.setFilter(TextureFilter::NEAREST);
+  m_lightClustersTexture.setFilter(TextureFilter::NEAREST);
+  m_lightIndicesTexture.setFilter(TextureFilter::NEAREST);
+  m_lightClustersTexture.resize(LightClusterer::clusterCountX * LightClusterer::clusterCountY, LightClusterer::clusterCountZ);
+  updateLights();
 }
 
 void RenderSystem::initialize(unsigned int sceneWidth, unsigned int sceneHeight) {
@@ -277,21 +447,117 @@ void RenderSystem::sendCameraInfo() const {
   sendViewProjectionMatrix(camera.getProjectionMatrix() * camera.getViewMatrix());
 }
 
-void RenderSystem::updateLight(const Entity& entity, unsigned int lightIndex) const {
-  const auto& light = entity.getComponent<Light>();
-  const std::size_t dataStride = sizeof(Vec4f) * 4 * lightIndex;
+void RenderSystem::updateLight(Entity& entity, unsigned int lightIndex) {
+  auto& light = entity.getComponent<Light>();
+  const std::size_t dataIndex = static_cast<std::size_t>(lightIndex) * 4;
+
+  assert("Error: The light's data must have been allocated before being updated." && dataIndex + 4 <= m_lightsData.size());
 
   if (light.getType() == LightType::DIRECTIONAL) {
-    m_lightsUbo.sendData(Vec4f(0.f), static_cast<unsigned int>(dataStride));
+    m_lightsData[dataIndex] = Vec4f(0.f);
   } else {
     assert("Error: A non-directional light needs to have a Transform component." && entity.hasComponent<Transform>());
-    m_lightsUbo.sendData(Vec4f(entity.getComponent<Transform>().getPosition(), 1.f), static_cast<unsigned int>(dataStride));
+    auto& lightTransform = entity.getComponent<Transform>();
+
+    m_lightsData[dataIndex] = Vec4f(lightTransform.getPosition(), 1.f);
+    m_clusteredLights[lightIndex - m_directionalLightCount] = ClusteredLight{ lightTransform.getPosition(), light.computeInfluenceRadius(), lightIndex };
+
+    // The camera's transform update status is reset when sending its information
+    if (&entity != m_cameraEntity)
+      lightTransform.setUpdated(false);
+  }
+
+  const Color& color = light.getColor();
+
+  m_lightsData[dataIndex + 1] = Vec4f(light.getDirection(), 0.f);
+  m_lightsData[dataIndex + 2] = Vec4f(color.red(), color.green(), color.blue(), 1.f);
+  m_lightsData[dataIndex + 3] = Vec4f(light.getEnergy(), light.getAngle().value, 0.f, 0.f);
+
+  light.setUpdated(false);
+}
+
+void RenderSystem::updateModifiedLights() {
+  ZoneScopedN("RenderSystem::updateModifiedLights");
+
+  // If a light has been enabled or added to an already linked entity, it is missing from the known lights, which must all be recomputed
+  const auto enabledLightCount = static_cast<std::size_t>(std::ranges::count_if(m_entities, [] (const Entity* entity) {
+    return (entity->isEnabled() && entity->hasComponent<Light>());
+  }));
+
+  if (enabledLightCount != m_lightEntities.size()) {
+    updateLights();
+    return;
+  }
+
+  std::size_t firstModifiedTexel = std::numeric_limits<std::size_t>::max();
+  std::size_t endModifiedTexel   = 0;
+
+  for (unsigned int lightIndex = 0; lightIndex < m_lightEntities.size(); ++lightIndex) {
+    Entity& entity = *m_lightEntities[lightIndex];
+
+    // If a light has been disabled, removed or changed to or from being directional, the lights' order isn't valid anymore
+    if (!entity.isEnabled() || !entity.hasComponent<Light>()
+     || ((entity.getComponent<Light>().getType() == LightType::DIRECTIONAL) != (lightIndex < m_directionalLightCount))) {
+      updateLights();
+      return;
+    }
+
+    const auto& light = entity.getComponent<Light>();
+    const bool hasMoved = (light.getType() != LightType::DIRECTIONAL && entity.getComponent<Transform>().hasUpdated());
+
+    if (!light.hasUpdated() && !hasMoved)
+      continue;
+
+    updateLight(entity, lightIndex);
+
+    firstModifiedTexel = std::min(firstModifiedTexel, static_cast<std::size_t>(lightIndex) * 4);
+    endModifiedTexel   = static_cast<std::size_t>(lightIndex) * 4 + 4;
   }
 
-  m_lightsUbo.sendData(light.getDirection(), static_cast<unsigned int>(dataStride + sizeof(Vec4f)));
-  m_lightsUbo.sendData(light.getColor(), static_cast<unsigned int>(dataStride + sizeof(Vec4f) * 2));
-  m_lightsUbo.sendData(light.getEnergy(), static_cast<unsigned int>(dataStride + sizeof(Vec4f) * 3));
-  m_lightsUbo.sendData(light.getAngle().value, static_cast<unsigned int>(dataStride + sizeof(Vec4f) * 3 + sizeof(float)));
+  if (endModifiedTexel == 0)
+    return;
+
+  // All modified lights are sent at once; the texels in between are sent as well, which is much cheaper than multiple uploads
+  const std::size_t firstRow = firstModifiedTexel / lightTextureWidth;
+  const std::size_t lastRow  = (endModifiedTexel - 1) / lightTextureWidth;
+  const bool isSingleRow     = (firstRow == lastRow);
+
+  const auto offsetX = static_cast<unsigned int>(isSingleRow ? firstModifiedTexel % lightTextureWidth : 0);
+  const auto width   = static_cast<unsigned int>(isSingleRow ? endModifiedTexel - firstModifiedTexel : lightTextureWidth);
+  const auto height  = static_cast<unsigned int>(lastRow - firstRow + 1);
+
+  m_lightsTexture.bind();
+  Renderer::sendImageSubData2D(TextureType::TEXTURE_2D, 0,
+                               offsetX, static_cast<unsigned int>(firstRow),
+                               width, height,
+                               TextureFormat::RGBA, PixelDataType::FLOAT,
+                               m_lightsData.data() + firstRow * lightTextureWidth + offsetX);
+  m_lightsTexture.unbind();
+}
+
+void RenderSystem::updateLightClusters(const Mat4f& viewMat, const Mat4f& projMat, float nearPlane, float farPlane) {
+  ZoneScopedN("RenderSystem::updateLightClusters");
+
+  m_lightClusterer.computeClusters(m_clusteredLights, viewMat, projMat, nearPlane, farPlane);
+
+  // Indices are sent as floating-point values, which represent them exactly up to 2^24
+
+  const std::vector<LightCluster>& clusters = m_lightClusterer.getClusters();
+  m_lightClustersData.resize(clusters.size());
+  std::ranges::transform(clusters, m_lightClustersData.begin(), [] (const LightCluster& cluster) noexcept {
+    return Vec2f(static_cast<float>(cluster.offset), static_cast<float>(cluster.count));
+  });
+
+  const std::vector<unsigned int>& lightIndices = m_lightClusterer.getLightIndices();
+  m_lightIndicesData.resize(lightIndices.size());
+  std::ranges::transform(lightIndices, m_lightIndicesData.begin(), [] (unsigned int index) noexcept { return static_cast<float>(index); });
+
+  sendLightTextureData(m_lightClustersTexture, m_lightClustersData, LightClusterer::clusterCountX * LightClusterer::clusterCountY, TextureFormat::RG);
+  sendLightTextureData(m_lightIndicesTexture, m_lightIndicesData, lightTextureWidth, TextureFormat::RED);
+
+  m_lightsUbo.bind();
+  m_lightsUbo.sendData(nearPlane, 0);
+  m_lightsUbo.sendData(LightClusterer::computeDepthScale(nearPlane, farPlane), sizeof(float));
 }
 
 #if defined(RAZ_USE_XR)
@@ -336,6 +602,8 @@ void RenderSystem::renderXrFrame() {
     sendViewProjectionMatrix(projMat * viewMat);
     sendCameraPosition(position);
 
+    updateLightClusters(viewMat, projMat, nearZ, farZ);
+
     m_renderGraph.execute(*this);
 
     assert("Error: There is no valid last executed pass." && m_renderGraph.m_lastExecutedPass);
@@ -7,36 +7,59 @@ namespace Raz {
 
 RenderTimer::RenderTimer() noexcept {
 #if !defined(USE_OPENGL_ES)
-  Renderer::generateQuery(m_index);
+  for (auto& index : m_indices)
+    Renderer::generateQuery(index);
 #endif
 }
 
 void RenderTimer::start() const noexcept {
 #if !defined(USE_OPENGL_ES)
-  Renderer::beginQuery(QueryType::TIME_ELAPSED, m_index);
+  // If the GPU is late enough for the next query to still be in flight, its result is discarded by starting it again
+  if (m_pendingQueryCount == queryCount && !updateTime())
+    --m_pendingQueryCount;
+
+  Renderer::beginQuery(QueryType::TIME_ELAPSED, m_indices[m_nextQueryIndex]);
 #endif
 }
 
 void RenderTimer::stop() const noexcept {
 #if !defined(USE_OPENGL_ES)
   Renderer::endQuery(QueryType::TIME_ELAPSED);
+
+  m_nextQueryIndex = (m_nextQueryIndex + 1) % queryCount;
+  ++m_pendingQueryCount;
 #endif
 }
 
-float RenderTimer::recoverTime() const noexcept {
+bool RenderTimer::updateTime() const noexcept {
 #if !defined(USE_OPENGL_ES)
-  int64_t time {};
-  Renderer::recoverQueryResult(m_index, time);
+  bool hasNewTime = false;
+
+  // Queries finish in the order they have been issued; the first one whose result is not available ends the recovery
+  while (m_pendingQueryCount > 0) {
+    const unsigned int queryIndex = m_indices[(m_nextQueryIndex + queryCount - m_pendingQueryCount) % queryCount];
+
+    if (!Renderer::isQueryResultAvailable(queryIndex))
+      break;
+
+    int64_t time {};
+    Renderer::recoverQueryResult(queryIndex, time);
+
+    m_time     = static_cast<float>(time) / 1'000'000.f;
+    hasNewTime = true;
+    --m_pendingQueryCount;
+  }
 
-  return (static_cast<float>(time) / 1'000'000.f);
+  return hasNewTime;
 #else
-  return 0;
+  return false;
 #endif
 }
 
 RenderTimer::~RenderTimer() {
 #if !defined(USE_OPENGL_ES)
-  Renderer::deleteQuery(m_index);
+  for (const auto& index : m_indices)
+    Renderer::deleteQuery(index);
 #endif
 }
 
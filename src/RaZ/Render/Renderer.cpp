@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <limits>
 
 namespace Raz {
 
@@ -128,6 +129,22 @@ void Renderer::initialize() {
   recoverDefaultFramebufferColorFormat();
   recoverDefaultFramebufferDepthFormat();
 
+#if !defined(USE_WEBGL)
+  // Letting the driver compile shaders on as many threads as it sees fit; compilations & links then only wait for completion when their status is queried
+  if (isExtensionSupported("GL_KHR_parallel_shader_compile")) {
+    glMaxShaderCompilerThreadsKHR(std::numeric_limits<unsigned int>::max());
+    s_isParallelShaderCompileEnabled = true;
+  }
+#if !defined(USE_OPENGL_ES)
+  else if (isExtensionSupported("GL_ARB_parallel_shader_compile")) {
+    glMaxShaderCompilerThreadsARB(std::numeric_limits<unsigned int>::max());
+    s_isParallelShaderCompileEnabled = true;
+  }
+#endif
+
+  printConditionalErrors();
+#endif
+
 #if !defined(RAZ_PLATFORM_MAC) && !defined(USE_OPENGL_ES) // Setting the debug message callback provokes a crash on macOS & isn't available on OpenGL ES
   if (checkVersion(4, 3)) {
     enable(Capability::DEBUG_OUTPUT);
@@ -511,6 +528,28 @@ void Renderer::sendBufferSubData(BufferType type, std::ptrdiff_t offset, std::pt
   printConditionalErrors();
 }
 
+#if !defined(USE_WEBGL)
+void* Renderer::mapBufferRange(BufferType type, std::ptrdiff_t offset, std::ptrdiff_t length, BufferMappingAccess access) {
+  assert("Error: The Renderer must be initialized before calling its functions." && isInitialized());
+
+  void* data = glMapBufferRange(static_cast<unsigned int>(type), offset, length, static_cast<unsigned int>(access));
+
+  printConditionalErrors();
+
+  return data;
+}
+
+bool Renderer::unmapBuffer(BufferType type) {
+  assert("Error: The Renderer must be initialized before calling its functions." && isInitialized());
+
+  const bool isDataValid = (glUnmapBuffer(static_cast<unsigned int>(type)) == GL_TRUE);
+
+  printConditionalErrors();
+
+  return isDataValid;
+}
+#endif
+
 void Renderer::deleteBuffers(unsigned int count, const unsigned int* indices) {
   assert("Error: The Renderer must be initialized before calling its functions." && isInitialized());
 
@@ -706,6 +745,27 @@ void Renderer::sendImageData2D(TextureType type,
   printConditionalErrors();
 }
 
+void Renderer::sendCompressedImageData2D(TextureType type,
+                                         unsigned int mipmapLevel,
+                                         TextureInternalFormat internalFormat,
+                                         unsigned int width, unsigned int height,
+                                         std::size_t dataSize, const void* data) {
+  assert("Error: The Renderer must be initialized before calling its functions." && isInitialized());
+
+  TracyGpuZone("Renderer::sendCompressedImageData2D")
+
+  glCompressedTexImage2D(static_cast<unsigned int>(type),
+                         static_cast<int>(mipmapLevel),
+                         static_cast<unsigned int>(internalFormat),
+                         static_cast<int>(width),
+                         static_cast<int>(height),
+                         0,
+                         static_cast<int>(dataSize),
+                         data);
+
+  printConditionalErrors();
+}
+
 void Renderer::sendImageSubData2D(TextureType type,
                                   unsigned int mipmapLevel,
                                   unsigned int offsetX, unsigned int offsetY,
@@ -1004,16 +1064,71 @@ void Renderer::linkProgram(unsigned int index) {
 
   glLinkProgram(index);
 
-  if (!isProgramLinked(index)) {
-    char infoLog[512];
+  // Checking the link status would wait for the link to finish, defeating parallel compilation
+  if (!s_isParallelShaderCompileEnabled && !isProgramLinked(index))
+    logProgramErrors(index);
+
+  printConditionalErrors();
+}
+
+void Renderer::logProgramErrors(unsigned int index) {
+  assert("Error: The Renderer must be initialized before calling its functions." && isInitialized());
+
+  char infoLog[512];
 
-    glGetProgramInfoLog(index, static_cast<int>(std::size(infoLog)), nullptr, infoLog);
-    Logger::error("[Renderer] Shader program link failed (ID {}): {}", index, infoLog);
+  for (const unsigned int shaderIndex : recoverAttachedShaders(index)) {
+    if (isShaderCompiled(shaderIndex))
+      continue;
+
+    glGetShaderInfoLog(shaderIndex, static_cast<int>(std::size(infoLog)), nullptr, infoLog);
+    Logger::error("[Renderer] Shader compilation failed (ID {}): {}", shaderIndex, infoLog);
   }
 
+  glGetProgramInfoLog(index, static_cast<int>(std::size(infoLog)), nullptr, infoLog);
+  Logger::error("[Renderer] Shader program link failed (ID {}): {}", index, infoLog);
+
+  printConditionalErrors();
+}
+
+#if !defined(USE_WEBGL)
+void Renderer::setProgramBinaryRetrievable(unsigned int index, bool retrievable) {
+  assert("Error: The Renderer must be initialized before calling its functions." && isInitialized());
+
+  glProgramParameteri(index, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, (retrievable ? GL_TRUE : GL_FALSE));
+
   printConditionalErrors();
 }
 
+std::vector<unsigned char> Renderer::recoverProgramBinary(unsigned int index, unsigned int& format) {
+  assert("Error: The Renderer must be initialized before calling its functions." && isInitialized());
+
+  TracyGpuZone("Renderer::recoverProgramBinary")
+
+  int binaryLength {};
+  getProgramParameter(index, ProgramParameter::PROGRAM_BINARY_LENGTH, &binaryLength);
+
+  if (binaryLength <= 0)
+    return {};
+
+  std::vector<unsigned char> binary(static_cast<std::size_t>(binaryLength));
+  glGetProgramBinary(index, binaryLength, nullptr, &format, binary.data());
+
+  printConditionalErrors();
+
+  return binary;
+}
+
+void Renderer::sendProgramBinary(unsigned int index, unsigned int format, const std::vector<unsigned char>& binary) {
+  assert("Error: The Renderer must be initialized before calling its functions." && isInitialized());
+
+  TracyGpuZone("Renderer::sendProgramBinary")
+
+  glProgramBinary(index, format, binary.data(), static_cast<int>(binary.size()));
+
+  printConditionalErrors();
+}
+#endif
+
 void Renderer::useProgram(unsigned int index) {
   assert("Error: The Renderer must be initialized before calling its functions." && isInitialized());
 
@@ -1117,7 +1232,8 @@ void Renderer::compileShader(unsigned int index) {
 
   glCompileShader(index);
 
-  if (!isShaderCompiled(index)) {
+  // Checking the compilation status would wait for it to finish, defeating parallel compilation
+  if (!s_isParallelShaderCompileEnabled && !isShaderCompiled(index)) {
     char infoLog[512];
 
     glGetShaderInfoLog(index, static_cast<int>(std::size(infoLog)), nullptr, infoLog);
@@ -1619,6 +1735,22 @@ void Renderer::drawElementsInstanced(PrimitiveType type, unsigned int primitiveC
   printConditionalErrors();
 }
 
+#if !defined(USE_OPENGL_ES)
+void Renderer::multiDrawElementsIndirect(PrimitiveType type, ElementDataType dataType, std::ptrdiff_t commandsOffset,
+                                         unsigned int drawCount, unsigned int stride) {
+  assert("Error: The Renderer must be initialized before calling its functions." && isInitialized());
+  assert("Error: Multi-draw indirect requires OpenGL 4.3+." && checkVersion(4, 3));
+
+  TracyGpuZone("Renderer::multiDrawElementsIndirect")
+
+  glMultiDrawElementsIndirect(static_cast<unsigned int>(type), static_cast<unsigned int>(dataType),
+                              reinterpret_cast<const void*>(commandsOffset),
+                              static_cast<int>(drawCount), static_cast<int>(stride));
+
+  printConditionalErrors();
+}
+#endif
+
 void Renderer::dispatchCompute(unsigned int groupCountX, unsigned int groupCountY, unsigned int groupCountZ) {
   assert("Error: The Renderer must be initialized before calling its functions." && isInitialized());
 #if !defined(USE_OPENGL_ES)
@@ -1690,6 +1822,17 @@ void Renderer::endQuery(QueryType type) {
   printConditionalErrors();
 }
 
+bool Renderer::isQueryResultAvailable(unsigned int index) {
+  assert("Error: The Renderer must be initialized before calling its functions." && isInitialized());
+
+  unsigned int isAvailable {};
+  glGetQueryObjectuiv(index, GL_QUERY_RESULT_AVAILABLE, &isAvailable);
+
+  printConditionalErrors();
+
+  return (isAvailable == GL_TRUE);
+}
+
 #if !defined(USE_OPENGL_ES)
 void Renderer::recoverQueryResult(unsigned int index, int64_t& result) {
   assert("Error: The Renderer must be initialized before calling its functions." && isInitialized());
@@ -1716,6 +1859,51 @@ void Renderer::deleteQueries(unsigned int count, const unsigned int* indices) {
   printConditionalErrors();
 }
 
+void* Renderer::createFenceSync() {
+  assert("Error: The Renderer must be initialized before calling its functions." && isInitialized());
+
+  GLsync sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+  printConditionalErrors();
+
+  return sync;
+}
+
+bool Renderer::isSyncSignaled(void* sync) {
+  assert("Error: The Renderer must be initialized before calling its functions." && isInitialized());
+
+  // The commands are flushed so that the fence is guaranteed to be eventually signaled
+  const unsigned int status = glClientWaitSync(static_cast<GLsync>(sync), GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+
+  printConditionalErrors();
+
+  return (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED);
+}
+
+void Renderer::waitSync(void* sync) {
+  assert("Error: The Renderer must be initialized before calling its functions." && isInitialized());
+
+  ZoneScopedN("Renderer::waitSync");
+
+  constexpr uint64_t timeout = 1'000'000'000; // 1 second, in nanoseconds
+
+  unsigned int status = glClientWaitSync(static_cast<GLsync>(sync), GL_SYNC_FLUSH_COMMANDS_BIT, timeout);
+
+  // The timeout only bounds each wait, which is repeated until the fence is signaled
+  while (status == GL_TIMEOUT_EXPIRED)
+    status = glClientWaitSync(static_cast<GLsync>(sync), 0, timeout);
+
+  printConditionalErrors();
+}
+
+void Renderer::deleteSync(void* sync) {
+  assert("Error: The Renderer must be initialized before calling its functions." && isInitialized());
+
+  glDeleteSync(static_cast<GLsync>(sync));
+
+  printConditionalErrors();
+}
+
 #if !defined(USE_OPENGL_ES)
 void Renderer::setLabel(RenderObjectType type, unsigned int objectIndex, const char* label) {
   assert("Error: The Renderer must be initialized before calling its functions." && isInitialized());
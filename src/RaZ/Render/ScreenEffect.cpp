@@ -0,0 +1,131 @@
+#include "RaZ/Render/ScreenEffect.hpp"
+#include "RaZ/Utils/StrUtils.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <format>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace Raz {
+
+namespace {
+
+constexpr std::string_view effectFunctionName = "applyEffect";
+
+bool isIdentifierCharacter(char character) noexcept {
+  return (std::isalnum(static_cast<unsigned char>(character)) || character == '_');
+}
+
+/// Recovers the names of the uniforms declared in the given source, uniform blocks excluded.
+std::unordered_set<std::string> recoverUniformNames(const std::string& source) {
+  std::unordered_set<std::string> uniformNames;
+
+  std::istringstream sourceStream(source);
+  std::string line;
+
+  while (std::getline(sourceStream, line)) {
+    StrUtils::trimLeft(line);
+
+    if (!StrUtils::startsWith(line, "uniform ") || line.find('{') != std::string::npos)
+      continue;
+
+    // A declaration may contain several uniforms separated by commas, each of which may be an array
+    const std::size_t declarationEnd = std::min(line.find(';'), line.size());
+
+    for (std::string& variable : StrUtils::split(line.substr(8, declarationEnd - 8), ',')) {
+      variable.erase(std::min(variable.find('['), variable.size()));
+      StrUtils::trimRight(variable);
+
+      const auto nameBegin = std::find_if_not(variable.rbegin(), variable.rend(), isIdentifierCharacter).base();
+      uniformNames.emplace(nameBegin, variable.end());
+    }
+  }
+
+  return uniformNames;
+}
+
+std::string renameIdentifiers(const std::string& source, const std::unordered_set<std::string>& names, std::size_t effectIndex) {
+  std::string renamedSource;
+  renamedSource.reserve(source.size());
+
+  std::size_t charIndex = 0;
+
+  while (charIndex < source.size()) {
+    if (!isIdentifierCharacter(source[charIndex])) {
+      renamedSource += source[charIndex++];
+      continue;
+    }
+
+    const std::size_t identifierBegin = charIndex;
+
+    while (charIndex < source.size() && isIdentifierCharacter(source[charIndex]))
+      ++charIndex;
+
+    std::string identifier = source.substr(identifierBegin, charIndex - identifierBegin);
+
+    if (names.contains(identifier))
+      identifier = ScreenEffect::recoverFusedName(identifier, effectIndex);
+
+    renamedSource += identifier;
+  }
+
+  return renamedSource;
+}
+
+} // namespace
+
+std::string ScreenEffect::generateShaderSource(const std::vector<const ScreenEffect*>& effects) {
+  if (effects.empty())
+    throw std::invalid_argument("[ScreenEffect] At least one effect must be given to generate a shader");
+
+  if (std::any_of(effects.cbegin() + 1, effects.cend(), [] (const ScreenEffect* effect) noexcept { return effect->samplesInput; }))
+    throw std::invalid_argument("[ScreenEffect] Only the first effect of a chain can sample its input");
+
+  const bool isFused = (effects.size() > 1);
+
+  std::string shaderSource = R"(in vec2 fragTexcoords;
+
+uniform sampler2D uniBuffer;
+
+layout(location = 0) out vec4 fragColor;
+)";
+
+  std::string mainSource = "\nvoid main() {\n";
+
+  for (std::size_t effectIndex = 0; effectIndex < effects.size(); ++effectIndex) {
+    const ScreenEffect& effect = *effects[effectIndex];
+    std::string functionName(effectFunctionName);
+
+    shaderSource += '\n';
+
+    if (isFused) {
+      // Each effect's uniforms & function are renamed so that they don't clash with the other effects'
+      std::unordered_set<std::string> names = recoverUniformNames(effect.source);
+      names.emplace(functionName);
+
+      shaderSource += renameIdentifiers(effect.source, names, effectIndex);
+      functionName  = recoverFusedName(functionName, effectIndex);
+    } else {
+      shaderSource += effect.source;
+    }
+
+    if (effectIndex > 0)
+      mainSource += std::format("  color = {}(color, fragTexcoords);\n", functionName);
+    else if (effect.samplesInput)
+      mainSource += std::format("  vec3 color = {}(fragTexcoords);\n", functionName);
+    else
+      mainSource += std::format("  vec3 color = {}(texture(uniBuffer, fragTexcoords).rgb, fragTexcoords);\n", functionName);
+  }
+
+  mainSource += "\n  fragColor = vec4(color, 1.0);\n}\n";
+
+  return shaderSource + mainSource;
+}
+
+std::string ScreenEffect::recoverFusedName(const std::string& name, std::size_t effectIndex) {
+  return std::format("{}_{}", name, effectIndex);
+}
+
+} // namespace Raz
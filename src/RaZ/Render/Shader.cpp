@@ -25,6 +25,7 @@ void Shader::load() const {
 void Shader::compile() const {
   Logger::debug("[Shader] Compiling (ID: {})...", m_index.get());
   Renderer::compileShader(m_index);
+  m_isCompilationPending = false;
   Logger::debug("[Shader] Compiled");
 }
 
@@ -55,6 +56,7 @@ void Shader::loadSource(const std::string& source) const {
   }
 
   Renderer::sendShaderSource(m_index, shaderSource);
+  m_isCompilationPending = true;
 
   Logger::debug("[Shader] Loaded source");
 }
@@ -1,9 +1,15 @@
 #include "RaZ/Render/Renderer.hpp"
 #include "RaZ/Render/ShaderProgram.hpp"
+#include "RaZ/Utils/FileUtils.hpp"
 #include "RaZ/Utils/Logger.hpp"
 
 #include "tracy/Tracy.hpp"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <ranges>
 
 namespace Raz {
@@ -54,6 +60,93 @@ ImageInternalFormat recoverImageTextureFormat(const Texture& texture) {
   throw std::invalid_argument("[ShaderProgram] The given image texture is not supported");
 }
 
+#if !defined(USE_WEBGL)
+bool isProgramBinarySupported() {
+#if !defined(USE_OPENGL_ES)
+  if (!Renderer::checkVersion(4, 1) && !Renderer::isExtensionSupported("GL_ARB_get_program_binary"))
+    return false;
+#else
+  if (!Renderer::checkVersion(3, 0))
+    return false;
+#endif
+
+  int binaryFormatCount {};
+  Renderer::getParameter(StateParameter::PROGRAM_BINARY_FORMAT_COUNT, &binaryFormatCount);
+
+  return (binaryFormatCount > 0);
+}
+
+FilePath recoverBinaryCachePath(unsigned int programIndex, const FilePath& cacheDirectory) {
+  // The binary depends on the driver, which must thus be part of the key along with all the shaders' sources
+  std::string key = Renderer::getContextInfo(ContextInfo::VENDOR) + '\n'
+                  + Renderer::getContextInfo(ContextInfo::RENDERER) + '\n'
+                  + Renderer::getContextInfo(ContextInfo::VERSION) + '\n';
+
+  // The order in which shaders are attached is irrelevant to the resulting program; they are sorted by stage to always give the same key
+  std::vector<unsigned int> shaderIndices = Renderer::recoverAttachedShaders(programIndex);
+  std::ranges::sort(shaderIndices, [] (unsigned int shaderIndex1, unsigned int shaderIndex2) {
+    return (Renderer::recoverShaderType(shaderIndex1) < Renderer::recoverShaderType(shaderIndex2));
+  });
+
+  for (const unsigned int shaderIndex : shaderIndices) {
+    key += std::to_string(static_cast<unsigned int>(Renderer::recoverShaderType(shaderIndex))) + '\n';
+    key += Renderer::recoverShaderSource(shaderIndex) + '\n';
+  }
+
+  // 64-bit FNV-1a hash, which remains identical between runs & platforms
+  uint64_t hash = 14695981039346656037ull;
+
+  for (const char character : key) {
+    hash ^= static_cast<unsigned char>(character);
+    hash *= 1099511628211ull;
+  }
+
+  return cacheDirectory + std::format("/{:016x}.bin", hash);
+}
+
+bool loadCachedBinary(unsigned int programIndex, const FilePath& binaryPath) {
+  ZoneScopedN("[ShaderProgram]::loadCachedBinary");
+
+  if (!FileUtils::isReadable(binaryPath))
+    return false;
+
+  const std::vector<unsigned char> fileData = FileUtils::readFileToArray(binaryPath);
+
+  // The file starts with the binary's format, followed by the binary itself
+  unsigned int binaryFormat {};
+
+  if (fileData.size() <= sizeof(binaryFormat))
+    return false;
+
+  std::memcpy(&binaryFormat, fileData.data(), sizeof(binaryFormat));
+  const std::vector<unsigned char> binary(fileData.begin() + sizeof(binaryFormat), fileData.end());
+
+  Renderer::sendProgramBinary(programIndex, binaryFormat, binary);
+
+  return Renderer::isProgramLinked(programIndex);
+}
+
+void saveCachedBinary(unsigned int programIndex, const FilePath& binaryPath) {
+  ZoneScopedN("[ShaderProgram]::saveCachedBinary");
+
+  unsigned int binaryFormat {};
+  const std::vector<unsigned char> binary = Renderer::recoverProgramBinary(programIndex, binaryFormat);
+
+  if (binary.empty())
+    return;
+
+  std::ofstream file(binaryPath, std::ios_base::binary);
+
+  if (!file) {
+    Logger::warn("[ShaderProgram] Unable to save the program's binary to '{}'", binaryPath);
+    return;
+  }
+
+  file.write(reinterpret_cast<const char*>(&binaryFormat), sizeof(binaryFormat));
+  file.write(reinterpret_cast<const char*>(binary.data()), static_cast<std::streamsize>(binary.size()));
+}
+#endif
+
 } // namespace
 
 ShaderProgram::ShaderProgram()
@@ -107,6 +200,24 @@ const Texture& ShaderProgram::getImageTexture(const std::string& uniformName) co
 }
 #endif
 
+void ShaderProgram::copyAttribute(const ShaderProgram& program, AttributeHandle handle, const std::string& uniformName) {
+  assert("Error: The given attribute handle is invalid." && handle.index < program.m_attributes.size());
+
+  const Attribute& sourceAttrib = program.m_attributes[handle.index];
+
+  if (Attribute* attrib = findAttribute(uniformName)) {
+    if (attrib->value != sourceAttrib.value) {
+      attrib->value   = sourceAttrib.value;
+      attrib->isDirty = true;
+    }
+
+    return;
+  }
+
+  const int locationIndex = (isLinked() ? recoverUniformLocation(uniformName) : -1);
+  m_attributes.emplace_back(Attribute{ uniformName, locationIndex, sourceAttrib.value });
+}
+
 void ShaderProgram::setTexture(TexturePtr texture, const std::string& uniformName) {
   const auto textureIt = std::ranges::find_if(m_textures, [&uniformName] (const auto& element) noexcept {
     return (element.second == uniformName);
@@ -156,12 +267,56 @@ void ShaderProgram::setImageTexture(TexturePtr texture, const std::string& unifo
 }
 #endif
 
-void ShaderProgram::link() {
-  ZoneScopedN("ShaderProgram::link");
+void ShaderProgram::setBinaryCacheDirectory(FilePath directory) {
+  if (!directory.isEmpty())
+    std::filesystem::create_directories(directory.getPath());
+
+  s_binaryCacheDirectory = std::move(directory);
+}
+
+void ShaderProgram::startLink() {
+  ZoneScopedN("ShaderProgram::startLink");
 
   Logger::debug("[ShaderProgram] Linking (ID: {})...", m_index.get());
 
+  m_binaryCachePath = FilePath();
+
+#if !defined(USE_WEBGL)
+  if (!s_binaryCacheDirectory.isEmpty() && isProgramBinarySupported()) {
+    FilePath binaryPath = recoverBinaryCachePath(m_index, s_binaryCacheDirectory);
+
+    if (loadCachedBinary(m_index, binaryPath)) {
+      Logger::debug("[ShaderProgram] Loaded binary from '{}'", binaryPath);
+      return;
+    }
+
+    Renderer::setProgramBinaryRetrievable(m_index, true);
+    m_binaryCachePath = std::move(binaryPath);
+  }
+#endif
+
+  compileShaders();
   Renderer::linkProgram(m_index);
+}
+
+void ShaderProgram::completeLink() {
+  ZoneScopedN("ShaderProgram::completeLink");
+
+  // With parallel compilation, errors could not be checked when linking; querying the status now waits for the link to finish
+  if (Renderer::isParallelShaderCompileEnabled() && !isLinked())
+    Renderer::logProgramErrors(m_index);
+
+#if !defined(USE_WEBGL)
+  if (!m_binaryCachePath.isEmpty()) {
+    if (isLinked())
+      saveCachedBinary(m_index, m_binaryCachePath);
+
+    m_binaryCachePath = FilePath();
+  }
+#endif
+
+  // Linking invalidates the uniforms' locations
+  m_uniformLocations.clear();
   updateAttributesLocations();
 
   Logger::debug("[ShaderProgram] Linked");
@@ -177,7 +332,6 @@ void ShaderProgram::updateShaders() {
   Logger::debug("[ShaderProgram] Updating shaders...");
 
   loadShaders();
-  compileShaders();
   link();
   sendAttributes();
   initTextures();
@@ -196,15 +350,30 @@ bool ShaderProgram::isUsed() const {
   return (Renderer::getCurrentProgram() == m_index);
 }
 
+AttributeHandle ShaderProgram::recoverAttributeHandle(const std::string& uniformName) const {
+  const Attribute* attrib = findAttribute(uniformName);
+
+  if (attrib == nullptr)
+    throw std::invalid_argument("[ShaderProgram] The given attribute uniform name does not exist");
+
+  return AttributeHandle{ static_cast<std::size_t>(attrib - m_attributes.data()) };
+}
+
 void ShaderProgram::sendAttributes() const {
   ZoneScopedN("ShaderProgram::sendAttributes");
 
-  if (m_attributes.empty())
+  // Values are kept in the program once sent; only those which have been modified since need to be sent again
+  if (std::ranges::none_of(m_attributes, [] (const Attribute& attrib) noexcept { return attrib.isDirty; }))
     return;
 
   use();
 
-  for (const Attribute& attrib : m_attributes | std::views::values) {
+  for (const Attribute& attrib : m_attributes) {
+    if (!attrib.isDirty)
+      continue;
+
+    attrib.isDirty = false;
+
     if (attrib.location == -1)
       continue;
 
@@ -213,7 +382,9 @@ void ShaderProgram::sendAttributes() const {
 }
 
 void ShaderProgram::removeAttribute(const std::string& uniformName) {
-  const auto attribIt = m_attributes.find(uniformName);
+  const auto attribIt = std::ranges::find_if(m_attributes, [&uniformName] (const Attribute& attrib) noexcept {
+    return (attrib.uniformName == uniformName);
+  });
 
   if (attribIt == m_attributes.end())
     throw std::invalid_argument("[ShaderProgram] The given attribute uniform name does not exist");
@@ -310,7 +481,15 @@ void ShaderProgram::removeImageTexture(const std::string& uniformName) {
 #endif
 
 int ShaderProgram::recoverUniformLocation(const std::string& uniformName) const {
-  return Renderer::recoverUniformLocation(m_index, uniformName.c_str());
+  const auto locationIt = m_uniformLocations.find(uniformName);
+
+  if (locationIt != m_uniformLocations.end())
+    return locationIt->second;
+
+  const int location = Renderer::recoverUniformLocation(m_index, uniformName.c_str());
+  m_uniformLocations.emplace(uniformName, location);
+
+  return location;
 }
 
 void ShaderProgram::sendUniform(int index, int value) const {
@@ -414,11 +593,21 @@ ShaderProgram::~ShaderProgram() {
   Logger::debug("[ShaderProgram] Destroyed");
 }
 
+const ShaderProgram::Attribute* ShaderProgram::findAttribute(const std::string& uniformName) const noexcept {
+  const auto attribIt = std::ranges::find_if(m_attributes, [&uniformName] (const Attribute& attrib) noexcept {
+    return (attrib.uniformName == uniformName);
+  });
+
+  return (attribIt != m_attributes.end() ? &(*attribIt) : nullptr);
+}
+
 void ShaderProgram::updateAttributesLocations() {
   ZoneScopedN("ShaderProgram::updateAttributesLocations");
 
-  for (auto& [name, attrib] : m_attributes)
-    attrib.location = recoverUniformLocation(name);
+  for (Attribute& attrib : m_attributes) {
+    attrib.location = recoverUniformLocation(attrib.uniformName);
+    attrib.isDirty  = true; // Uniforms are reset by linking, all values must be sent again
+  }
 }
 
 void RenderShaderProgram::setVertexShader(VertexShader&& vertShader) {
@@ -428,8 +617,6 @@ void RenderShaderProgram::setVertexShader(VertexShader&& vertShader) {
     Renderer::detachShader(m_index, m_vertShader.getIndex());
 
   m_vertShader = std::move(vertShader);
-  m_vertShader.compile();
-
   Renderer::attachShader(m_index, m_vertShader.getIndex());
 }
 
@@ -441,8 +628,6 @@ void RenderShaderProgram::setTessellationControlShader(TessellationControlShader
     Renderer::detachShader(m_index, m_tessCtrlShader->getIndex());
 
   m_tessCtrlShader = std::move(tessCtrlShader);
-  m_tessCtrlShader->compile();
-
   Renderer::attachShader(m_index, m_tessCtrlShader->getIndex());
 }
 
@@ -453,8 +638,6 @@ void RenderShaderProgram::setTessellationEvaluationShader(TessellationEvaluation
     Renderer::detachShader(m_index, m_tessEvalShader->getIndex());
 
   m_tessEvalShader = std::move(tessEvalShader);
-  m_tessEvalShader->compile();
-
   Renderer::attachShader(m_index, m_tessEvalShader->getIndex());
 }
 
@@ -465,8 +648,6 @@ void RenderShaderProgram::setGeometryShader(GeometryShader&& geomShader) {
     Renderer::detachShader(m_index, m_geomShader->getIndex());
 
   m_geomShader = std::move(geomShader);
-  m_geomShader->compile();
-
   Renderer::attachShader(m_index, m_geomShader->getIndex());
 }
 #endif
@@ -478,8 +659,6 @@ void RenderShaderProgram::setFragmentShader(FragmentShader&& fragShader) {
     Renderer::detachShader(m_index, m_fragShader.getIndex());
 
   m_fragShader = std::move(fragShader);
-  m_fragShader.compile();
-
   Renderer::attachShader(m_index, m_fragShader.getIndex());
 }
 
@@ -539,10 +718,13 @@ RenderShaderProgram RenderShaderProgram::clone() const {
   program.m_imageTextures = m_imageTextures;
 #endif
 
-  sendAttributes();
-  initTextures();
+  // The copied locations & sent statuses are those of the original program
+  program.updateAttributesLocations();
+
+  program.sendAttributes();
+  program.initTextures();
 #if !defined(USE_WEBGL)
-  initImageTextures();
+  program.initImageTextures();
 #endif
 
   return program;
@@ -569,13 +751,13 @@ void RenderShaderProgram::compileShaders() const {
 
   Logger::debug("[RenderShaderProgram] Compiling shaders...");
 
-  m_vertShader.compile();
+  if (m_vertShader.isCompilationPending()) m_vertShader.compile();
 #if !defined(USE_OPENGL_ES)
-  if (m_tessCtrlShader) m_tessCtrlShader->compile();
-  if (m_tessEvalShader) m_tessEvalShader->compile();
-  if (m_geomShader) m_geomShader->compile();
+  if (m_tessCtrlShader && m_tessCtrlShader->isCompilationPending()) m_tessCtrlShader->compile();
+  if (m_tessEvalShader && m_tessEvalShader->isCompilationPending()) m_tessEvalShader->compile();
+  if (m_geomShader && m_geomShader->isCompilationPending()) m_geomShader->compile();
 #endif
-  m_fragShader.compile();
+  if (m_fragShader.isCompilationPending()) m_fragShader.compile();
 
   Logger::debug("[RenderShaderProgram] Compiled shaders");
 }
@@ -637,8 +819,6 @@ void ComputeShaderProgram::setShader(ComputeShader&& compShader) {
     Renderer::detachShader(m_index, m_compShader.getIndex());
 
   m_compShader = std::move(compShader);
-  m_compShader.compile();
-
   Renderer::attachShader(m_index, m_compShader.getIndex());
 
   link();
@@ -653,9 +833,12 @@ ComputeShaderProgram ComputeShaderProgram::clone() const {
   program.m_textures      = m_textures;
   program.m_imageTextures = m_imageTextures;
 
-  sendAttributes();
-  initTextures();
-  initImageTextures();
+  // The copied locations & sent statuses are those of the original program
+  program.updateAttributesLocations();
+
+  program.sendAttributes();
+  program.initTextures();
+  program.initImageTextures();
 
   return program;
 }
@@ -672,7 +855,8 @@ void ComputeShaderProgram::compileShaders() const {
   ZoneScopedN("ComputeShaderProgram::compileShaders");
 
   Logger::debug("[ComputeShaderProgram] Compiling shader...");
-  m_compShader.compile();
+  if (m_compShader.isCompilationPending())
+    m_compShader.compile();
   Logger::debug("[ComputeShaderProgram] Compiled shader");
 }
 
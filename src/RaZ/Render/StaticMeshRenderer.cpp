@@ -0,0 +1,214 @@
+#include "RaZ/Data/Mesh.hpp"
+#include "RaZ/Render/StaticMeshRenderer.hpp"
+#include "RaZ/Utils/Logger.hpp"
+
+#include "tracy/Tracy.hpp"
+#include "GL/glew.h" // Needed by TracyOpenGL.hpp
+#include "tracy/TracyOpenGL.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace Raz {
+
+namespace {
+
+using FrustumPlanes = std::array<Vec4f, 6>;
+
+/// Extracts the planes of the frustum defined by the given matrix, whose normals point inward.
+/// \param modelViewProjMat Matrix transforming points into clip space.
+/// \return Left, right, bottom, top, near & far planes, each represented by its equation's coefficients.
+FrustumPlanes computeFrustumPlanes(const Mat4f& modelViewProjMat) {
+  const Vec4f rowX = modelViewProjMat.recoverRow(0);
+  const Vec4f rowY = modelViewProjMat.recoverRow(1);
+  const Vec4f rowZ = modelViewProjMat.recoverRow(2);
+  const Vec4f rowW = modelViewProjMat.recoverRow(3);
+
+  // A point is in the frustum if each of its clip space coordinates is between -w & w
+  return { rowW + rowX, rowW - rowX, rowW + rowY, rowW - rowY, rowW + rowZ, rowW - rowZ };
+}
+
+bool isBoxInFrustum(const AABB& box, const FrustumPlanes& planes) noexcept {
+  const Vec3f& minPos = box.getMinPosition();
+  const Vec3f& maxPos = box.getMaxPosition();
+
+  return std::ranges::all_of(planes, [&minPos, &maxPos] (const Vec4f& plane) noexcept {
+    // The box's corner farthest along the plane's normal is checked; if it is behind the plane, the whole box is
+    const Vec3f farthestCorner(plane.x() >= 0.f ? maxPos.x() : minPos.x(),
+                               plane.y() >= 0.f ? maxPos.y() : minPos.y(),
+                               plane.z() >= 0.f ? maxPos.z() : minPos.z());
+    return (plane.dot(Vec4f(farthestCorner, 1.f)) >= 0.f);
+  });
+}
+
+} // namespace
+
+void StaticMeshRenderer::addSubmesh(const Submesh& submesh, const Mat4f& transform, std::size_t materialIndex) {
+  ZoneScopedN("StaticMeshRenderer::addSubmesh");
+
+  std::vector<Vertex>& mergedVertices      = m_mergedGeometry.getVertices();
+  std::vector<unsigned int>& mergedIndices = m_mergedGeometry.getTriangleIndices();
+
+  const auto firstVertex = static_cast<unsigned int>(mergedVertices.size());
+  const Mat4f normalMat  = transform.inverse().transpose();
+
+  Vec3f minPos(std::numeric_limits<float>::max());
+  Vec3f maxPos(std::numeric_limits<float>::lowest());
+
+  mergedVertices.reserve(mergedVertices.size() + submesh.getVertexCount());
+
+  for (const Vertex& vertex : submesh.getVertices()) {
+    Vertex& mergedVertex = mergedVertices.emplace_back(vertex);
+    mergedVertex.position = Vec3f(transform * Vec4f(vertex.position, 1.f));
+    mergedVertex.normal   = Vec3f(normalMat * Vec4f(vertex.normal, 0.f)).normalize();
+    mergedVertex.tangent  = Vec3f(transform * Vec4f(vertex.tangent, 0.f)).normalize();
+
+    for (std::size_t i = 0; i < 3; ++i) {
+      minPos[i] = std::min(minPos[i], mergedVertex.position[i]);
+      maxPos[i] = std::max(maxPos[i], mergedVertex.position[i]);
+    }
+  }
+
+  // The indices are made absolute in the merged vertices, so that the draw commands need no base vertex
+  MergedSubmesh& mergedSubmesh = m_submeshes.emplace_back();
+  mergedSubmesh.firstIndex     = static_cast<unsigned int>(mergedIndices.size());
+  mergedSubmesh.indexCount     = static_cast<unsigned int>(submesh.getTriangleIndexCount());
+  mergedSubmesh.boundingBox    = AABB(minPos, maxPos);
+  mergedSubmesh.materialIndex  = materialIndex;
+
+  mergedIndices.reserve(mergedIndices.size() + submesh.getTriangleIndexCount());
+
+  for (const unsigned int index : submesh.getTriangleIndices())
+    mergedIndices.emplace_back(firstVertex + index);
+}
+
+void StaticMeshRenderer::addMesh(const Mesh& mesh, const Mat4f& transform, std::size_t materialIndex) {
+  for (const Submesh& submesh : mesh.getSubmeshes())
+    addSubmesh(submesh, transform, materialIndex);
+}
+
+void StaticMeshRenderer::load() {
+  ZoneScopedN("StaticMeshRenderer::load");
+
+  if (m_submeshes.empty()) {
+    Logger::error("[StaticMeshRenderer] Cannot load an empty geometry");
+    return;
+  }
+
+  Logger::debug("[StaticMeshRenderer] Loading geometry...");
+
+  // Sorting the submeshes by material, reordering their indices accordingly, makes the commands of each material contiguous
+  std::ranges::stable_sort(m_submeshes, {}, &MergedSubmesh::materialIndex);
+
+  const std::vector<unsigned int>& indices = m_mergedGeometry.getTriangleIndices();
+  std::vector<unsigned int> sortedIndices;
+  sortedIndices.reserve(indices.size());
+
+  for (MergedSubmesh& submesh : m_submeshes) {
+    const auto submeshIndicesBegin = indices.cbegin() + submesh.firstIndex;
+    submesh.firstIndex = static_cast<unsigned int>(sortedIndices.size());
+    sortedIndices.insert(sortedIndices.end(), submeshIndicesBegin, submeshIndicesBegin + submesh.indexCount);
+  }
+
+  m_mergedGeometry.getTriangleIndices() = std::move(sortedIndices);
+  m_submeshRenderer.load(m_mergedGeometry);
+
+  // If no material exists, create a default one
+  if (m_materials.empty()) {
+    Material& material = m_materials.emplace_back(MaterialType::COOK_TORRANCE);
+    material.getProgram().sendAttributes();
+    material.getProgram().initTextures();
+#if !defined(USE_WEBGL)
+    material.getProgram().initImageTextures();
+#endif
+  }
+
+  Logger::debug("[StaticMeshRenderer] Loaded geometry ({} submeshes, {} vertices)", m_submeshes.size(), m_mergedGeometry.getVertexCount());
+}
+
+void StaticMeshRenderer::updateDrawCommands(const Mat4f& modelViewProjMat) {
+  ZoneScopedN("StaticMeshRenderer::updateDrawCommands");
+
+  m_drawCommands.clear();
+  m_drawRanges.clear();
+  m_visibleSubmeshCount = 0;
+
+  const FrustumPlanes frustumPlanes = computeFrustumPlanes(modelViewProjMat);
+
+  for (const MergedSubmesh& submesh : m_submeshes) {
+    if (!isBoxInFrustum(submesh.boundingBox, frustumPlanes))
+      continue;
+
+    ++m_visibleSubmeshCount;
+
+    if (m_drawRanges.empty() || m_drawRanges.back().materialIndex != submesh.materialIndex)
+      m_drawRanges.emplace_back(DrawRange{ submesh.materialIndex, m_drawCommands.size(), 0 });
+
+    DrawRange& drawRange = m_drawRanges.back();
+
+    // A submesh directly following the previous visible one in the index buffer simply extends its command
+    if (drawRange.commandCount > 0) {
+      DrawElementsIndirectCommand& lastCommand = m_drawCommands.back();
+
+      if (lastCommand.firstIndex + lastCommand.count == submesh.firstIndex) {
+        lastCommand.count += submesh.indexCount;
+        continue;
+      }
+    }
+
+    m_drawCommands.emplace_back(DrawElementsIndirectCommand{ submesh.indexCount, 1, submesh.firstIndex, 0, 0 });
+    ++drawRange.commandCount;
+  }
+}
+
+void StaticMeshRenderer::draw() const {
+  ZoneScopedN("StaticMeshRenderer::draw");
+  TracyGpuZone("StaticMeshRenderer::draw")
+
+  if (m_drawCommands.empty())
+    return;
+
+  m_submeshRenderer.bind();
+
+#if !defined(USE_OPENGL_ES)
+  const bool isMultiDrawAvailable = Renderer::checkVersion(4, 3);
+
+  if (isMultiDrawAvailable) {
+    // All commands are sent at once, each material then drawing its own range
+    m_indirectBuffer.bind();
+    Renderer::sendBufferData(BufferType::DRAW_INDIRECT_BUFFER,
+                             static_cast<std::ptrdiff_t>(sizeof(DrawElementsIndirectCommand) * m_drawCommands.size()),
+                             m_drawCommands.data(),
+                             BufferDataUsage::STREAM_DRAW);
+  }
+#endif
+
+  for (const DrawRange& drawRange : m_drawRanges) {
+    assert("Error: The material index does not reference any existing material." && drawRange.materialIndex < m_materials.size());
+    m_materials[drawRange.materialIndex].getProgram().bindTextures();
+
+#if !defined(USE_OPENGL_ES)
+    if (isMultiDrawAvailable) {
+      Renderer::multiDrawElementsIndirect(PrimitiveType::TRIANGLES, ElementDataType::UINT,
+                                          static_cast<std::ptrdiff_t>(sizeof(DrawElementsIndirectCommand) * drawRange.firstCommand),
+                                          static_cast<unsigned int>(drawRange.commandCount));
+      continue;
+    }
+#endif
+
+    for (std::size_t commandIndex = drawRange.firstCommand; commandIndex < drawRange.firstCommand + drawRange.commandCount; ++commandIndex) {
+      const DrawElementsIndirectCommand& command = m_drawCommands[commandIndex];
+      Renderer::drawElements(PrimitiveType::TRIANGLES, command.count, ElementDataType::UINT,
+                             reinterpret_cast<const void*>(static_cast<std::uintptr_t>(command.firstIndex) * sizeof(unsigned int)));
+    }
+  }
+
+#if !defined(USE_OPENGL_ES)
+  if (isMultiDrawAvailable)
+    m_indirectBuffer.unbind();
+#endif
+}
+
+} // namespace Raz
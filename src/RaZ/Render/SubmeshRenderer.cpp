@@ -64,13 +64,16 @@ void SubmeshRenderer::load(const Submesh& submesh, RenderMode renderMode) {
   setRenderMode(renderMode, submesh);
 }
 
+void SubmeshRenderer::bind() const {
+  m_vao.bind();
+  m_ibo.bind();
+}
+
 void SubmeshRenderer::draw() const {
   ZoneScopedN("SubmeshRenderer::draw");
   TracyGpuZone("SubmeshRenderer::draw")
 
-  m_vao.bind();
-  m_ibo.bind();
-
+  bind();
   m_renderFunc(m_vbo, m_ibo);
 }
 
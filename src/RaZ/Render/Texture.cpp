@@ -1,4 +1,5 @@
 #include "RaZ/Data/Color.hpp"
+#include "RaZ/Data/CompressedImage.hpp"
 #include "RaZ/Data/Image.hpp"
 #if defined(USE_OPENGL_ES)
 #include "RaZ/Render/Framebuffer.hpp"
@@ -133,6 +134,41 @@ constexpr TextureColorspace recoverColorspace(ImageColorspace imgColorspace, boo
   return texColorspace;
 }
 
+constexpr TextureColorspace recoverColorspace(BlockCompressionFormat format, bool isSrgb) {
+  switch (format) {
+    case BlockCompressionFormat::BC1:
+      return (isSrgb ? TextureColorspace::SRGB : TextureColorspace::RGB);
+
+    case BlockCompressionFormat::BC3:
+    case BlockCompressionFormat::BC7:
+      return (isSrgb ? TextureColorspace::SRGBA : TextureColorspace::RGBA);
+
+    case BlockCompressionFormat::BC4:
+      return TextureColorspace::GRAY;
+
+    case BlockCompressionFormat::BC5:
+      return TextureColorspace::RG;
+
+    default:
+      break;
+  }
+
+  throw std::invalid_argument("[Texture] Invalid block compression format to recover the colorspace from");
+}
+
+constexpr TextureInternalFormat recoverInternalFormat(BlockCompressionFormat format, bool isSrgb) {
+  switch (format) {
+    case BlockCompressionFormat::BC1: return (isSrgb ? TextureInternalFormat::BC1_SRGB : TextureInternalFormat::BC1_RGB);
+    case BlockCompressionFormat::BC3: return (isSrgb ? TextureInternalFormat::BC3_SRGBA : TextureInternalFormat::BC3_RGBA);
+    case BlockCompressionFormat::BC4: return TextureInternalFormat::BC4_RED;
+    case BlockCompressionFormat::BC5: return TextureInternalFormat::BC5_RG;
+    case BlockCompressionFormat::BC7: return (isSrgb ? TextureInternalFormat::BC7_SRGBA : TextureInternalFormat::BC7_RGBA);
+    default: break;
+  }
+
+  throw std::invalid_argument("[Texture] Invalid block compression format to recover the internal format from");
+}
+
 } // namespace
 
 void Texture::bind() const {
@@ -367,6 +403,44 @@ void Texture2D::load(const Image& image, bool createMipmaps, bool shouldUseSrgb)
   setLoadedParameters(createMipmaps);
 }
 
+void Texture2D::load(const CompressedImage& image) {
+  ZoneScopedN("Texture2D::load(CompressedImage)");
+
+  if (image.isEmpty()) {
+    // Image not found, defaulting texture to pure white
+    fill(ColorPreset::White);
+    return;
+  }
+
+  m_width      = image.getWidth();
+  m_height     = image.getHeight();
+  m_colorspace = recoverColorspace(image.getFormat(), image.isSrgb());
+  m_dataType   = TextureDataType::BYTE;
+
+  const TextureInternalFormat internalFormat = recoverInternalFormat(image.getFormat(), image.isSrgb());
+
+  bind();
+
+  for (std::size_t levelIndex = 0; levelIndex < image.getLevelCount(); ++levelIndex) {
+    const CompressedImageLevel& level = image.getLevel(levelIndex);
+    Renderer::sendCompressedImageData2D(TextureType::TEXTURE_2D,
+                                        static_cast<unsigned int>(levelIndex),
+                                        internalFormat,
+                                        level.width,
+                                        level.height,
+                                        level.data.size(),
+                                        level.data.data());
+  }
+
+  // The mipmap chain may stop before reaching 1x1; the texture would be incomplete without clamping the maximum level
+  Renderer::setTextureParameter(TextureType::TEXTURE_2D, TextureParameter::MAX_LEVEL, static_cast<int>(image.getLevelCount() - 1));
+
+  setLoadedParameters(false);
+
+  if (image.getLevelCount() > 1)
+    setFilter(TextureFilter::LINEAR, TextureFilter::LINEAR, TextureFilter::LINEAR);
+}
+
 void Texture2D::fill(const Color& color) {
   ZoneScopedN("Texture2D::fill");
 
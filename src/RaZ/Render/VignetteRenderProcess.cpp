@@ -15,7 +15,7 @@ constexpr std::string_view vignetteSource = {
 } // namespace
 
 VignetteRenderProcess::VignetteRenderProcess(RenderGraph& renderGraph)
-  : MonoPassRenderProcess(renderGraph, FragmentShader::loadFromSource(vignetteSource), "Vignette") {
+  : MonoPassRenderProcess(renderGraph, ScreenEffect{ std::string(vignetteSource), false }, "Vignette") {
   setStrength(0.25f);
   setOpacity(1.f);
   setColor(ColorPreset::Black);
@@ -24,22 +24,33 @@ void LuaWrapper::registerCoreTypes() {
   {
     sol::usertype<FrameTimeInfo> frameTimeInfo = state.new_usertype<FrameTimeInfo>("FrameTimeInfo",
                                                                                    sol::constructors<FrameTimeInfo()>());
-    frameTimeInfo["deltaTime"]    = &FrameTimeInfo::deltaTime;
-    frameTimeInfo["globalTime"]   = &FrameTimeInfo::globalTime;
-    frameTimeInfo["substepCount"] = &FrameTimeInfo::substepCount;
-    frameTimeInfo["substepTime"]  = &FrameTimeInfo::substepTime;
+    frameTimeInfo["deltaTime"]          = &FrameTimeInfo::deltaTime;
+    frameTimeInfo["globalTime"]         = &FrameTimeInfo::globalTime;
+    frameTimeInfo["substepCount"]       = &FrameTimeInfo::substepCount;
+    frameTimeInfo["substepTime"]        = &FrameTimeInfo::substepTime;
+    frameTimeInfo["interpolationAlpha"] = &FrameTimeInfo::interpolationAlpha;
+
+    state.new_enum<WorldUpdateMode>("WorldUpdateMode", {
+      { "SEQUENTIAL", WorldUpdateMode::SEQUENTIAL },
+      { "PARALLEL",   WorldUpdateMode::PARALLEL }
+    });
 
     sol::usertype<Application> application = state.new_usertype<Application>("Application",
                                                                              sol::constructors<Application(),
                                                                                                Application(std::size_t)>());
-    application["getWorlds"]        = PickNonConstOverload<>(&Application::getWorlds);
-    application["getTimeInfo"]      = &Application::getTimeInfo;
-    application["setFixedTimeStep"] = &Application::setFixedTimeStep;
-    application["addWorld"]         = &Application::addWorld<>;
-    application["run"]              = sol::overload([] (Application& app) { app.run(); },
-                                                    [] (Application& app, const std::function<void(const FrameTimeInfo&)>& func) { app.run(func); });
-    application["runOnce"]          = &Application::runOnce;
-    application["quit"]             = &Application::quit;
+    application["getWorlds"]          = PickNonConstOverload<>(&Application::getWorlds);
+    application["getTimeInfo"]        = &Application::getTimeInfo;
+    application["getWorldUpdateMode"] = &Application::getWorldUpdateMode;
+    application["getTargetFrameRate"] = &Application::getTargetFrameRate;
+    application["setWorldUpdateMode"] = &Application::setWorldUpdateMode;
+    application["setFixedTimeStep"]   = &Application::setFixedTimeStep;
+    application["setMaxSubstepCount"] = &Application::setMaxSubstepCount;
+    application["setTargetFrameRate"] = &Application::setTargetFrameRate;
+    application["addWorld"]           = &Application::addWorld<>;
+    application["run"]                = sol::overload([] (Application& app) { app.run(); },
+                                                      [] (Application& app, const std::function<void(const FrameTimeInfo&)>& func) { app.run(func); });
+    application["runOnce"]            = &Application::runOnce;
+    application["quit"]               = &Application::quit;
   }
 
   {
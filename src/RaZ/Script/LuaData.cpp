@@ -9,6 +9,7 @@
 #include "RaZ/Data/MarchingSquares.hpp"
 #include "RaZ/Data/Mesh.hpp"
 #include "RaZ/Data/MeshDistanceField.hpp"
+#include "RaZ/Data/NoiseField.hpp"
 #include "RaZ/Script/LuaWrapper.hpp"
 #include "RaZ/Utils/TypeUtils.hpp"
 
@@ -31,6 +32,7 @@ void LuaWrapper::registerDataTypes() {
     bitset["isEmpty"]             = &Bitset::isEmpty;
     bitset["getEnabledBitCount"]  = &Bitset::getEnabledBitCount;
     bitset["getDisabledBitCount"] = &Bitset::getDisabledBitCount;
+    bitset["intersects"]          = &Bitset::intersects;
     bitset["setBit"]              = sol::overload([] (Bitset& b, std::size_t p) { b.setBit(p); },
                                                   PickOverload<std::size_t, bool>(&Bitset::setBit));
     bitset["resize"]              = &Bitset::resize;
@@ -58,16 +60,22 @@ void LuaWrapper::registerDataTypes() {
       bvhNode["isLeaf"]         = &BoundingVolumeHierarchyNode::isLeaf;
       bvhNode["query"]          = sol::overload([] (const BoundingVolumeHierarchyNode& n, const Ray& r) { return n.query(r); },
                                                 PickOverload<const Ray&, RayHit*>(&BoundingVolumeHierarchyNode::query));
+      bvhNode["queryClosest"]   = sol::overload([] (const BoundingVolumeHierarchyNode& n, const Vec3f& p) { return n.queryClosest(p); },
+                                                [] (const BoundingVolumeHierarchyNode& n, const Vec3f& p, float d) { return n.queryClosest(p, d); },
+                                                &BoundingVolumeHierarchyNode::queryClosest);
     }
 
     {
       sol::usertype<BoundingVolumeHierarchy> bvh = state.new_usertype<BoundingVolumeHierarchy>("BoundingVolumeHierarchy",
                                                                                                sol::constructors<BoundingVolumeHierarchy()>());
-      bvh["getRootNode"] = [] (const BoundingVolumeHierarchy& b) { return &b.getRootNode(); };
+      bvh["getRootNode"]  = [] (const BoundingVolumeHierarchy& b) { return &b.getRootNode(); };
       // Sol doesn't seem to be able to bind a constant reference to std::vector; leaving a copy here as it is "cheap"
-      bvh["build"]       = [] (BoundingVolumeHierarchy& b, std::vector<Entity*> e) { b.build(e); };
-      bvh["query"]       = sol::overload([] (const BoundingVolumeHierarchy& b, const Ray& r) { return b.query(r); },
-                                         PickOverload<const Ray&, RayHit*>(&BoundingVolumeHierarchy::query));
+      bvh["build"]        = [] (BoundingVolumeHierarchy& b, std::vector<Entity*> e) { b.build(e); };
+      bvh["query"]        = sol::overload([] (const BoundingVolumeHierarchy& b, const Ray& r) { return b.query(r); },
+                                          PickOverload<const Ray&, RayHit*>(&BoundingVolumeHierarchy::query));
+      bvh["queryClosest"] = sol::overload([] (const BoundingVolumeHierarchy& b, const Vec3f& p) { return b.queryClosest(p); },
+                                          [] (const BoundingVolumeHierarchy& b, const Vec3f& p, float d) { return b.queryClosest(p, d); },
+                                          &BoundingVolumeHierarchy::queryClosest);
     }
 
     {
@@ -143,7 +151,8 @@ void LuaWrapper::registerDataTypes() {
 
   {
     sol::table marchingCubes = state["MarchingCubes"].get_or_create<sol::table>();
-    marchingCubes["compute"] = &MarchingCubes::compute;
+    marchingCubes["compute"] = sol::overload(PickOverload<const Grid3b&>(&MarchingCubes::compute),
+                                             PickOverload<const Grid3f&, float>(&MarchingCubes::compute));
   }
 
   {
@@ -151,6 +160,24 @@ void LuaWrapper::registerDataTypes() {
     marchingSquares["compute"] = &MarchingSquares::compute;
   }
 
+  {
+    state.new_enum<NoiseType>("NoiseType", {
+      { "PERLIN",  NoiseType::PERLIN },
+      { "SIMPLEX", NoiseType::SIMPLEX }
+    });
+
+    sol::table noiseField = state["NoiseField"].get_or_create<sol::table>();
+    noiseField["fill"]    = sol::overload([] (Grid2f& g, NoiseType t) { NoiseField::fill(g, t); },
+                                          [] (Grid2f& g, NoiseType t, const NoiseSettings& s) { NoiseField::fill(g, t, s); },
+                                          PickOverload<Grid2f&, NoiseType, const NoiseSettings&, const Vec2f&>(&NoiseField::fill),
+                                          [] (Grid3f& g, NoiseType t) { NoiseField::fill(g, t); },
+                                          [] (Grid3f& g, NoiseType t, const NoiseSettings& s) { NoiseField::fill(g, t, s); },
+                                          PickOverload<Grid3f&, NoiseType, const NoiseSettings&, const Vec3f&>(&NoiseField::fill),
+                                          [] (Image& i, NoiseType t) { NoiseField::fill(i, t); },
+                                          [] (Image& i, NoiseType t, const NoiseSettings& s) { NoiseField::fill(i, t, s); },
+                                          PickOverload<Image&, NoiseType, const NoiseSettings&, const Vec2f&>(&NoiseField::fill));
+  }
+
   {
     sol::usertype<MeshDistanceField> mdf = state.new_usertype<MeshDistanceField>("MeshDistanceField",
                                                                                  sol::constructors<
@@ -159,6 +186,9 @@ void LuaWrapper::registerDataTypes() {
                                                                                  sol::base_classes, sol::bases<Grid3f>());
     mdf["setBvh"]        = &MeshDistanceField::setBvh;
     mdf["compute"]       = &MeshDistanceField::compute;
+    mdf["computeExact"]  = sol::overload([] (MeshDistanceField& m) { m.computeExact(); },
+                                         [] (MeshDistanceField& m, std::size_t w) { m.computeExact(w); },
+                                         &MeshDistanceField::computeExact);
     mdf["recoverSlices"] = &MeshDistanceField::recoverSlices;
   }
 }
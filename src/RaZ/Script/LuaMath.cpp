@@ -2,7 +2,9 @@
 #include "RaZ/Math/Constants.hpp"
 #include "RaZ/Math/MathUtils.hpp"
 #include "RaZ/Math/Matrix.hpp"
+#include "RaZ/Math/NoiseSettings.hpp"
 #include "RaZ/Math/PerlinNoise.hpp"
+#include "RaZ/Math/SimplexNoise.hpp"
 #include "RaZ/Math/Transform.hpp"
 #include "RaZ/Script/LuaWrapper.hpp"
 #include "RaZ/Utils/FloatUtils.hpp"
@@ -85,6 +87,17 @@ void LuaWrapper::registerMathTypes() {
                                               PickOverload<float, float, float>(&MathUtils::smootherstep<float>));
   }
 
+  {
+    sol::usertype<NoiseSettings> noiseSettings = state.new_usertype<NoiseSettings>("NoiseSettings",
+                                                                                   sol::constructors<NoiseSettings()>());
+    noiseSettings["frequency"]   = &NoiseSettings::frequency;
+    noiseSettings["octaveCount"] = &NoiseSettings::octaveCount;
+    noiseSettings["lacunarity"]  = &NoiseSettings::lacunarity;
+    noiseSettings["persistence"] = &NoiseSettings::persistence;
+    noiseSettings["seed"]        = &NoiseSettings::seed;
+    noiseSettings["normalize"]   = &NoiseSettings::normalize;
+  }
+
   {
     sol::table perlinNoise   = state["PerlinNoise"].get_or_create<sol::table>();
     perlinNoise["compute1D"] = sol::overload([] (float x) { return PerlinNoise::compute1D(x); },
@@ -98,6 +111,16 @@ void LuaWrapper::registerMathTypes() {
                                              PickOverload<float, float, float, uint8_t, bool>(&PerlinNoise::compute3D));
   }
 
+  {
+    sol::table simplexNoise   = state["SimplexNoise"].get_or_create<sol::table>();
+    simplexNoise["compute2D"] = sol::overload([] (float x, float y) { return SimplexNoise::compute2D(x, y); },
+                                              [] (float x, float y, uint8_t o) { return SimplexNoise::compute2D(x, y, o); },
+                                              PickOverload<float, float, uint8_t, bool>(&SimplexNoise::compute2D));
+    simplexNoise["compute3D"] = sol::overload([] (float x, float y, float z) { return SimplexNoise::compute3D(x, y, z); },
+                                              [] (float x, float y, float z, uint8_t o) { return SimplexNoise::compute3D(x, y, z, o); },
+                                              PickOverload<float, float, float, uint8_t, bool>(&SimplexNoise::compute3D));
+  }
+
   {
     sol::usertype<Quaternionf> quaternionf = state.new_usertype<Quaternionf>("Quaternionf",
                                                                              sol::constructors<Quaternionf(float, float, float, float),
@@ -1,7 +1,12 @@
+#include "RaZ/Data/Mesh.hpp"
 #include "RaZ/Physics/Collider.hpp"
+#include "RaZ/Physics/ConvexHull.hpp"
+#include "RaZ/Physics/NarrowPhase.hpp"
 #include "RaZ/Physics/PhysicsSystem.hpp"
 #include "RaZ/Physics/RigidBody.hpp"
+#include "RaZ/Physics/TriangleMesh.hpp"
 #include "RaZ/Script/LuaWrapper.hpp"
+#include "RaZ/Utils/Ray.hpp"
 #include "RaZ/Utils/Shape.hpp"
 #include "RaZ/Utils/TypeUtils.hpp"
 
@@ -19,22 +24,91 @@ void LuaWrapper::registerPhysicsTypes() {
     sol::usertype<Collider> collider = state.new_usertype<Collider>("Collider",
                                                                     sol::constructors<Collider()>(),
                                                                     sol::base_classes, sol::bases<Component>());
-    collider["getShapeType"] = &Collider::getShapeType;
-    collider["hasShape"]     = &Collider::hasShape;
-    collider["getShape"]     = [] (Collider& c) { return &c.getShape(); };
-    collider["setShape"]     = [] (Collider& c, Shape& s) { c.setShape(std::move(s)); };
-    collider["intersects"]   = sol::overload(PickOverload<const Collider&>(&Collider::intersects),
-                                             PickOverload<const Shape&>(&Collider::intersects),
-                                             [] (Collider& c, const Ray& r) { return c.intersects(r); },
-                                             PickOverload<const Ray&, RayHit*>(&Collider::intersects));
+    collider["getShapeType"]   = &Collider::getShapeType;
+    collider["layerMask"]      = sol::property(&Collider::getLayerMask, &Collider::setLayerMask);
+    collider["hasShape"]       = &Collider::hasShape;
+    collider["getShape"]       = [] (Collider& c) { return &c.getShape(); };
+    collider["setShape"]       = [] (Collider& c, Shape& s) { c.setShape(std::move(s)); };
+    collider["intersects"]     = sol::overload(PickOverload<const Collider&>(&Collider::intersects),
+                                               PickOverload<const Shape&>(&Collider::intersects),
+                                               [] (Collider& c, const Ray& r) { return c.intersects(r); },
+                                               PickOverload<const Ray&, RayHit*>(&Collider::intersects));
+    collider["computeContact"] = &Collider::computeContact;
+  }
+
+  {
+    sol::usertype<ContactManifold> contactManifold = state.new_usertype<ContactManifold>("ContactManifold",
+                                                                                         sol::constructors<ContactManifold()>());
+    contactManifold["normal"]     = &ContactManifold::normal;
+    contactManifold["pointCount"] = &ContactManifold::pointCount;
+    contactManifold["getPoint"]   = [] (const ContactManifold& m, std::size_t i) { return m.points[i]; };
+  }
+
+  {
+    sol::usertype<ContactPoint> contactPoint = state.new_usertype<ContactPoint>("ContactPoint",
+                                                                                sol::constructors<ContactPoint()>());
+    contactPoint["position"]         = &ContactPoint::position;
+    contactPoint["penetrationDepth"] = &ContactPoint::penetrationDepth;
+  }
+
+  {
+    sol::usertype<ConvexHull> convexHull = state.new_usertype<ConvexHull>("ConvexHull",
+                                                                          sol::constructors<ConvexHull(const std::vector<Vec3f>&),
+                                                                                            ConvexHull(const Mesh&)>(),
+                                                                          sol::base_classes, sol::bases<Shape>());
+    convexHull["getVertices"]    = &ConvexHull::getVertices;
+    convexHull["computeSupport"] = &ConvexHull::computeSupport;
+  }
+
+  {
+    sol::table narrowPhase = state["NarrowPhase"].get_or_create<sol::table>();
+    narrowPhase["computeSupport"] = &NarrowPhase::computeSupport;
+    narrowPhase["intersects"]     = &NarrowPhase::intersects;
+    narrowPhase["computeContact"] = &NarrowPhase::computeContact;
   }
 
   {
     sol::usertype<PhysicsSystem> physicsSystem = state.new_usertype<PhysicsSystem>("PhysicsSystem",
                                                                                    sol::constructors<PhysicsSystem()>(),
                                                                                    sol::base_classes, sol::bases<System>());
-    physicsSystem["gravity"]  = sol::property(&PhysicsSystem::getGravity, &PhysicsSystem::setGravity);
-    physicsSystem["friction"] = sol::property(&PhysicsSystem::getFriction, &PhysicsSystem::setFriction);
+    physicsSystem["gravity"]                = sol::property(&PhysicsSystem::getGravity, &PhysicsSystem::setGravity);
+    physicsSystem["friction"]               = sol::property(&PhysicsSystem::getFriction, &PhysicsSystem::setFriction);
+    physicsSystem["sleepVelocityThreshold"] = sol::property(&PhysicsSystem::getSleepVelocityThreshold, &PhysicsSystem::setSleepVelocityThreshold);
+    physicsSystem["sleepTimeThreshold"]     = sol::property(&PhysicsSystem::getSleepTimeThreshold, &PhysicsSystem::setSleepTimeThreshold);
+    physicsSystem["updateQueryStructure"]   = &PhysicsSystem::updateQueryStructure;
+    physicsSystem["raycast"]                = sol::overload([] (const PhysicsSystem& s, const Ray& r) { return s.raycast(r); },
+                                                            [] (const PhysicsSystem& s, const Ray& r, RayHit* h) { return s.raycast(r, h); },
+                                                            [] (const PhysicsSystem& s, const Ray& r, RayHit* h, float d) { return s.raycast(r, h, d); },
+                                                            &PhysicsSystem::raycast);
+    physicsSystem["raycastAll"]             = sol::overload([] (const PhysicsSystem& s, const Ray& r) { return s.raycastAll(r); },
+                                                            [] (const PhysicsSystem& s, const Ray& r, float d) { return s.raycastAll(r, d); },
+                                                            &PhysicsSystem::raycastAll);
+    physicsSystem["raycastBatch"]           = sol::overload([] (const PhysicsSystem& s, std::vector<Ray> r) { return s.raycastBatch(r); },
+                                                            [] (const PhysicsSystem& s, std::vector<Ray> r, float d) { return s.raycastBatch(r, d); },
+                                                            [] (const PhysicsSystem& s, std::vector<Ray> r, float d, std::uint32_t m) {
+                                                              return s.raycastBatch(r, d, m);
+                                                            });
+    physicsSystem["overlap"]                = sol::overload([] (const PhysicsSystem& s, const Sphere& sph) { return s.overlap(sph); },
+                                                            [] (const PhysicsSystem& s, const AABB& b) { return s.overlap(b); },
+                                                            PickOverload<const Sphere&, std::uint32_t>(&PhysicsSystem::overlap),
+                                                            PickOverload<const AABB&, std::uint32_t>(&PhysicsSystem::overlap));
+    physicsSystem["overlapBatch"]           = sol::overload([] (const PhysicsSystem& s, std::vector<Sphere> sph) { return s.overlapBatch(sph); },
+                                                            [] (const PhysicsSystem& s, std::vector<Sphere> sph, std::uint32_t m) {
+                                                              return s.overlapBatch(sph, m);
+                                                            });
+    physicsSystem["sweep"]                  = sol::overload([] (const PhysicsSystem& s, const Sphere& sph, const Vec3f& dir) { return s.sweep(sph, dir); },
+                                                            [] (const PhysicsSystem& s, const Sphere& sph, const Vec3f& dir, RayHit* h) { return s.sweep(sph, dir, h); },
+                                                            [] (const PhysicsSystem& s, const Sphere& sph, const Vec3f& dir, RayHit* h, float d) {
+                                                              return s.sweep(sph, dir, h, d);
+                                                            },
+                                                            &PhysicsSystem::sweep);
+  }
+
+  {
+    sol::usertype<ColliderHit> colliderHit = state.new_usertype<ColliderHit>("ColliderHit",
+                                                                             sol::constructors<ColliderHit()>());
+    colliderHit["entity"] = &ColliderHit::entity;
+    colliderHit["hit"]    = &ColliderHit::hit;
   }
 
   {
@@ -46,6 +120,21 @@ void LuaWrapper::registerPhysicsTypes() {
     rigidBody["bounciness"] = sol::property(&RigidBody::getBounciness, &RigidBody::setBounciness);
     rigidBody["velocity"]   = sol::property(&RigidBody::getVelocity, &RigidBody::setVelocity);
     rigidBody["forces"]     = sol::property(&RigidBody::getForces, &RigidBody::setForces<Vec3f>);
+    rigidBody["isSleeping"] = &RigidBody::isSleeping;
+    rigidBody["wakeUp"]     = &RigidBody::wakeUp;
+    rigidBody["putToSleep"] = &RigidBody::putToSleep;
+  }
+
+  {
+    sol::usertype<TriangleMesh> triangleMesh = state.new_usertype<TriangleMesh>("TriangleMesh",
+                                                                                sol::constructors<TriangleMesh(const Mesh&)>(),
+                                                                                sol::base_classes, sol::bases<Shape>());
+    triangleMesh["getTriangles"]  = &TriangleMesh::getTriangles;
+    triangleMesh["findTriangles"] = [] (const TriangleMesh& m, const AABB& b) {
+      std::vector<std::size_t> indices;
+      m.findTriangles(b, indices);
+      return indices;
+    };
   }
 }
 
@@ -29,6 +29,8 @@ void LuaWrapper::registerRenderTypes() {
                                                               sol::base_classes, sol::bases<Component>());
     camera["getFrameWidth"]                  = &Camera::getFrameWidth;
     camera["getFrameHeight"]                 = &Camera::getFrameHeight;
+    camera["getNearPlane"]                   = &Camera::getNearPlane;
+    camera["getFarPlane"]                    = &Camera::getFarPlane;
     camera["fieldOfView"]                    = sol::property(&Camera::getFieldOfView, &Camera::setFieldOfView);
     camera["orthographicBound"]              = sol::property(&Camera::getOrthographicBound, &Camera::setOrthographicBound);
     camera["cameraType"]                     = sol::property(&Camera::getCameraType, &Camera::setCameraType);
@@ -140,11 +142,13 @@ void LuaWrapper::registerRenderTypes() {
                                                                              Light(LightType, const Vec3f&, float, Radiansf),
                                                                              Light(LightType, const Vec3f&, float, Radiansf, const Color&)>(),
                                                            sol::base_classes, sol::bases<Component>());
-    light["type"]      = sol::property(&Light::getType, &Light::setType);
-    light["direction"] = sol::property(&Light::getDirection, &Light::setDirection);
-    light["energy"]    = sol::property(&Light::getEnergy, &Light::setEnergy);
-    light["color"]     = sol::property(&Light::getColor, &Light::setColor);
-    light["angle"]     = sol::property(&Light::getAngle, &Light::setAngle);
+    light["type"]                   = sol::property(&Light::getType, &Light::setType);
+    light["direction"]              = sol::property(&Light::getDirection, &Light::setDirection);
+    light["energy"]                 = sol::property(&Light::getEnergy, &Light::setEnergy);
+    light["color"]                  = sol::property(&Light::getColor, &Light::setColor);
+    light["angle"]                  = sol::property(&Light::getAngle, &Light::setAngle);
+    light["computeInfluenceRadius"] = sol::overload([] (const Light& l) { return l.computeInfluenceRadius(); },
+                                                    &Light::computeInfluenceRadius);
 
     state.new_enum<LightType>("LightType", {
       { "POINT",       LightType::POINT },
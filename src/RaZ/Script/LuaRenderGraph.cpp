@@ -37,6 +37,12 @@ void LuaWrapper::registerRenderGraphTypes() {
 
     renderGraph["isValid"]                                = &RenderGraph::isValid;
     renderGraph["getGeometryPass"]                        = PickNonConstOverload<>(&RenderGraph::getGeometryPass);
+    renderGraph["isCompiled"]                             = &RenderGraph::isCompiled;
+    renderGraph["isScreenEffectFusionEnabled"]            = &RenderGraph::isScreenEffectFusionEnabled;
+    renderGraph["getFusedPassCount"]                      = &RenderGraph::getFusedPassCount;
+    renderGraph["getTransientTextureCount"]               = &RenderGraph::getTransientTextureCount;
+    renderGraph["getAllocatedTransientTextureCount"]      = &RenderGraph::getAllocatedTransientTextureCount;
+    renderGraph["isTransientTexture"]                     = &RenderGraph::isTransientTexture;
     renderGraph["addBloomRenderProcess"]                  = &RenderGraph::addRenderProcess<BloomRenderProcess>;
     renderGraph["addBoxBlurRenderProcess"]                = &RenderGraph::addRenderProcess<BoxBlurRenderProcess>;
     renderGraph["addChromaticAberrationRenderProcess"]    = &RenderGraph::addRenderProcess<ChromaticAberrationRenderProcess>;
@@ -48,6 +54,12 @@ void LuaWrapper::registerRenderGraphTypes() {
     renderGraph["addScreenSpaceReflectionsRenderProcess"] = &RenderGraph::addRenderProcess<ScreenSpaceReflectionsRenderProcess>;
     renderGraph["addSobelFilterRenderProcess"]            = &RenderGraph::addRenderProcess<SobelFilterRenderProcess>;
     renderGraph["addVignetteRenderProcess"]               = &RenderGraph::addRenderProcess<VignetteRenderProcess>;
+    renderGraph["addTransientTexture"]                    = sol::overload([] (RenderGraph& g, TextureColorspace c, TextureDataType t) { return g.addTransientTexture(c, t); },
+                                                                          &RenderGraph::addTransientTexture);
+    renderGraph["enableScreenEffectFusion"]               = sol::overload([] (RenderGraph& g) { g.enableScreenEffectFusion(); },
+                                                                          PickOverload<bool>(&RenderGraph::enableScreenEffectFusion));
+    renderGraph["disableScreenEffectFusion"]              = &RenderGraph::disableScreenEffectFusion;
+    renderGraph["compile"]                                = &RenderGraph::compile;
     renderGraph["resizeViewport"]                         = &RenderGraph::resizeViewport;
     renderGraph["updateShaders"]                          = &RenderGraph::updateShaders;
   }
@@ -76,6 +88,7 @@ void LuaWrapper::registerRenderGraphTypes() {
                                                        [] (const RenderPass& p, const std::string& n) { return &p.getReadTexture(n); });
     renderPass["hasReadTexture"]       = &RenderPass::hasReadTexture;
     renderPass["getFramebuffer"]       = [] (const RenderPass& p) { return &p.getFramebuffer(); };
+    renderPass["hasScreenEffect"]      = &RenderPass::hasScreenEffect;
     renderPass["recoverElapsedTime"]   = &RenderPass::recoverElapsedTime;
     renderPass["setName"]              = &RenderPass::setName;
     renderPass["setProgram"]           = [] (RenderPass& p, RenderShaderProgram& sp) { p.setProgram(std::move(sp)); };
@@ -83,83 +83,87 @@ void LuaWrapper::registerShaderProgramTypes() {
     imageTextureUsage["READ_WRITE"] = ImageTextureUsage::READ_WRITE;
 
     sol::usertype<ShaderProgram> shaderProgram = state.new_usertype<ShaderProgram>("ShaderProgram", sol::no_constructor);
-    shaderProgram["hasAttribute"]           = [] (const ShaderProgram& p, const std::string& n) { return p.hasAttribute(n); };
-    shaderProgram["getAttributeCount"]      = &ShaderProgram::getAttributeCount;
-    shaderProgram["hasTexture"]             = sol::overload(PickOverload<const Texture&>(&ShaderProgram::hasTexture),
-                                                            PickOverload<const std::string&>(&ShaderProgram::hasTexture));
-    shaderProgram["getTextureCount"]        = &ShaderProgram::getTextureCount;
-    shaderProgram["getTexture"]             = sol::overload([] (const ShaderProgram& p, std::size_t i) { return &p.getTexture(i); },
-                                                            [] (const ShaderProgram& p, const std::string& n) { return &p.getTexture(n); });
+    shaderProgram["hasAttribute"]            = [] (const ShaderProgram& p, const std::string& n) { return p.hasAttribute(n); };
+    shaderProgram["getAttributeCount"]       = &ShaderProgram::getAttributeCount;
+    shaderProgram["hasTexture"]              = sol::overload(PickOverload<const Texture&>(&ShaderProgram::hasTexture),
+                                                             PickOverload<const std::string&>(&ShaderProgram::hasTexture));
+    shaderProgram["getBinaryCacheDirectory"] = &ShaderProgram::getBinaryCacheDirectory;
+    shaderProgram["getTextureCount"]         = &ShaderProgram::getTextureCount;
+    shaderProgram["getTexture"]              = sol::overload([] (const ShaderProgram& p, std::size_t i) { return &p.getTexture(i); },
+                                                             [] (const ShaderProgram& p, const std::string& n) { return &p.getTexture(n); });
 #if !defined(USE_WEBGL)
-    shaderProgram["hasImageTexture"]        = sol::overload(PickOverload<const Texture&>(&ShaderProgram::hasImageTexture),
-                                                            PickOverload<const std::string&>(&ShaderProgram::hasImageTexture));
-    shaderProgram["getImageTextureCount"]   = &ShaderProgram::getImageTextureCount;
-    shaderProgram["getImageTexture"]        = sol::overload([] (const ShaderProgram& p, std::size_t i) { return &p.getImageTexture(i); },
-                                                            [] (const ShaderProgram& p, const std::string& n) { return &p.getImageTexture(n); });
+    shaderProgram["hasImageTexture"]         = sol::overload(PickOverload<const Texture&>(&ShaderProgram::hasImageTexture),
+                                                             PickOverload<const std::string&>(&ShaderProgram::hasImageTexture));
+    shaderProgram["getImageTextureCount"]    = &ShaderProgram::getImageTextureCount;
+    shaderProgram["getImageTexture"]         = sol::overload([] (const ShaderProgram& p, std::size_t i) { return &p.getImageTexture(i); },
+                                                             [] (const ShaderProgram& p, const std::string& n) { return &p.getImageTexture(n); });
 #endif
-    shaderProgram["setIntAttribute"]        = &ShaderProgram::setAttribute<int>;
-    shaderProgram["setUintAttribute"]       = &ShaderProgram::setAttribute<unsigned int>;
-    shaderProgram["setFloatAttribute"]      = &ShaderProgram::setAttribute<float>;
-    shaderProgram["setAttribute"]           = sol::overload(&ShaderProgram::setAttribute<const Vec2i&>,
-                                                            &ShaderProgram::setAttribute<const Vec3i&>,
-                                                            &ShaderProgram::setAttribute<const Vec4i&>,
-                                                            &ShaderProgram::setAttribute<const Vec2u&>,
-                                                            &ShaderProgram::setAttribute<const Vec3u&>,
-                                                            &ShaderProgram::setAttribute<const Vec4u&>,
-                                                            &ShaderProgram::setAttribute<const Vec2f&>,
-                                                            &ShaderProgram::setAttribute<const Vec3f&>,
-                                                            &ShaderProgram::setAttribute<const Vec4f&>,
-                                                            &ShaderProgram::setAttribute<const Mat2f&>,
-                                                            &ShaderProgram::setAttribute<const Mat3f&>,
-                                                            &ShaderProgram::setAttribute<const Mat4f&>);
+    shaderProgram["setBinaryCacheDirectory"] = &ShaderProgram::setBinaryCacheDirectory;
+    shaderProgram["setIntAttribute"]         = PickOverload<int&&, const std::string&>(&ShaderProgram::setAttribute<int>);
+    shaderProgram["setUintAttribute"]        = PickOverload<unsigned int&&, const std::string&>(&ShaderProgram::setAttribute<unsigned int>);
+    shaderProgram["setFloatAttribute"]       = PickOverload<float&&, const std::string&>(&ShaderProgram::setAttribute<float>);
+    shaderProgram["setAttribute"]            = sol::overload(PickOverload<const Vec2i&, const std::string&>(&ShaderProgram::setAttribute<const Vec2i&>),
+                                                             PickOverload<const Vec3i&, const std::string&>(&ShaderProgram::setAttribute<const Vec3i&>),
+                                                             PickOverload<const Vec4i&, const std::string&>(&ShaderProgram::setAttribute<const Vec4i&>),
+                                                             PickOverload<const Vec2u&, const std::string&>(&ShaderProgram::setAttribute<const Vec2u&>),
+                                                             PickOverload<const Vec3u&, const std::string&>(&ShaderProgram::setAttribute<const Vec3u&>),
+                                                             PickOverload<const Vec4u&, const std::string&>(&ShaderProgram::setAttribute<const Vec4u&>),
+                                                             PickOverload<const Vec2f&, const std::string&>(&ShaderProgram::setAttribute<const Vec2f&>),
+                                                             PickOverload<const Vec3f&, const std::string&>(&ShaderProgram::setAttribute<const Vec3f&>),
+                                                             PickOverload<const Vec4f&, const std::string&>(&ShaderProgram::setAttribute<const Vec4f&>),
+                                                             PickOverload<const Mat2f&, const std::string&>(&ShaderProgram::setAttribute<const Mat2f&>),
+                                                             PickOverload<const Mat3f&, const std::string&>(&ShaderProgram::setAttribute<const Mat3f&>),
+                                                             PickOverload<const Mat4f&, const std::string&>(&ShaderProgram::setAttribute<const Mat4f&>));
     // Sol does not seem to be able to bind shared pointers from derived classes to a shared pointer of the base class
     //   (e.g., Texture2DPtr cannot be given directly to setTexture(), which takes a TexturePtr)
-    shaderProgram["setTexture"]             = sol::overload(
+    shaderProgram["setTexture"]              = sol::overload(
 #if !defined(USE_OPENGL_ES)
-                                                            [] (ShaderProgram& p, Texture1DPtr t, const std::string& n) { p.setTexture(std::move(t), n); },
+                                                             [] (ShaderProgram& p, Texture1DPtr t, const std::string& n) { p.setTexture(std::move(t), n); },
 #endif
-                                                            [] (ShaderProgram& p, Texture2DPtr t, const std::string& n) { p.setTexture(std::move(t), n); },
-                                                            [] (ShaderProgram& p, Texture3DPtr t, const std::string& n) { p.setTexture(std::move(t), n); });
+                                                             [] (ShaderProgram& p, Texture2DPtr t, const std::string& n) { p.setTexture(std::move(t), n); },
+                                                             [] (ShaderProgram& p, Texture3DPtr t, const std::string& n) { p.setTexture(std::move(t), n); });
 #if !defined(USE_WEBGL)
-    shaderProgram["setImageTexture"]        = sol::overload(
+    shaderProgram["setImageTexture"]         = sol::overload(
 #if !defined(USE_OPENGL_ES)
-                                                            [] (ShaderProgram& p, Texture1DPtr t,
-                                                                const std::string& n) { p.setImageTexture(std::move(t), n, ImageTextureUsage::READ_WRITE); },
-                                                            [] (ShaderProgram& p, Texture1DPtr t, const std::string& n,
-                                                                ImageTextureUsage u) { p.setImageTexture(std::move(t), n, u); },
+                                                             [] (ShaderProgram& p, Texture1DPtr t,
+                                                                 const std::string& n) { p.setImageTexture(std::move(t), n, ImageTextureUsage::READ_WRITE); },
+                                                             [] (ShaderProgram& p, Texture1DPtr t, const std::string& n,
+                                                                 ImageTextureUsage u) { p.setImageTexture(std::move(t), n, u); },
 #endif
-                                                            [] (ShaderProgram& p, Texture2DPtr t,
-                                                                const std::string& n) { p.setImageTexture(std::move(t), n, ImageTextureUsage::READ_WRITE); },
-                                                            [] (ShaderProgram& p, Texture2DPtr t, const std::string& n,
-                                                                ImageTextureUsage u) { p.setImageTexture(std::move(t), n, u); },
-                                                            [] (ShaderProgram& p, Texture3DPtr t,
-                                                                const std::string& n) { p.setImageTexture(std::move(t), n, ImageTextureUsage::READ_WRITE); },
-                                                            [] (ShaderProgram& p, Texture3DPtr t, const std::string& n,
-                                                                ImageTextureUsage u) { p.setImageTexture(std::move(t), n, u); });
+                                                             [] (ShaderProgram& p, Texture2DPtr t,
+                                                                 const std::string& n) { p.setImageTexture(std::move(t), n, ImageTextureUsage::READ_WRITE); },
+                                                             [] (ShaderProgram& p, Texture2DPtr t, const std::string& n,
+                                                                 ImageTextureUsage u) { p.setImageTexture(std::move(t), n, u); },
+                                                             [] (ShaderProgram& p, Texture3DPtr t,
+                                                                 const std::string& n) { p.setImageTexture(std::move(t), n, ImageTextureUsage::READ_WRITE); },
+                                                             [] (ShaderProgram& p, Texture3DPtr t, const std::string& n,
+                                                                 ImageTextureUsage u) { p.setImageTexture(std::move(t), n, u); });
 #endif
-    shaderProgram["loadShaders"]            = &ShaderProgram::loadShaders;
-    shaderProgram["compileShaders"]         = &ShaderProgram::compileShaders;
-    shaderProgram["link"]                   = &ShaderProgram::link;
-    shaderProgram["isLinked"]               = &ShaderProgram::isLinked;
-    shaderProgram["updateShaders"]          = &ShaderProgram::updateShaders;
-    shaderProgram["use"]                    = &ShaderProgram::use;
-    shaderProgram["isUsed"]                 = &ShaderProgram::isUsed;
-    shaderProgram["sendAttributes"]         = &ShaderProgram::sendAttributes;
-    shaderProgram["removeAttribute"]        = &ShaderProgram::removeAttribute;
-    shaderProgram["clearAttributes"]        = &ShaderProgram::clearAttributes;
-    shaderProgram["initTextures"]           = &ShaderProgram::initTextures;
-    shaderProgram["bindTextures"]           = &ShaderProgram::bindTextures;
-    shaderProgram["removeTexture"]          = sol::overload(PickOverload<const Texture&>(&ShaderProgram::removeTexture),
-                                                            PickOverload<const std::string&>(&ShaderProgram::removeTexture));
-    shaderProgram["clearTextures"]          = &ShaderProgram::clearTextures;
+    shaderProgram["loadShaders"]             = &ShaderProgram::loadShaders;
+    shaderProgram["compileShaders"]          = &ShaderProgram::compileShaders;
+    shaderProgram["link"]                    = &ShaderProgram::link;
+    shaderProgram["startLink"]               = &ShaderProgram::startLink;
+    shaderProgram["completeLink"]            = &ShaderProgram::completeLink;
+    shaderProgram["isLinked"]                = &ShaderProgram::isLinked;
+    shaderProgram["updateShaders"]           = &ShaderProgram::updateShaders;
+    shaderProgram["use"]                     = &ShaderProgram::use;
+    shaderProgram["isUsed"]                  = &ShaderProgram::isUsed;
+    shaderProgram["sendAttributes"]          = &ShaderProgram::sendAttributes;
+    shaderProgram["removeAttribute"]         = &ShaderProgram::removeAttribute;
+    shaderProgram["clearAttributes"]         = &ShaderProgram::clearAttributes;
+    shaderProgram["initTextures"]            = &ShaderProgram::initTextures;
+    shaderProgram["bindTextures"]            = &ShaderProgram::bindTextures;
+    shaderProgram["removeTexture"]           = sol::overload(PickOverload<const Texture&>(&ShaderProgram::removeTexture),
+                                                             PickOverload<const std::string&>(&ShaderProgram::removeTexture));
+    shaderProgram["clearTextures"]           = &ShaderProgram::clearTextures;
 #if !defined(USE_WEBGL)
-    shaderProgram["initImageTextures"]      = &ShaderProgram::initImageTextures;
-    shaderProgram["bindImageTextures"]      = &ShaderProgram::bindImageTextures;
-    shaderProgram["removeImageTexture"]     = sol::overload(PickOverload<const Texture&>(&ShaderProgram::removeImageTexture),
-                                                            PickOverload<const std::string&>(&ShaderProgram::removeImageTexture));
-    shaderProgram["clearImageTextures"]     = &ShaderProgram::clearImageTextures;
+    shaderProgram["initImageTextures"]       = &ShaderProgram::initImageTextures;
+    shaderProgram["bindImageTextures"]       = &ShaderProgram::bindImageTextures;
+    shaderProgram["removeImageTexture"]      = sol::overload(PickOverload<const Texture&>(&ShaderProgram::removeImageTexture),
+                                                             PickOverload<const std::string&>(&ShaderProgram::removeImageTexture));
+    shaderProgram["clearImageTextures"]      = &ShaderProgram::clearImageTextures;
 #endif
-    shaderProgram["recoverUniformLocation"] = &ShaderProgram::recoverUniformLocation;
+    shaderProgram["recoverUniformLocation"]  = &ShaderProgram::recoverUniformLocation;
   }
 }
 
@@ -123,13 +123,15 @@ void LuaWrapper::registerShapeTypes() {
   }
 
   state.new_enum<ShapeType>("ShapeType", {
-    { "AABB",     ShapeType::AABB },
-    { "LINE",     ShapeType::LINE },
-    { "OBB",      ShapeType::OBB },
-    { "PLANE",    ShapeType::PLANE },
-    { "QUAD",     ShapeType::QUAD },
-    { "SPHERE",   ShapeType::SPHERE },
-    { "TRIANGLE", ShapeType::TRIANGLE }
+    { "AABB",          ShapeType::AABB },
+    { "LINE",          ShapeType::LINE },
+    { "OBB",           ShapeType::OBB },
+    { "PLANE",         ShapeType::PLANE },
+    { "QUAD",          ShapeType::QUAD },
+    { "SPHERE",        ShapeType::SPHERE },
+    { "TRIANGLE",      ShapeType::TRIANGLE },
+    { "CONVEX_HULL",   ShapeType::CONVEX_HULL },
+    { "TRIANGLE_MESH", ShapeType::TRIANGLE_MESH }
   });
 }
 
@@ -117,7 +117,11 @@ void LuaWrapper::registerUtilsTypes() {
   }
 
   {
-    state.new_usertype<TriggerSystem>("TriggerSystem", sol::constructors<TriggerSystem()>());
+    sol::usertype<TriggerSystem> triggerSystem = state.new_usertype<TriggerSystem>("TriggerSystem",
+                                                                                   sol::constructors<TriggerSystem()>(),
+                                                                                   sol::base_classes, sol::bases<System>());
+    triggerSystem["getCellSize"] = &TriggerSystem::getCellSize;
+    triggerSystem["setCellSize"] = &TriggerSystem::setCellSize;
   }
 
   {
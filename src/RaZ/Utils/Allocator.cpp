@@ -0,0 +1,149 @@
+#include "RaZ/Utils/Allocator.hpp"
+
+#include "tracy/Tracy.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace Raz {
+
+#if defined(RAZ_USE_PROFILING)
+namespace {
+
+// These are constant-initialized, hence usable by the global allocation operators even during static initialization
+constinit std::atomic<std::size_t> globalAllocationCount    = 0;
+constinit std::atomic<std::size_t> globalDeallocationCount  = 0;
+constinit std::atomic<std::size_t> globalAllocatedByteCount = 0;
+
+} // namespace
+#endif
+
+LinearArena::LinearArena(std::size_t blockSize, std::pmr::memory_resource* upstream) : m_blockSize{ blockSize }, m_upstream{ upstream } {
+  if (blockSize == 0)
+    throw std::invalid_argument("[LinearArena] The block size must not be 0.");
+
+  if (upstream == nullptr)
+    throw std::invalid_argument("[LinearArena] The upstream resource must not be null.");
+}
+
+LinearArena::LinearArena(LinearArena&& arena) noexcept
+  : m_blockSize{ arena.m_blockSize },
+    m_upstream{ arena.m_upstream },
+    m_blocks{ std::exchange(arena.m_blocks, {}) },
+    m_currentBlockIndex{ std::exchange(arena.m_currentBlockIndex, 0) },
+    m_currentOffset{ std::exchange(arena.m_currentOffset, 0) },
+    m_usedByteCount{ std::exchange(arena.m_usedByteCount, 0) },
+    m_stats{ std::exchange(arena.m_stats, {}) } {}
+
+std::size_t LinearArena::getCapacity() const noexcept {
+  std::size_t capacity = 0;
+
+  for (const Block& block : m_blocks)
+    capacity += block.size;
+
+  return capacity;
+}
+
+void LinearArena::reset() {
+  ZoneScopedN("LinearArena::reset");
+
+  if (m_blocks.size() > 1) {
+    const std::size_t capacity = getCapacity();
+    release();
+
+    m_blocks.push_back(Block{ static_cast<std::byte*>(m_upstream->allocate(capacity, alignof(std::max_align_t))), capacity });
+  }
+
+  m_currentBlockIndex = 0;
+  m_currentOffset     = 0;
+  m_usedByteCount     = 0;
+  m_stats             = {};
+}
+
+void LinearArena::release() {
+  for (const Block& block : m_blocks)
+    m_upstream->deallocate(block.data, block.size, alignof(std::max_align_t));
+
+  m_blocks.clear();
+
+  m_currentBlockIndex = 0;
+  m_currentOffset     = 0;
+  m_usedByteCount     = 0;
+}
+
+LinearArena& LinearArena::operator=(LinearArena&& arena) noexcept {
+  if (this == &arena)
+    return *this;
+
+  release();
+
+  m_blockSize         = arena.m_blockSize;
+  m_upstream          = arena.m_upstream;
+  m_blocks            = std::exchange(arena.m_blocks, {});
+  m_currentBlockIndex = std::exchange(arena.m_currentBlockIndex, 0);
+  m_currentOffset     = std::exchange(arena.m_currentOffset, 0);
+  m_usedByteCount     = std::exchange(arena.m_usedByteCount, 0);
+  m_stats             = std::exchange(arena.m_stats, {});
+
+  return *this;
+}
+
+void* LinearArena::do_allocate(std::size_t byteCount, std::size_t alignment) {
+  // Finding the first block, from the current one, which can hold the requested bytes
+  while (m_currentBlockIndex < m_blocks.size()) {
+    const Block& block = m_blocks[m_currentBlockIndex];
+
+    void* ptr                 = block.data + m_currentOffset;
+    std::size_t remainingSize = block.size - m_currentOffset;
+
+    if (std::align(alignment, byteCount, ptr, remainingSize)) {
+      const std::size_t newOffset = static_cast<std::size_t>(static_cast<std::byte*>(ptr) - block.data) + byteCount;
+
+      m_usedByteCount += newOffset - m_currentOffset;
+      m_currentOffset  = newOffset;
+
+      ++m_stats.allocationCount;
+      m_stats.allocatedByteCount += byteCount;
+
+      return ptr;
+    }
+
+    // The remaining space of the block is lost until the next reset
+    m_usedByteCount += block.size - m_currentOffset;
+
+    ++m_currentBlockIndex;
+    m_currentOffset = 0;
+  }
+
+  // No block is large enough; allocating a new one, which is at least big enough to hold the requested bytes with any alignment
+  const std::size_t blockSize = std::max(m_blockSize, byteCount + alignment);
+  m_blocks.push_back(Block{ static_cast<std::byte*>(m_upstream->allocate(blockSize, alignof(std::max_align_t))), blockSize });
+
+  return do_allocate(byteCount, alignment);
+}
+
+#if defined(RAZ_USE_PROFILING)
+namespace Allocator {
+
+void registerAllocation(std::size_t byteCount) noexcept {
+  globalAllocationCount.fetch_add(1, std::memory_order_relaxed);
+  globalAllocatedByteCount.fetch_add(byteCount, std::memory_order_relaxed);
+}
+
+void registerDeallocation() noexcept {
+  globalDeallocationCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+AllocationStats getGlobalStats() noexcept {
+  return AllocationStats{ globalAllocationCount.load(std::memory_order_relaxed),
+                          globalDeallocationCount.load(std::memory_order_relaxed),
+                          globalAllocatedByteCount.load(std::memory_order_relaxed) };
+}
+
+} // namespace Allocator
+#endif
+
+} // namespace Raz
@@ -1,7 +1,36 @@
 #if !defined(_MSC_VER) || !defined(__SANITIZE_ADDRESS__) // MSVC's ASan redefines the new & delete operators, which end up being in conflict with those
 
+#include "RaZ/Utils/Allocator.hpp"
+
 #include <tracy/Tracy.hpp>
 
+#include <cstdlib>
+
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+
+namespace {
+
+void* allocateAligned(std::size_t size, std::size_t alignment) noexcept {
+#if defined(_WIN32)
+  return _aligned_malloc(size, alignment);
+#else
+  // std::aligned_alloc() requires the size to be a multiple of the alignment
+  return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+#endif
+}
+
+void freeAligned(void* ptr) noexcept {
+#if defined(_WIN32)
+  _aligned_free(ptr);
+#else
+  std::free(ptr);
+#endif
+}
+
+} // namespace
+
 // See https://en.cppreference.com/w/cpp/memory/new/operator_new
 
 void* operator new(std::size_t size) {
@@ -9,6 +38,7 @@ void* operator new(std::size_t size) {
 
   if (void* ptr = std::malloc(size)) {
     TracyAlloc(ptr, size);
+    Raz::Allocator::registerAllocation(size);
     return ptr;
   }
 
@@ -28,6 +58,7 @@ void* operator new[](std::size_t size) {
 
   if (void* ptr = std::malloc(size)) {
     TracyAlloc(ptr, size);
+    Raz::Allocator::registerAllocation(size);
     return ptr;
   }
 
@@ -42,10 +73,43 @@ void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
   }
 }
 
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  size = std::max(static_cast<std::size_t>(1), size);
+
+  if (void* ptr = allocateAligned(size, static_cast<std::size_t>(alignment))) {
+    TracyAlloc(ptr, size);
+    Raz::Allocator::registerAllocation(size);
+    return ptr;
+  }
+
+  throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+  try {
+      return operator new(size, alignment);
+  } catch (...) {
+      return nullptr;
+  }
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+  return operator new(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+  try {
+      return operator new[](size, alignment);
+  } catch (...) {
+      return nullptr;
+  }
+}
+
 // See https://en.cppreference.com/w/cpp/memory/new/operator_delete
 
 void operator delete(void* ptr) noexcept {
   TracyFree(ptr);
+  Raz::Allocator::registerDeallocation();
   std::free(ptr);
 }
 
@@ -59,6 +123,7 @@ void operator delete(void* ptr, const std::nothrow_t&) noexcept {
 
 void operator delete[](void* ptr) noexcept {
   TracyFree(ptr);
+  Raz::Allocator::registerDeallocation();
   std::free(ptr);
 }
 
@@ -70,4 +135,30 @@ void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
   operator delete[](ptr);
 }
 
+void operator delete(void* ptr, std::align_val_t) noexcept {
+  TracyFree(ptr);
+  Raz::Allocator::registerDeallocation();
+  freeAligned(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t alignment) noexcept {
+  operator delete(ptr, alignment);
+}
+
+void operator delete(void* ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+  operator delete(ptr, alignment);
+}
+
+void operator delete[](void* ptr, std::align_val_t alignment) noexcept {
+  operator delete(ptr, alignment);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t alignment) noexcept {
+  operator delete[](ptr, alignment);
+}
+
+void operator delete[](void* ptr, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+  operator delete[](ptr, alignment);
+}
+
 #endif
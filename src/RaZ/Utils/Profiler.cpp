@@ -0,0 +1,278 @@
+#include "RaZ/Utils/FilePath.hpp"
+#include "RaZ/Utils/Profiler.hpp"
+
+#include "tracy/Tracy.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <format>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <string>
+
+namespace Raz {
+
+namespace {
+
+/// Single-producer single-consumer ring buffer of events; only its owning thread writes into it, while the collection is made under the registry's lock.
+struct EventBuffer {
+  std::array<ProfileEvent, Profiler::eventBufferCapacity> events {};
+  std::atomic<std::size_t> writeIndex = 0;
+  std::atomic<std::size_t> readIndex  = 0;
+  std::uint32_t threadIndex {};
+};
+
+struct ProfilerData {
+  std::mutex bufferMutex {};
+  std::vector<std::unique_ptr<EventBuffer>> eventBuffers {};
+  std::atomic<std::size_t> droppedEventCount = 0;
+
+  std::mutex timingMutex {};
+  std::size_t timingWindowSize = 240;
+  std::map<std::string, TimingWindow, std::less<>> timings {};
+
+  std::mutex nameMutex {};
+  std::set<std::string, std::less<>> names {};
+};
+
+ProfilerData& getData() {
+  static ProfilerData data;
+  return data;
+}
+
+const std::chrono::steady_clock::time_point profilerEpoch = std::chrono::steady_clock::now();
+
+EventBuffer& getThreadEventBuffer() {
+  // The buffers are owned by the profiler so that the events recorded by a thread remain available after it ended
+  thread_local EventBuffer* threadBuffer = [] () {
+    ProfilerData& data = getData();
+    const std::lock_guard<std::mutex> lock(data.bufferMutex);
+
+    auto& buffer        = data.eventBuffers.emplace_back(std::make_unique<EventBuffer>());
+    buffer->threadIndex = static_cast<std::uint32_t>(data.eventBuffers.size() - 1);
+    return buffer.get();
+  }();
+
+  return *threadBuffer;
+}
+
+void writeEscapedString(std::ostream& stream, std::string_view str) {
+  for (const char chr : str) {
+    switch (chr) {
+      case '"':  stream << "\\\""; break;
+      case '\\': stream << "\\\\"; break;
+      case '\n': stream << "\\n"; break;
+      case '\t': stream << "\\t"; break;
+      default:
+        if (static_cast<unsigned char>(chr) < 0x20)
+          stream << std::format("\\u{:04x}", static_cast<int>(chr));
+        else
+          stream << chr;
+        break;
+    }
+  }
+}
+
+} // namespace
+
+TimingWindow::TimingWindow(std::size_t capacity) : m_capacity{ capacity } {
+  if (capacity == 0)
+    throw std::invalid_argument("[TimingWindow] The capacity must not be 0.");
+
+  m_samples.reserve(capacity);
+}
+
+void TimingWindow::addSample(float time) {
+  if (m_samples.size() < m_capacity) {
+    m_samples.emplace_back(time);
+    m_nextIndex = m_samples.size() % m_capacity;
+    return;
+  }
+
+  m_samples[m_nextIndex] = time;
+  m_nextIndex            = (m_nextIndex + 1) % m_capacity;
+}
+
+TimingStats TimingWindow::computeStats() const {
+  TimingStats stats {};
+  stats.sampleCount = m_samples.size();
+
+  if (m_samples.empty())
+    return stats;
+
+  std::vector<float> sortedSamples = m_samples;
+  std::ranges::sort(sortedSamples);
+
+  const auto computePercentile = [&sortedSamples] (float percentile) {
+    const auto rank = static_cast<std::size_t>(std::ceil(percentile * static_cast<float>(sortedSamples.size())));
+    return sortedSamples[std::clamp(rank, static_cast<std::size_t>(1), sortedSamples.size()) - 1];
+  };
+
+  stats.average      = std::accumulate(sortedSamples.cbegin(), sortedSamples.cend(), 0.f) / static_cast<float>(sortedSamples.size());
+  stats.median       = computePercentile(0.5f);
+  stats.percentile95 = computePercentile(0.95f);
+  stats.percentile99 = computePercentile(0.99f);
+  stats.maximum      = sortedSamples.back();
+
+  return stats;
+}
+
+void TimingWindow::clear() noexcept {
+  m_samples.clear();
+  m_nextIndex = 0;
+}
+
+std::size_t Profiler::getDroppedEventCount() noexcept {
+  return getData().droppedEventCount.load(std::memory_order_relaxed);
+}
+
+void Profiler::setTimingWindowSize(std::size_t sampleCount) {
+  if (sampleCount == 0)
+    throw std::invalid_argument("[Profiler] The timing window size must not be 0.");
+
+  ProfilerData& data = getData();
+  const std::lock_guard<std::mutex> lock(data.timingMutex);
+
+  data.timingWindowSize = sampleCount;
+  data.timings.clear();
+}
+
+std::string_view Profiler::storeName(std::string_view name) {
+  ProfilerData& data = getData();
+  const std::lock_guard<std::mutex> lock(data.nameMutex);
+
+  auto nameIt = data.names.find(name);
+
+  if (nameIt == data.names.cend())
+    nameIt = data.names.emplace(name).first;
+
+  return *nameIt;
+}
+
+void Profiler::recordEvent(std::string_view name, std::chrono::steady_clock::time_point startTime, std::chrono::steady_clock::time_point endTime) {
+  if (!isEnabled())
+    return;
+
+  EventBuffer& buffer = getThreadEventBuffer();
+
+  const std::size_t writeIndex = buffer.writeIndex.load(std::memory_order_relaxed);
+
+  if (writeIndex - buffer.readIndex.load(std::memory_order_acquire) >= eventBufferCapacity) {
+    getData().droppedEventCount.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  buffer.events[writeIndex % eventBufferCapacity] = ProfileEvent{ name,
+                                                                  std::chrono::duration_cast<std::chrono::nanoseconds>(startTime - profilerEpoch).count(),
+                                                                  std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count(),
+                                                                  buffer.threadIndex };
+  buffer.writeIndex.store(writeIndex + 1, std::memory_order_release);
+}
+
+void Profiler::recordTiming(std::string_view name, float time) {
+  if (!isEnabled())
+    return;
+
+  ProfilerData& data = getData();
+  const std::lock_guard<std::mutex> lock(data.timingMutex);
+
+  auto timingIt = data.timings.find(name);
+
+  if (timingIt == data.timings.end())
+    timingIt = data.timings.emplace(std::string(name), TimingWindow(data.timingWindowSize)).first;
+
+  timingIt->second.addSample(time);
+}
+
+TimingStats Profiler::computeTimingStats(std::string_view name) {
+  ProfilerData& data = getData();
+  const std::lock_guard<std::mutex> lock(data.timingMutex);
+
+  const auto timingIt = data.timings.find(name);
+  return (timingIt != data.timings.cend() ? timingIt->second.computeStats() : TimingStats{});
+}
+
+std::vector<ProfileEvent> Profiler::collectEvents() {
+  ZoneScopedN("Profiler::collectEvents");
+
+  ProfilerData& data = getData();
+  std::vector<ProfileEvent> events;
+
+  {
+    const std::lock_guard<std::mutex> lock(data.bufferMutex);
+
+    for (const std::unique_ptr<EventBuffer>& buffer : data.eventBuffers) {
+      const std::size_t readIndex  = buffer->readIndex.load(std::memory_order_relaxed);
+      const std::size_t writeIndex = buffer->writeIndex.load(std::memory_order_acquire);
+
+      for (std::size_t eventIndex = readIndex; eventIndex < writeIndex; ++eventIndex)
+        events.emplace_back(buffer->events[eventIndex % eventBufferCapacity]);
+
+      buffer->readIndex.store(writeIndex, std::memory_order_release);
+    }
+  }
+
+  std::ranges::sort(events, [] (const ProfileEvent& event1, const ProfileEvent& event2) noexcept { return (event1.startTime < event2.startTime); });
+
+  return events;
+}
+
+void Profiler::exportChromeTrace(const std::vector<ProfileEvent>& events, std::ostream& stream) {
+  ZoneScopedN("Profiler::exportChromeTrace");
+
+  stream << "{\"traceEvents\":[";
+
+  for (std::size_t eventIndex = 0; eventIndex < events.size(); ++eventIndex) {
+    const ProfileEvent& event = events[eventIndex];
+
+    stream << (eventIndex > 0 ? ",\n" : "\n") << "{\"name\":\"";
+    writeEscapedString(stream, event.name);
+    // Timestamps & durations are expected in microseconds
+    stream << std::format(R"(","cat":"RaZ","ph":"X","ts":{:.3f},"dur":{:.3f},"pid":0,"tid":{}}})",
+                          static_cast<double>(event.startTime) / 1000.0,
+                          static_cast<double>(event.duration) / 1000.0,
+                          event.threadIndex);
+  }
+
+  stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+void Profiler::saveChromeTrace(const FilePath& filePath) {
+  ZoneScopedN("Profiler::saveChromeTrace");
+
+  std::ofstream file(filePath, std::ios_base::binary);
+
+  if (!file)
+    throw std::invalid_argument(std::format("[Profiler] Unable to create a trace file as '{}'; path to file must exist", filePath));
+
+  exportChromeTrace(collectEvents(), file);
+}
+
+void Profiler::clear() {
+  collectEvents();
+
+  ProfilerData& data = getData();
+  data.droppedEventCount.store(0, std::memory_order_relaxed);
+
+  const std::lock_guard<std::mutex> lock(data.timingMutex);
+  data.timings.clear();
+}
+
+ProfileScope::~ProfileScope() {
+  if (!m_isEnabled)
+    return;
+
+  const std::chrono::steady_clock::time_point endTime = std::chrono::steady_clock::now();
+  Profiler::recordEvent(m_name, m_startTime, endTime);
+
+  if (m_aggregateTiming)
+    Profiler::recordTiming(m_name, std::chrono::duration<float, std::milli>(endTime - m_startTime).count());
+}
+
+} // namespace Raz
@@ -196,8 +196,53 @@ void Triangle::translate(const Vec3f& displacement) noexcept {
   m_thirdPos  += displacement;
 }
 
-Vec3f Triangle::computeProjection(const Vec3f&) const {
-  throw std::runtime_error("Error: Not implemented yet.");
+Vec3f Triangle::computeProjection(const Vec3f& point) const {
+  // Finding the Voronoi region of the triangle in which the point lies, as described in Christer Ericson's "Real-Time Collision Detection" (5.1.5)
+
+  const Vec3f firstEdge  = m_secondPos - m_firstPos;
+  const Vec3f secondEdge = m_thirdPos - m_firstPos;
+
+  const Vec3f firstDir = point - m_firstPos;
+  const float firstDot1 = firstEdge.dot(firstDir);
+  const float firstDot2 = secondEdge.dot(firstDir);
+
+  if (firstDot1 <= 0.f && firstDot2 <= 0.f)
+    return m_firstPos;
+
+  const Vec3f secondDir = point - m_secondPos;
+  const float secondDot1 = firstEdge.dot(secondDir);
+  const float secondDot2 = secondEdge.dot(secondDir);
+
+  if (secondDot1 >= 0.f && secondDot2 <= secondDot1)
+    return m_secondPos;
+
+  const float thirdRegion = firstDot1 * secondDot2 - secondDot1 * firstDot2;
+
+  if (thirdRegion <= 0.f && firstDot1 >= 0.f && secondDot1 <= 0.f)
+    return m_firstPos + firstEdge * (firstDot1 / (firstDot1 - secondDot1));
+
+  const Vec3f thirdDir = point - m_thirdPos;
+  const float thirdDot1 = firstEdge.dot(thirdDir);
+  const float thirdDot2 = secondEdge.dot(thirdDir);
+
+  if (thirdDot2 >= 0.f && thirdDot1 <= thirdDot2)
+    return m_thirdPos;
+
+  const float secondRegion = thirdDot1 * firstDot2 - firstDot1 * thirdDot2;
+
+  if (secondRegion <= 0.f && firstDot2 >= 0.f && thirdDot2 <= 0.f)
+    return m_firstPos + secondEdge * (firstDot2 / (firstDot2 - thirdDot2));
+
+  const float firstRegion = secondDot1 * thirdDot2 - thirdDot1 * secondDot2;
+
+  if (firstRegion <= 0.f && secondDot2 - secondDot1 >= 0.f && thirdDot1 - thirdDot2 >= 0.f) {
+    const float coeff = (secondDot2 - secondDot1) / ((secondDot2 - secondDot1) + (thirdDot1 - thirdDot2));
+    return m_secondPos + (m_thirdPos - m_secondPos) * coeff;
+  }
+
+  // The point projects inside the triangle
+  const float invDenom = 1.f / (firstRegion + secondRegion + thirdRegion);
+  return m_firstPos + firstEdge * (secondRegion * invDenom) + secondEdge * (thirdRegion * invDenom);
 }
 
 AABB Triangle::computeBoundingBox() const {
@@ -348,7 +393,13 @@ Vec3f OBB::computeProjection(const Vec3f&) const {
 }
 
 AABB OBB::computeBoundingBox() const {
-  throw std::runtime_error("Error: Not implemented yet.");
+  const auto [minMinMin, minMinMax, minMaxMin, minMaxMax, maxMinMin, maxMinMax, maxMaxMin, maxMaxMax] = computeRotatedCorners();
+
+  const auto [xMin, xMax] = std::minmax({ minMinMin.x(), minMinMax.x(), minMaxMin.x(), minMaxMax.x(), maxMinMin.x(), maxMinMax.x(), maxMaxMin.x(), maxMaxMax.x() });
+  const auto [yMin, yMax] = std::minmax({ minMinMin.y(), minMinMax.y(), minMaxMin.y(), minMaxMax.y(), maxMinMin.y(), maxMinMax.y(), maxMaxMin.y(), maxMaxMax.y() });
+  const auto [zMin, zMax] = std::minmax({ minMinMin.z(), minMinMax.z(), minMaxMin.z(), minMaxMax.z(), maxMinMin.z(), maxMinMax.z(), maxMaxMin.z(), maxMaxMax.z() });
+
+  return AABB(Vec3f(xMin, yMin, zMin), Vec3f(xMax, yMax, zMax));
 }
 
 BoxCorners OBB::computeRotatedCorners() const {
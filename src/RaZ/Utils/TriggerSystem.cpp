@@ -5,52 +5,240 @@
 
 #include "tracy/Tracy.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 namespace Raz {
 
+namespace {
+
+constexpr float maxCellCoord = static_cast<float>(1 << 20);
+
+constexpr std::uint64_t computeCellKey(int x, int y, int z) noexcept {
+  // Each coordinate is packed into 21 bits; cells too far apart may share the same key, which only leads to a few more (discarded) candidates
+  constexpr std::uint64_t coordMask = (1ull << 21) - 1;
+  return ((static_cast<std::uint64_t>(x) & coordMask) << 42)
+       | ((static_cast<std::uint64_t>(y) & coordMask) << 21)
+       |  (static_cast<std::uint64_t>(z) & coordMask);
+}
+
+Vec3f computeAbsolutePosition(const Transform& transform) {
+  return transform.getRotation() * transform.getPosition();
+}
+
+} // namespace
+
 TriggerSystem::TriggerSystem() {
   registerComponents<Triggerer, TriggerVolume>();
 }
 
+void TriggerSystem::setCellSize(float cellSize) {
+  if (cellSize <= 0.f)
+    throw std::invalid_argument("[TriggerSystem] The cell size must be strictly positive.");
+
+  m_cellSize = cellSize;
+
+  // All volumes will be inserted back on the next update
+  m_grid.clear();
+  m_volumeCells.clear();
+  m_largeVolumes.clear();
+}
+
 bool TriggerSystem::update(const FrameTimeInfo&) {
   ZoneScopedN("TriggerSystem::update");
 
-  for (Entity* triggererEntity : m_entities) {
-    if (!triggererEntity->hasComponent<Triggerer>() || !triggererEntity->hasComponent<Transform>())
-      continue;
+  m_triggerers.clear();
+  m_triggererIndices.clear();
+
+  {
+    ZoneScopedN("TriggerSystem::update[grid]");
 
-    const auto& triggerer          = triggererEntity->getComponent<Triggerer>();
-    const auto& triggererTransform = triggererEntity->getComponent<Transform>();
-    const Vec3f triggererPos       = triggererTransform.getRotation() * triggererTransform.getPosition();
+    for (Entity* entity : m_entities) {
+      if (entity->hasComponent<Triggerer>() && entity->hasComponent<Transform>()) {
+        const Vec3f triggererPos = computeAbsolutePosition(entity->getComponent<Transform>());
+        m_triggererIndices.try_emplace(entity, m_triggerers.size());
+        m_triggerers.emplace_back(TriggererInfo{ entity, triggererPos, computeCell(triggererPos) });
+      }
+
+      const auto volumeIt = m_volumeCells.find(entity);
+
+      if (!entity->hasComponent<TriggerVolume>() || !entity->hasComponent<Transform>()) {
+        if (volumeIt != m_volumeCells.cend())
+          removeVolume(*entity);
 
-    for (Entity* triggerVolumeEntity : m_entities) {
-      if (!triggerVolumeEntity->hasComponent<TriggerVolume>() || !triggerVolumeEntity->hasComponent<Transform>())
         continue;
+      }
+
+      const Vec3f volumePos  = computeAbsolutePosition(entity->getComponent<Transform>());
+      const AABB boundingBox = computeBoundingBox(entity->getComponent<TriggerVolume>(), volumePos);
+
+      // The volume's shape may have changed without it having moved, in which case it may overlap other cells
+      if (volumeIt != m_volumeCells.cend()) {
+        if (volumeIt->second.position == volumePos && volumeIt->second.boundingBox == boundingBox)
+          continue;
+
+        removeVolume(*entity);
+      }
+
+      insertVolume(*entity, volumePos, boundingBox);
+    }
+  }
+
+  for (const TriggererInfo& triggererInfo : m_triggerers) {
+    const Bitset& triggerableComponents = triggererInfo.entity->getComponent<Triggerer>().getTriggerableComponents();
+
+    const auto processVolumes = [this, &triggerableComponents, &triggererInfo] (const std::vector<Entity*>& volumeEntities) {
+      for (Entity* triggerVolumeEntity : volumeEntities) {
+        if (!triggerableComponents.intersects(triggerVolumeEntity->getEnabledComponents()))
+          continue;
+
+        auto& triggerVolume = triggerVolumeEntity->getComponent<TriggerVolume>();
+
+        if (!triggerVolume.m_enabled)
+          continue;
+
+        const VolumeCells& volumeCells = m_volumeCells.find(triggerVolumeEntity)->second;
+
+        // Cells sharing the same key may be listed; those not actually overlapped by the volume are left to the leave check below
+        if (!volumeCells.contains(triggererInfo.cell))
+          continue;
+
+        processTrigger(triggerVolume, *triggererInfo.entity, triggererInfo.position, volumeCells.position);
+      }
+    };
+
+    if (const auto cellIt = m_grid.find(computeCellKey(triggererInfo.cell.x(), triggererInfo.cell.y(), triggererInfo.cell.z()));
+        cellIt != m_grid.cend()) {
+      processVolumes(cellIt->second);
+    }
+
+    processVolumes(m_largeVolumes);
+  }
+
+  // The triggerers which were inside a volume but are now out of its cells have not been tested against it & must leave it
+  for (const auto& [triggerVolumeEntity, volumeCells] : m_volumeCells) {
+    auto& triggerVolume = volumeCells.entity->getComponent<TriggerVolume>();
+
+    if (!triggerVolume.m_enabled || triggerVolume.m_triggeringEntities.empty() || volumeCells.isLarge)
+      continue;
+
+    m_leavingEntities.clear();
+
+    for (const Entity* triggeringEntity : triggerVolume.m_triggeringEntities) {
+      // Entities which are not valid triggerers anymore are not processed at all
+      const auto triggererIt = m_triggererIndices.find(triggeringEntity);
 
-      if ((triggerer.getTriggerableComponents() & triggerVolumeEntity->getEnabledComponents()).isEmpty())
+      if (triggererIt == m_triggererIndices.cend())
         continue;
 
-      auto& triggerVolume = triggerVolumeEntity->getComponent<TriggerVolume>();
+      const TriggererInfo& triggererInfo = m_triggerers[triggererIt->second];
+
+      if (volumeCells.contains(triggererInfo.cell))
+        continue;
 
-      if (!triggerVolume.m_enabled)
+      if (!triggererInfo.entity->getComponent<Triggerer>().getTriggerableComponents().intersects(triggerVolumeEntity->getEnabledComponents()))
         continue;
 
-      processTrigger(triggerVolume, *triggererEntity, triggererPos, triggerVolumeEntity->getComponent<Transform>());
+      m_leavingEntities.emplace_back(triggererIt->second);
+    }
+
+    for (const std::size_t triggererIndex : m_leavingEntities) {
+      const TriggererInfo& triggererInfo = m_triggerers[triggererIndex];
+      processTrigger(triggerVolume, *triggererInfo.entity, triggererInfo.position, volumeCells.position);
     }
   }
 
   return true;
 }
 
+void TriggerSystem::unlinkEntity(const EntityPtr& entity) {
+  System::unlinkEntity(entity);
+
+  if (m_volumeCells.contains(entity.get()))
+    removeVolume(*entity);
+}
+
+Vec3i TriggerSystem::computeCell(const Vec3f& position) const noexcept {
+  const auto computeCoord = [this] (float coord) {
+    return static_cast<int>(std::floor(std::clamp(coord / m_cellSize, -maxCellCoord, maxCellCoord)));
+  };
+
+  return Vec3i(computeCoord(position.x()), computeCoord(position.y()), computeCoord(position.z()));
+}
+
+AABB TriggerSystem::computeBoundingBox(const TriggerVolume& triggerVolume, const Vec3f& position) {
+  const Shape& volume    = std::visit([] (const Shape& shape) noexcept -> const Shape& { return shape; }, triggerVolume.m_volume);
+  const AABB boundingBox = volume.computeBoundingBox();
+
+  return AABB(boundingBox.getMinPosition() + position, boundingBox.getMaxPosition() + position);
+}
+
+void TriggerSystem::insertVolume(Entity& entity, const Vec3f& position, const AABB& boundingBox) {
+  VolumeCells volumeCells { &entity, position, boundingBox, computeCell(boundingBox.getMinPosition()), computeCell(boundingBox.getMaxPosition()), false };
+
+  const Vec3i cellCounts = volumeCells.maxCell - volumeCells.minCell + 1;
+  volumeCells.isLarge    = (static_cast<std::int64_t>(cellCounts.x()) * cellCounts.y() * cellCounts.z() > maxVolumeCellCount);
+
+  if (volumeCells.isLarge) {
+    m_largeVolumes.emplace_back(&entity);
+  } else {
+    for (int z = volumeCells.minCell.z(); z <= volumeCells.maxCell.z(); ++z) {
+      for (int y = volumeCells.minCell.y(); y <= volumeCells.maxCell.y(); ++y) {
+        for (int x = volumeCells.minCell.x(); x <= volumeCells.maxCell.x(); ++x)
+          m_grid[computeCellKey(x, y, z)].emplace_back(&entity);
+      }
+    }
+  }
+
+  m_volumeCells.insert_or_assign(&entity, volumeCells);
+}
+
+void TriggerSystem::removeVolume(const Entity& entity) {
+  const auto volumeIt = m_volumeCells.find(&entity);
+  const VolumeCells& volumeCells = volumeIt->second;
+
+  const auto removeEntity = [&entity] (std::vector<Entity*>& entities) {
+    const auto entityIt = std::ranges::find(entities, &entity);
+
+    if (entityIt == entities.end())
+      return;
+
+    *entityIt = entities.back();
+    entities.pop_back();
+  };
+
+  if (volumeCells.isLarge) {
+    removeEntity(m_largeVolumes);
+  } else {
+    for (int z = volumeCells.minCell.z(); z <= volumeCells.maxCell.z(); ++z) {
+      for (int y = volumeCells.minCell.y(); y <= volumeCells.maxCell.y(); ++y) {
+        for (int x = volumeCells.minCell.x(); x <= volumeCells.maxCell.x(); ++x) {
+          const auto cellIt = m_grid.find(computeCellKey(x, y, z));
+
+          if (cellIt == m_grid.end())
+            continue;
+
+          removeEntity(cellIt->second);
+
+          if (cellIt->second.empty())
+            m_grid.erase(cellIt);
+        }
+      }
+    }
+  }
+
+  m_volumeCells.erase(volumeIt);
+}
+
 void TriggerSystem::processTrigger(TriggerVolume& triggerVolume,
                                    Entity& triggererEntity,
                                    const Vec3f& triggererPos,
-                                   const Transform& triggerVolumeTransform) {
+                                   const Vec3f& triggerVolumePos) {
   ZoneScopedN("TriggerSystem::processTrigger");
 
   const bool wasBeingTriggered = triggerVolume.m_triggeringEntities.contains(&triggererEntity);
 
-  const Vec3f triggerVolumeAbsPos = triggerVolumeTransform.getRotation() * triggerVolumeTransform.getPosition();
-  const Vec3f triggererRelPos     = triggererPos - triggerVolumeAbsPos; // Triggerer position in the volume's space
+  const Vec3f triggererRelPos     = triggererPos - triggerVolumePos; // Triggerer position in the volume's space
   const bool isCurrentlyTriggered = std::visit([&triggererRelPos] (const auto& volume) {
     return volume.contains(triggererRelPos);
   }, triggerVolume.m_volume);
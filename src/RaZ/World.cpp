@@ -1,4 +1,5 @@
 #include "RaZ/World.hpp"
+#include "RaZ/Utils/Profiler.hpp"
 
 #include "tracy/Tracy.hpp"
 
@@ -11,8 +12,13 @@ Entity& World::addEntity(bool enabled) {
   return *m_entities.back();
 }
 
+bool World::requiresMainThread() const noexcept {
+  return std::ranges::any_of(m_systems, [] (const SystemPtr& system) noexcept { return (system != nullptr && system->requiresMainThread()); });
+}
+
 bool World::update(const FrameTimeInfo& timeInfo) {
   ZoneScopedN("World::update");
+  const ProfileScope updateScope("World::update", true);
 
   refresh();
 
@@ -20,6 +26,7 @@ bool World::update(const FrameTimeInfo& timeInfo) {
     if (!m_activeSystems[systemIndex])
       continue;
 
+    const ProfileScope systemScope(m_systemNames[systemIndex], true);
     const bool isSystemActive = m_systems[systemIndex]->update(timeInfo);
 
     if (!isSystemActive)
@@ -51,15 +58,15 @@ void World::refresh() {
       if (system == nullptr || !m_activeSystems[systemIndex])
         continue;
 
-      const Bitset matchingComponents = system->getAcceptedComponents() & entity->getEnabledComponents();
+      const bool hasMatchingComponents = system->getAcceptedComponents().intersects(entity->getEnabledComponents());
 
       // If the system does not contain the entity, check if it should (if it possesses the accepted components); if yes, link it
       // Else, if the system contains the entity but should not, unlink it
       if (!system->containsEntity(*entity)) {
-        if (!matchingComponents.isEmpty())
+        if (hasMatchingComponents)
           system->linkEntity(entity);
       } else {
-        if (matchingComponents.isEmpty())
+        if (!hasMatchingComponents)
           system->unlinkEntity(entity);
       }
     }
@@ -123,8 +130,10 @@ void World::cleanEntities() {
     if (entityIter == m_entities.end())
       throw std::invalid_argument("[World] The entity to be removed isn't owned by this world");
 
-    for (const SystemPtr& system : m_systems)
-      system->unlinkEntity(*entityIter);
+    for (const SystemPtr& system : m_systems) {
+      if (system)
+        system->unlinkEntity(*entityIter);
+    }
 
     m_entities.erase(entityIter);
   }
@@ -0,0 +1,187 @@
+#include "RaZ/Application.hpp"
+#include "RaZ/System.hpp"
+#include "RaZ/Utils/Threading.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace {
+
+class TimeInfoSystem final : public Raz::System {
+public:
+  explicit TimeInfoSystem(Raz::FrameTimeInfo& timeInfo) : m_timeInfo{ timeInfo } {}
+
+  bool update(const Raz::FrameTimeInfo& timeInfo) override {
+    m_timeInfo = timeInfo;
+    return true;
+  }
+
+private:
+  Raz::FrameTimeInfo& m_timeInfo;
+};
+
+class ThreadIdSystem final : public Raz::System {
+public:
+  ThreadIdSystem(std::thread::id& threadId, bool requiresMainThread, int updateCount)
+    : m_threadId{ threadId }, m_requiresMainThread{ requiresMainThread }, m_remainingUpdateCount{ updateCount } {}
+
+  bool requiresMainThread() const noexcept override { return m_requiresMainThread; }
+
+  bool update(const Raz::FrameTimeInfo&) override {
+    if (m_remainingUpdateCount < 0)
+      throw std::runtime_error("Error: Failed update");
+
+    m_threadId = std::this_thread::get_id();
+    return (--m_remainingUpdateCount > 0);
+  }
+
+private:
+  std::thread::id& m_threadId;
+  bool m_requiresMainThread {};
+  int m_remainingUpdateCount {};
+};
+
+class ParallelWorkSystem final : public Raz::System {
+public:
+  explicit ParallelWorkSystem(std::atomic<std::size_t>& processedCount) : m_processedCount{ processedCount } {}
+
+  bool update(const Raz::FrameTimeInfo&) override {
+    // Waits for tasks executed on the default thread pool, as would do some systems like the PhysicsSystem's batch queries
+    Raz::Threading::parallelize(0, 64, [this] (const Raz::Threading::IndexRange& range) noexcept {
+      m_processedCount += range.endIndex - range.beginIndex;
+    });
+
+    return false;
+  }
+
+private:
+  std::atomic<std::size_t>& m_processedCount;
+};
+
+} // namespace
+
+TEST_CASE("Application fixed time steps", "[core]") {
+  Raz::FrameTimeInfo timeInfo {};
+
+  Raz::Application app;
+  app.addWorld().addSystem<TimeInfoSystem>(timeInfo);
+  app.setFixedTimeStep(0.001f);
+  app.setMaxSubstepCount(3);
+
+  // Far more time than needed for 3 steps has elapsed; only the maximum count is processed, the remaining time being dropped
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  CHECK(app.runOnce());
+  CHECK(timeInfo.deltaTime >= 0.0199f);
+  CHECK(timeInfo.substepCount == 3);
+  CHECK(timeInfo.substepTime == 0.001f);
+  CHECK(timeInfo.interpolationAlpha >= 0.f);
+  CHECK(timeInfo.interpolationAlpha < 1.f);
+
+  app.setFixedTimeStep(10.f);
+  CHECK(app.runOnce());
+  CHECK(timeInfo.substepCount == 0);
+  CHECK(timeInfo.interpolationAlpha < 0.01f);
+}
+
+TEST_CASE("Application frame pacing", "[core]") {
+  Raz::FrameTimeInfo timeInfo {};
+
+  Raz::Application app;
+  app.addWorld().addSystem<TimeInfoSystem>(timeInfo);
+  CHECK(app.getTargetFrameRate() == 0.f);
+  app.setTargetFrameRate(50.f);
+  CHECK(app.getTargetFrameRate() > 49.99f);
+  CHECK(app.getTargetFrameRate() < 50.01f);
+
+  CHECK(app.runOnce());
+  const auto startTime = std::chrono::steady_clock::now();
+  CHECK(app.runOnce());
+  CHECK(app.runOnce());
+
+  // The second cycle started at least 20ms after the first, and the third as long after the second
+  CHECK(std::chrono::steady_clock::now() - startTime >= std::chrono::milliseconds(20));
+  CHECK(timeInfo.deltaTime >= 0.0199f);
+
+  app.setTargetFrameRate(0.f);
+  CHECK(app.getTargetFrameRate() == 0.f); // The cycles are not limited anymore
+  CHECK(app.runOnce());
+}
+
+TEST_CASE("Application parallel worlds", "[core]") {
+  Raz::Application app;
+  CHECK(app.getWorldUpdateMode() == Raz::WorldUpdateMode::SEQUENTIAL);
+  app.setWorldUpdateMode(Raz::WorldUpdateMode::PARALLEL);
+  CHECK(app.getWorldUpdateMode() == Raz::WorldUpdateMode::PARALLEL);
+
+  std::array<std::thread::id, 4> threadIds {};
+  app.addWorld().addSystem<ThreadIdSystem>(threadIds[0], true, 3);
+  app.addWorld().addSystem<ThreadIdSystem>(threadIds[1], false, 3);
+  app.addWorld().addSystem<ThreadIdSystem>(threadIds[2], false, 3);
+  app.addWorld().addSystem<ThreadIdSystem>(threadIds[3], false, 1);
+
+  CHECK(app.getWorlds()[0]->requiresMainThread());
+  CHECK_FALSE(app.getWorlds()[1]->requiresMainThread());
+
+  CHECK(app.runOnce());
+  CHECK(threadIds[0] == std::this_thread::get_id());
+
+#if defined(RAZ_THREADS_AVAILABLE)
+  CHECK(threadIds[1] != std::this_thread::get_id());
+  CHECK(threadIds[2] != std::this_thread::get_id());
+  CHECK(threadIds[3] != std::this_thread::get_id());
+#endif
+
+  // A world without any active system is not updated anymore
+  threadIds[3] = {};
+  CHECK(app.runOnce());
+  CHECK(threadIds[3] == std::thread::id());
+
+  CHECK_FALSE(app.runOnce()); // All worlds are now inactive
+}
+
+TEST_CASE("Application parallel worlds exceptions", "[core]") {
+  std::thread::id threadId {};
+
+  Raz::Application app;
+  app.setWorldUpdateMode(Raz::WorldUpdateMode::PARALLEL);
+  app.addWorld().addSystem<ThreadIdSystem>(threadId, false, -1);
+  app.addWorld().addSystem<ThreadIdSystem>(threadId, true, 1);
+
+  // An exception thrown by a world updated on another thread is rethrown on the calling one
+  CHECK_THROWS_AS(app.runOnce(), std::runtime_error);
+}
+
+TEST_CASE("Application parallel worlds nested parallelization", "[core]") {
+  // Having more worlds than the default thread pool has threads must not block all of them, each world waiting for its own parallel tasks
+  const std::size_t worldCount = Raz::Threading::getDefaultThreadPool().getThreadCount() * 2;
+  std::atomic<std::size_t> processedCount = 0;
+
+  Raz::Application app(worldCount);
+  app.setWorldUpdateMode(Raz::WorldUpdateMode::PARALLEL);
+
+  for (std::size_t worldIndex = 0; worldIndex < worldCount; ++worldIndex)
+    app.addWorld().addSystem<ParallelWorkSystem>(processedCount);
+
+  CHECK_FALSE(app.runOnce());
+  CHECK(processedCount == worldCount * 64);
+}
+
+TEST_CASE("Application move", "[core]") {
+  Raz::FrameTimeInfo timeInfo {};
+
+  Raz::Application app;
+  app.addWorld().addSystem<TimeInfoSystem>(timeInfo);
+  CHECK(app.getFrameArena().allocate(16, 8) != nullptr);
+
+  // The frame arena's memory follows the application
+  Raz::Application movedApp(std::move(app));
+  CHECK(movedApp.getWorlds().size() == 1);
+  CHECK(movedApp.getFrameArena().getUsedByteCount() == 16);
+  CHECK(movedApp.runOnce());
+  CHECK(movedApp.getFrameArena().getUsedByteCount() == 0);
+}
@@ -1,4 +1,5 @@
 #include "RaZ/Component.hpp"
+#include "RaZ/Entity.hpp"
 #include "RaZ/Data/Mesh.hpp"
 #include "RaZ/Math/Transform.hpp"
 #include "RaZ/Render/Camera.hpp"
@@ -6,6 +7,23 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <cstdint>
+#include <memory>
+
+namespace {
+
+struct FirstPooledComponent : public Raz::Component {
+  int value {};
+};
+
+struct SecondPooledComponent : public Raz::Component {
+  int value {};
+};
+
+struct alignas(64) AlignedComponent : public Raz::Component {};
+
+} // namespace
+
 TEST_CASE("Components IDs", "[core]") {
   // With the CRTP, every component gets a different constant ID with the first call
   // The ID is incremented with every distinct component call
@@ -22,3 +40,22 @@ TEST_CASE("Components IDs", "[core]") {
   CHECK(meshIndex == Raz::Component::getId<Raz::Mesh>());
   CHECK(lightIndex == Raz::Component::getId<Raz::Light>());
 }
+
+TEST_CASE("Components allocation", "[core]") {
+  Raz::Entity entity(0);
+
+  const FirstPooledComponent* firstAddress = &entity.addComponent<FirstPooledComponent>();
+  entity.removeComponent<FirstPooledComponent>();
+
+  // Although both types have the same size, each is allocated from its own pool; the memory released by one is only reused for the same type
+  CHECK(&entity.addComponent<SecondPooledComponent>() != static_cast<const void*>(firstAddress));
+  CHECK(&entity.addComponent<FirstPooledComponent>() == firstAddress);
+
+  CHECK(reinterpret_cast<std::uintptr_t>(&entity.addComponent<AlignedComponent>()) % 64 == 0);
+
+  // Components allocated directly are released normally as well
+  auto component = std::make_unique<SecondPooledComponent>();
+  component->value = 42;
+  CHECK(component->value == 42);
+  component = nullptr;
+}
@@ -79,6 +79,13 @@ TEST_CASE("Bitset manipulations", "[data]") {
   CHECK(~fullOnes == fullZeros);
   CHECK(~alternated1 == alternated2);
   CHECK(~alternated2 == alternated1);
+
+  CHECK(alternated1.intersects(alternated1));
+  CHECK(alternated1.intersects(fullOnes));
+  CHECK_FALSE(alternated1.intersects(alternated2));
+  CHECK_FALSE(fullOnes.intersects(fullZeros));
+  CHECK_FALSE(fullOnes.intersects(Raz::Bitset()));
+  CHECK(Raz::Bitset({ false, true }).intersects(alternated2)); // Only the common bits are checked
 }
 
 TEST_CASE("Bitset shifts", "[data]") {
@@ -0,0 +1,115 @@
+#include "RaZ/Data/BlockCompression.hpp"
+#include "RaZ/Data/Image.hpp"
+#include "RaZ/Math/Vector.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cmath>
+
+namespace {
+
+// Colors vary along a single direction, which block compression handles well; a gray-alpha image's channels vary independently
+Raz::Image createGradientImage(unsigned int width, unsigned int height, Raz::ImageColorspace colorspace) {
+  Raz::Image img(width, height, colorspace);
+
+  for (unsigned int heightIndex = 0; heightIndex < height; ++heightIndex) {
+    for (unsigned int widthIndex = 0; widthIndex < width; ++widthIndex) {
+      const auto horizValue = static_cast<uint8_t>(widthIndex * 255 / (width - 1));
+      const auto vertValue  = static_cast<uint8_t>(heightIndex * 255 / (height - 1));
+      const std::array<uint8_t, 4> values = { horizValue,
+                                              (colorspace == Raz::ImageColorspace::GRAY_ALPHA ? vertValue : static_cast<uint8_t>(255 - horizValue)),
+                                              static_cast<uint8_t>(horizValue / 2),
+                                              horizValue };
+
+      for (uint8_t channelIndex = 0; channelIndex < img.getChannelCount(); ++channelIndex)
+        img.setByteValue(widthIndex, heightIndex, channelIndex, values[channelIndex]);
+    }
+  }
+
+  return img;
+}
+
+float computeRootMeanSquaredError(const Raz::Image& originalImg, const Raz::Image& decompressedImg) {
+  float squaredError = 0.f;
+
+  for (unsigned int heightIndex = 0; heightIndex < originalImg.getHeight(); ++heightIndex) {
+    for (unsigned int widthIndex = 0; widthIndex < originalImg.getWidth(); ++widthIndex) {
+      for (uint8_t channelIndex = 0; channelIndex < decompressedImg.getChannelCount(); ++channelIndex) {
+        const float diff = static_cast<float>(originalImg.recoverByteValue(widthIndex, heightIndex, channelIndex))
+                         - static_cast<float>(decompressedImg.recoverByteValue(widthIndex, heightIndex, channelIndex));
+        squaredError += diff * diff;
+      }
+    }
+  }
+
+  return std::sqrt(squaredError / static_cast<float>(originalImg.getWidth() * originalImg.getHeight() * decompressedImg.getChannelCount()));
+}
+
+} // namespace
+
+TEST_CASE("BlockCompression constant color", "[data]") {
+  Raz::Image img(8, 8, Raz::ImageColorspace::RGBA);
+  for (unsigned int heightIndex = 0; heightIndex < img.getHeight(); ++heightIndex) {
+    for (unsigned int widthIndex = 0; widthIndex < img.getWidth(); ++widthIndex)
+      img.setPixel(widthIndex, heightIndex, Raz::Vec4b(255, 0, 132, 64));
+  }
+
+  // These values can be represented exactly in every format except BC7, whose endpoint channels share their lowest bit
+  for (const Raz::BlockCompressionFormat format : { Raz::BlockCompressionFormat::BC1, Raz::BlockCompressionFormat::BC3,
+                                                    Raz::BlockCompressionFormat::BC4, Raz::BlockCompressionFormat::BC5,
+                                                    Raz::BlockCompressionFormat::BC7 }) {
+    const Raz::CompressedImage compressedImg = Raz::BlockCompression::compress(img, format, false);
+    CHECK(compressedImg.getLevelCount() == 1);
+    CHECK(compressedImg.getLevel(0).data.size() == 4 * Raz::CompressedImage::getBlockSize(format));
+
+    const Raz::Image decompressedImg = Raz::BlockCompression::decompress(compressedImg);
+    CHECK(decompressedImg.getWidth() == 8);
+    CHECK(decompressedImg.getHeight() == 8);
+    CHECK(computeRootMeanSquaredError(img, decompressedImg) <= (format == Raz::BlockCompressionFormat::BC7 ? 1.f : 0.f));
+  }
+
+  CHECK(Raz::BlockCompression::decompress(Raz::BlockCompression::compress(img, Raz::BlockCompressionFormat::BC1, false)).getChannelCount() == 3);
+  CHECK(Raz::BlockCompression::decompress(Raz::BlockCompression::compress(img, Raz::BlockCompressionFormat::BC3, false)).getChannelCount() == 4);
+  CHECK(Raz::BlockCompression::decompress(Raz::BlockCompression::compress(img, Raz::BlockCompressionFormat::BC4, false)).getChannelCount() == 1);
+  CHECK(Raz::BlockCompression::decompress(Raz::BlockCompression::compress(img, Raz::BlockCompressionFormat::BC5, false)).getChannelCount() == 2);
+  CHECK(Raz::BlockCompression::decompress(Raz::BlockCompression::compress(img, Raz::BlockCompressionFormat::BC7, false)).getChannelCount() == 4);
+}
+
+TEST_CASE("BlockCompression gradient quality", "[data]") {
+  const Raz::Image rgbaImg = createGradientImage(16, 16, Raz::ImageColorspace::RGBA);
+  const Raz::Image grayImg = createGradientImage(16, 16, Raz::ImageColorspace::GRAY);
+  const Raz::Image rgImg   = createGradientImage(16, 16, Raz::ImageColorspace::GRAY_ALPHA);
+
+  CHECK(computeRootMeanSquaredError(rgbaImg, Raz::BlockCompression::decompress(Raz::BlockCompression::compress(rgbaImg, Raz::BlockCompressionFormat::BC1))) < 3.f);
+  CHECK(computeRootMeanSquaredError(rgbaImg, Raz::BlockCompression::decompress(Raz::BlockCompression::compress(rgbaImg, Raz::BlockCompressionFormat::BC3))) < 3.f);
+  CHECK(computeRootMeanSquaredError(rgbaImg, Raz::BlockCompression::decompress(Raz::BlockCompression::compress(rgbaImg, Raz::BlockCompressionFormat::BC7))) < 2.f);
+  CHECK(computeRootMeanSquaredError(grayImg, Raz::BlockCompression::decompress(Raz::BlockCompression::compress(grayImg, Raz::BlockCompressionFormat::BC4))) < 2.f);
+  CHECK(computeRootMeanSquaredError(rgImg, Raz::BlockCompression::decompress(Raz::BlockCompression::compress(rgImg, Raz::BlockCompressionFormat::BC5))) < 2.f);
+}
+
+TEST_CASE("BlockCompression mipmaps", "[data]") {
+  const Raz::Image img = createGradientImage(16, 6, Raz::ImageColorspace::SRGB);
+
+  const Raz::CompressedImage compressedImg = Raz::BlockCompression::compress(img, Raz::BlockCompressionFormat::BC7);
+  CHECK(compressedImg.getFormat() == Raz::BlockCompressionFormat::BC7);
+  CHECK(compressedImg.isSrgb());
+  REQUIRE(compressedImg.getLevelCount() == 5); // 16x6, 8x3, 4x1, 2x1 & 1x1
+
+  CHECK(compressedImg.getLevel(1).width == 8);
+  CHECK(compressedImg.getLevel(1).height == 3);
+  CHECK(compressedImg.getLevel(1).data.size() == 2 * 16); // Partial blocks are stored as full ones
+
+  CHECK(compressedImg.getLevel(4).width == 1);
+  CHECK(compressedImg.getLevel(4).height == 1);
+  CHECK(compressedImg.getLevel(4).data.size() == 16);
+
+  const Raz::Image lastLevel = Raz::BlockCompression::decompress(compressedImg, 4);
+  CHECK(lastLevel.getWidth() == 1);
+  CHECK(lastLevel.getHeight() == 1);
+  CHECK(lastLevel.getColorspace() == Raz::ImageColorspace::SRGBA);
+
+  CHECK_FALSE(Raz::BlockCompression::compress(img, Raz::BlockCompressionFormat::BC4).isSrgb()); // Single & dual channel formats are never sRGB
+  CHECK_THROWS(Raz::BlockCompression::decompress(compressedImg, 5));
+  CHECK_THROWS(Raz::BlockCompression::compress(Raz::Image(), Raz::BlockCompressionFormat::BC1));
+}
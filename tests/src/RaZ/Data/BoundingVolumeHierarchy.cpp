@@ -210,7 +210,7 @@ TEST_CASE("BoundingVolumeHierarchy query", "[data]") {
 
   CHECK(entity == &entity1);
   CHECK(hit.position == Raz::Vec3f(0.f, 0.f, 0.5f));
-  CHECK_THROWS(triangle1.contains(hit.position)); // TODO: wait for the triangle's point containment check to be available
+  CHECK(triangle1.contains(hit.position));
   CHECK(hit.normal == triangle1.computeNormal());
   CHECK(hit.distance == 1.f);
 
@@ -218,7 +218,7 @@ TEST_CASE("BoundingVolumeHierarchy query", "[data]") {
 
   CHECK(entity == &entity2);
   CHECK(hit.position == Raz::Vec3f(0.f, 0.5f, 0.f));
-  CHECK_THROWS(triangle2.contains(hit.position)); // TODO: wait for the triangle's point containment check to be available
+  CHECK(triangle2.contains(hit.position));
   CHECK(hit.normal == triangle2.computeNormal());
   CHECK(hit.distance == 1.f);
 
@@ -226,7 +226,7 @@ TEST_CASE("BoundingVolumeHierarchy query", "[data]") {
 
   CHECK(entity == &entity3);
   CHECK(hit.position == Raz::Vec3f(-2.f, 0.f, 0.f));
-  CHECK_THROWS(triangle3.contains(hit.position)); // TODO: wait for the triangle's point containment check to be available
+  CHECK(triangle3.contains(hit.position));
   CHECK(hit.normal == triangle3.computeNormal());
   CHECK(hit.distance == 1.f);
 
@@ -235,7 +235,7 @@ TEST_CASE("BoundingVolumeHierarchy query", "[data]") {
 
   CHECK(entity == &entity1);
   CHECK(hit.position == Raz::Vec3f(0.f, 0.f, 0.25f));
-  CHECK_THROWS(triangle1.contains(hit.position)); // TODO: wait for the triangle's point containment check to be available
+  CHECK(triangle1.contains(hit.position));
   CHECK(hit.normal == triangle1.computeNormal());
   CHECK(hit.distance == 1.414213538f);
 
@@ -244,7 +244,7 @@ TEST_CASE("BoundingVolumeHierarchy query", "[data]") {
 
   CHECK(entity == &entity2);
   CHECK(hit.position == Raz::Vec3f(0.f, 0.375f, 0.f));
-  CHECK_THROWS(triangle2.contains(hit.position)); // TODO: wait for the triangle's point containment check to be available
+  CHECK(triangle2.contains(hit.position));
   CHECK(hit.normal == triangle2.computeNormal());
   CHECK(hit.distance == 1.414213538f);
 
@@ -257,3 +257,49 @@ TEST_CASE("BoundingVolumeHierarchy query", "[data]") {
   CHECK(hit.normal == Raz::Vec3f(0.f));
   CHECK(hit.distance == std::numeric_limits<float>::max());
 }
+
+TEST_CASE("BoundingVolumeHierarchy closest query", "[data]") {
+  Raz::BoundingVolumeHierarchy bvh;
+  CHECK(bvh.queryClosest(Raz::Vec3f(0.f)) == nullptr); // The BVH is empty
+
+  const Raz::Triangle triangle1(Raz::Vec3f(-1.f, 0.f, 1.f), Raz::Vec3f(1.f, 0.f, 1.f), Raz::Vec3f(0.f, 0.f, -1.f));
+  const Raz::Triangle triangle2(Raz::Vec3f(3.f, -1.f, 0.f), Raz::Vec3f(5.f, -1.f, 0.f), Raz::Vec3f(4.f, 1.f, 0.f));
+
+  Raz::Entity entity1(0);
+  Raz::Entity entity2(1);
+
+  {
+    Raz::Submesh& submesh = entity1.addComponent<Raz::Mesh>().addSubmesh();
+    submesh.getVertices() = { { triangle1.getFirstPos() }, { triangle1.getSecondPos() }, { triangle1.getThirdPos() } };
+    submesh.getTriangleIndices() = { 0, 1, 2 };
+  }
+
+  {
+    Raz::Submesh& submesh = entity2.addComponent<Raz::Mesh>().addSubmesh();
+    submesh.getVertices() = { { triangle2.getFirstPos() }, { triangle2.getSecondPos() }, { triangle2.getThirdPos() } };
+    submesh.getTriangleIndices() = { 0, 1, 2 };
+  }
+
+  bvh.build({ &entity1, &entity2 });
+
+  Raz::RayHit hit;
+
+  CHECK(bvh.queryClosest(Raz::Vec3f(0.f, 2.f, 0.f), std::numeric_limits<float>::max(), &hit) == &entity1);
+  CHECK(hit.position == Raz::Vec3f(0.f));
+  CHECK(hit.normal == triangle1.computeNormal());
+  CHECK(hit.distance == 2.f);
+
+  // The closest point can be on a triangle's edge or vertex
+  CHECK(bvh.queryClosest(Raz::Vec3f(4.f, -3.f, 0.f), std::numeric_limits<float>::max(), &hit) == &entity2);
+  CHECK(hit.position == Raz::Vec3f(4.f, -1.f, 0.f));
+  CHECK(hit.distance == 2.f);
+
+  CHECK(bvh.queryClosest(Raz::Vec3f(4.f, 3.f, 0.f), std::numeric_limits<float>::max(), &hit) == &entity2);
+  CHECK(hit.position == triangle2.getThirdPos());
+  CHECK(hit.distance == 2.f);
+
+  // Triangles farther than the maximum distance are ignored
+  CHECK(bvh.queryClosest(Raz::Vec3f(4.f, 3.f, 0.f), 1.f) == nullptr);
+  CHECK(bvh.queryClosest(Raz::Vec3f(2.f, 0.f, 0.f), 0.5f) == nullptr);
+  CHECK(bvh.queryClosest(Raz::Vec3f(2.f, 0.f, 0.f), 1.5f) == &entity1);
+}
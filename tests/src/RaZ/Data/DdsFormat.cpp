@@ -0,0 +1,82 @@
+#include "RaZ/Data/BlockCompression.hpp"
+#include "RaZ/Data/DdsFormat.hpp"
+#include "RaZ/Data/Image.hpp"
+#include "RaZ/Math/Vector.hpp"
+#include "RaZ/Utils/FilePath.hpp"
+#include "RaZ/Utils/FileUtils.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <fstream>
+
+namespace {
+
+void writeModifiedHeader(const std::vector<unsigned char>& bytes, std::size_t fieldOffset, uint32_t value, std::size_t byteCount = 0) {
+  std::vector<unsigned char> modifiedBytes(bytes.cbegin(), (byteCount == 0 ? bytes.cend() : bytes.cbegin() + static_cast<std::ptrdiff_t>(byteCount)));
+
+  for (std::size_t byteIndex = 0; byteIndex < 4; ++byteIndex)
+    modifiedBytes[fieldOffset + byteIndex] = static_cast<unsigned char>(value >> (byteIndex * 8));
+
+  std::ofstream file("téstÊxpørt.dds", std::ios::binary);
+  file.write(reinterpret_cast<const char*>(modifiedBytes.data()), static_cast<std::streamsize>(modifiedBytes.size()));
+}
+
+} // namespace
+
+TEST_CASE("DdsFormat load/save", "[data]") {
+  Raz::Image img(12, 8, Raz::ImageColorspace::SRGBA);
+  for (unsigned int heightIndex = 0; heightIndex < img.getHeight(); ++heightIndex) {
+    for (unsigned int widthIndex = 0; widthIndex < img.getWidth(); ++widthIndex)
+      img.setPixel(widthIndex, heightIndex, Raz::Vec4b(static_cast<uint8_t>(widthIndex * 20), static_cast<uint8_t>(heightIndex * 30), 127, 255));
+  }
+
+  for (const Raz::BlockCompressionFormat format : { Raz::BlockCompressionFormat::BC1, Raz::BlockCompressionFormat::BC3,
+                                                    Raz::BlockCompressionFormat::BC4, Raz::BlockCompressionFormat::BC5,
+                                                    Raz::BlockCompressionFormat::BC7 }) {
+    const Raz::CompressedImage origImg = Raz::BlockCompression::compress(img, format);
+    Raz::DdsFormat::save("téstÊxpørt.dds", origImg);
+
+    const Raz::CompressedImage savedImg = Raz::DdsFormat::load("téstÊxpørt.dds");
+    CHECK(savedImg.getFormat() == origImg.getFormat());
+    CHECK(savedImg.isSrgb() == origImg.isSrgb());
+    CHECK(savedImg.getWidth() == 12);
+    CHECK(savedImg.getHeight() == 8);
+    REQUIRE(savedImg.getLevelCount() == origImg.getLevelCount());
+
+    for (std::size_t levelIndex = 0; levelIndex < savedImg.getLevelCount(); ++levelIndex) {
+      CHECK(savedImg.getLevel(levelIndex).width == origImg.getLevel(levelIndex).width);
+      CHECK(savedImg.getLevel(levelIndex).height == origImg.getLevel(levelIndex).height);
+      CHECK(savedImg.getLevel(levelIndex).data == origImg.getLevel(levelIndex).data);
+    }
+  }
+
+  CHECK_THROWS(Raz::DdsFormat::save("téstÊxpørt.dds", Raz::CompressedImage()));
+}
+
+TEST_CASE("DdsFormat load invalid", "[data]") {
+  Raz::Image img(12, 8, Raz::ImageColorspace::RGBA);
+  Raz::DdsFormat::save("téstÊxpørt.dds", Raz::BlockCompression::compress(img, Raz::BlockCompressionFormat::BC1));
+
+  const std::vector<unsigned char> bytes = Raz::FileUtils::readFileToArray("téstÊxpørt.dds");
+  constexpr std::size_t heightOffset   = 12;
+  constexpr std::size_t widthOffset    = 16;
+  constexpr std::size_t mipCountOffset = 28;
+
+  // A mipmap count exceeding what the dimensions allow is clamped; a 12x8 image has at most 4 levels (12x8, 6x4, 3x2 & 1x1)
+  writeModifiedHeader(bytes, mipCountOffset, 40);
+  const Raz::CompressedImage clampedImg = Raz::DdsFormat::load("téstÊxpørt.dds");
+  CHECK(clampedImg.getLevelCount() == 4);
+
+  writeModifiedHeader(bytes, widthOffset, 0);
+  CHECK_THROWS(Raz::DdsFormat::load("téstÊxpørt.dds"));
+
+  writeModifiedHeader(bytes, heightOffset, 0);
+  CHECK_THROWS(Raz::DdsFormat::load("téstÊxpørt.dds"));
+
+  // Dimensions requiring more data than available are rejected, even if the level's size would overflow
+  writeModifiedHeader(bytes, widthOffset, 0xFFFFFFFF);
+  CHECK_THROWS(Raz::DdsFormat::load("téstÊxpørt.dds"));
+
+  writeModifiedHeader(bytes, mipCountOffset, 1, 128 + 8); // Header & a single block, while 12x8 requires 6 of them
+  CHECK_THROWS(Raz::DdsFormat::load("téstÊxpørt.dds"));
+}
@@ -173,3 +173,33 @@ TEST_CASE("Image copy/move", "[data]") {
   CHECK(imgCopy.isEmpty());
   CHECK(imgMove != imgCopy);
 }
+
+TEST_CASE("Image external data", "[data]") {
+  bool isReleased = false;
+
+  {
+    auto* externalData = new float[6] { 0.f, 1.f, 2.f, 3.f, 4.f, 5.f };
+    Raz::ImageDataFPtr imgData = Raz::ImageDataF::create(externalData, 6, [&isReleased] (float* ptr) noexcept {
+      delete[] ptr;
+      isReleased = true;
+    });
+    CHECK(imgData->getSize() == 6);
+
+    Raz::Image img(3, 1, Raz::ImageColorspace::GRAY_ALPHA, std::move(imgData));
+    CHECK(img.getDataType() == Raz::ImageDataType::FLOAT);
+    CHECK(img.getChannelCount() == 2);
+    CHECK(img.getDataPtr() == externalData); // The memory has been adopted, not copied
+    CHECK(img.recoverPixel<float, 2>(1, 0) == Raz::Vec2f(2.f, 3.f));
+
+    const Raz::Image imgCopy(img); // A copy allocates its own memory
+    CHECK(imgCopy.getDataPtr() != externalData);
+    CHECK(imgCopy == img);
+
+    CHECK_FALSE(isReleased);
+  }
+
+  CHECK(isReleased);
+
+  CHECK_THROWS(Raz::Image(2, 2, Raz::ImageColorspace::RGB, nullptr));
+  CHECK_THROWS(Raz::Image(2, 2, Raz::ImageColorspace::RGB, Raz::ImageDataB::create(4)));
+}
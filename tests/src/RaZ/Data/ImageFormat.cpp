@@ -89,6 +89,10 @@ void checkImageLoad(const Raz::FilePath& filePath, uint8_t expectedChannelCount,
                  expectedChannelCount,
                  expectedColorspace,
                  { expectedValues[2], expectedValues[3], expectedValues[0], expectedValues[1] });
+  checkImageData(Raz::ImageFormat::loadFromData(std::span<const unsigned char>(fileContent)),
+                 expectedChannelCount,
+                 expectedColorspace,
+                 expectedValues);
 }
 
 void checkImageSave(const Raz::FilePath& filePath,
@@ -72,3 +72,171 @@ TEST_CASE("ImageUtils equirectangular to cubemap", "[data]") {
     }
   }
 }
+
+TEST_CASE("ImageUtils resize", "[data]") {
+  SECTION("Box downscale") {
+    Raz::Image img(4, 2, Raz::ImageColorspace::GRAY);
+    for (unsigned int heightIndex = 0; heightIndex < img.getHeight(); ++heightIndex) {
+      for (unsigned int widthIndex = 0; widthIndex < img.getWidth(); ++widthIndex)
+        img.setPixel(widthIndex, heightIndex, static_cast<uint8_t>(widthIndex * 10 + heightIndex * 100));
+    }
+
+    const Raz::Image resizedImg = Raz::ImageUtils::resize(img, 2, 1, Raz::ImageUtils::ResizeFilter::BOX);
+    REQUIRE(resizedImg.getWidth() == 2);
+    REQUIRE(resizedImg.getHeight() == 1);
+    CHECK(resizedImg.getColorspace() == Raz::ImageColorspace::GRAY);
+    CHECK(resizedImg.recoverPixel<uint8_t>(0, 0) == 55);  // (0 + 10 + 100 + 110) / 4
+    CHECK(resizedImg.recoverPixel<uint8_t>(1, 0) == 75);  // (20 + 30 + 120 + 130) / 4
+  }
+
+  SECTION("Constant image") {
+    Raz::Image img(17, 9, Raz::ImageColorspace::RGBA, Raz::ImageDataType::FLOAT);
+    for (unsigned int heightIndex = 0; heightIndex < img.getHeight(); ++heightIndex) {
+      for (unsigned int widthIndex = 0; widthIndex < img.getWidth(); ++widthIndex)
+        img.setPixel(widthIndex, heightIndex, Raz::Vec4f(0.25f, 0.5f, 0.75f, 1.f));
+    }
+
+    // Every filter's weights are normalized, so that a constant image must remain constant whatever the new dimensions
+    for (const Raz::ImageUtils::ResizeFilter filter : { Raz::ImageUtils::ResizeFilter::BOX,
+                                                        Raz::ImageUtils::ResizeFilter::BILINEAR,
+                                                        Raz::ImageUtils::ResizeFilter::LANCZOS }) {
+      for (const Raz::Vec2u& size : { Raz::Vec2u(5, 3), Raz::Vec2u(40, 31) }) {
+        const Raz::Image resizedImg = Raz::ImageUtils::resize(img, size.x(), size.y(), filter);
+        REQUIRE(resizedImg.getWidth() == size.x());
+        REQUIRE(resizedImg.getHeight() == size.y());
+
+        for (unsigned int heightIndex = 0; heightIndex < resizedImg.getHeight(); ++heightIndex) {
+          for (unsigned int widthIndex = 0; widthIndex < resizedImg.getWidth(); ++widthIndex) {
+            const Raz::Vec4f resizedPixel = resizedImg.recoverPixel<float, 4>(widthIndex, heightIndex);
+            CHECK_THAT(resizedPixel, IsNearlyEqualToVector(Raz::Vec4f(0.25f, 0.5f, 0.75f, 1.f), 0.000001f));
+          }
+        }
+      }
+    }
+  }
+
+  SECTION("Bilinear upscale") {
+    Raz::Image img(2, 1, Raz::ImageColorspace::GRAY, Raz::ImageDataType::FLOAT);
+    img.setPixel(0, 0, 0.f);
+    img.setPixel(1, 0, 1.f);
+
+    const Raz::Image resizedImg = Raz::ImageUtils::resize(img, 4, 1, Raz::ImageUtils::ResizeFilter::BILINEAR);
+    CHECK(resizedImg.recoverPixel<float>(0, 0) == 0.f);
+    CHECK(resizedImg.recoverPixel<float>(1, 0) == 0.25f);
+    CHECK(resizedImg.recoverPixel<float>(2, 0) == 0.75f);
+    CHECK(resizedImg.recoverPixel<float>(3, 0) == 1.f);
+  }
+
+  CHECK_THROWS(Raz::ImageUtils::resize(Raz::Image(), 1, 1));
+  CHECK_THROWS(Raz::ImageUtils::resize(Raz::Image(1, 1, Raz::ImageColorspace::GRAY), 0, 1));
+}
+
+TEST_CASE("ImageUtils mipmaps", "[data]") {
+  Raz::Image img(16, 4, Raz::ImageColorspace::RGB);
+  for (unsigned int heightIndex = 0; heightIndex < img.getHeight(); ++heightIndex) {
+    for (unsigned int widthIndex = 0; widthIndex < img.getWidth(); ++widthIndex)
+      img.setPixel(widthIndex, heightIndex, Raz::Vec3b(static_cast<uint8_t>(widthIndex % 2 == 0 ? 0 : 200), 100, 50));
+  }
+
+  const std::vector<Raz::Image> mipmaps = Raz::ImageUtils::generateMipmaps(img);
+  REQUIRE(mipmaps.size() == 4);
+
+  CHECK(mipmaps[0].getWidth() == 8);
+  CHECK(mipmaps[0].getHeight() == 2);
+  CHECK(mipmaps[1].getWidth() == 4);
+  CHECK(mipmaps[1].getHeight() == 1);
+  CHECK(mipmaps[2].getWidth() == 2);
+  CHECK(mipmaps[2].getHeight() == 1);
+  CHECK(mipmaps[3].getWidth() == 1);
+  CHECK(mipmaps[3].getHeight() == 1);
+
+  for (const Raz::Image& mipmap : mipmaps) {
+    CHECK(mipmap.getColorspace() == Raz::ImageColorspace::RGB);
+    CHECK(mipmap.recoverPixel<uint8_t, 3>(0, 0) == Raz::Vec3b(100, 100, 50));
+  }
+}
+
+TEST_CASE("ImageUtils colorspace conversions", "[data]") {
+  Raz::Image srgbImg(2, 1, Raz::ImageColorspace::SRGBA);
+  srgbImg.setPixel(0, 0, Raz::Vec4b(0, 128, 255, 128));
+  srgbImg.setPixel(1, 0, Raz::Vec4b(10, 50, 200, 255));
+
+  const Raz::Image linearImg = Raz::ImageUtils::convertSrgbToLinear(srgbImg);
+  CHECK(linearImg.getColorspace() == Raz::ImageColorspace::RGBA);
+  CHECK(linearImg.getDataType() == Raz::ImageDataType::FLOAT);
+  const Raz::Vec4f firstLinearPixel  = linearImg.recoverPixel<float, 4>(0, 0);
+  const Raz::Vec4f secondLinearPixel = linearImg.recoverPixel<float, 4>(1, 0);
+  CHECK_THAT(firstLinearPixel, IsNearlyEqualToVector(Raz::Vec4f(0.f, 0.2158605f, 1.f, 0.5019608f)));
+  CHECK_THAT(secondLinearPixel, IsNearlyEqualToVector(Raz::Vec4f(0.0030353f, 0.0318960f, 0.5775804f, 1.f)));
+
+  const Raz::Image convertedSrgbImg = Raz::ImageUtils::convertLinearToSrgb(linearImg);
+  CHECK(convertedSrgbImg == srgbImg);
+
+  // Float sRGB images are converted from their own values, not reinterpreted as bytes
+  Raz::Image floatSrgbImg(2, 1, Raz::ImageColorspace::SRGBA, Raz::ImageDataType::FLOAT);
+  floatSrgbImg.setPixel(0, 0, Raz::Vec4f(0.f, 128.f / 255.f, 1.f, 0.5f));
+  floatSrgbImg.setPixel(1, 0, Raz::Vec4f(10.f / 255.f, 50.f / 255.f, 200.f / 255.f, 1.f));
+
+  const Raz::Image floatLinearImg = Raz::ImageUtils::convertSrgbToLinear(floatSrgbImg);
+  CHECK(floatLinearImg.getColorspace() == Raz::ImageColorspace::RGBA);
+  CHECK(floatLinearImg.getDataType() == Raz::ImageDataType::FLOAT);
+  const Raz::Vec4f firstFloatLinearPixel  = floatLinearImg.recoverPixel<float, 4>(0, 0);
+  const Raz::Vec4f secondFloatLinearPixel = floatLinearImg.recoverPixel<float, 4>(1, 0);
+  CHECK_THAT(firstFloatLinearPixel, IsNearlyEqualToVector(Raz::Vec4f(0.f, 0.2158605f, 1.f, 0.5f)));
+  CHECK_THAT(secondFloatLinearPixel, IsNearlyEqualToVector(secondLinearPixel));
+
+  CHECK_THROWS(Raz::ImageUtils::convertSrgbToLinear(linearImg));
+  CHECK_THROWS(Raz::ImageUtils::convertLinearToSrgb(srgbImg));
+
+  const Raz::Image srgbImgNoAlpha = Raz::ImageUtils::convertRgbaToRgb(srgbImg);
+  CHECK(srgbImgNoAlpha.getColorspace() == Raz::ImageColorspace::SRGB);
+  CHECK(srgbImgNoAlpha.recoverPixel<uint8_t, 3>(0, 0) == Raz::Vec3b(0, 128, 255));
+  CHECK(srgbImgNoAlpha.recoverPixel<uint8_t, 3>(1, 0) == Raz::Vec3b(10, 50, 200));
+
+  const Raz::Image srgbImgAlpha = Raz::ImageUtils::convertRgbToRgba(srgbImgNoAlpha, 0.5f);
+  CHECK(srgbImgAlpha.getColorspace() == Raz::ImageColorspace::SRGBA);
+  CHECK(srgbImgAlpha.recoverPixel<uint8_t, 4>(0, 0) == Raz::Vec4b(0, 128, 255, 128));
+  CHECK(srgbImgAlpha.recoverPixel<uint8_t, 4>(1, 0) == Raz::Vec4b(10, 50, 200, 128));
+
+  CHECK_THROWS(Raz::ImageUtils::convertRgbToRgba(srgbImg));
+  CHECK_THROWS(Raz::ImageUtils::convertRgbaToRgb(srgbImgNoAlpha));
+}
+
+TEST_CASE("ImageUtils in-place operations", "[data]") {
+  Raz::Image img(3, 2, Raz::ImageColorspace::RGBA);
+  for (unsigned int heightIndex = 0; heightIndex < img.getHeight(); ++heightIndex) {
+    for (unsigned int widthIndex = 0; widthIndex < img.getWidth(); ++widthIndex)
+      img.setPixel(widthIndex, heightIndex, Raz::Vec4b(static_cast<uint8_t>(widthIndex), static_cast<uint8_t>(heightIndex), 200, 128));
+  }
+
+  SECTION("Swizzle") {
+    Raz::ImageUtils::swizzleChannels(img, { 2, 1, 0, 3 });
+    CHECK(img.recoverPixel<uint8_t, 4>(1, 0) == Raz::Vec4b(200, 0, 1, 128));
+    CHECK(img.recoverPixel<uint8_t, 4>(2, 1) == Raz::Vec4b(200, 1, 2, 128));
+
+    Raz::Image grayImg(1, 1, Raz::ImageColorspace::GRAY);
+    CHECK_THROWS(Raz::ImageUtils::swizzleChannels(grayImg, { 1, 0, 0, 0 }));
+  }
+
+  SECTION("Flip") {
+    Raz::ImageUtils::flipHorizontally(img);
+    CHECK(img.recoverPixel<uint8_t, 4>(0, 0) == Raz::Vec4b(2, 0, 200, 128));
+    CHECK(img.recoverPixel<uint8_t, 4>(1, 0) == Raz::Vec4b(1, 0, 200, 128));
+    CHECK(img.recoverPixel<uint8_t, 4>(2, 1) == Raz::Vec4b(0, 1, 200, 128));
+
+    Raz::ImageUtils::flipVertically(img);
+    CHECK(img.recoverPixel<uint8_t, 4>(0, 0) == Raz::Vec4b(2, 1, 200, 128));
+    CHECK(img.recoverPixel<uint8_t, 4>(2, 1) == Raz::Vec4b(0, 0, 200, 128));
+  }
+
+  SECTION("Premultiplied alpha") {
+    Raz::ImageUtils::premultiplyAlpha(img);
+    CHECK(img.recoverPixel<uint8_t, 4>(2, 1) == Raz::Vec4b(1, 1, 100, 128));
+
+    Raz::ImageUtils::unpremultiplyAlpha(img);
+    CHECK(img.recoverPixel<uint8_t, 4>(2, 1) == Raz::Vec4b(2, 2, 199, 128));
+
+    Raz::Image rgbImg(1, 1, Raz::ImageColorspace::RGB);
+    CHECK_THROWS(Raz::ImageUtils::premultiplyAlpha(rgbImg));
+  }
+}
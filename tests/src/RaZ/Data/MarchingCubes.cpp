@@ -1,13 +1,46 @@
 #include "RaZ/Data/Grid3.hpp"
 #include "RaZ/Data/MarchingCubes.hpp"
 #include "RaZ/Data/Mesh.hpp"
+#include "RaZ/Data/SparseGrid3.hpp"
 
 #include "CatchCustomMatchers.hpp"
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
+#include <map>
 #include <numeric>
 
+namespace {
+
+template <typename GridT>
+void fillSphere(GridT& grid, const Raz::Vec3f& center, float radius) {
+  for (std::size_t depthIndex = 0; depthIndex < grid.getDepth(); ++depthIndex) {
+    for (std::size_t heightIndex = 0; heightIndex < grid.getHeight(); ++heightIndex) {
+      for (std::size_t widthIndex = 0; widthIndex < grid.getWidth(); ++widthIndex) {
+        const Raz::Vec3f point(static_cast<float>(widthIndex), static_cast<float>(heightIndex), static_cast<float>(depthIndex));
+        if ((point - center).computeLength() <= radius)
+          grid.setValue(widthIndex, heightIndex, depthIndex, true);
+      }
+    }
+  }
+}
+
+// Recovers the positions of all triangles' vertices, sorted so that meshes can be compared regardless of their triangles' order
+std::vector<std::array<float, 3>> recoverSortedPositions(const Raz::Submesh& submesh) {
+  std::vector<std::array<float, 3>> positions;
+
+  for (const unsigned int index : submesh.getTriangleIndices()) {
+    const Raz::Vec3f& position = submesh.getVertices()[index].position;
+    positions.push_back({ position.x(), position.y(), position.z() });
+  }
+
+  std::sort(positions.begin(), positions.end());
+  return positions;
+}
+
+} // namespace
+
 TEST_CASE("MarchingCubes computation", "[data]") {
   // Grids smaller than 2x2x2 are not allowed
   CHECK_THROWS(Raz::MarchingCubes::compute(Raz::Grid3b(1, 1, 1)));
@@ -262,3 +295,136 @@ TEST_CASE("MarchingCubes computation", "[data]") {
     CHECK(indices == expectedIndices);
   }
 }
+
+TEST_CASE("MarchingCubes scalar computation", "[data]") {
+  CHECK_THROWS(Raz::MarchingCubes::compute(Raz::Grid3f(1, 1, 1), 0.f));
+  CHECK_THROWS(Raz::MarchingCubes::compute(Raz::Grid3f(2, 2, 1), 0.f));
+
+  CHECK(Raz::MarchingCubes::compute(Raz::Grid3f(3, 3, 3, -1.f), 0.f).getSubmeshes().front().getVertexCount() == 0);
+  CHECK(Raz::MarchingCubes::compute(Raz::Grid3f(3, 3, 3, 1.f), 0.f).getSubmeshes().front().getVertexCount() == 0);
+
+  // Creating the signed distance field of a sphere; the mesh being centered, the sphere is expected to be around the origin
+  constexpr float radius = 6.f;
+  Raz::Grid3f grid(20, 20, 20);
+
+  for (std::size_t depthIndex = 0; depthIndex < grid.getDepth(); ++depthIndex) {
+    for (std::size_t heightIndex = 0; heightIndex < grid.getHeight(); ++heightIndex) {
+      for (std::size_t widthIndex = 0; widthIndex < grid.getWidth(); ++widthIndex) {
+        const Raz::Vec3f point(static_cast<float>(widthIndex) - 9.5f, static_cast<float>(heightIndex) - 9.5f, static_cast<float>(depthIndex) - 9.5f);
+        grid.setValue(widthIndex, heightIndex, depthIndex, point.computeLength() - radius);
+      }
+    }
+  }
+
+  const Raz::Mesh mesh = Raz::MarchingCubes::compute(grid, 0.f);
+  const Raz::Submesh& submesh = mesh.getSubmeshes().front();
+  REQUIRE(submesh.getTriangleIndexCount() > 0);
+  CHECK(submesh.getTriangleIndexCount() % 3 == 0);
+
+  // Vertices are shared between triangles; on a closed surface, each vertex is used by several of them
+  CHECK(submesh.getVertexCount() * 3 < submesh.getTriangleIndexCount());
+
+  for (const Raz::Vertex& vertex : submesh.getVertices()) {
+    // Interpolated positions lie almost exactly on the sphere, & gradient normals point outward
+    CHECK_THAT(vertex.position.computeLength(), IsNearlyEqualTo(radius, 0.05f));
+    CHECK_THAT(vertex.normal.computeLength(), IsNearlyEqualTo(1.f));
+    CHECK(vertex.normal.dot(vertex.position.normalize()) > 0.99f);
+  }
+
+  const std::vector<unsigned int>& indices = submesh.getTriangleIndices();
+  std::map<std::pair<unsigned int, unsigned int>, std::size_t> edgeCounts;
+
+  for (std::size_t triangleIndex = 0; triangleIndex < indices.size(); triangleIndex += 3) {
+    const Raz::Vertex& firstVert  = submesh.getVertices()[indices[triangleIndex]];
+    const Raz::Vertex& secondVert = submesh.getVertices()[indices[triangleIndex + 1]];
+    const Raz::Vertex& thirdVert  = submesh.getVertices()[indices[triangleIndex + 2]];
+
+    // The triangles' winding matches the normals' direction
+    const Raz::Vec3f faceNormal = (secondVert.position - firstVert.position).cross(thirdVert.position - firstVert.position);
+    CHECK(faceNormal.dot(firstVert.normal + secondVert.normal + thirdVert.normal) > 0.f);
+
+    for (std::size_t i = 0; i < 3; ++i) {
+      const unsigned int firstIndex  = indices[triangleIndex + i];
+      const unsigned int secondIndex = indices[triangleIndex + (i + 1) % 3];
+      ++edgeCounts[std::minmax(firstIndex, secondIndex)];
+    }
+  }
+
+  // The surface is closed & has no duplicated vertex, including across the slabs computed in parallel: each edge is shared by exactly 2 triangles
+  CHECK(std::all_of(edgeCounts.cbegin(), edgeCounts.cend(), [] (const auto& edgeCount) { return (edgeCount.second == 2); }));
+}
+
+TEST_CASE("MarchingCubes sparse computation", "[data]") {
+  CHECK_THROWS(Raz::MarchingCubes::compute(Raz::SparseGrid3b(1, 2, 2)));
+  CHECK(Raz::MarchingCubes::compute(Raz::SparseGrid3b(8, 8, 8, false, 4)).getSubmeshes().front().getVertexCount() == 0);
+  CHECK(Raz::MarchingCubes::compute(Raz::SparseGrid3b(8, 8, 8, true, 4)).getSubmeshes().front().getVertexCount() == 0);
+
+  // The sphere crosses several chunk borders
+  Raz::Grid3b denseGrid(18, 17, 16);
+  Raz::SparseGrid3b sparseGrid(18, 17, 16, false, 4);
+  fillSphere(denseGrid, Raz::Vec3f(8.5f, 7.f, 8.f), 5.5f);
+  fillSphere(sparseGrid, Raz::Vec3f(8.5f, 7.f, 8.f), 5.5f);
+
+  const Raz::Mesh denseMesh  = Raz::MarchingCubes::compute(denseGrid);
+  const Raz::Mesh sparseMesh = Raz::MarchingCubes::compute(sparseGrid);
+  const Raz::Submesh& denseSubmesh  = denseMesh.getSubmeshes().front();
+  const Raz::Submesh& sparseSubmesh = sparseMesh.getSubmeshes().front();
+
+  // Both meshes have the same triangles, but the sparse one's vertices are shared
+  CHECK(sparseSubmesh.getTriangleIndexCount() == denseSubmesh.getTriangleIndexCount());
+  CHECK(sparseSubmesh.getVertexCount() < denseSubmesh.getVertexCount() / 3);
+  CHECK(recoverSortedPositions(sparseSubmesh) == recoverSortedPositions(denseSubmesh));
+
+  // The sphere being closed, each edge is shared by exactly two triangles if the vertices are properly welded across chunks
+  std::map<std::pair<unsigned int, unsigned int>, std::size_t> edgeCounts;
+  const std::vector<unsigned int>& indices = sparseSubmesh.getTriangleIndices();
+
+  for (std::size_t i = 0; i < indices.size(); i += 3) {
+    for (std::size_t edgeIndex = 0; edgeIndex < 3; ++edgeIndex) {
+      const unsigned int firstIndex  = indices[i + edgeIndex];
+      const unsigned int secondIndex = indices[i + (edgeIndex + 1) % 3];
+      ++edgeCounts[std::minmax(firstIndex, secondIndex)];
+    }
+  }
+
+  CHECK(std::all_of(edgeCounts.cbegin(), edgeCounts.cend(), [] (const auto& edgeCount) { return edgeCount.second == 2; }));
+
+  for (const Raz::Vertex& vertex : sparseSubmesh.getVertices())
+    CHECK_THAT(vertex.normal.computeLength(), IsNearlyEqualTo(1.f));
+}
+
+TEST_CASE("MarchingCubes incremental meshing", "[data]") {
+  Raz::SparseGrid3b grid(40, 40, 40, false, 8);
+  fillSphere(grid, Raz::Vec3f(12.f), 6.f);
+
+  Raz::MarchingCubes::IncrementalMesher mesher;
+  CHECK(mesher.update(grid) > 0);
+  CHECK(grid.getDirtyChunks().empty());
+  CHECK(mesher.getMeshedChunkCount() > 0);
+
+  const std::size_t initialChunkCount = mesher.getMeshedChunkCount();
+
+  {
+    const Raz::Mesh incrementalMesh = mesher.buildMesh();
+    CHECK(recoverSortedPositions(incrementalMesh.getSubmeshes().front()) == recoverSortedPositions(Raz::MarchingCubes::compute(grid).getSubmeshes().front()));
+  }
+
+  // Nothing changed, nothing is remeshed
+  CHECK(mesher.update(grid) == 0);
+
+  // Adding a single point in the middle of a chunk only remeshes this chunk & its 7 lower neighbors
+  grid.setValue(30, 30, 30, true);
+  CHECK(mesher.update(grid) == 8);
+  CHECK(mesher.getMeshedChunkCount() == initialChunkCount + 1);
+
+  {
+    const Raz::Mesh incrementalMesh = mesher.buildMesh();
+    CHECK(incrementalMesh.getSubmeshes().front().getTriangleIndexCount() == Raz::MarchingCubes::compute(grid).getSubmeshes().front().getTriangleIndexCount());
+    CHECK(recoverSortedPositions(incrementalMesh.getSubmeshes().front()) == recoverSortedPositions(Raz::MarchingCubes::compute(grid).getSubmeshes().front()));
+  }
+
+  // Removing the point's chunk makes its mesh disappear
+  grid.removeChunk(grid.computeChunkIndex(30, 30, 30));
+  mesher.update(grid);
+  CHECK(mesher.getMeshedChunkCount() == initialChunkCount);
+}
@@ -3,6 +3,7 @@
 #include "RaZ/Data/Image.hpp"
 #include "RaZ/Data/Mesh.hpp"
 #include "RaZ/Data/MeshDistanceField.hpp"
+#include "RaZ/Data/SparseGrid3.hpp"
 
 #include "CatchCustomMatchers.hpp"
 
@@ -136,6 +137,105 @@ TEST_CASE("MeshDistanceField computation", "[data]") {
   CHECK_THAT(mdf.getValue(4, 4, 6), IsNearlyEqualTo(-0.503709972f));
 }
 
+TEST_CASE("MeshDistanceField exact computation", "[data]") {
+  const Raz::AABB fieldBox(Raz::Vec3f(-1.f), Raz::Vec3f(1.f));
+
+  Raz::MeshDistanceField mdf(fieldBox, 9, 9, 9);
+  CHECK_THROWS(mdf.computeExact()); // No BVH set
+
+  Raz::BoundingVolumeHierarchy bvh;
+  mdf.setBvh(bvh);
+  CHECK_THROWS(mdf.computeExact(0)); // The narrow band can't be empty
+
+  mdf.computeExact(); // The BVH is empty, nothing will be computed
+  CHECK(mdf.getValue(0, 0, 0) == std::numeric_limits<float>::max());
+  CHECK(mdf.getValue(4, 4, 4) == std::numeric_limits<float>::max());
+
+  Raz::Entity mesh(0);
+  mesh.addComponent<Raz::Mesh>(Raz::AABB(fieldBox.getMinPosition() * 0.5f, fieldBox.getMaxPosition() * 0.5f));
+  bvh.build({ &mesh });
+
+  // The narrow band only covers the points within a single cell of the surface
+  mdf.computeExact(1, false);
+  CHECK(mdf.getValue(0, 0, 0) == std::numeric_limits<float>::max());
+  CHECK(mdf.getValue(4, 4, 0) == std::numeric_limits<float>::max());
+  CHECK_THAT(mdf.getValue(4, 4, 1), IsNearlyEqualTo(0.25f));
+  CHECK_THAT(mdf.getValue(2, 4, 4), IsNearlyEqualTo(0.f));
+  CHECK_THAT(mdf.getValue(3, 3, 3), IsNearlyEqualTo(-0.25f));
+  CHECK(mdf.getValue(4, 4, 4) == -std::numeric_limits<float>::max()); // The center is known to be inside, but too far to have been computed
+
+  // Propagating beyond the narrow band gives the exact distances everywhere
+  mdf.computeExact(1);
+  // Corners
+  CHECK_THAT(mdf.getValue(0, 0, 0), IsNearlyEqualTo(0.866025403f));
+  CHECK_THAT(mdf.getValue(8, 8, 8), IsNearlyEqualTo(0.866025403f));
+  // Edges
+  CHECK_THAT(mdf.getValue(4, 0, 0), IsNearlyEqualTo(0.707106781f));
+  CHECK_THAT(mdf.getValue(8, 4, 8), IsNearlyEqualTo(0.707106781f));
+  // Faces
+  CHECK_THAT(mdf.getValue(4, 4, 0), IsNearlyEqualTo(0.5f));
+  CHECK_THAT(mdf.getValue(8, 4, 4), IsNearlyEqualTo(0.5f));
+  // Inside
+  CHECK_THAT(mdf.getValue(3, 3, 3), IsNearlyEqualTo(-0.25f));
+  CHECK_THAT(mdf.getValue(5, 4, 3), IsNearlyEqualTo(-0.25f));
+  CHECK_THAT(mdf.getValue(4, 4, 4), IsNearlyEqualTo(-0.5f));
+  // On the surface
+  CHECK_THAT(mdf.getValue(2, 2, 2), IsNearlyEqualTo(0.f));
+  CHECK_THAT(mdf.getValue(6, 4, 4), IsNearlyEqualTo(0.f));
+
+  // Only the values close to the surface are stored in the sparse grid, the others being clamped
+  const Raz::SparseGrid3f narrowBand = mdf.recoverNarrowBand(0.3f, 4);
+  CHECK(narrowBand.getDefaultValue() == 0.3f);
+  CHECK(narrowBand.getAllocatedChunkCount() == 8);
+  CHECK(narrowBand.getDirtyChunks().empty());
+  CHECK(narrowBand.getValue(0, 0, 0) == 0.3f);
+  CHECK_THAT(narrowBand.getValue(4, 4, 1), IsNearlyEqualTo(0.25f));
+  CHECK_THAT(narrowBand.getValue(3, 3, 3), IsNearlyEqualTo(-0.25f));
+  CHECK(narrowBand.getValue(4, 4, 4) == -0.3f);
+}
+
+TEST_CASE("MeshDistanceField exact computation precision", "[data]") {
+  Raz::Entity entity(0);
+  const Raz::Mesh& mesh = entity.addComponent<Raz::Mesh>(Raz::Sphere(Raz::Vec3f(0.1f, -0.05f, 0.f), 0.7f), 2, Raz::SphereMeshType::ICO);
+
+  Raz::BoundingVolumeHierarchy bvh;
+  bvh.build({ &entity });
+
+  Raz::MeshDistanceField mdf(Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f)), 17, 17, 17);
+  mdf.setBvh(bvh);
+  mdf.computeExact();
+
+  // Comparing against the distances to all triangles; inside the sphere, the distances must be negative
+  const Raz::Submesh& submesh = mesh.getSubmeshes().front();
+
+  for (std::size_t depthIndex = 0; depthIndex < 17; ++depthIndex) {
+    for (std::size_t heightIndex = 0; heightIndex < 17; ++heightIndex) {
+      for (std::size_t widthIndex = 0; widthIndex < 17; ++widthIndex) {
+        const Raz::Vec3f point(-1.f + static_cast<float>(widthIndex) * 0.125f,
+                               -1.f + static_cast<float>(heightIndex) * 0.125f,
+                               -1.f + static_cast<float>(depthIndex) * 0.125f);
+        float expectedDistance = std::numeric_limits<float>::max();
+
+        for (std::size_t i = 0; i < submesh.getTriangleIndexCount(); i += 3) {
+          const Raz::Triangle triangle(submesh.getVertices()[submesh.getTriangleIndices()[i]].position,
+                                       submesh.getVertices()[submesh.getTriangleIndices()[i + 1]].position,
+                                       submesh.getVertices()[submesh.getTriangleIndices()[i + 2]].position);
+          expectedDistance = std::min(expectedDistance, (triangle.computeProjection(point) - point).computeLength());
+        }
+
+        const float distance = mdf.getValue(widthIndex, heightIndex, depthIndex);
+        CHECK_THAT(std::abs(distance), IsNearlyEqualTo(expectedDistance, 0.01f));
+
+        // The mesh being a rough approximation of the sphere, the points too close to its surface may be on either side
+        const float sphereDistance = (point - Raz::Vec3f(0.1f, -0.05f, 0.f)).computeLength() - 0.7f;
+
+        if (std::abs(sphereDistance) > 0.15f)
+          CHECK((sphereDistance < 0.f) == (distance < 0.f));
+      }
+    }
+  }
+}
+
 TEST_CASE("MeshDistanceField slices", "[data]") {
   // Creating a distance field with a single triangle inside
   //
@@ -0,0 +1,79 @@
+#include "RaZ/Data/Grid2.hpp"
+#include "RaZ/Data/Grid3.hpp"
+#include "RaZ/Data/Image.hpp"
+#include "RaZ/Data/NoiseField.hpp"
+#include "RaZ/Math/PerlinNoise.hpp"
+#include "RaZ/Math/SimplexNoise.hpp"
+
+#include "CatchCustomMatchers.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+
+TEST_CASE("NoiseField grid filling", "[data]") {
+  const Raz::NoiseSettings settings{ .frequency = 0.1f, .octaveCount = 3, .seed = 7 };
+
+  Raz::Grid2f grid2(13, 9);
+  Raz::NoiseField::fill(grid2, Raz::NoiseType::PERLIN, settings, Raz::Vec2f(-4.f, 2.5f));
+
+  for (std::size_t heightIndex = 0; heightIndex < grid2.getHeight(); ++heightIndex) {
+    for (std::size_t widthIndex = 0; widthIndex < grid2.getWidth(); ++widthIndex) {
+      const Raz::Vec2f point(static_cast<float>(widthIndex) - 4.f, static_cast<float>(heightIndex) + 2.5f);
+      float expectedValue {};
+      Raz::PerlinNoise::compute2D({ &point, 1 }, { &expectedValue, 1 }, settings);
+
+      CHECK(grid2.getValue(widthIndex, heightIndex) == expectedValue);
+    }
+  }
+
+  Raz::Grid3f grid3(5, 6, 7);
+  Raz::NoiseField::fill(grid3, Raz::NoiseType::SIMPLEX, settings);
+
+  for (std::size_t depthIndex = 0; depthIndex < grid3.getDepth(); ++depthIndex) {
+    for (std::size_t heightIndex = 0; heightIndex < grid3.getHeight(); ++heightIndex) {
+      for (std::size_t widthIndex = 0; widthIndex < grid3.getWidth(); ++widthIndex) {
+        const Raz::Vec3f point(static_cast<float>(widthIndex), static_cast<float>(heightIndex), static_cast<float>(depthIndex));
+        float expectedValue {};
+        Raz::SimplexNoise::compute3D({ &point, 1 }, { &expectedValue, 1 }, settings);
+
+        CHECK(grid3.getValue(widthIndex, heightIndex, depthIndex) == expectedValue);
+      }
+    }
+  }
+
+  // Filling adjacent regions gives seamless values
+  Raz::Grid2f leftGrid(8, 8);
+  Raz::Grid2f rightGrid(8, 8);
+  Raz::NoiseField::fill(leftGrid, Raz::NoiseType::SIMPLEX, settings);
+  Raz::NoiseField::fill(rightGrid, Raz::NoiseType::SIMPLEX, settings, Raz::Vec2f(7.f, 0.f));
+
+  for (std::size_t heightIndex = 0; heightIndex < 8; ++heightIndex)
+    CHECK(leftGrid.getValue(7, heightIndex) == rightGrid.getValue(0, heightIndex));
+}
+
+TEST_CASE("NoiseField image filling", "[data]") {
+  const Raz::NoiseSettings settings{ .frequency = 0.05f, .octaveCount = 4 };
+
+  Raz::Image byteImg(16, 8, Raz::ImageColorspace::RGB);
+  Raz::NoiseField::fill(byteImg, Raz::NoiseType::PERLIN, settings);
+
+  Raz::Image floatImg(16, 8, Raz::ImageColorspace::GRAY, Raz::ImageDataType::FLOAT);
+  Raz::NoiseField::fill(floatImg, Raz::NoiseType::PERLIN, settings);
+
+  for (unsigned int heightIndex = 0; heightIndex < 8; ++heightIndex) {
+    for (unsigned int widthIndex = 0; widthIndex < 16; ++widthIndex) {
+      const float value = floatImg.recoverFloatValue(widthIndex, heightIndex, 0);
+      CHECK_THAT(value, IsNearlyEqualTo(Raz::PerlinNoise::compute2D(static_cast<float>(widthIndex) * 0.05f, static_cast<float>(heightIndex) * 0.05f, 4), 0.000001f));
+
+      // Byte images are always given normalized values, & all their channels are filled
+      const auto expectedByteValue = static_cast<uint8_t>(std::clamp((value + 1.f) / 2.f, 0.f, 1.f) * 255.f + 0.5f);
+      CHECK(byteImg.recoverByteValue(widthIndex, heightIndex, 0) == expectedByteValue);
+      CHECK(byteImg.recoverByteValue(widthIndex, heightIndex, 1) == expectedByteValue);
+      CHECK(byteImg.recoverByteValue(widthIndex, heightIndex, 2) == expectedByteValue);
+    }
+  }
+
+  Raz::Image emptyImg;
+  CHECK_THROWS(Raz::NoiseField::fill(emptyImg, Raz::NoiseType::SIMPLEX));
+}
@@ -0,0 +1,75 @@
+#include "RaZ/Data/SparseGrid3.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("SparseGrid3 basic", "[data]") {
+  // A grid requires at least one element, and chunks must not be empty
+  CHECK_THROWS(Raz::SparseGrid3f(0, 0, 0));
+  CHECK_THROWS(Raz::SparseGrid3f(0, 1, 1));
+  CHECK_THROWS(Raz::SparseGrid3f(1, 1, 1, 0.f, 0));
+  CHECK_NOTHROW(Raz::SparseGrid3f(1, 1, 1));
+
+  Raz::SparseGrid3f grid(10, 5, 9, 3.f, 4);
+  CHECK(grid.getWidth() == 10);
+  CHECK(grid.getHeight() == 5);
+  CHECK(grid.getDepth() == 9);
+  CHECK(grid.getChunkSize() == 4);
+  CHECK(grid.getChunkCountX() == 3);
+  CHECK(grid.getChunkCountY() == 2);
+  CHECK(grid.getChunkCountZ() == 3);
+  CHECK(grid.getDefaultValue() == 3.f);
+  CHECK(grid.getAllocatedChunkCount() == 0);
+  CHECK(grid.getValue(9, 4, 8) == 3.f);
+
+  CHECK(grid.computeChunkIndex(0, 0, 0) == 0);
+  CHECK(grid.computeChunkIndex(3, 3, 3) == 0);
+  CHECK(grid.computeChunkIndex(4, 0, 0) == 1);
+  CHECK(grid.computeChunkIndex(0, 4, 0) == 3);
+  CHECK(grid.computeChunkIndex(9, 4, 8) == 17);
+  CHECK(grid.recoverChunkCoordinates(17) == std::array<std::size_t, 3>{ 2, 1, 2 });
+
+  // Setting the default value to an unallocated chunk does not allocate it
+  grid.setValue(0, 0, 0, 3.f);
+  CHECK(grid.getAllocatedChunkCount() == 0);
+  CHECK(grid.getDirtyChunks().empty());
+
+  grid.setValue(9, 4, 8, 42.f);
+  CHECK(grid.getAllocatedChunkCount() == 1);
+  CHECK(grid.findChunk(17) != nullptr);
+  CHECK(grid.findChunk(0) == nullptr);
+  CHECK(grid.getValue(9, 4, 8) == 42.f);
+  CHECK(grid.getValue(8, 4, 8) == 3.f);
+  CHECK(grid.getDirtyChunks().contains(17));
+}
+
+TEST_CASE("SparseGrid3 chunk management", "[data]") {
+  Raz::SparseGrid3b grid(64, 64, 64, false, 16);
+
+  grid.setValue(1, 2, 3, true);
+  grid.setValue(40, 50, 60, true);
+  grid.setValue(41, 50, 60, true);
+  CHECK(grid.getAllocatedChunkCount() == 2);
+  CHECK(grid.getDirtyChunks().size() == 2);
+
+  grid.clearDirtyChunks();
+  CHECK(grid.getDirtyChunks().empty());
+
+  // Resetting a value to the default one keeps the chunk allocated until pruning
+  grid.setValue(1, 2, 3, false);
+  CHECK(grid.getAllocatedChunkCount() == 2);
+  CHECK(grid.getDirtyChunks().size() == 1);
+
+  CHECK(grid.prune() == 1);
+  CHECK(grid.getAllocatedChunkCount() == 1);
+  CHECK(grid.getValue(1, 2, 3) == false);
+  CHECK(grid.getValue(40, 50, 60) == true);
+
+  // Removing a chunk resets all its values & flags it as modified
+  grid.clearDirtyChunks();
+  const std::size_t chunkIndex = grid.computeChunkIndex(40, 50, 60);
+  grid.removeChunk(chunkIndex);
+  CHECK(grid.getAllocatedChunkCount() == 0);
+  CHECK(grid.getDirtyChunks().contains(chunkIndex));
+  CHECK(grid.getValue(40, 50, 60) == false);
+  CHECK(grid.getValue(41, 50, 60) == false);
+}
@@ -1,7 +1,11 @@
 #include "RaZ/Math/PerlinNoise.hpp"
 
+#include "CatchCustomMatchers.hpp"
+
 #include <catch2/catch_test_macros.hpp>
 
+#include <vector>
+
 TEST_CASE("Perlin noise 1D") {
   // Whole coordinates always give 0
   CHECK(Raz::PerlinNoise::compute1D(0.f) == 0.f);
@@ -109,3 +113,51 @@ TEST_CASE("Perlin noise 3D") {
   CHECK(Raz::PerlinNoise::compute3D(1026.1134f, 1026.1134f, 1026.1134f, 8, true) == 0.512580812f);
   CHECK(Raz::PerlinNoise::compute3D(3721.846f, 3721.846f, 3721.846f, 8, true) == 0.469632179f);
 }
+
+TEST_CASE("Perlin noise batch") {
+  std::vector<Raz::Vec2f> points2D;
+  std::vector<Raz::Vec3f> points3D;
+
+  // 21 points are computed, thus the last block of points is partial
+  for (int i = 0; i < 21; ++i) {
+    points2D.emplace_back(static_cast<float>(i) * 0.37f, 1026.1134f - static_cast<float>(i) * 1.3f);
+    points3D.emplace_back(static_cast<float>(i) * 0.37f, 1026.1134f - static_cast<float>(i) * 1.3f, static_cast<float>(i * i) * 0.05f);
+  }
+
+  std::vector<float> values(points2D.size());
+
+  // With the default settings, the values are the same as those computed for each point independently
+  Raz::PerlinNoise::compute2D(points2D, values, { .octaveCount = 8 });
+  for (std::size_t i = 0; i < points2D.size(); ++i)
+    CHECK_THAT(values[i], IsNearlyEqualTo(Raz::PerlinNoise::compute2D(points2D[i].x(), points2D[i].y(), 8), 0.000001f));
+
+  Raz::PerlinNoise::compute3D(points3D, values, { .octaveCount = 4, .normalize = true });
+  for (std::size_t i = 0; i < points3D.size(); ++i)
+    CHECK_THAT(values[i], IsNearlyEqualTo(Raz::PerlinNoise::compute3D(points3D[i].x(), points3D[i].y(), points3D[i].z(), 4, true), 0.000001f));
+
+  // The frequency is applied to the points' coordinates
+  Raz::PerlinNoise::compute2D(points2D, values, { .frequency = 0.5f });
+  for (std::size_t i = 0; i < points2D.size(); ++i)
+    CHECK_THAT(values[i], IsNearlyEqualTo(Raz::PerlinNoise::compute2D(points2D[i].x() * 0.5f, points2D[i].y() * 0.5f), 0.000001f));
+
+  // Changing the seed gives different values, which are always the same for a given seed
+  std::vector<float> seededValues(points2D.size());
+  Raz::PerlinNoise::compute2D(points2D, seededValues, { .seed = 42 });
+
+  std::vector<float> otherSeededValues(points2D.size());
+  Raz::PerlinNoise::compute2D(points2D, otherSeededValues, { .seed = 42 });
+  CHECK(seededValues == otherSeededValues);
+
+  Raz::PerlinNoise::compute2D(points2D, otherSeededValues, { .seed = 43 });
+  CHECK(seededValues != otherSeededValues);
+
+  // Negative coordinates are handled, and whole ones always give 0
+  const std::vector<Raz::Vec2f> negativePoints = { Raz::Vec2f(-3.f, -7.f), Raz::Vec2f(-1.25f, -0.5f) };
+  Raz::PerlinNoise::compute2D(negativePoints, std::span(values.data(), 2));
+  CHECK(values[0] == 0.f);
+  CHECK(values[1] != 0.f);
+  CHECK(values[1] >= -1.f);
+  CHECK(values[1] <= 1.f);
+
+  CHECK_THROWS(Raz::PerlinNoise::compute2D(points2D, std::span(values.data(), 3)));
+}
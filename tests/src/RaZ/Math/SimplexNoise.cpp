@@ -0,0 +1,114 @@
+#include "RaZ/Math/SimplexNoise.hpp"
+
+#include "CatchCustomMatchers.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <vector>
+
+TEST_CASE("Simplex noise 2D") {
+  // The same coordinates must always give the same value
+  const float value = Raz::SimplexNoise::compute2D(1.0123f, 2.5123f);
+  CHECK(Raz::SimplexNoise::compute2D(1.0123f, 2.5123f) == value);
+  CHECK(value != 0.f);
+
+  // The noise is continuous
+  CHECK_THAT(Raz::SimplexNoise::compute2D(1.0124f, 2.5123f), IsNearlyEqualTo(value, 0.01f));
+  CHECK_THAT(Raz::SimplexNoise::compute2D(1.0123f, 2.5124f), IsNearlyEqualTo(value, 0.01f));
+
+  // Adding octaves adds details, progressively less important
+  const float twoOctavesValue = Raz::SimplexNoise::compute2D(1.0123f, 2.5123f, 2);
+  CHECK_THAT(twoOctavesValue, IsNearlyEqualTo(value + Raz::SimplexNoise::compute2D(2.0246f, 5.0246f) * 0.5f, 0.000001f));
+
+  // The value can be normalized between [0; 1]
+  CHECK_THAT(Raz::SimplexNoise::compute2D(1.0123f, 2.5123f, 2, true), IsNearlyEqualTo((twoOctavesValue + 1.f) / 2.f, 0.000001f));
+
+  // Values are within [-1; 1], negative coordinates included
+  float minValue = 0.f;
+  float maxValue = 0.f;
+
+  for (int i = -50; i < 50; ++i) {
+    for (int j = -50; j < 50; ++j) {
+      const float noise = Raz::SimplexNoise::compute2D(static_cast<float>(i) * 0.173f, static_cast<float>(j) * 0.251f);
+      minValue = std::min(minValue, noise);
+      maxValue = std::max(maxValue, noise);
+    }
+  }
+
+  CHECK(minValue >= -1.001f);
+  CHECK(minValue < -0.5f);
+  CHECK(maxValue <= 1.001f);
+  CHECK(maxValue > 0.5f);
+}
+
+TEST_CASE("Simplex noise 3D") {
+  const float value = Raz::SimplexNoise::compute3D(1.0123f, 2.0123f, 3.0123f);
+  CHECK(Raz::SimplexNoise::compute3D(1.0123f, 2.0123f, 3.0123f) == value);
+  CHECK(value != 0.f);
+
+  CHECK_THAT(Raz::SimplexNoise::compute3D(1.0124f, 2.0123f, 3.0123f), IsNearlyEqualTo(value, 0.01f));
+  CHECK_THAT(Raz::SimplexNoise::compute3D(1.0123f, 2.0123f, 3.0124f), IsNearlyEqualTo(value, 0.01f));
+
+  const float twoOctavesValue = Raz::SimplexNoise::compute3D(1.0123f, 2.0123f, 3.0123f, 2);
+  CHECK_THAT(twoOctavesValue, IsNearlyEqualTo(value + Raz::SimplexNoise::compute3D(2.0246f, 4.0246f, 6.0246f) * 0.5f, 0.000001f));
+  CHECK_THAT(Raz::SimplexNoise::compute3D(1.0123f, 2.0123f, 3.0123f, 2, true), IsNearlyEqualTo((twoOctavesValue + 1.f) / 2.f, 0.000001f));
+
+  float minValue = 0.f;
+  float maxValue = 0.f;
+
+  for (int i = -20; i < 20; ++i) {
+    for (int j = -20; j < 20; ++j) {
+      for (int k = -20; k < 20; ++k) {
+        const float noise = Raz::SimplexNoise::compute3D(static_cast<float>(i) * 0.173f, static_cast<float>(j) * 0.251f, static_cast<float>(k) * 0.197f);
+        minValue = std::min(minValue, noise);
+        maxValue = std::max(maxValue, noise);
+      }
+    }
+  }
+
+  CHECK(minValue >= -1.001f);
+  CHECK(minValue < -0.5f);
+  CHECK(maxValue <= 1.001f);
+  CHECK(maxValue > 0.5f);
+}
+
+TEST_CASE("Simplex noise batch") {
+  std::vector<Raz::Vec2f> points2D;
+  std::vector<Raz::Vec3f> points3D;
+
+  for (int i = 0; i < 21; ++i) {
+    points2D.emplace_back(static_cast<float>(i) * 0.37f, -static_cast<float>(i) * 1.3f);
+    points3D.emplace_back(static_cast<float>(i) * 0.37f, -static_cast<float>(i) * 1.3f, static_cast<float>(i * i) * 0.05f);
+  }
+
+  std::vector<float> values(points2D.size());
+
+  // With the default settings, the values are the same as those computed for each point independently
+  Raz::SimplexNoise::compute2D(points2D, values, { .octaveCount = 8 });
+  for (std::size_t i = 0; i < points2D.size(); ++i)
+    CHECK_THAT(values[i], IsNearlyEqualTo(Raz::SimplexNoise::compute2D(points2D[i].x(), points2D[i].y(), 8), 0.000001f));
+
+  Raz::SimplexNoise::compute3D(points3D, values, { .octaveCount = 4, .normalize = true });
+  for (std::size_t i = 0; i < points3D.size(); ++i)
+    CHECK_THAT(values[i], IsNearlyEqualTo(Raz::SimplexNoise::compute3D(points3D[i].x(), points3D[i].y(), points3D[i].z(), 4, true), 0.000001f));
+
+  // The lacunarity & persistence change the frequency & amplitude of the successive octaves
+  Raz::SimplexNoise::compute3D(points3D, values, { .octaveCount = 2, .lacunarity = 3.f, .persistence = 0.25f });
+  for (std::size_t i = 0; i < points3D.size(); ++i) {
+    const Raz::Vec3f& point = points3D[i];
+    const float expectedValue = Raz::SimplexNoise::compute3D(point.x(), point.y(), point.z())
+                              + Raz::SimplexNoise::compute3D(point.x() * 3.f, point.y() * 3.f, point.z() * 3.f) * 0.25f;
+    CHECK_THAT(values[i], IsNearlyEqualTo(expectedValue, 0.000001f));
+  }
+
+  // Changing the seed gives different values
+  std::vector<float> seededValues(points3D.size());
+  Raz::SimplexNoise::compute3D(points3D, seededValues, { .seed = 42 });
+  Raz::SimplexNoise::compute3D(points3D, values, { .seed = 42 });
+  CHECK(seededValues == values);
+  Raz::SimplexNoise::compute3D(points3D, values, { .seed = 43 });
+  CHECK(seededValues != values);
+
+  CHECK_THROWS(Raz::SimplexNoise::compute3D(points3D, std::span(values.data(), 3)));
+}
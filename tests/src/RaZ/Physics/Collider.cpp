@@ -1,4 +1,8 @@
+#include "RaZ/Data/Mesh.hpp"
 #include "RaZ/Physics/Collider.hpp"
+#include "RaZ/Physics/ConvexHull.hpp"
+#include "RaZ/Physics/NarrowPhase.hpp"
+#include "RaZ/Physics/TriangleMesh.hpp"
 #include "RaZ/Utils/Shape.hpp"
 
 #include <catch2/catch_test_macros.hpp>
@@ -7,6 +11,10 @@ TEST_CASE("Collider basic", "[physics]") {
   Raz::Collider collider(Raz::Plane(1.5f));
   CHECK(collider.getShapeType() == Raz::ShapeType::PLANE);
   CHECK(collider.getShape<Raz::Plane>().getDistance() == 1.5f);
+  CHECK(collider.getLayerMask() == 1);
+
+  collider.setLayerMask(6);
+  CHECK(collider.getLayerMask() == 6);
 
   constexpr Raz::Vec3f center(1.f, 2.f, 3.f);
   collider.setShape(Raz::Sphere(center, 3.f));
@@ -22,3 +30,30 @@ TEST_CASE("Collider basic", "[physics]") {
   CHECK(collider.getShapeType() == Raz::ShapeType::AABB);
   CHECK(collider.getShape<Raz::AABB>().computeCentroid() == Raz::Vec3f(0.f));
 }
+
+TEST_CASE("Collider complex shapes", "[physics]") {
+  const Raz::Mesh boxMesh(Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f)));
+
+  Raz::Collider collider{ Raz::ConvexHull(boxMesh) };
+  CHECK(collider.getShapeType() == Raz::ShapeType::CONVEX_HULL);
+  CHECK(collider.getShape<Raz::ConvexHull>().getVertices().size() == 8);
+
+  CHECK(collider.intersects(Raz::Sphere(Raz::Vec3f(0.f, 1.5f, 0.f), 0.75f)));
+  CHECK_FALSE(collider.intersects(Raz::Sphere(Raz::Vec3f(0.f, 1.5f, 0.f), 0.25f)));
+  CHECK(collider.intersects(Raz::Ray(Raz::Vec3f(0.f, 5.f, 0.f), -Raz::Axis::Y)));
+
+  Raz::ContactManifold manifold;
+  REQUIRE(collider.computeContact(Raz::Sphere(Raz::Vec3f(0.f, 1.5f, 0.f), 0.75f), manifold));
+  CHECK(manifold.normal.y() > 0.99f); // The normal points from the collider's shape towards the given one
+  CHECK(manifold.points[0].penetrationDepth > 0.24f);
+  CHECK(manifold.points[0].penetrationDepth < 0.26f);
+
+  collider.setShape(Raz::TriangleMesh(boxMesh));
+  CHECK(collider.getShapeType() == Raz::ShapeType::TRIANGLE_MESH);
+  CHECK(collider.getShape<Raz::TriangleMesh>().getTriangles().size() == 12);
+
+  CHECK(collider.intersects(Raz::Sphere(Raz::Vec3f(0.f, 1.5f, 0.f), 0.75f)));
+  CHECK_FALSE(collider.intersects(Raz::Sphere(Raz::Vec3f(0.f), 0.5f))); // A triangle mesh is hollow
+  CHECK(collider.intersects(Raz::Ray(Raz::Vec3f(0.f, 5.f, 0.f), -Raz::Axis::Y)));
+  CHECK(collider.computeContact(Raz::Sphere(Raz::Vec3f(0.f, 1.5f, 0.f), 0.75f), manifold));
+}
@@ -0,0 +1,113 @@
+#include "RaZ/Data/Mesh.hpp"
+#include "RaZ/Math/Angle.hpp"
+#include "RaZ/Physics/ConvexHull.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+
+using namespace Raz::Literals;
+
+namespace {
+
+// The points of a 2x2x2 cube centered on the origin, with points inside & on its faces which must not be part of the hull
+const std::vector<Raz::Vec3f> cubePoints = {
+  Raz::Vec3f(-1.f, -1.f, -1.f), Raz::Vec3f(1.f, -1.f, -1.f), Raz::Vec3f(-1.f, 1.f, -1.f), Raz::Vec3f(1.f, 1.f, -1.f),
+  Raz::Vec3f(0.f), Raz::Vec3f(0.5f, -0.25f, 0.1f), Raz::Vec3f(0.f, 1.f, 0.f), Raz::Vec3f(1.f, 0.5f, 0.5f),
+  Raz::Vec3f(-1.f, -1.f, 1.f), Raz::Vec3f(1.f, -1.f, 1.f), Raz::Vec3f(-1.f, 1.f, 1.f), Raz::Vec3f(1.f, 1.f, 1.f)
+};
+
+} // namespace
+
+TEST_CASE("ConvexHull creation", "[physics]") {
+  CHECK_THROWS(Raz::ConvexHull({ Raz::Vec3f(0.f), Raz::Vec3f(1.f), Raz::Vec3f(2.f) }));
+  CHECK_THROWS(Raz::ConvexHull({ Raz::Vec3f(0.f), Raz::Vec3f(1.f, 0.f, 0.f), Raz::Vec3f(0.f, 1.f, 0.f), Raz::Vec3f(1.f, 1.f, 0.f) })); // Coplanar
+
+  const Raz::ConvexHull hull(cubePoints);
+  CHECK(hull.getType() == Raz::ShapeType::CONVEX_HULL);
+  CHECK(hull.getVertices().size() == 8);
+  CHECK(hull.getFaces().size() == 12);
+
+  for (const Raz::ConvexHull::Face& face : hull.getFaces()) {
+    // All faces are on the cube's sides, their normals pointing outward
+    CHECK(face.distance == 1.f);
+    CHECK(std::abs(face.normal.x()) + std::abs(face.normal.y()) + std::abs(face.normal.z()) == 1.f);
+  }
+
+  CHECK(hull.computeCentroid() == Raz::Vec3f(0.f));
+  CHECK(hull.computeBoundingBox() == Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f)));
+  CHECK(hull.computeSupport(Raz::Vec3f(1.f, -2.f, 0.5f)) == Raz::Vec3f(1.f, -1.f, 1.f));
+
+  // An icosahedron, all of whose vertices are part of the hull
+  const Raz::ConvexHull meshHull(Raz::Mesh(Raz::Sphere(Raz::Vec3f(0.f), 1.f), 1, Raz::SphereMeshType::ICO));
+  CHECK(meshHull.getVertices().size() == 12);
+  CHECK(meshHull.getFaces().size() == 20);
+  CHECK(meshHull.contains(Raz::Vec3f(0.f, 0.75f, 0.f)));
+  CHECK_FALSE(meshHull.contains(Raz::Vec3f(0.8f, 0.8f, 0.f)));
+}
+
+TEST_CASE("ConvexHull point containment", "[physics]") {
+  const Raz::ConvexHull hull(cubePoints);
+
+  CHECK(hull.contains(Raz::Vec3f(0.f)));
+  CHECK(hull.contains(Raz::Vec3f(1.f, 0.5f, -1.f)));
+  CHECK(hull.contains(Raz::Vec3f(-1.f)));
+  CHECK_FALSE(hull.contains(Raz::Vec3f(1.01f, 0.f, 0.f)));
+  CHECK_FALSE(hull.contains(Raz::Vec3f(0.f, -2.f, 0.5f)));
+}
+
+TEST_CASE("ConvexHull shapes intersection", "[physics]") {
+  const Raz::ConvexHull hull(cubePoints);
+
+  CHECK(hull.intersects(Raz::Line(Raz::Vec3f(-2.f, 0.f, 0.f), Raz::Vec3f(2.f, 0.f, 0.f))));
+  CHECK_FALSE(hull.intersects(Raz::Line(Raz::Vec3f(-2.f, 2.f, 0.f), Raz::Vec3f(2.f, 2.f, 0.f))));
+
+  CHECK(hull.intersects(Raz::Plane(0.5f, Raz::Axis::Y)));
+  CHECK_FALSE(hull.intersects(Raz::Plane(1.5f, Raz::Axis::Y)));
+
+  CHECK(hull.intersects(Raz::Sphere(Raz::Vec3f(1.5f, 1.5f, 0.f), 0.75f)));
+  CHECK_FALSE(hull.intersects(Raz::Sphere(Raz::Vec3f(1.5f, 1.5f, 0.f), 0.7f))); // The sphere is close to the edge but does not touch it
+
+  CHECK(hull.intersects(Raz::Triangle(Raz::Vec3f(0.f, 0.f, 3.f), Raz::Vec3f(0.f, 0.f, -3.f), Raz::Vec3f(0.f, 3.f, 0.f))));
+  CHECK_FALSE(hull.intersects(Raz::Triangle(Raz::Vec3f(2.f, 0.f, 3.f), Raz::Vec3f(2.f, 0.f, -3.f), Raz::Vec3f(2.f, 3.f, 0.f))));
+
+  CHECK(hull.intersects(Raz::AABB(Raz::Vec3f(0.5f), Raz::Vec3f(3.f))));
+  CHECK_FALSE(hull.intersects(Raz::AABB(Raz::Vec3f(1.5f), Raz::Vec3f(3.f))));
+
+  // A box rotated by 45° around Y, whose corner reaches the hull while its unrotated version would not
+  const Raz::Quaternionf rotation(45_deg, Raz::Axis::Y);
+  CHECK_FALSE(hull.intersects(Raz::OBB(Raz::Vec3f(1.2f, -0.5f, -0.5f), Raz::Vec3f(2.2f, 0.5f, 0.5f))));
+  CHECK(hull.intersects(Raz::OBB(Raz::Vec3f(1.2f, -0.5f, -0.5f), Raz::Vec3f(2.2f, 0.5f, 0.5f), rotation)));
+  CHECK_FALSE(hull.intersects(Raz::OBB(Raz::Vec3f(1.8f, -0.5f, -0.5f), Raz::Vec3f(2.8f, 0.5f, 0.5f), rotation)));
+}
+
+TEST_CASE("ConvexHull ray intersection", "[physics]") {
+  const Raz::ConvexHull hull(cubePoints);
+
+  Raz::RayHit hit;
+  CHECK(hull.intersects(Raz::Ray(Raz::Vec3f(-5.f, 0.5f, 0.f), Raz::Axis::X), &hit));
+  CHECK(hit.position == Raz::Vec3f(-1.f, 0.5f, 0.f));
+  CHECK(hit.normal == -Raz::Axis::X);
+  CHECK(hit.distance == 4.f);
+
+  CHECK_FALSE(hull.intersects(Raz::Ray(Raz::Vec3f(-5.f, 0.5f, 0.f), -Raz::Axis::X), &hit));
+  CHECK_FALSE(hull.intersects(Raz::Ray(Raz::Vec3f(-5.f, 1.5f, 0.f), Raz::Axis::X), &hit));
+
+  // The ray starting inside the hull, the hit is behind it
+  CHECK(hull.intersects(Raz::Ray(Raz::Vec3f(0.f), Raz::Axis::Y), &hit));
+  CHECK(hit.distance == -1.f);
+}
+
+TEST_CASE("ConvexHull translation & projection", "[physics]") {
+  Raz::ConvexHull hull(cubePoints);
+  hull.translate(Raz::Vec3f(1.f, 2.f, 3.f));
+
+  CHECK(hull.computeCentroid() == Raz::Vec3f(1.f, 2.f, 3.f));
+  CHECK(hull.contains(Raz::Vec3f(1.5f, 2.5f, 3.5f)));
+  CHECK_FALSE(hull.contains(Raz::Vec3f(0.f)));
+  CHECK(hull.computeBoundingBox() == Raz::AABB(Raz::Vec3f(0.f, 1.f, 2.f), Raz::Vec3f(2.f, 3.f, 4.f)));
+
+  CHECK(hull.computeProjection(Raz::Vec3f(1.5f, 2.5f, 3.5f)) == Raz::Vec3f(1.5f, 2.5f, 3.5f));
+  CHECK(hull.computeProjection(Raz::Vec3f(5.f, 2.5f, 3.5f)) == Raz::Vec3f(2.f, 2.5f, 3.5f));
+  CHECK(hull.computeProjection(Raz::Vec3f(5.f, 5.f, 5.f)) == Raz::Vec3f(2.f, 3.f, 4.f));
+}
@@ -0,0 +1,140 @@
+#include "RaZ/Math/Angle.hpp"
+#include "RaZ/Physics/ConvexHull.hpp"
+#include "RaZ/Physics/NarrowPhase.hpp"
+#include "RaZ/Physics/TriangleMesh.hpp"
+#include "RaZ/Utils/Shape.hpp"
+
+#include "CatchCustomMatchers.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Raz::Literals;
+
+TEST_CASE("NarrowPhase support points", "[physics]") {
+  CHECK(Raz::NarrowPhase::computeSupport(Raz::Sphere(Raz::Vec3f(1.f), 2.f), Raz::Vec3f(0.f, 3.f, 0.f)) == Raz::Vec3f(1.f, 3.f, 1.f));
+  CHECK(Raz::NarrowPhase::computeSupport(Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(2.f)), Raz::Vec3f(1.f, -1.f, 1.f)) == Raz::Vec3f(2.f, -1.f, 2.f));
+  CHECK(Raz::NarrowPhase::computeSupport(Raz::Triangle(Raz::Vec3f(0.f), Raz::Vec3f(1.f, 0.f, 0.f), Raz::Vec3f(0.f, 1.f, 0.f)),
+                                         Raz::Vec3f(-1.f, 2.f, 0.f)) == Raz::Vec3f(0.f, 1.f, 0.f));
+  CHECK(Raz::NarrowPhase::computeSupport(Raz::Line(Raz::Vec3f(0.f), Raz::Vec3f(1.f)), Raz::Vec3f(-1.f)) == Raz::Vec3f(0.f));
+
+  // A box rotated by 45° around Y has one of its corners farthest along X
+  const Raz::OBB obb(Raz::Vec3f(-1.f), Raz::Vec3f(1.f), Raz::Quaternionf(45_deg, Raz::Axis::Y));
+  CHECK_THAT(Raz::NarrowPhase::computeSupport(obb, Raz::Axis::X).x(), IsNearlyEqualTo(1.41421356f, 0.00001f));
+
+  CHECK_THROWS(Raz::NarrowPhase::computeSupport(Raz::Plane(0.f), Raz::Axis::Y));
+}
+
+TEST_CASE("NarrowPhase intersection", "[physics]") {
+  // These pairs are not handled by the shapes themselves
+  const Raz::OBB obb(Raz::Vec3f(-1.f), Raz::Vec3f(1.f), Raz::Quaternionf(45_deg, Raz::Axis::Y));
+  CHECK(Raz::NarrowPhase::intersects(obb, Raz::OBB(Raz::Vec3f(1.f, -1.f, -1.f), Raz::Vec3f(3.f, 1.f, 1.f), Raz::Quaternionf(10_deg, Raz::Axis::X))));
+  CHECK_FALSE(Raz::NarrowPhase::intersects(obb, Raz::OBB(Raz::Vec3f(1.5f, -1.f, -1.f), Raz::Vec3f(3.f, 1.f, 1.f))));
+  CHECK(Raz::NarrowPhase::intersects(obb, Raz::Sphere(Raz::Vec3f(2.f, 0.f, 0.f), 0.6f)));
+  CHECK_FALSE(Raz::NarrowPhase::intersects(obb, Raz::Sphere(Raz::Vec3f(2.f, 0.f, 0.f), 0.5f)));
+  CHECK(Raz::NarrowPhase::intersects(obb, Raz::Plane(1.f, Raz::Axis::X)));
+  CHECK_FALSE(Raz::NarrowPhase::intersects(obb, Raz::Plane(1.5f, Raz::Axis::X)));
+
+  const Raz::Triangle triangle(Raz::Vec3f(-3.f, 0.5f, -3.f), Raz::Vec3f(0.f, 0.5f, 3.f), Raz::Vec3f(3.f, 0.5f, -3.f));
+  CHECK(Raz::NarrowPhase::intersects(triangle, Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f))));
+  CHECK_FALSE(Raz::NarrowPhase::intersects(triangle, Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f, 0.4f, 1.f))));
+  CHECK(Raz::NarrowPhase::intersects(Raz::Quad(Raz::Vec3f(-1.f, 1.f, 0.f), Raz::Vec3f(1.f, 1.f, 0.f), Raz::Vec3f(1.f, -1.f, 0.f), Raz::Vec3f(-1.f, -1.f, 0.f)),
+                                     triangle));
+
+  // Planes are checked against each other by the shapes
+  CHECK(Raz::NarrowPhase::intersects(Raz::Plane(1.f, Raz::Axis::X), Raz::Plane(1.f, Raz::Axis::Y)));
+  CHECK_FALSE(Raz::NarrowPhase::intersects(Raz::Plane(1.f, Raz::Axis::X), Raz::Plane(2.f, Raz::Axis::X)));
+}
+
+TEST_CASE("NarrowPhase convex contacts", "[physics]") {
+  Raz::ContactManifold manifold;
+
+  CHECK_FALSE(Raz::NarrowPhase::computeContact(Raz::Sphere(Raz::Vec3f(0.f), 1.f), Raz::Sphere(Raz::Vec3f(2.5f, 0.f, 0.f), 1.f), manifold));
+
+  REQUIRE(Raz::NarrowPhase::computeContact(Raz::Sphere(Raz::Vec3f(0.f), 1.f), Raz::Sphere(Raz::Vec3f(1.5f, 0.f, 0.f), 1.f), manifold));
+  CHECK_THAT(manifold.normal, IsNearlyEqualToVector(-Raz::Axis::X, 0.01f));
+  REQUIRE(manifold.pointCount == 1);
+  CHECK_THAT(manifold.points[0].penetrationDepth, IsNearlyEqualTo(0.5f, 0.01f));
+  CHECK_THAT(manifold.points[0].position, IsNearlyEqualToVector(Raz::Vec3f(1.f, 0.f, 0.f), 0.01f));
+
+  // A box resting on a larger one is in contact with it by its whole bottom face
+  const Raz::AABB bottomBox(Raz::Vec3f(-2.f, -1.f, -2.f), Raz::Vec3f(2.f, 0.f, 2.f));
+  const Raz::AABB topBox(Raz::Vec3f(-0.5f, -0.1f, -0.5f), Raz::Vec3f(0.5f, 0.9f, 0.5f));
+
+  REQUIRE(Raz::NarrowPhase::computeContact(topBox, bottomBox, manifold));
+  CHECK_THAT(manifold.normal, IsNearlyEqualToVector(Raz::Axis::Y, 0.0001f));
+  CHECK(manifold.pointCount == 4);
+
+  for (std::size_t pointIndex = 0; pointIndex < manifold.pointCount; ++pointIndex) {
+    CHECK_THAT(manifold.points[pointIndex].penetrationDepth, IsNearlyEqualTo(0.1f, 0.0001f));
+    CHECK_THAT(manifold.points[pointIndex].position.y(), IsNearlyEqualTo(-0.1f, 0.0001f));
+  }
+
+  // Swapping the shapes reverses the normal
+  REQUIRE(Raz::NarrowPhase::computeContact(bottomBox, topBox, manifold));
+  CHECK_THAT(manifold.normal, IsNearlyEqualToVector(-Raz::Axis::Y, 0.0001f));
+  CHECK_THAT(manifold.points[0].penetrationDepth, IsNearlyEqualTo(0.1f, 0.0001f));
+
+  // Convex hulls work the same way; this one is an octahedron, whose lowest point touches the box
+  const Raz::ConvexHull hull({ Raz::Axis::X, -Raz::Axis::X, Raz::Axis::Y, -Raz::Axis::Y, Raz::Axis::Z, -Raz::Axis::Z });
+  REQUIRE(Raz::NarrowPhase::computeContact(hull, Raz::OBB(Raz::Vec3f(-1.f, -3.f, -1.f), Raz::Vec3f(1.f, -0.75f, 1.f)), manifold));
+  CHECK_THAT(manifold.normal, IsNearlyEqualToVector(Raz::Axis::Y, 0.0001f));
+  CHECK_THAT(manifold.points[0].penetrationDepth, IsNearlyEqualTo(0.25f, 0.0001f));
+  CHECK(manifold.pointCount == 1);
+  CHECK_THAT(manifold.points[0].position, IsNearlyEqualToVector(-Raz::Axis::Y, 0.0001f));
+}
+
+TEST_CASE("NarrowPhase plane contacts", "[physics]") {
+  const Raz::Plane plane(0.f, Raz::Axis::Y);
+  Raz::ContactManifold manifold;
+
+  CHECK_FALSE(Raz::NarrowPhase::computeContact(plane, plane, manifold));
+  CHECK_FALSE(Raz::NarrowPhase::computeContact(Raz::Sphere(Raz::Vec3f(0.f, 1.5f, 0.f), 1.f), plane, manifold));
+
+  REQUIRE(Raz::NarrowPhase::computeContact(Raz::Sphere(Raz::Vec3f(0.f, 0.75f, 0.f), 1.f), plane, manifold));
+  CHECK(manifold.normal == Raz::Axis::Y);
+  CHECK(manifold.pointCount == 1);
+  CHECK(manifold.points[0].position == Raz::Vec3f(0.f, -0.25f, 0.f));
+  CHECK(manifold.points[0].penetrationDepth == 0.25f);
+
+  // A tilted box only has its lowest corners below the plane
+  const Raz::AABB box(Raz::Vec3f(-1.f, -0.5f, -1.f), Raz::Vec3f(1.f, 1.5f, 1.f));
+  REQUIRE(Raz::NarrowPhase::computeContact(box, plane, manifold));
+  CHECK(manifold.pointCount == 4);
+  CHECK(manifold.points[0].penetrationDepth == 0.5f);
+
+  const Raz::OBB tiltedBox(Raz::Vec3f(-1.f, 0.2f, -1.f), Raz::Vec3f(1.f, 2.2f, 1.f), Raz::Quaternionf(45_deg, Raz::Axis::Z));
+  REQUIRE(Raz::NarrowPhase::computeContact(tiltedBox, plane, manifold));
+  CHECK(manifold.pointCount == 2);
+  CHECK_THAT(manifold.points[0].penetrationDepth, IsNearlyEqualTo(0.21421356f, 0.00001f));
+
+  // The plane being the first shape, the normal points towards it & the points are on its surface
+  REQUIRE(Raz::NarrowPhase::computeContact(plane, box, manifold));
+  CHECK(manifold.normal == -Raz::Axis::Y);
+  CHECK(manifold.points[0].position.y() == 0.f);
+}
+
+TEST_CASE("NarrowPhase triangle mesh contacts", "[physics]") {
+  // A floor made of two triangles
+  const Raz::TriangleMesh floor({
+    Raz::Triangle(Raz::Vec3f(-5.f, 0.f, -5.f), Raz::Vec3f(-5.f, 0.f, 5.f), Raz::Vec3f(5.f, 0.f, 5.f)),
+    Raz::Triangle(Raz::Vec3f(-5.f, 0.f, -5.f), Raz::Vec3f(5.f, 0.f, 5.f), Raz::Vec3f(5.f, 0.f, -5.f))
+  });
+
+  Raz::ContactManifold manifold;
+  CHECK_FALSE(Raz::NarrowPhase::computeContact(Raz::AABB(Raz::Vec3f(-1.f, 0.1f, -1.f), Raz::Vec3f(1.f, 2.f, 1.f)), floor, manifold));
+
+  // The box crosses the diagonal shared by both triangles; its contacts with each of them are merged
+  REQUIRE(Raz::NarrowPhase::computeContact(Raz::AABB(Raz::Vec3f(-1.f, -0.2f, -1.f), Raz::Vec3f(1.f, 2.f, 1.f)), floor, manifold));
+  CHECK_THAT(manifold.normal, IsNearlyEqualToVector(Raz::Axis::Y, 0.0001f));
+  CHECK(manifold.pointCount == 4);
+
+  for (std::size_t pointIndex = 0; pointIndex < manifold.pointCount; ++pointIndex) {
+    CHECK_THAT(manifold.points[pointIndex].penetrationDepth, IsNearlyEqualTo(0.2f, 0.0001f));
+    CHECK_THAT(manifold.points[pointIndex].position.y(), IsNearlyEqualTo(-0.2f, 0.0001f));
+  }
+
+  // The mesh being the first shape, the normal points towards it
+  REQUIRE(Raz::NarrowPhase::computeContact(floor, Raz::Sphere(Raz::Vec3f(3.f, 0.5f, -2.f), 1.f), manifold));
+  CHECK_THAT(manifold.normal, IsNearlyEqualToVector(-Raz::Axis::Y, 0.01f));
+  CHECK_THAT(manifold.points[0].penetrationDepth, IsNearlyEqualTo(0.5f, 0.01f));
+}
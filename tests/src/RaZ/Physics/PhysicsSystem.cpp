@@ -6,17 +6,29 @@
 #include "RaZ/Physics/RigidBody.hpp"
 #include "RaZ/Utils/Shape.hpp"
 
+#include "CatchCustomMatchers.hpp"
+
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
+#include <vector>
+
 TEST_CASE("PhysicsSystem basic", "[physics]") {
   Raz::PhysicsSystem physics;
   CHECK(physics.getGravity() == Raz::Vec3f(0.f, -9.80665f, 0.f));
   CHECK(physics.getFriction() == 0.95f);
 
+  CHECK(physics.getSleepVelocityThreshold() == 0.05f);
+  CHECK(physics.getSleepTimeThreshold() == 0.5f);
+
   physics.setGravity(Raz::Vec3f(0.f));
   physics.setFriction(0.25f);
+  physics.setSleepVelocityThreshold(0.1f);
+  physics.setSleepTimeThreshold(1.f);
   CHECK(physics.getGravity() == Raz::Vec3f(0.f));
   CHECK(physics.getFriction() == 0.25f);
+  CHECK(physics.getSleepVelocityThreshold() == 0.1f);
+  CHECK(physics.getSleepTimeThreshold() == 1.f);
 }
 
 TEST_CASE("PhysicsSystem accepted components", "[physics]") {
@@ -119,3 +131,288 @@ TEST_CASE("PhysicsSystem rigid bodies collision", "[physics]") {
   CHECK(staticParticleTransform.getPosition().strictlyEquals(initParticlePos));
   CHECK(staticParticleRigidBody.getVelocity().strictlyEquals(Raz::Vec3f(0.f)));
 }
+
+TEST_CASE("PhysicsSystem rigid bodies contacts", "[physics]") {
+  Raz::World world(4);
+  world.addSystem<Raz::PhysicsSystem>();
+
+  constexpr float substepTime = 0.016666f;
+  const auto updateWorld = [&world] (int substepCount) {
+    CHECK_NOTHROW(world.update(Raz::FrameTimeInfo{ .deltaTime    = static_cast<float>(substepCount) * substepTime,
+                                                   .globalTime   = 0.f,
+                                                   .substepCount = substepCount,
+                                                   .substepTime  = substepTime }));
+  };
+
+  world.addEntityWithComponent<Raz::Transform>().addComponent<Raz::Collider>(Raz::Plane(0.f, Raz::Axis::Y));
+  world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(5.f, 0.f, 0.f)).addComponent<Raz::Collider>(Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f)));
+
+  // Rigid bodies with a solid collider are separated from the others along their contact manifold's normal, resting on their surface
+  Raz::Entity& sphere   = world.addEntity();
+  auto& sphereTransform = sphere.addComponent<Raz::Transform>(Raz::Vec3f(0.f, 3.f, 0.f));
+  auto& sphereRigidBody = sphere.addComponent<Raz::RigidBody>(1.f, 0.f);
+  sphere.addComponent<Raz::Collider>(Raz::Sphere(Raz::Vec3f(0.f), 0.5f));
+
+  Raz::Entity& box   = world.addEntity();
+  auto& boxTransform = box.addComponent<Raz::Transform>(Raz::Vec3f(5.f, 3.f, 0.f));
+  box.addComponent<Raz::RigidBody>(1.f, 0.f);
+  box.addComponent<Raz::Collider>(Raz::AABB(Raz::Vec3f(-0.5f), Raz::Vec3f(0.5f)));
+
+  updateWorld(120);
+  CHECK_THAT(sphereTransform.getPosition().y(), IsNearlyEqualTo(0.5f, 0.01f));
+  CHECK(sphereTransform.getPosition().x() == 0.f);
+  CHECK_THAT(sphereRigidBody.getVelocity().y(), IsNearlyEqualTo(0.f));
+  CHECK_THAT(boxTransform.getPosition().y(), IsNearlyEqualTo(1.5f, 0.01f)); // Resting on top of the static box
+  CHECK(boxTransform.getPosition().x() == 5.f);
+
+  // A bouncy body going into a collider has the velocity's component along the contact normal reflected
+  Raz::Entity& ball   = world.addEntity();
+  ball.addComponent<Raz::Transform>(Raz::Vec3f(0.f, 0.45f, 3.f));
+  auto& ballRigidBody = ball.addComponent<Raz::RigidBody>(1.f, 1.f);
+  ball.addComponent<Raz::Collider>(Raz::Sphere(Raz::Vec3f(0.f), 0.5f));
+  ballRigidBody.setVelocity(Raz::Vec3f(1.f, -2.f, 0.f));
+
+  updateWorld(1);
+  CHECK(ballRigidBody.getVelocity().x() > 0.f);
+  CHECK(ballRigidBody.getVelocity().y() > 0.f);
+}
+
+TEST_CASE("PhysicsSystem sleeping bodies", "[physics]") {
+  Raz::World world(4);
+  world.addSystem<Raz::PhysicsSystem>();
+
+  constexpr float substepTime = 0.016666f;
+  const auto updateWorld = [&world] (int substepCount) {
+    CHECK_NOTHROW(world.update(Raz::FrameTimeInfo{ .deltaTime    = static_cast<float>(substepCount) * substepTime,
+                                                   .globalTime   = 0.f,
+                                                   .substepCount = substepCount,
+                                                   .substepTime  = substepTime }));
+  };
+
+  world.addEntityWithComponent<Raz::Transform>().addComponent<Raz::Collider>(Raz::Plane(0.f, Raz::Axis::Y));
+
+  Raz::Entity& box   = world.addEntity();
+  auto& boxTransform = box.addComponent<Raz::Transform>(Raz::Vec3f(0.f, 0.5f, 0.f));
+  auto& boxRigidBody = box.addComponent<Raz::RigidBody>(1.f, 0.f);
+  box.addComponent<Raz::Collider>(Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f)));
+
+  // The box falls onto the floor, then stays at rest long enough to be put to sleep
+  updateWorld(30);
+  CHECK_FALSE(boxRigidBody.isSleeping());
+  CHECK(boxTransform.getPosition().y() < 1.01f);
+
+  updateWorld(60);
+  REQUIRE(boxRigidBody.isSleeping());
+  CHECK(boxRigidBody.getVelocity() == Raz::Vec3f(0.f));
+
+  // A sleeping body is not moved anymore
+  const Raz::Vec3f sleepingPos = boxTransform.getPosition();
+  updateWorld(10);
+  CHECK(boxTransform.getPosition().strictlyEquals(sleepingPos));
+
+  // Applying a force wakes it up
+  boxRigidBody.setForces(Raz::Vec3f(0.f, 20.f, 0.f));
+  CHECK_FALSE(boxRigidBody.isSleeping());
+  updateWorld(10);
+  CHECK(boxTransform.getPosition().y() > sleepingPos.y());
+
+  boxRigidBody.setForces(Raz::Vec3f(0.f));
+  updateWorld(120);
+  REQUIRE(boxRigidBody.isSleeping());
+
+  // A body falling onto the sleeping one wakes it up
+  Raz::Entity& ball = world.addEntity();
+  ball.addComponent<Raz::Transform>(Raz::Vec3f(0.f, 2.5f, 0.f));
+  ball.addComponent<Raz::RigidBody>(1.f, 0.f);
+
+  updateWorld(30);
+  CHECK_FALSE(boxRigidBody.isSleeping());
+}
+
+TEST_CASE("PhysicsSystem sleeping bodies wake up", "[physics]") {
+  Raz::World world(4);
+  auto& physics = world.addSystem<Raz::PhysicsSystem>();
+
+  constexpr float substepTime = 0.016666f;
+  const auto updateWorld = [&world] (int substepCount) {
+    CHECK_NOTHROW(world.update(Raz::FrameTimeInfo{ .deltaTime    = static_cast<float>(substepCount) * substepTime,
+                                                   .globalTime   = 0.f,
+                                                   .substepCount = substepCount,
+                                                   .substepTime  = substepTime }));
+  };
+
+  world.addEntityWithComponent<Raz::Transform>().addComponent<Raz::Collider>(Raz::Plane(0.f, Raz::Axis::Y));
+
+  Raz::Entity& ball   = world.addEntity();
+  auto& ballTransform = ball.addComponent<Raz::Transform>(Raz::Vec3f(0.f, 4.f, 0.f));
+  auto& ballRigidBody = ball.addComponent<Raz::RigidBody>(1.f, 0.f);
+  ball.addComponent<Raz::Collider>(Raz::Sphere(Raz::Vec3f(0.f), 0.5f));
+
+  const auto addPlatform = [&world] () -> Raz::Entity& {
+    Raz::Entity& platform = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(0.f, 2.f, 0.f));
+    platform.addComponent<Raz::Collider>(Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f)));
+    return platform;
+  };
+  // The ball is put back above the platform & left to fall asleep onto it
+  const auto restOnPlatform = [&] () {
+    ballTransform.setPosition(Raz::Vec3f(0.f, 4.f, 0.f));
+    ballRigidBody.wakeUp();
+
+    updateWorld(120);
+    REQUIRE(ballRigidBody.isSleeping());
+    REQUIRE_THAT(ballTransform.getPosition().y(), IsNearlyEqualTo(3.5f, 0.01f));
+  };
+  const auto checkFallsToFloor = [&] () {
+    updateWorld(1);
+    CHECK_FALSE(ballRigidBody.isSleeping());
+
+    updateWorld(120);
+    CHECK_THAT(ballTransform.getPosition().y(), IsNearlyEqualTo(0.5f, 0.01f));
+  };
+
+  Raz::Entity* platform = &addPlatform();
+
+  // Moving the collider supporting a sleeping body wakes it up
+  restOnPlatform();
+  platform->getComponent<Raz::Transform>().translate(Raz::Vec3f(5.f, 0.f, 0.f));
+  checkFallsToFloor();
+
+  // Moving a collider not touching it leaves it asleep
+  updateWorld(60);
+  REQUIRE(ballRigidBody.isSleeping());
+  platform->getComponent<Raz::Transform>().translate(Raz::Vec3f(5.f, 0.f, 0.f));
+  updateWorld(1);
+  CHECK(ballRigidBody.isSleeping());
+
+  // Removing the supporting collider wakes it up as well, whether the entity or only its collider is removed
+  platform->getComponent<Raz::Transform>().setPosition(Raz::Vec3f(0.f, 2.f, 0.f));
+  restOnPlatform();
+  world.removeEntity(*platform);
+  checkFallsToFloor();
+
+  platform = &addPlatform();
+  restOnPlatform();
+  platform->removeComponent<Raz::Collider>();
+  checkFallsToFloor();
+
+  // Changing the gravity wakes all bodies up
+  updateWorld(60);
+  REQUIRE(ballRigidBody.isSleeping());
+
+  physics.setGravity(physics.getGravity());
+  CHECK(ballRigidBody.isSleeping());
+
+  physics.setGravity(Raz::Vec3f(0.f, 9.80665f, 0.f));
+  CHECK_FALSE(ballRigidBody.isSleeping());
+  updateWorld(10);
+  CHECK(ballTransform.getPosition().y() > 0.5f);
+}
+
+TEST_CASE("PhysicsSystem queries", "[physics]") {
+  Raz::World world;
+
+  const auto& physics = world.addSystem<Raz::PhysicsSystem>();
+
+  Raz::Entity& sphere = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(0.f, 0.f, -5.f));
+  sphere.addComponent<Raz::Collider>(Raz::Sphere(Raz::Vec3f(0.f), 1.f));
+
+  Raz::Entity& box = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(0.f, 0.f, -10.f));
+  box.addComponent<Raz::Collider>(Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f)));
+
+  Raz::Entity& layeredBox = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(10.f, 0.f, 0.f));
+  layeredBox.addComponent<Raz::Collider>(Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f))).setLayerMask(2);
+
+  // The floor has no bounding box, but must be found by all queries
+  Raz::Entity& floor = world.addEntityWithComponent<Raz::Transform>();
+  floor.addComponent<Raz::Collider>(Raz::Plane(-2.f, Raz::Axis::Y));
+
+  // Adding many other colliders for the query structure to have several levels
+  for (int i = 0; i < 50; ++i)
+    world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(static_cast<float>(i) * 3.f, 10.f, 0.f)).addComponent<Raz::Collider>(Raz::Sphere(Raz::Vec3f(0.f), 1.f));
+
+  world.update({});
+
+  Raz::RayHit hit;
+  CHECK(physics.raycast(Raz::Ray(Raz::Vec3f(0.f), -Raz::Axis::Z), &hit) == &sphere);
+  CHECK(hit.position == Raz::Vec3f(0.f, 0.f, -4.f));
+  CHECK(hit.normal == Raz::Axis::Z);
+  CHECK(hit.distance == 4.f);
+  CHECK(physics.raycast(Raz::Ray(Raz::Vec3f(0.f), -Raz::Axis::Z), nullptr, 3.f) == nullptr);
+  CHECK(physics.raycast(Raz::Ray(Raz::Vec3f(0.f), -Raz::Axis::Y), &hit) == &floor);
+  CHECK(hit.distance == 2.f);
+
+  const std::vector<Raz::ColliderHit> hits = physics.raycastAll(Raz::Ray(Raz::Vec3f(0.f), -Raz::Axis::Z));
+  REQUIRE(hits.size() == 2);
+  CHECK(hits[0].entity == &sphere);
+  CHECK(hits[1].entity == &box);
+  CHECK(hits[1].hit.position == Raz::Vec3f(0.f, 0.f, -9.f));
+  CHECK(hits[1].hit.distance == 9.f);
+
+  // Colliders are only found if they share a layer with the query's mask
+  CHECK(physics.raycast(Raz::Ray(Raz::Vec3f(0.f), Raz::Axis::X), nullptr, Raz::PhysicsSystem::maxQueryDistance, 1) == nullptr);
+  CHECK(physics.raycast(Raz::Ray(Raz::Vec3f(0.f), Raz::Axis::X), &hit, Raz::PhysicsSystem::maxQueryDistance, 2) == &layeredBox);
+  CHECK(hit.distance == 9.f);
+
+  std::vector<Raz::Entity*> overlapping = physics.overlap(Raz::Sphere(Raz::Vec3f(0.f, 0.f, -7.5f), 1.8f));
+  CHECK(overlapping.size() == 2);
+  CHECK(std::ranges::find(overlapping, &sphere) != overlapping.cend());
+  CHECK(std::ranges::find(overlapping, &box) != overlapping.cend());
+
+  overlapping = physics.overlap(Raz::Sphere(Raz::Vec3f(0.f, 0.f, -7.5f), 2.6f));
+  CHECK(overlapping.size() == 3); // The floor is now reached
+
+  overlapping = physics.overlap(Raz::AABB(Raz::Vec3f(8.f, -1.f, -1.f), Raz::Vec3f(9.5f, 1.f, 1.f)));
+  REQUIRE(overlapping.size() == 1);
+  CHECK(overlapping.front() == &layeredBox);
+  CHECK(physics.overlap(Raz::AABB(Raz::Vec3f(8.f, -1.f, -1.f), Raz::Vec3f(9.5f, 1.f, 1.f)), 1).empty());
+
+  // Sweeping a sphere finds the first collider it touches, the hit position being the contact point
+  CHECK(physics.sweep(Raz::Sphere(Raz::Vec3f(0.f), 0.5f), -Raz::Axis::Z, &hit) == &sphere);
+  CHECK(hit.position == Raz::Vec3f(0.f, 0.f, -4.f));
+  CHECK(hit.distance == 3.5f);
+  CHECK(physics.sweep(Raz::Sphere(Raz::Vec3f(0.f), 0.5f), -Raz::Axis::Y, &hit) == &floor);
+  CHECK(hit.position == Raz::Vec3f(0.f, -2.f, 0.f));
+  CHECK(hit.distance == 1.5f);
+  CHECK(physics.sweep(Raz::Sphere(Raz::Vec3f(0.f, 0.f, 3.f), 0.5f), -Raz::Axis::X, &hit) == nullptr);
+
+  const std::vector<Raz::ColliderHit> batchHits = physics.raycastBatch({ Raz::Ray(Raz::Vec3f(0.f), -Raz::Axis::Z),
+                                                                         Raz::Ray(Raz::Vec3f(0.f), Raz::Axis::Z),
+                                                                         Raz::Ray(Raz::Vec3f(30.f, 0.f, 0.f), Raz::Axis::Y) });
+  REQUIRE(batchHits.size() == 3);
+  CHECK(batchHits[0].entity == &sphere);
+  CHECK(batchHits[1].entity == nullptr);
+  CHECK(batchHits[2].entity != nullptr);
+  CHECK(batchHits[2].hit.distance == 9.f);
+
+  const std::vector<std::vector<Raz::Entity*>> batchOverlaps = physics.overlapBatch({ Raz::Sphere(Raz::Vec3f(0.f, 0.f, -5.f), 0.5f),
+                                                                                      Raz::Sphere(Raz::Vec3f(0.f, 5.f, 0.f), 0.5f) });
+  REQUIRE(batchOverlaps.size() == 2);
+  CHECK(batchOverlaps[0] == std::vector<Raz::Entity*>{ &sphere });
+  CHECK(batchOverlaps[1].empty());
+
+  // Moving & removing colliders updates the query structure
+  sphere.getComponent<Raz::Transform>().setPosition(Raz::Vec3f(0.f, 0.f, -20.f));
+  world.update({});
+  CHECK(physics.raycast(Raz::Ray(Raz::Vec3f(0.f), -Raz::Axis::Z), &hit) == &box);
+  CHECK(hit.distance == 9.f);
+
+  world.removeEntity(box);
+  world.update({});
+  CHECK(physics.raycast(Raz::Ray(Raz::Vec3f(0.f), -Raz::Axis::Z), &hit) == &sphere);
+  CHECK(hit.distance == 19.f);
+  // An entity losing its collider but keeping its rigid body stays linked, yet must no longer be found by the queries
+  sphere.addComponent<Raz::RigidBody>(0.f, 0.f);
+  floor.addComponent<Raz::RigidBody>(0.f, 0.f);
+  world.update({});
+
+  sphere.removeComponent<Raz::Collider>();
+  floor.removeComponent<Raz::Collider>();
+  CHECK(physics.raycast(Raz::Ray(Raz::Vec3f(0.f), -Raz::Axis::Z)) == nullptr);
+  CHECK(physics.raycast(Raz::Ray(Raz::Vec3f(0.f), -Raz::Axis::Y)) == nullptr);
+  CHECK(physics.overlap(Raz::Sphere(Raz::Vec3f(0.f, 0.f, -20.f), 5.f)).empty());
+
+  CHECK_NOTHROW(world.update({}));
+  CHECK(physics.raycast(Raz::Ray(Raz::Vec3f(0.f), -Raz::Axis::Z)) == nullptr);
+  CHECK(physics.overlap(Raz::Sphere(Raz::Vec3f(0.f, 0.f, -20.f), 5.f)).empty());
+  CHECK(physics.sweep(Raz::Sphere(Raz::Vec3f(0.f), 0.5f), -Raz::Axis::Y) == nullptr);
+}
@@ -31,3 +31,30 @@ TEST_CASE("RigidBody basic", "[physics]") {
   rigidBody.setVelocity(Raz::Vec3f(0.f, 1.12f, -3.f));
   CHECK(rigidBody.getVelocity() == Raz::Vec3f(0.f, 1.12f, -3.f));
 }
+
+TEST_CASE("RigidBody sleeping", "[physics]") {
+  Raz::RigidBody rigidBody(1.f, 0.5f);
+  CHECK_FALSE(rigidBody.isSleeping());
+
+  rigidBody.setVelocity(Raz::Vec3f(1.f, 2.f, 3.f));
+  rigidBody.putToSleep();
+  CHECK(rigidBody.isSleeping());
+  CHECK(rigidBody.getVelocity() == Raz::Vec3f(0.f)); // A sleeping rigid body does not move
+
+  rigidBody.wakeUp();
+  CHECK_FALSE(rigidBody.isSleeping());
+
+  // Setting a null velocity or the same forces keeps the rigid body asleep
+  rigidBody.putToSleep();
+  rigidBody.setVelocity(Raz::Vec3f(0.f));
+  rigidBody.setForces(Raz::Vec3f(0.f));
+  CHECK(rigidBody.isSleeping());
+
+  // Any other velocity or forces wakes it up
+  rigidBody.setVelocity(Raz::Vec3f(0.f, 1.f, 0.f));
+  CHECK_FALSE(rigidBody.isSleeping());
+
+  rigidBody.putToSleep();
+  rigidBody.setForces(Raz::Vec3f(1.f, 0.f, 0.f));
+  CHECK_FALSE(rigidBody.isSleeping());
+}
@@ -0,0 +1,87 @@
+#include "RaZ/Data/Mesh.hpp"
+#include "RaZ/Math/Angle.hpp"
+#include "RaZ/Physics/TriangleMesh.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+
+using namespace Raz::Literals;
+
+TEST_CASE("TriangleMesh creation", "[physics]") {
+  CHECK_THROWS(Raz::TriangleMesh(std::vector<Raz::Triangle>()));
+
+  const Raz::TriangleMesh mesh(Raz::Mesh(Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f))));
+  CHECK(mesh.getType() == Raz::ShapeType::TRIANGLE_MESH);
+  CHECK(mesh.getTriangles().size() == 12);
+  CHECK(mesh.computeCentroid() == Raz::Vec3f(0.f));
+  CHECK(mesh.computeBoundingBox() == Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f)));
+
+  std::vector<std::size_t> triangleIndices;
+  mesh.findTriangles(Raz::AABB(Raz::Vec3f(0.5f, -0.5f, -0.5f), Raz::Vec3f(2.f, 0.5f, 0.5f)), triangleIndices);
+  CHECK(triangleIndices.size() == 2); // Only the right face's triangles are overlapped
+  CHECK(std::ranges::all_of(triangleIndices, [&mesh] (std::size_t index) { return (mesh.getTriangles()[index].computeNormal() == Raz::Axis::X); }));
+}
+
+TEST_CASE("TriangleMesh point containment", "[physics]") {
+  const Raz::TriangleMesh mesh(Raz::Mesh(Raz::Sphere(Raz::Vec3f(0.f), 1.f), 1, Raz::SphereMeshType::ICO));
+
+  CHECK(mesh.contains(Raz::Vec3f(0.f)));
+  CHECK(mesh.contains(Raz::Vec3f(0.5f, -0.5f, 0.25f)));
+  CHECK_FALSE(mesh.contains(Raz::Vec3f(1.5f, 0.f, 0.f)));
+  CHECK_FALSE(mesh.contains(Raz::Vec3f(0.8f, 0.8f, 0.f)));
+}
+
+TEST_CASE("TriangleMesh shapes intersection", "[physics]") {
+  // A concave mesh shaped like a V, opened upward
+  const Raz::TriangleMesh mesh({
+    Raz::Triangle(Raz::Vec3f(-2.f, 2.f, -1.f), Raz::Vec3f(-2.f, 2.f, 1.f), Raz::Vec3f(0.f, 0.f, 1.f)),
+    Raz::Triangle(Raz::Vec3f(-2.f, 2.f, -1.f), Raz::Vec3f(0.f, 0.f, 1.f), Raz::Vec3f(0.f, 0.f, -1.f)),
+    Raz::Triangle(Raz::Vec3f(0.f, 0.f, -1.f), Raz::Vec3f(0.f, 0.f, 1.f), Raz::Vec3f(2.f, 2.f, 1.f)),
+    Raz::Triangle(Raz::Vec3f(0.f, 0.f, -1.f), Raz::Vec3f(2.f, 2.f, 1.f), Raz::Vec3f(2.f, 2.f, -1.f))
+  });
+
+  // The sphere is inside the V, without touching any side
+  CHECK_FALSE(mesh.intersects(Raz::Sphere(Raz::Vec3f(0.f, 1.5f, 0.f), 0.5f)));
+  CHECK(mesh.intersects(Raz::Sphere(Raz::Vec3f(0.f, 1.5f, 0.f), 1.1f)));
+
+  CHECK(mesh.intersects(Raz::Line(Raz::Vec3f(0.f, 1.f, 0.f), Raz::Vec3f(0.f, -1.f, 0.f))));
+  CHECK_FALSE(mesh.intersects(Raz::Line(Raz::Vec3f(0.f, 1.f, 0.f), Raz::Vec3f(0.f, 0.5f, 0.f))));
+
+  CHECK(mesh.intersects(Raz::Plane(1.f, Raz::Axis::Y)));
+  CHECK_FALSE(mesh.intersects(Raz::Plane(3.f, Raz::Axis::Y)));
+
+  CHECK(mesh.intersects(Raz::AABB(Raz::Vec3f(1.f, 0.5f, -0.5f), Raz::Vec3f(1.5f, 1.5f, 0.5f))));
+  CHECK_FALSE(mesh.intersects(Raz::AABB(Raz::Vec3f(-0.25f, 1.f, -0.5f), Raz::Vec3f(0.25f, 1.5f, 0.5f))));
+
+  CHECK(mesh.intersects(Raz::OBB(Raz::Vec3f(1.f, 0.5f, -0.5f), Raz::Vec3f(1.5f, 1.5f, 0.5f), Raz::Quaternionf(30_deg, Raz::Axis::Z))));
+  CHECK(mesh.intersects(Raz::Triangle(Raz::Vec3f(-3.f, 1.f, 0.f), Raz::Vec3f(3.f, 1.f, 0.f), Raz::Vec3f(0.f, 3.f, 0.f))));
+}
+
+TEST_CASE("TriangleMesh ray intersection", "[physics]") {
+  const Raz::TriangleMesh mesh(Raz::Mesh(Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f))));
+
+  Raz::RayHit hit;
+  CHECK(mesh.intersects(Raz::Ray(Raz::Vec3f(0.25f, 5.f, 0.5f), -Raz::Axis::Y), &hit));
+  CHECK(hit.position == Raz::Vec3f(0.25f, 1.f, 0.5f));
+  CHECK(hit.distance == 4.f);
+
+  // The closest face is found, even if others are hit behind it
+  CHECK(mesh.intersects(Raz::Ray(Raz::Vec3f(0.25f, -5.f, 0.5f), Raz::Axis::Y), &hit));
+  CHECK(hit.position == Raz::Vec3f(0.25f, -1.f, 0.5f));
+  CHECK(hit.distance == 4.f);
+
+  CHECK_FALSE(mesh.intersects(Raz::Ray(Raz::Vec3f(2.f, 5.f, 0.5f), -Raz::Axis::Y), &hit));
+}
+
+TEST_CASE("TriangleMesh translation & projection", "[physics]") {
+  Raz::TriangleMesh mesh(Raz::Mesh(Raz::AABB(Raz::Vec3f(-1.f), Raz::Vec3f(1.f))));
+  mesh.translate(Raz::Vec3f(0.f, 3.f, 0.f));
+
+  CHECK(mesh.computeBoundingBox() == Raz::AABB(Raz::Vec3f(-1.f, 2.f, -1.f), Raz::Vec3f(1.f, 4.f, 1.f)));
+  CHECK(mesh.intersects(Raz::Sphere(Raz::Vec3f(0.f, 1.5f, 0.f), 0.6f)));
+  CHECK_FALSE(mesh.intersects(Raz::Sphere(Raz::Vec3f(0.f), 0.6f)));
+
+  CHECK(mesh.computeProjection(Raz::Vec3f(0.5f, 0.f, 0.25f)) == Raz::Vec3f(0.5f, 2.f, 0.25f));
+  CHECK(mesh.computeProjection(Raz::Vec3f(0.f, 3.f, 0.75f)) == Raz::Vec3f(0.f, 3.f, 1.f));
+}
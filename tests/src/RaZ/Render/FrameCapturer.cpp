@@ -0,0 +1,116 @@
+#include "RaZ/Data/Image.hpp"
+#include "RaZ/Render/Framebuffer.hpp"
+#include "RaZ/Render/FrameCapturer.hpp"
+#include "RaZ/Render/Renderer.hpp"
+#include "RaZ/Render/Texture.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace {
+
+void clearFramebuffer(const Raz::Framebuffer& framebuffer, float value) {
+  framebuffer.bind();
+  Raz::Renderer::clearColor(value, value, value, 1.f);
+  Raz::Renderer::clear(Raz::MaskType::COLOR);
+}
+
+} // namespace
+
+TEST_CASE("FrameCapturer formats", "[render]") {
+  CHECK_THROWS(Raz::FrameCapturer(1, 1, Raz::TextureFormat::DEPTH_STENCIL)); // The format must be representable by an image
+
+  const Raz::FrameCapturer depthCapturer(1, 1, Raz::TextureFormat::DEPTH, Raz::PixelDataType::UBYTE);
+  CHECK(depthCapturer.getDataType() == Raz::PixelDataType::FLOAT); // Depth is always recovered as floating-point values
+  CHECK(depthCapturer.getPendingCaptureCount() == 0);
+}
+
+TEST_CASE("FrameCapturer capture", "[render]") {
+  Raz::Renderer::setPixelStorage(Raz::PixelStorage::PACK_ALIGNMENT, 1);
+
+  const auto colorBuffer = Raz::Texture2D::create(3, 2, Raz::TextureColorspace::RGB);
+  Raz::Framebuffer framebuffer;
+  framebuffer.addColorBuffer(colorBuffer, 0);
+
+  Raz::FrameCapturer capturer(3, 2);
+
+  // More frames than there are buffers are captured; none must be dropped, the oldest ones being waited for
+  std::vector<std::promise<Raz::Image>> imagePromises(Raz::FrameCapturer::bufferCount * 2);
+
+  for (std::size_t frameIndex = 0; frameIndex < imagePromises.size(); ++frameIndex) {
+    clearFramebuffer(framebuffer, static_cast<float>(frameIndex) / static_cast<float>(imagePromises.size()));
+    capturer.capture([&promise = imagePromises[frameIndex]] (Raz::Image&& image) { promise.set_value(std::move(image)); });
+    CHECK(capturer.getPendingCaptureCount() <= Raz::FrameCapturer::bufferCount);
+  }
+
+  framebuffer.unbind();
+
+  capturer.flush();
+  CHECK(capturer.getPendingCaptureCount() == 0);
+
+  for (std::size_t frameIndex = 0; frameIndex < imagePromises.size(); ++frameIndex) {
+    const Raz::Image image = imagePromises[frameIndex].get_future().get();
+
+    REQUIRE(image.getWidth() == 3);
+    REQUIRE(image.getHeight() == 2);
+    CHECK(image.getColorspace() == Raz::ImageColorspace::RGB);
+    CHECK(image.getDataType() == Raz::ImageDataType::BYTE);
+
+    const auto expectedValue = static_cast<uint8_t>(static_cast<float>(frameIndex) / static_cast<float>(imagePromises.size()) * 255.f + 0.5f);
+    CHECK(image.recoverByteValue(0, 0, 0) == expectedValue);
+    CHECK(image.recoverByteValue(2, 1, 2) == expectedValue);
+  }
+
+  // Resizing the capturer changes the size of the delivered frames
+  capturer.resize(1, 1);
+
+  std::promise<Raz::Image> resizedPromise;
+  capturer.capture([&resizedPromise] (Raz::Image&& image) { resizedPromise.set_value(std::move(image)); });
+  capturer.flush();
+
+  const Raz::Image resizedImage = resizedPromise.get_future().get();
+  CHECK(resizedImage.getWidth() == 1);
+  CHECK(resizedImage.getHeight() == 1);
+}
+
+TEST_CASE("FrameCapturer callbacks", "[render]") {
+  std::atomic<std::size_t> runningCallbackCount    = 0;
+  std::atomic<std::size_t> maxRunningCallbackCount = 0;
+  std::atomic<std::size_t> finishedCallbackCount   = 0;
+
+  // Catch's assertions can't be used from the worker threads on which the frames are delivered
+  const auto callback = [&] (Raz::Image&&) noexcept {
+    const std::size_t runningCount = ++runningCallbackCount;
+
+    std::size_t maxRunningCount = maxRunningCallbackCount;
+    while (runningCount > maxRunningCount && !maxRunningCallbackCount.compare_exchange_weak(maxRunningCount, runningCount)) {}
+
+    // The callbacks are slower than the captures, which would otherwise pile them up
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+    --runningCallbackCount;
+    ++finishedCallbackCount;
+  };
+
+  {
+    Raz::FrameCapturer capturer(1, 1);
+
+    for (std::size_t frameIndex = 0; frameIndex < Raz::FrameCapturer::bufferCount * 4; ++frameIndex)
+      capturer.capture(callback);
+
+    // Flushing waits for all the callbacks to have been executed
+    capturer.flush();
+    CHECK(finishedCallbackCount == Raz::FrameCapturer::bufferCount * 4);
+    CHECK(maxRunningCallbackCount <= Raz::FrameCapturer::bufferCount);
+
+    capturer.capture(callback);
+  }
+
+  // Destroying the capturer waits for its callbacks as well, which can thus safely refer to what it outlives
+  CHECK(finishedCallbackCount == Raz::FrameCapturer::bufferCount * 4 + 1);
+}
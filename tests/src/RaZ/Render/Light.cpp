@@ -0,0 +1,36 @@
+#include "RaZ/Render/Light.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Raz::Literals;
+
+TEST_CASE("Light updated status", "[render]") {
+  Raz::Light light(Raz::LightType::POINT, 1.f);
+  CHECK(light.hasUpdated()); // A newly created light has yet to be sent
+
+  light.setUpdated(false);
+  CHECK_FALSE(light.hasUpdated());
+
+  light.setEnergy(2.f);
+  CHECK(light.hasUpdated());
+  light.setUpdated(false);
+
+  light.setColor(Raz::ColorPreset::Red);
+  CHECK(light.hasUpdated());
+  light.setUpdated(false);
+
+  light.setType(Raz::LightType::SPOT);
+  light.setUpdated(false);
+  light.setDirection(Raz::Axis::X);
+  CHECK(light.hasUpdated());
+  light.setUpdated(false);
+
+  light.setAngle(90_deg);
+  CHECK(light.hasUpdated());
+
+  // Getters leave the status untouched
+  light.setUpdated(false);
+  static_cast<void>(light.getEnergy());
+  static_cast<void>(light.computeInfluenceRadius());
+  CHECK_FALSE(light.hasUpdated());
+}
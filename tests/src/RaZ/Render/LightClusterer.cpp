@@ -0,0 +1,131 @@
+#include "RaZ/Render/Camera.hpp"
+#include "RaZ/Render/Light.hpp"
+#include "RaZ/Render/LightClusterer.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <span>
+
+using namespace Raz::Literals;
+
+namespace {
+
+bool isLightInCluster(const Raz::LightClusterer& clusterer, unsigned int lightIndex, unsigned int clusterX, unsigned int clusterY, unsigned int clusterZ) {
+  const Raz::LightCluster& cluster = clusterer.getCluster(clusterX, clusterY, clusterZ);
+  const std::span<const unsigned int> clusterIndices(clusterer.getLightIndices().data() + cluster.offset, cluster.count);
+  return (std::ranges::find(clusterIndices, lightIndex) != clusterIndices.end());
+}
+
+} // namespace
+
+TEST_CASE("Light influence radius", "[render]") {
+  CHECK(Raz::Light(Raz::LightType::POINT, 1.f).computeInfluenceRadius() == 16.f);
+  CHECK(Raz::Light(Raz::LightType::POINT, 4.f).computeInfluenceRadius(0.25f) == 4.f);
+  CHECK(Raz::Light(Raz::LightType::SPOT, -Raz::Axis::Z, 1.f, 45_deg, Raz::Color(0.25f, 0.f, 0.f)).computeInfluenceRadius() == 8.f);
+  CHECK(Raz::Light(Raz::LightType::POINT, 0.f).computeInfluenceRadius() == 0.f);
+  CHECK(Raz::Light(Raz::LightType::DIRECTIONAL, -Raz::Axis::Y, 1.f).computeInfluenceRadius() == std::numeric_limits<float>::infinity());
+}
+
+TEST_CASE("LightClusterer depth slices", "[render]") {
+  const float depthScale = Raz::LightClusterer::computeDepthScale(0.1f, 1000.f);
+
+  CHECK(Raz::LightClusterer::computeDepthSlice(0.1f, 0.1f, depthScale) == 0);
+  CHECK(Raz::LightClusterer::computeDepthSlice(0.f, 0.1f, depthScale) == 0); // Depths closer than the near plane are clamped
+  CHECK(Raz::LightClusterer::computeDepthSlice(-5.f, 0.1f, depthScale) == 0);
+  CHECK(Raz::LightClusterer::computeDepthSlice(1.01f, 0.1f, depthScale) == 6); // The depth range spans 4 decades, each being split in 6 slices
+  CHECK(Raz::LightClusterer::computeDepthSlice(10.1f, 0.1f, depthScale) == 12);
+  CHECK(Raz::LightClusterer::computeDepthSlice(999.f, 0.1f, depthScale) == Raz::LightClusterer::clusterCountZ - 1);
+  CHECK(Raz::LightClusterer::computeDepthSlice(5000.f, 0.1f, depthScale) == Raz::LightClusterer::clusterCountZ - 1);
+}
+
+TEST_CASE("LightClusterer perspective clustering", "[render]") {
+  const Raz::Camera camera(1600, 900, 90_deg, 0.1f, 100.f);
+
+  Raz::LightClusterer clusterer;
+  clusterer.computeClusters({
+    Raz::ClusteredLight{ Raz::Vec3f(0.f, 0.f, -10.f), 1.f, 3 }, // In front of the camera
+    Raz::ClusteredLight{ Raz::Vec3f(0.f, 0.f, 10.f), 1.f, 4 },  // Behind the camera
+    Raz::ClusteredLight{ Raz::Vec3f(50.f, 0.f, -10.f), 1.f, 5 }, // Outside of the frustum, to the right
+    Raz::ClusteredLight{ Raz::Vec3f(0.f, 0.f, -10.f), 0.f, 6 },  // Without any influence
+    Raz::ClusteredLight{ Raz::Vec3f(0.f, 0.f, -500.f), 10.f, 7 } // Beyond the far plane
+  }, Raz::Mat4f::identity(), camera.getProjectionMatrix(), 0.1f, 100.f);
+
+  REQUIRE(clusterer.getClusters().size() == Raz::LightClusterer::clusterCount);
+  CHECK(std::ranges::all_of(clusterer.getLightIndices(), [] (unsigned int index) noexcept { return (index == 3); }));
+
+  // The light spans depths from 9 to 11, respectively in the slices 15 & 16, and is at the center of the screen
+  CHECK(isLightInCluster(clusterer, 3, 7, 4, 15));
+  CHECK(isLightInCluster(clusterer, 3, 8, 4, 15));
+  CHECK(isLightInCluster(clusterer, 3, 7, 4, 16));
+  CHECK(isLightInCluster(clusterer, 3, 8, 4, 16));
+  CHECK_FALSE(isLightInCluster(clusterer, 3, 7, 4, 14));
+  CHECK_FALSE(isLightInCluster(clusterer, 3, 7, 4, 17));
+  CHECK_FALSE(isLightInCluster(clusterer, 3, 0, 0, 15));
+  CHECK_FALSE(isLightInCluster(clusterer, 3, 15, 8, 16));
+
+  unsigned int totalCount = 0;
+  for (const Raz::LightCluster& cluster : clusterer.getClusters())
+    totalCount += cluster.count;
+  CHECK(totalCount == clusterer.getLightIndices().size());
+
+  // A light containing the camera covers the whole screen, up to its farthest depth
+  clusterer.computeClusters({ Raz::ClusteredLight{ Raz::Vec3f(0.f), 1.f, 0 } }, Raz::Mat4f::identity(), camera.getProjectionMatrix(), 0.1f, 100.f);
+
+  const unsigned int lastSlice = Raz::LightClusterer::computeDepthSlice(1.f, 0.1f, Raz::LightClusterer::computeDepthScale(0.1f, 100.f));
+  CHECK(clusterer.getLightIndices().size() == Raz::LightClusterer::clusterCountX * Raz::LightClusterer::clusterCountY * (lastSlice + 1));
+  CHECK(isLightInCluster(clusterer, 0, 0, 0, 0));
+  CHECK(isLightInCluster(clusterer, 0, 15, 8, lastSlice));
+  CHECK_FALSE(isLightInCluster(clusterer, 0, 15, 8, lastSlice + 1));
+
+  // Moving the camera, the first light is now behind it
+  const Raz::Mat4f viewMat = Raz::Mat4f(1.f, 0.f, 0.f,  0.f,
+                                        0.f, 1.f, 0.f,  0.f,
+                                        0.f, 0.f, 1.f, 20.f,
+                                        0.f, 0.f, 0.f,  1.f);
+  clusterer.computeClusters({ Raz::ClusteredLight{ Raz::Vec3f(0.f, 0.f, -10.f), 1.f, 0 } }, viewMat, camera.getProjectionMatrix(), 0.1f, 100.f);
+  CHECK(clusterer.getLightIndices().empty());
+}
+
+TEST_CASE("LightClusterer orthographic clustering", "[render]") {
+  Raz::Camera camera(100, 100, 90_deg, 0.1f, 100.f, Raz::ProjectionType::ORTHOGRAPHIC);
+  camera.setOrthographicBound(10.f);
+
+  Raz::LightClusterer clusterer;
+  clusterer.computeClusters({
+    Raz::ClusteredLight{ Raz::Vec3f(9.f, -9.f, -10.f), 0.5f, 0 },
+    Raz::ClusteredLight{ Raz::Vec3f(0.f, 0.f, 10.f), 0.5f, 1 } // Behind the camera, which can still be seen with an orthographic projection
+  }, Raz::Mat4f::identity(), camera.getProjectionMatrix(), 0.1f, 100.f);
+
+  // Without perspective, the light remains in the bottom-right corner whatever its depth
+  CHECK(isLightInCluster(clusterer, 0, 15, 0, 15));
+  CHECK_FALSE(isLightInCluster(clusterer, 0, 8, 4, 15));
+
+  CHECK(isLightInCluster(clusterer, 1, 8, 4, 0));
+  CHECK_FALSE(isLightInCluster(clusterer, 1, 8, 4, 1));
+}
+
+TEST_CASE("LightClusterer parallel clustering", "[render]") {
+  const Raz::Camera camera(1600, 900, 90_deg, 0.1f, 100.f);
+
+  // Enough lights are given for their clusters to be computed in parallel; the indices must still be stored in order in each cluster
+  std::vector<Raz::ClusteredLight> lights;
+  for (unsigned int lightIndex = 0; lightIndex < 1000; ++lightIndex)
+    lights.emplace_back(Raz::ClusteredLight{ Raz::Vec3f(static_cast<float>(lightIndex % 2) * 2.f - 1.f, 0.f, -10.f), 0.5f, lightIndex });
+
+  Raz::LightClusterer clusterer;
+  clusterer.computeClusters(lights, Raz::Mat4f::identity(), camera.getProjectionMatrix(), 0.1f, 100.f);
+
+  const Raz::LightCluster& leftCluster = clusterer.getCluster(7, 4, 15);
+  REQUIRE(leftCluster.count == 500);
+  const Raz::LightCluster& rightCluster = clusterer.getCluster(8, 4, 15);
+  REQUIRE(rightCluster.count == 500);
+
+  const std::vector<unsigned int>& indices = clusterer.getLightIndices();
+
+  for (unsigned int i = 0; i < 500; ++i) {
+    CHECK(indices[leftCluster.offset + i] == i * 2);
+    CHECK(indices[rightCluster.offset + i] == i * 2 + 1);
+  }
+}
@@ -1,4 +1,8 @@
+#include "RaZ/Render/ChromaticAberrationRenderProcess.hpp"
+#include "RaZ/Render/FilmGrainRenderProcess.hpp"
+#include "RaZ/Render/PixelizationRenderProcess.hpp"
 #include "RaZ/Render/RenderGraph.hpp"
+#include "RaZ/Render/VignetteRenderProcess.hpp"
 
 #include <catch2/catch_test_macros.hpp>
 
@@ -25,3 +29,223 @@ TEST_CASE("RenderGraph validity", "[render]") {
   firstPass.addReadTexture(depthTexture, "");
   CHECK_FALSE(graph.isValid()); // The depth texture is set as both read & write usages in the geometry buffer; at least one pass is invalid, thus the graph is
 }
+
+TEST_CASE("RenderGraph compilation", "[render]") {
+  Raz::RenderGraph graph;
+  CHECK_FALSE(graph.isCompiled());
+
+  graph.compile();
+  CHECK(graph.isCompiled());
+  CHECK(graph.getExecutionList().empty());
+
+  Raz::RenderPass& firstPass = graph.addNode();
+  CHECK_FALSE(graph.isCompiled()); // Adding a pass requires the graph to be compiled again
+
+  Raz::RenderPass& secondPass = graph.addNode();
+  Raz::RenderPass& thirdPass  = graph.addNode();
+  Raz::RenderPass& fourthPass = graph.addNode();
+
+  // The passes are added in the reverse order of their dependencies; the execution list must still have them after their parents
+  graph.getGeometryPass().addChildren(thirdPass);
+  thirdPass.addChildren(secondPass);
+  secondPass.addChildren(firstPass);
+
+  graph.compile();
+  CHECK(graph.getExecutionList() == std::vector<const Raz::RenderPass*>{ &thirdPass, &secondPass, &firstPass, &fourthPass });
+
+  // Disabling the first pass, no other one consumes the second & third passes' outputs, which are thus culled
+  firstPass.disable();
+  CHECK_FALSE(graph.isCompiled());
+
+  graph.compile();
+  CHECK(graph.getExecutionList() == std::vector<const Raz::RenderPass*>{ &fourthPass });
+
+  // The fourth pass now needs the third's output, which is executed again
+  thirdPass.addChildren(fourthPass);
+  graph.compile();
+  CHECK(graph.getExecutionList() == std::vector<const Raz::RenderPass*>{ &thirdPass, &fourthPass });
+
+  graph.removeNode(fourthPass);
+  CHECK_FALSE(graph.isCompiled());
+  graph.compile();
+  CHECK(graph.getExecutionList().empty());
+}
+
+TEST_CASE("RenderGraph screen effects fusion", "[render]") {
+  Raz::RenderGraph graph;
+
+  auto& chromaticAberration = graph.addRenderProcess<Raz::ChromaticAberrationRenderProcess>();
+  auto& vignette            = graph.addRenderProcess<Raz::VignetteRenderProcess>();
+  auto& filmGrain           = graph.addRenderProcess<Raz::FilmGrainRenderProcess>();
+  auto& pixelization        = graph.addRenderProcess<Raz::PixelizationRenderProcess>();
+
+  const auto inputBuffer  = Raz::Texture2D::create(2, 2, Raz::TextureColorspace::RGB);
+  const auto firstBuffer  = Raz::Texture2D::create(2, 2, Raz::TextureColorspace::RGB);
+  const auto secondBuffer = Raz::Texture2D::create(2, 2, Raz::TextureColorspace::RGB);
+  const auto thirdBuffer  = Raz::Texture2D::create(2, 2, Raz::TextureColorspace::RGB);
+  const auto outputBuffer = Raz::Texture2D::create(2, 2, Raz::TextureColorspace::RGB);
+
+  chromaticAberration.setInputBuffer(inputBuffer);
+  chromaticAberration.setOutputBuffer(firstBuffer);
+  vignette.setInputBuffer(firstBuffer);
+  vignette.setOutputBuffer(secondBuffer);
+  filmGrain.setInputBuffer(secondBuffer);
+  filmGrain.setOutputBuffer(thirdBuffer);
+  pixelization.setInputBuffer(thirdBuffer);
+  pixelization.setOutputBuffer(outputBuffer);
+
+  chromaticAberration.addChild(vignette);
+  vignette.addChild(filmGrain);
+  filmGrain.addChild(pixelization);
+
+  // The pixelization samples its input at arbitrary coordinates & cannot be fused with the previous effects
+  graph.compile();
+  REQUIRE(graph.getFusedPassCount() == 1);
+  REQUIRE(graph.getExecutionList().size() == 2);
+  CHECK(graph.getExecutionList()[1] == &graph.getNode(3));
+
+  const Raz::RenderPass& fusedPass = *graph.getExecutionList().front();
+  CHECK(fusedPass.getName() == "Chromatic aberration + Vignette + Film grain");
+  CHECK(&fusedPass.getReadTexture("uniBuffer") == inputBuffer.get());
+  REQUIRE(fusedPass.getFramebuffer().getColorBufferCount() == 1);
+  CHECK(&fusedPass.getFramebuffer().getColorBuffer(0) == thirdBuffer.get());
+
+  // The effects' parameters are forwarded to the fused pass
+  CHECK(fusedPass.getProgram().hasTexture("uniMask_0"));
+  CHECK(fusedPass.getProgram().getAttribute<float>("uniStrength_1") == 0.25f);
+
+  vignette.setStrength(0.5f);
+  graph.compile();
+  CHECK(fusedPass.getProgram().getAttribute<float>("uniStrength_1") == 0.5f); // The fused pass is kept as the chain is unchanged
+
+  // Reading an intermediate buffer from another pass prevents it from being fused away
+  Raz::RenderPass& readingPass = graph.addNode();
+  readingPass.addReadTexture(secondBuffer, "uniBuffer");
+  graph.compile();
+  REQUIRE(graph.getFusedPassCount() == 1);
+  CHECK(graph.getExecutionList().front()->getName() == "Chromatic aberration + Vignette");
+
+  graph.removeNode(readingPass);
+  filmGrain.disable();
+  graph.compile();
+  CHECK(graph.getFusedPassCount() == 0); // The chain is broken, and the first two effects are culled as their output is not used
+  CHECK(graph.getExecutionList() == std::vector<const Raz::RenderPass*>{ &graph.getNode(3) });
+
+  // The fusion can be disabled, for instance if the intermediate buffers are needed outside of the graph
+  filmGrain.enable();
+  graph.compile();
+  CHECK(graph.isScreenEffectFusionEnabled());
+  CHECK(graph.getFusedPassCount() == 1);
+
+  graph.disableScreenEffectFusion();
+  CHECK_FALSE(graph.isScreenEffectFusionEnabled());
+  CHECK_FALSE(graph.isCompiled());
+  graph.compile();
+  CHECK(graph.getFusedPassCount() == 0);
+  CHECK(graph.getExecutionList().size() == 4);
+
+  graph.enableScreenEffectFusion();
+  graph.compile();
+  CHECK(graph.getFusedPassCount() == 1);
+}
+
+TEST_CASE("RenderGraph fused transient textures", "[render]") {
+  Raz::RenderGraph graph;
+  graph.resizeViewport(8, 8);
+
+  const Raz::Texture2DPtr inputTexture        = graph.addTransientTexture(Raz::TextureColorspace::RGB, Raz::TextureDataType::FLOAT16);
+  const Raz::Texture2DPtr intermediateTexture = graph.addTransientTexture(Raz::TextureColorspace::RGB, Raz::TextureDataType::FLOAT16);
+  const Raz::Texture2DPtr otherTexture        = graph.addTransientTexture(Raz::TextureColorspace::RGB, Raz::TextureDataType::FLOAT16);
+  const auto outputBuffer = Raz::Texture2D::create(8, 8, Raz::TextureColorspace::RGB);
+
+  Raz::RenderPass& inputPass = graph.addNode();
+  inputPass.addWriteColorTexture(inputTexture, 0);
+
+  auto& vignette = graph.addRenderProcess<Raz::VignetteRenderProcess>();
+  vignette.setInputBuffer(inputTexture);
+  vignette.setOutputBuffer(intermediateTexture);
+  vignette.addParent(inputPass);
+
+  // This pass is executed between both effects, writing to a texture of the same format as the chain's input
+  Raz::RenderPass& otherPass = graph.addNode();
+  otherPass.addWriteColorTexture(otherTexture, 0);
+
+  auto& filmGrain = graph.addRenderProcess<Raz::FilmGrainRenderProcess>();
+  filmGrain.setInputBuffer(intermediateTexture);
+  filmGrain.setOutputBuffer(outputBuffer);
+  vignette.addChild(filmGrain);
+
+  graph.compile();
+  REQUIRE(graph.getFusedPassCount() == 1);
+  REQUIRE(graph.getExecutionList().size() == 3);
+  CHECK(graph.getExecutionList()[1] == &otherPass);
+
+  // The fused pass reads the chain's input after the other pass has been executed; their textures must not be shared
+  const Raz::RenderPass& fusedPass = *graph.getExecutionList()[2];
+  CHECK(&fusedPass.getReadTexture("uniBuffer") == &inputPass.getFramebuffer().getColorBuffer(0));
+  CHECK(&fusedPass.getReadTexture("uniBuffer") != &otherPass.getFramebuffer().getColorBuffer(0));
+}
+
+TEST_CASE("RenderGraph transient textures", "[render]") {
+  Raz::RenderGraph graph;
+  graph.resizeViewport(8, 8);
+
+  const Raz::Texture2DPtr firstTexture  = graph.addTransientTexture(Raz::TextureColorspace::RGB, Raz::TextureDataType::FLOAT16);
+  const Raz::Texture2DPtr secondTexture = graph.addTransientTexture(Raz::TextureColorspace::RGB, Raz::TextureDataType::FLOAT16);
+  const Raz::Texture2DPtr thirdTexture  = graph.addTransientTexture(Raz::TextureColorspace::RGB, Raz::TextureDataType::FLOAT16);
+  const Raz::Texture2DPtr halfTexture   = graph.addTransientTexture(Raz::TextureColorspace::RGB, Raz::TextureDataType::FLOAT16, 2);
+  CHECK_THROWS(graph.addTransientTexture(Raz::TextureColorspace::RGB, Raz::TextureDataType::FLOAT16, 0));
+  CHECK(graph.getTransientTextureCount() == 4);
+  CHECK(graph.isTransientTexture(*firstTexture));
+  CHECK_FALSE(graph.isTransientTexture(*Raz::Texture2D::create()));
+
+  // Passes are executed sequentially, each reading the texture written to by the previous one
+  Raz::RenderPass& firstPass = graph.addNode();
+  firstPass.addWriteColorTexture(firstTexture, 0);
+
+  Raz::RenderPass& secondPass = graph.addNode();
+  secondPass.addReadTexture(firstTexture, "uniBuffer");
+  secondPass.addWriteColorTexture(secondTexture, 0);
+  secondPass.addParents(firstPass);
+
+  Raz::RenderPass& thirdPass = graph.addNode();
+  thirdPass.addReadTexture(secondTexture, "uniBuffer");
+  thirdPass.addWriteColorTexture(thirdTexture, 0);
+  thirdPass.addParents(secondPass);
+
+  Raz::RenderPass& fourthPass = graph.addNode();
+  fourthPass.addReadTexture(thirdTexture, "uniBuffer");
+  fourthPass.addWriteColorTexture(halfTexture, 0);
+  fourthPass.addParents(thirdPass);
+
+  graph.compile();
+
+  // The first & third textures' lifetimes do not overlap, hence are backed by the same texture; the half-sized one cannot share any
+  CHECK(graph.getAllocatedTransientTextureCount() == 3);
+  CHECK(graph.isValid());
+
+  const Raz::Texture2D& firstAllocatedTexture = firstPass.getFramebuffer().getColorBuffer(0);
+  CHECK(&firstAllocatedTexture != firstTexture.get()); // The placeholders have been replaced
+  CHECK(graph.isTransientTexture(firstAllocatedTexture));
+  CHECK(&secondPass.getReadTexture("uniBuffer") == &firstAllocatedTexture);
+  CHECK(&thirdPass.getFramebuffer().getColorBuffer(0) == &firstAllocatedTexture);
+  CHECK(&secondPass.getFramebuffer().getColorBuffer(0) != &firstAllocatedTexture);
+  CHECK(&fourthPass.getReadTexture("uniBuffer") == &firstAllocatedTexture);
+
+  // The allocated textures are sized according to the viewport
+  CHECK(firstAllocatedTexture.getWidth() == 8);
+  CHECK(fourthPass.getFramebuffer().getColorBuffer(0).getWidth() == 4);
+
+  graph.resizeViewport(16, 4);
+  CHECK(firstAllocatedTexture.getWidth() == 16);
+  CHECK(firstAllocatedTexture.getHeight() == 4);
+  CHECK(fourthPass.getFramebuffer().getColorBuffer(0).getWidth() == 8);
+  CHECK(fourthPass.getFramebuffer().getColorBuffer(0).getHeight() == 2);
+
+  // Once the fourth pass is removed, the half-sized texture is not used anymore & its memory is released
+  graph.removeNode(fourthPass);
+  graph.compile();
+  CHECK(graph.getAllocatedTransientTextureCount() == 2);
+  CHECK(graph.getTransientTextureCount() == 4); // The placeholder still existing, the texture may be used again later
+  CHECK(&thirdPass.getFramebuffer().getColorBuffer(0) == &firstPass.getFramebuffer().getColorBuffer(0));
+}
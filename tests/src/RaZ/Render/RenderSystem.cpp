@@ -9,12 +9,15 @@
 #include "RaZ/Render/Light.hpp"
 #include "RaZ/Render/MeshRenderer.hpp"
 #include "RaZ/Render/RenderSystem.hpp"
+#include "RaZ/Utils/Profiler.hpp"
 
 #include "CatchCustomMatchers.hpp"
 #include "TestUtils.hpp"
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <atomic>
+
 using namespace Raz::Literals;
 
 namespace {
@@ -65,6 +68,73 @@ TEST_CASE("RenderSystem camera presence", "[render]") {
   CHECK_NOTHROW(world.update({})); // Ok, doesn't need a transform
 }
 
+TEST_CASE("RenderSystem frame timings", "[render]") {
+  Raz::World world(1);
+
+  auto& renderSystem = world.addSystem<Raz::RenderSystem>(1, 1);
+  world.addEntityWithComponent<Raz::Camera>();
+
+  Raz::RenderGraph& renderGraph = renderSystem.getRenderGraph();
+  Raz::RenderPass& pass         = renderGraph.addNode(Raz::FragmentShader::loadFromSource(R"(
+    layout(location = 0) out vec4 fragColor;
+    void main() { fragColor = vec4(1.0); }
+  )"), "Timed pass");
+
+  CHECK(renderGraph.getFrameTimings().empty());
+
+  // Rendering more frames than the timers have queries, the oldest measures are either recovered or discarded, but never waited for
+  for (std::size_t frameIndex = 0; frameIndex < Raz::RenderTimer::queryCount * 2; ++frameIndex) {
+    CHECK_NOTHROW(world.update({}));
+
+    const std::vector<Raz::RenderPassTiming>& timings = renderGraph.getFrameTimings();
+    REQUIRE(timings.size() == 2);
+    CHECK(timings[0].pass == &renderGraph.getGeometryPass());
+    CHECK(timings[1].pass == &pass);
+    CHECK(timings[1].cpuTime >= 0.f);
+    CHECK(timings[1].gpuTime >= 0.f);
+  }
+
+  // The names under which the passes are profiled follow their renaming
+  Raz::Profiler::clear();
+  Raz::Profiler::enable();
+
+  CHECK_NOTHROW(world.update({}));
+  CHECK(Raz::Profiler::computeTimingStats("Timed pass").sampleCount == 1);
+
+  pass.setName("Renamed pass");
+  CHECK_NOTHROW(world.update({}));
+  CHECK(Raz::Profiler::computeTimingStats("Timed pass").sampleCount == 1);
+  CHECK(Raz::Profiler::computeTimingStats("Renamed pass").sampleCount == 1);
+
+  Raz::Profiler::disable();
+  Raz::Profiler::clear();
+}
+
+TEST_CASE("RenderSystem frame capture", "[render]") {
+  Raz::World world(1);
+
+  auto& renderSystem = world.addSystem<Raz::RenderSystem>(1, 1);
+  world.addEntityWithComponent<Raz::Camera>();
+
+  std::atomic<std::size_t> capturedFrameCount = 0;
+
+  CHECK_FALSE(renderSystem.isFrameCaptureEnabled());
+  // Catch's assertions can't be used from the worker threads on which the frames are delivered
+  renderSystem.enableFrameCapture([&capturedFrameCount] (Raz::Image&& image) noexcept {
+    if (image.getWidth() == 1 && image.getHeight() == 1)
+      ++capturedFrameCount;
+  });
+  CHECK(renderSystem.isFrameCaptureEnabled());
+
+  for (std::size_t frameIndex = 0; frameIndex < Raz::FrameCapturer::bufferCount * 2; ++frameIndex)
+    CHECK_NOTHROW(world.update({}));
+
+  // Disabling the capture delivers all the frames still in flight & waits for their callbacks to have been executed
+  renderSystem.disableFrameCapture();
+  CHECK_FALSE(renderSystem.isFrameCaptureEnabled());
+  CHECK(capturedFrameCount == Raz::FrameCapturer::bufferCount * 2);
+}
+
 TEST_CASE("RenderSystem Cook-Torrance ball", "[render]") {
   Raz::World world(7);
 
@@ -104,6 +174,30 @@ TEST_CASE("RenderSystem Cook-Torrance ball", "[render]") {
   CHECK_THAT(renderFrame(world), IsNearlyEqualToImage(Raz::ImageFormat::load(RAZ_TESTS_ROOT "assets/renders/cook-torrance_ball_cubemap_base.png", true)));
 }
 
+TEST_CASE("RenderSystem light re-enabling", "[render]") {
+  Raz::World world(3);
+
+  const Raz::Window& window = TestUtils::getWindow();
+
+  const auto& renderSystem = world.addSystem<Raz::RenderSystem>(window.getWidth(), window.getHeight());
+
+  world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(0.f, 0.f, 3.f)).addComponent<Raz::Camera>(renderSystem.getSceneWidth(),
+                                                                                                     renderSystem.getSceneHeight());
+  world.addEntityWithComponent<Raz::Transform>().addComponent<Raz::MeshRenderer>(Raz::MeshFormat::load(RAZ_TESTS_ROOT "../assets/meshes/ball.obj").second);
+
+  Raz::Entity& light = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(0.f, 0.f, 1.5f));
+  light.addComponent<Raz::Light>(Raz::LightType::POINT, 1.5f, Raz::ColorPreset::White);
+
+  const Raz::Image litImg = renderFrame(world);
+
+  light.disable();
+  CHECK_FALSE(renderFrame(world) == litImg);
+
+  // The light has to be taken into account again once re-enabled
+  light.enable();
+  CHECK_THAT(renderFrame(world), IsNearlyEqualToImage(litImg));
+}
+
 TEST_CASE("RenderSystem Cook-Torrance alpha mask", "[render]") {
   Raz::World world(2);
 
@@ -0,0 +1,45 @@
+#include "RaZ/Render/ScreenEffect.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+bool contains(const std::string& source, const std::string& text) {
+  return (source.find(text) != std::string::npos);
+}
+
+} // namespace
+
+TEST_CASE("ScreenEffect shader generation", "[render]") {
+  CHECK_THROWS(Raz::ScreenEffect::generateShaderSource({}));
+
+  const Raz::ScreenEffect samplingEffect{ R"(uniform float uniStrength;
+uniform vec2 uniOffset, uniScales[2];
+
+vec3 applyEffect(vec2 uv) { return texture(uniBuffer, uv * uniScales[0] + uniOffset).rgb * uniStrength; })", true };
+  const Raz::ScreenEffect colorEffect{ R"(uniform float uniStrength;
+
+vec3 applyEffect(vec3 color, vec2 uv) { return color * uniStrength; })", false };
+
+  // A single effect is kept as is
+  const std::string singleSource = Raz::ScreenEffect::generateShaderSource({ &colorEffect });
+  CHECK(contains(singleSource, "uniform sampler2D uniBuffer;"));
+  CHECK(contains(singleSource, colorEffect.source));
+  CHECK(contains(singleSource, "vec3 color = applyEffect(texture(uniBuffer, fragTexcoords).rgb, fragTexcoords);"));
+
+  // When fused, the effects' uniforms & functions are renamed; the input buffer, read only once, is not
+  const std::string fusedSource = Raz::ScreenEffect::generateShaderSource({ &samplingEffect, &colorEffect, &colorEffect });
+  CHECK(contains(fusedSource, "uniform float uniStrength_0;"));
+  CHECK(contains(fusedSource, "uniform vec2 uniOffset_0, uniScales_0[2];"));
+  CHECK(contains(fusedSource, "texture(uniBuffer, uv * uniScales_0[0] + uniOffset_0).rgb * uniStrength_0"));
+  CHECK(contains(fusedSource, "uniform float uniStrength_1;"));
+  CHECK(contains(fusedSource, "uniform float uniStrength_2;"));
+  CHECK_FALSE(contains(fusedSource, "uniStrength;"));
+  CHECK(contains(fusedSource, "vec3 color = applyEffect_0(fragTexcoords);"));
+  CHECK(contains(fusedSource, "color = applyEffect_1(color, fragTexcoords);"));
+  CHECK(contains(fusedSource, "color = applyEffect_2(color, fragTexcoords);"));
+  CHECK(Raz::ScreenEffect::recoverFusedName("uniStrength", 2) == "uniStrength_2");
+
+  // Only the first effect of a chain can sample its input
+  CHECK_THROWS(Raz::ScreenEffect::generateShaderSource({ &colorEffect, &samplingEffect }));
+}
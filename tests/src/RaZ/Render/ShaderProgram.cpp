@@ -3,6 +3,8 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <filesystem>
+
 namespace {
 
 class TestShaderProgram final : public Raz::ShaderProgram {
@@ -220,6 +222,16 @@ TEST_CASE("ShaderProgram attributes", "[render]") {
   REQUIRE(program.hasAttribute("attrib1"));
   CHECK(program.getAttribute<int>("attrib1") == 42); // But its value has been reassigned
 
+  // Attributes can also be accessed from a handle, avoiding lookups by name
+  CHECK_THROWS(program.recoverAttributeHandle("attrib3"));
+  const Raz::AttributeHandle attrib2Handle = program.recoverAttributeHandle("attrib2");
+  CHECK(program.getAttribute<float>(attrib2Handle) == 6.f);
+
+  program.setAttribute(Raz::Vec2f(1.f, 2.f), attrib2Handle);
+  CHECK(program.getAttributeCount() == 2);
+  REQUIRE(program.hasAttribute<Raz::Vec2f>("attrib2")); // The attribute's type can be changed through its handle
+  CHECK(program.getAttribute<Raz::Vec2f>("attrib2") == Raz::Vec2f(1.f, 2.f));
+
   program.removeAttribute("attrib1");
   CHECK(program.getAttributeCount() == 1);
   CHECK_FALSE(program.hasAttribute("attrib1"));
@@ -366,9 +378,15 @@ TEST_CASE("RenderShaderProgram creation", "[render]") {
     CHECK_FALSE(program.isLinked());
     CHECK_FALSE(program.isUsed());
 
+    // The shaders are only compiled when linking the program
+    CHECK(program.getVertexShader().isCompilationPending());
+    CHECK(program.getFragmentShader().isCompilationPending());
+
     program.link();
     CHECK_FALSE(Raz::Renderer::hasErrors());
     CHECK(program.isLinked());
+    CHECK_FALSE(program.getVertexShader().isCompilationPending());
+    CHECK_FALSE(program.getFragmentShader().isCompilationPending());
 
     program.use();
     CHECK_FALSE(Raz::Renderer::hasErrors());
@@ -480,6 +498,74 @@ TEST_CASE("RenderShaderProgram uniforms", "[render]") {
   checkUniformInfo(correspUniInfo, program);
 }
 
+TEST_CASE("RenderShaderProgram binary cache", "[render]") {
+  Raz::Renderer::recoverErrors(); // Flushing errors
+
+  const Raz::FilePath cacheDirectory = "shaderCache";
+  std::filesystem::remove_all(cacheDirectory.getPath());
+
+  Raz::ShaderProgram::setBinaryCacheDirectory(cacheDirectory);
+  CHECK(Raz::ShaderProgram::getBinaryCacheDirectory() == cacheDirectory);
+  CHECK(std::filesystem::is_directory(cacheDirectory.getPath()));
+
+  const auto recoverBinaryCount = [&cacheDirectory] () {
+    return std::distance(std::filesystem::directory_iterator(cacheDirectory.getPath()), std::filesystem::directory_iterator());
+  };
+
+  {
+    // Without any binary available, the shaders are compiled
+    const Raz::RenderShaderProgram program(Raz::VertexShader::loadFromSource(vertSource), Raz::FragmentShader::loadFromSource(fragSource));
+    CHECK_FALSE(Raz::Renderer::hasErrors());
+    CHECK(program.isLinked());
+    CHECK_FALSE(program.getVertexShader().isCompilationPending());
+  }
+
+  // Program binaries are only available with OpenGL 4.1+, OpenGL ES 3.0+ or the 'GL_ARB_get_program_binary' extension, and if the driver provides any format
+#if defined(USE_WEBGL)
+  bool isBinarySupported = false;
+#elif defined(USE_OPENGL_ES)
+  bool isBinarySupported = Raz::Renderer::checkVersion(3, 0);
+#else
+  bool isBinarySupported = (Raz::Renderer::checkVersion(4, 1) || Raz::Renderer::isExtensionSupported("GL_ARB_get_program_binary"));
+#endif
+
+  if (isBinarySupported) {
+    int binaryFormatCount {};
+    Raz::Renderer::getParameter(Raz::StateParameter::PROGRAM_BINARY_FORMAT_COUNT, &binaryFormatCount);
+    isBinarySupported = (binaryFormatCount > 0);
+  }
+
+  if (isBinarySupported) {
+    CHECK(recoverBinaryCount() == 1);
+
+    {
+      // The same shaders are loaded from the cached binary, thus without being compiled
+      const Raz::RenderShaderProgram program(Raz::VertexShader::loadFromSource(vertSource), Raz::FragmentShader::loadFromSource(fragSource));
+      CHECK_FALSE(Raz::Renderer::hasErrors());
+      CHECK(program.isLinked());
+      CHECK(program.getVertexShader().isCompilationPending());
+      CHECK(program.getFragmentShader().isCompilationPending());
+      CHECK(program.recoverUniformLocation("uniVec3") != -1);
+    }
+
+    CHECK(recoverBinaryCount() == 1);
+
+    {
+      // Any change in the shaders' sources leads to a different binary
+      const std::string modifiedFragSource = std::string(fragSource) + "\n// Modified";
+      const Raz::RenderShaderProgram program(Raz::VertexShader::loadFromSource(vertSource), Raz::FragmentShader::loadFromSource(modifiedFragSource));
+      CHECK(program.isLinked());
+      CHECK_FALSE(program.getFragmentShader().isCompilationPending());
+    }
+
+    CHECK(recoverBinaryCount() == 2);
+  }
+
+  Raz::ShaderProgram::setBinaryCacheDirectory({});
+  CHECK(Raz::ShaderProgram::getBinaryCacheDirectory().isEmpty());
+  std::filesystem::remove_all(cacheDirectory.getPath());
+}
+
 #if !defined(USE_WEBGL)
 TEST_CASE("ComputeShaderProgram creation", "[render]") {
   // Compute shaders are only available in OpenGL 4.3+ or with the relevant extension
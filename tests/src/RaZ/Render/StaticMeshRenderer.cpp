@@ -0,0 +1,79 @@
+#include "RaZ/Data/Submesh.hpp"
+#include "RaZ/Math/Transform.hpp"
+#include "RaZ/Render/StaticMeshRenderer.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+Raz::Submesh createTriangle() {
+  Raz::Submesh triangle;
+  triangle.getVertices() = {
+    Raz::Vertex{ Raz::Vec3f(-0.5f, -0.5f, 0.f), Raz::Vec2f(0.f, 0.f), Raz::Axis::Z, Raz::Axis::X },
+    Raz::Vertex{ Raz::Vec3f(0.5f, -0.5f, 0.f), Raz::Vec2f(1.f, 0.f), Raz::Axis::Z, Raz::Axis::X },
+    Raz::Vertex{ Raz::Vec3f(0.f, 0.5f, 0.f), Raz::Vec2f(0.5f, 1.f), Raz::Axis::Z, Raz::Axis::X }
+  };
+  triangle.getTriangleIndices() = { 0, 1, 2 };
+  return triangle;
+}
+
+} // namespace
+
+TEST_CASE("StaticMeshRenderer draw commands", "[render]") {
+  const Raz::Submesh triangle  = createTriangle();
+  const Raz::Mat4f farRightMat = Raz::Transform(Raz::Vec3f(5.f, 0.f, 0.f)).computeTransformMatrix();
+
+  Raz::StaticMeshRenderer staticMeshRenderer;
+  staticMeshRenderer.addMaterial(Raz::Material(Raz::MaterialType::COOK_TORRANCE));
+  staticMeshRenderer.addMaterial(Raz::Material(Raz::MaterialType::BLINN_PHONG));
+
+  // The submeshes are added in no particular order, the loading grouping them by material
+  staticMeshRenderer.addSubmesh(triangle, Raz::Mat4f::identity(), 0);
+  staticMeshRenderer.addSubmesh(triangle, Raz::Mat4f::identity(), 1);
+  staticMeshRenderer.addSubmesh(triangle, Raz::Mat4f::identity(), 0);
+  staticMeshRenderer.addSubmesh(triangle, farRightMat, 1);
+  staticMeshRenderer.addSubmesh(triangle, Raz::Mat4f::identity(), 1);
+  staticMeshRenderer.load();
+
+  CHECK(staticMeshRenderer.getSubmeshCount() == 5);
+  CHECK(staticMeshRenderer.getMaterials().size() == 2);
+
+  // With an identity matrix, the frustum is the [-1; 1] cube; the translated submesh lies outside of it
+  staticMeshRenderer.updateDrawCommands(Raz::Mat4f::identity());
+
+  CHECK(staticMeshRenderer.getVisibleSubmeshCount() == 4);
+  CHECK(staticMeshRenderer.getDrawCallCount() == 2); // One per material
+
+  const std::vector<Raz::DrawElementsIndirectCommand>& drawCommands = staticMeshRenderer.getDrawCommands();
+  REQUIRE(drawCommands.size() == 3);
+
+  // Both submeshes of the first material are contiguous & are thus merged into a single command
+  CHECK(drawCommands[0].count == 6);
+  CHECK(drawCommands[0].firstIndex == 0);
+  // The culled submesh of the second material separates its two others, which can't be merged
+  CHECK(drawCommands[1].count == 3);
+  CHECK(drawCommands[1].firstIndex == 6);
+  CHECK(drawCommands[2].count == 3);
+  CHECK(drawCommands[2].firstIndex == 12);
+
+  for (const Raz::DrawElementsIndirectCommand& drawCommand : drawCommands) {
+    CHECK(drawCommand.instanceCount == 1);
+    CHECK(drawCommand.baseVertex == 0); // The indices are absolute
+  }
+
+  // Moving the geometry to the left, only the translated submesh remains visible
+  staticMeshRenderer.updateDrawCommands(Raz::Transform(Raz::Vec3f(-5.f, 0.f, 0.f)).computeTransformMatrix());
+
+  CHECK(staticMeshRenderer.getVisibleSubmeshCount() == 1);
+  CHECK(staticMeshRenderer.getDrawCallCount() == 1);
+  REQUIRE(staticMeshRenderer.getDrawCommands().size() == 1);
+  CHECK(staticMeshRenderer.getDrawCommands()[0].count == 3);
+  CHECK(staticMeshRenderer.getDrawCommands()[0].firstIndex == 9);
+
+  // Nothing is visible behind the near plane
+  staticMeshRenderer.updateDrawCommands(Raz::Transform(Raz::Vec3f(0.f, 0.f, -5.f)).computeTransformMatrix());
+
+  CHECK(staticMeshRenderer.getVisibleSubmeshCount() == 0);
+  CHECK(staticMeshRenderer.getDrawCallCount() == 0);
+  CHECK(staticMeshRenderer.getDrawCommands().empty());
+}
@@ -6,14 +6,16 @@ TEST_CASE("LuaCore Application", "[script][lua][core]") {
   CHECK(TestUtils::executeLuaScript(R"(
     local frameTimeInfo = FrameTimeInfo.new()
 
-    frameTimeInfo.deltaTime    = 0
-    frameTimeInfo.globalTime   = 0
-    frameTimeInfo.substepCount = 0
-    frameTimeInfo.substepTime  = 0
+    frameTimeInfo.deltaTime          = 0
+    frameTimeInfo.globalTime         = 0
+    frameTimeInfo.substepCount       = 0
+    frameTimeInfo.substepTime        = 0
+    frameTimeInfo.interpolationAlpha = 0
     assert(frameTimeInfo.deltaTime == 0)
     assert(frameTimeInfo.globalTime == 0)
     assert(frameTimeInfo.substepCount == 0)
     assert(frameTimeInfo.substepTime == 0)
+    assert(frameTimeInfo.interpolationAlpha == 0)
 
     local application = Application.new()
     application       = Application.new(1)
@@ -22,6 +24,12 @@ TEST_CASE("LuaCore Application", "[script][lua][core]") {
     assert(#application:getWorlds() == 1)
     application:setFixedTimeStep(0.5)
     assert(application:getTimeInfo().substepTime == 0.5)
+    application:setMaxSubstepCount(4)
+    application:setTargetFrameRate(0)
+    assert(application:getTargetFrameRate() == 0)
+    assert(application:getWorldUpdateMode() == WorldUpdateMode.SEQUENTIAL)
+    application:setWorldUpdateMode(WorldUpdateMode.PARALLEL)
+    assert(application:getWorldUpdateMode() == WorldUpdateMode.PARALLEL)
     application:run()
     application:run(function () end)
     assert(not application:runOnce())
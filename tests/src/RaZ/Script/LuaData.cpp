@@ -23,6 +23,8 @@ TEST_CASE("LuaData Bitset", "[script][lua][data]") {
     assert((bitset ~ bitset):getDisabledBitCount() == 3) -- [0, 0, 0]
     assert((bitset << 1):getSize() == 4) -- [0, 1, 0, 0]
     assert((bitset >> 1):getSize() == 2) -- [0, 1]
+    assert(bitset:intersects(bitset))
+    assert(not bitset:intersects(~bitset))
 
     bitset:reset()
     assert(bitset:getDisabledBitCount() == bitset:getSize())
@@ -41,6 +43,9 @@ TEST_CASE("LuaData BoundingVolumeHierarchy", "[script][lua][data]") {
     local rayHit = RayHit.new()
     assert(bvh:query(Ray.new(Vec3f.new(), Axis.Z)) == nil)
     assert(bvh:query(Ray.new(Vec3f.new(), Axis.Z), rayHit) == nil)
+    assert(bvh:queryClosest(Vec3f.new()) == nil)
+    assert(bvh:queryClosest(Vec3f.new(), 1) == nil)
+    assert(bvh:queryClosest(Vec3f.new(), 1, rayHit) == nil)
 
     local bvhRootNode = bvh:getRootNode()
 
@@ -53,6 +58,8 @@ TEST_CASE("LuaData BoundingVolumeHierarchy", "[script][lua][data]") {
     assert(bvhRootNode:isLeaf())
     assert(bvhRootNode:query(Ray.new(Vec3f.new(), Axis.Z)) == nil)
     assert(bvhRootNode:query(Ray.new(Vec3f.new(), Axis.Z), rayHit) == nil)
+    assert(bvhRootNode:queryClosest(Vec3f.new()) == nil)
+    assert(bvhRootNode:queryClosest(Vec3f.new(), 1, rayHit) == nil)
   )"));
 }
 
@@ -212,10 +219,39 @@ TEST_CASE("LuaData MeshDistanceField", "[script][lua][data]") {
     assert(mdf:getValue(0, 0, 0) ~= 0)
     mdf:setBvh(BoundingVolumeHierarchy.new())
     mdf:compute(1)
+    mdf:computeExact()
+    mdf:computeExact(1)
+    mdf:computeExact(1, false)
     assert(mdf:recoverSlices():size() == 2)
   )"));
 }
 
+TEST_CASE("LuaData NoiseField", "[script][lua][data]") {
+  CHECK(TestUtils::executeLuaScript(R"(
+    local settings       = NoiseSettings.new()
+    settings.frequency   = 0.1
+    settings.octaveCount = 2
+
+    local grid2 = Grid2f.new(3, 3)
+    NoiseField.fill(grid2, NoiseType.PERLIN)
+    NoiseField.fill(grid2, NoiseType.SIMPLEX, settings)
+    NoiseField.fill(grid2, NoiseType.SIMPLEX, settings, Vec2f.new(1, 2))
+    assert(FloatUtils.areNearlyEqual(grid2:getValue(1, 1), SimplexNoise.compute2D(0.2, 0.3, 2)))
+
+    local grid3 = Grid3f.new(2, 2, 2)
+    NoiseField.fill(grid3, NoiseType.PERLIN)
+    NoiseField.fill(grid3, NoiseType.PERLIN, settings)
+    NoiseField.fill(grid3, NoiseType.PERLIN, settings, Vec3f.new(1, 2, 3))
+    assert(FloatUtils.areNearlyEqual(grid3:getValue(1, 1, 1), PerlinNoise.compute3D(0.2, 0.3, 0.4, 2)))
+
+    local img = Image.new(2, 2, ImageColorspace.GRAY, ImageDataType.FLOAT)
+    NoiseField.fill(img, NoiseType.SIMPLEX)
+    NoiseField.fill(img, NoiseType.SIMPLEX, settings)
+    NoiseField.fill(img, NoiseType.SIMPLEX, settings, Vec2f.new(1, 2))
+    assert(FloatUtils.areNearlyEqual(img:recoverFloatValue(1, 1, 0), SimplexNoise.compute2D(0.2, 0.3, 2)))
+  )"));
+}
+
 TEST_CASE("LuaData Submesh", "[script][lua][data]") {
   CHECK(TestUtils::executeLuaScript(R"(
     local submesh = Submesh.new()
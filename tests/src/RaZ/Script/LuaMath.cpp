@@ -182,6 +182,21 @@ TEST_CASE("LuaMath Matrix", "[script][lua][math]") {
   )"));
 }
 
+TEST_CASE("LuaMath NoiseSettings", "[script][lua][math]") {
+  CHECK(TestUtils::executeLuaScript(R"(
+    local settings = NoiseSettings.new()
+    assert(settings.frequency == 1)
+    assert(settings.octaveCount == 1)
+    assert(settings.lacunarity == 2)
+    assert(settings.persistence == 0.5)
+    assert(settings.seed == 0)
+    assert(not settings.normalize)
+
+    settings.seed = 42
+    assert(settings.seed == 42)
+  )"));
+}
+
 TEST_CASE("LuaMath PerlinNoise", "[script][lua][math]") {
   CHECK(TestUtils::executeLuaScript(R"(
     assert(FloatUtils.areNearlyEqual(PerlinNoise.compute1D(0.1), -0.106848))
@@ -233,6 +248,18 @@ TEST_CASE("LuaMath Quaternion", "[script][lua][math]") {
   )"));
 }
 
+TEST_CASE("LuaMath SimplexNoise", "[script][lua][math]") {
+  CHECK(TestUtils::executeLuaScript(R"(
+    local value2D = SimplexNoise.compute2D(0.1, 0.2, 2)
+    assert(FloatUtils.areNearlyEqual(value2D, SimplexNoise.compute2D(0.1, 0.2) + SimplexNoise.compute2D(0.2, 0.4) * 0.5))
+    assert(FloatUtils.areNearlyEqual(SimplexNoise.compute2D(0.1, 0.2, 2, true), (value2D + 1) / 2))
+
+    local value3D = SimplexNoise.compute3D(0.1, 0.2, 0.3, 2)
+    assert(FloatUtils.areNearlyEqual(value3D, SimplexNoise.compute3D(0.1, 0.2, 0.3) + SimplexNoise.compute3D(0.2, 0.4, 0.6) * 0.5))
+    assert(FloatUtils.areNearlyEqual(SimplexNoise.compute3D(0.1, 0.2, 0.3, 2, true), (value3D + 1) / 2))
+  )"));
+}
+
 TEST_CASE("LuaMath Transform", "[script][lua][math]") {
   CHECK(TestUtils::executeLuaScript(R"(
     local trans = Transform.new()
@@ -10,6 +10,9 @@ TEST_CASE("LuaPhysics Collider", "[script][lua][physics]") {
     collider:setShape(Sphere.new(Vec3f.new(), 1))
     assert(collider:hasShape())
     assert(collider:getShapeType() == collider:getShape():getType())
+    assert(collider.layerMask == 1)
+    collider.layerMask = 3
+    assert(collider.layerMask == 3)
     assert(collider:getShape():computeBoundingBox() == AABB.new(Vec3f.new(-1), Vec3f.new(1)))
 
     assert(collider:intersects(collider))
@@ -20,18 +23,78 @@ TEST_CASE("LuaPhysics Collider", "[script][lua][physics]") {
   )"));
 }
 
+TEST_CASE("LuaPhysics ConvexHull", "[script][lua][physics]") {
+  CHECK(TestUtils::executeLuaScript(R"(
+    local convexHull = ConvexHull.new(Mesh.new(AABB.new(Vec3f.new(-1), Vec3f.new(1))))
+    assert(convexHull:getType() == ShapeType.CONVEX_HULL)
+    assert(#convexHull:getVertices() == 8)
+    assert(convexHull:computeSupport(Vec3f.new(1, 1, -1)) == Vec3f.new(1, 1, -1))
+    assert(convexHull:contains(Vec3f.new()))
+  )"));
+}
+
+TEST_CASE("LuaPhysics NarrowPhase", "[script][lua][physics]") {
+  CHECK(TestUtils::executeLuaScript(R"(
+    local sphere = Sphere.new(Vec3f.new(0, 1.5, 0), 1)
+    local box    = OBB.new(Vec3f.new(-1), Vec3f.new(1), Quaternionf.identity())
+
+    assert(NarrowPhase.computeSupport(box, Axis.Y):y() == 1)
+    assert(NarrowPhase.intersects(sphere, box))
+
+    local manifold = ContactManifold.new()
+    assert(NarrowPhase.computeContact(sphere, box, manifold))
+    assert(manifold.pointCount >= 1)
+    assert(manifold:getPoint(0).penetrationDepth > 0)
+    assert(not NarrowPhase.computeContact(Sphere.new(Vec3f.new(0, 3, 0), 1), box, manifold))
+
+    local collider = Collider.new()
+    collider:setShape(box)
+    assert(collider:computeContact(sphere, manifold))
+  )"));
+}
+
 TEST_CASE("LuaPhysics PhysicsSystem", "[script][lua][physics]") {
   CHECK(TestUtils::executeLuaScript(R"(
     local physicsSystem = PhysicsSystem.new()
 
-    physicsSystem.gravity  = Axis.Y
-    physicsSystem.friction = 0.25
+    physicsSystem.gravity                = Axis.Y
+    physicsSystem.friction               = 0.25
+    physicsSystem.sleepVelocityThreshold = 0.5
+    physicsSystem.sleepTimeThreshold     = 2
     assert(physicsSystem.gravity == Axis.Y)
     assert(physicsSystem.friction == 0.25)
+    assert(physicsSystem.sleepVelocityThreshold == 0.5)
+    assert(physicsSystem.sleepTimeThreshold == 2)
 
     assert(physicsSystem:getAcceptedComponents() ~= nil)
     assert(not physicsSystem:containsEntity(Entity.new(0)))
     assert(physicsSystem:update(FrameTimeInfo.new()))
+
+    physicsSystem:updateQueryStructure()
+    local rayHit = RayHit.new()
+    local ray    = Ray.new(Vec3f.new(), Axis.Z)
+    assert(physicsSystem:raycast(ray) == nil)
+    assert(physicsSystem:raycast(ray, rayHit) == nil)
+    assert(physicsSystem:raycast(ray, rayHit, 10) == nil)
+    assert(physicsSystem:raycast(ray, rayHit, 10, 1) == nil)
+    assert(#physicsSystem:raycastAll(ray) == 0)
+    assert(#physicsSystem:raycastAll(ray, 10) == 0)
+    assert(#physicsSystem:raycastAll(ray, 10, 1) == 0)
+    assert(physicsSystem:raycastBatch({ ray, ray })[2].entity == nil)
+    assert(#physicsSystem:raycastBatch({ ray }, 10) == 1)
+    assert(#physicsSystem:raycastBatch({ ray }, 10, 1) == 1)
+    local sphere = Sphere.new(Vec3f.new(), 1)
+    assert(#physicsSystem:overlap(sphere) == 0)
+    assert(#physicsSystem:overlap(sphere, 1) == 0)
+    assert(#physicsSystem:overlap(AABB.new(Vec3f.new(-1), Vec3f.new(1))) == 0)
+    assert(#physicsSystem:overlap(AABB.new(Vec3f.new(-1), Vec3f.new(1)), 1) == 0)
+    assert(#physicsSystem:overlapBatch({ sphere }) == 1)
+    assert(#physicsSystem:overlapBatch({ sphere }, 1) == 1)
+    assert(physicsSystem:sweep(sphere, Axis.Z) == nil)
+    assert(physicsSystem:sweep(sphere, Axis.Z, rayHit) == nil)
+    assert(physicsSystem:sweep(sphere, Axis.Z, rayHit, 10) == nil)
+    assert(physicsSystem:sweep(sphere, Axis.Z, rayHit, 10, 1) == nil)
+
     physicsSystem:destroy()
   )"));
 }
@@ -49,5 +112,20 @@ TEST_CASE("LuaPhysics RigidBody", "[script][lua][physics]") {
     assert(rigidBody.bounciness == 0.25)
     assert(rigidBody.velocity == Vec3f.new(1, 2, 3))
     assert(rigidBody.forces == Vec3f.new(5, 6, 7))
+
+    assert(not rigidBody:isSleeping())
+    rigidBody:putToSleep()
+    assert(rigidBody:isSleeping())
+    rigidBody:wakeUp()
+    assert(not rigidBody:isSleeping())
+  )"));
+}
+
+TEST_CASE("LuaPhysics TriangleMesh", "[script][lua][physics]") {
+  CHECK(TestUtils::executeLuaScript(R"(
+    local triangleMesh = TriangleMesh.new(Mesh.new(AABB.new(Vec3f.new(-1), Vec3f.new(1))))
+    assert(triangleMesh:getType() == ShapeType.TRIANGLE_MESH)
+    assert(#triangleMesh:getTriangles() == 12)
+    assert(#triangleMesh:findTriangles(AABB.new(Vec3f.new(0.5, -0.5, -0.5), Vec3f.new(2, 0.5, 0.5))) == 2)
   )"));
 }
@@ -12,6 +12,8 @@ TEST_CASE("LuaRender Camera", "[script][lua][render]") {
     camera       = Camera.new(1, 1, Radiansf.new(Degreesf.new(45)), 0.1)
     camera       = Camera.new(1, 1, Radiansf.new(Degreesf.new(45)), 0.1, 1000)
     camera       = Camera.new(1, 1, Radiansf.new(Degreesf.new(45)), 0.1, 1000, ProjectionType.PERSPECTIVE)
+    assert(camera:getNearPlane() > 0.09 and camera:getNearPlane() < 0.11)
+    assert(camera:getFarPlane() == 1000)
 
     camera.fieldOfView = Radiansf.new(1)
     camera.orthographicBound = 2
@@ -128,6 +130,11 @@ TEST_CASE("LuaRender Light", "[script][lua][render]") {
     assert(light.energy == 10)
     assert(light.color == ColorPreset.Black)
     assert(light.angle == Radiansf.new(Constant.Pi))
+
+    light.color  = ColorPreset.White
+    light.energy = 1
+    assert(light:computeInfluenceRadius() == 16)
+    assert(light:computeInfluenceRadius(0.25) == 2)
   )"));
 }
 
@@ -401,6 +408,21 @@ TEST_CASE("LuaRender RenderGraph", "[script][lua][render]") {
     assert(renderGraph:addScreenSpaceReflectionsRenderProcess() ~= nil)
     assert(renderGraph:addSobelFilterRenderProcess() ~= nil)
     assert(renderGraph:addVignetteRenderProcess() ~= nil)
+    local transientTexture = renderGraph:addTransientTexture(TextureColorspace.RGB, TextureDataType.FLOAT16)
+    renderGraph:addTransientTexture(TextureColorspace.RGB, TextureDataType.FLOAT16, 2)
+    assert(renderGraph:isTransientTexture(transientTexture))
+    renderGraph:getNode(0):addWriteColorTexture(transientTexture, 0)
+    assert(not renderGraph:isCompiled())
+    renderGraph:compile()
+    assert(renderGraph:isCompiled())
+    assert(renderGraph:getFusedPassCount() == 0)
+    assert(renderGraph:isScreenEffectFusionEnabled())
+    renderGraph:disableScreenEffectFusion()
+    assert(not renderGraph:isScreenEffectFusionEnabled())
+    renderGraph:enableScreenEffectFusion(false)
+    renderGraph:enableScreenEffectFusion()
+    assert(renderGraph:getTransientTextureCount() > 2) -- The bloom process also uses transient textures
+    assert(renderGraph:getAllocatedTransientTextureCount() > 0)
     renderGraph:resizeViewport(1, 1)
     renderGraph:updateShaders()
   )"));
@@ -441,6 +463,7 @@ TEST_CASE("LuaRender RenderPass", "[script][lua][render]") {
     assert(renderPass:getReadTextureCount() == 1)
     renderPass:clearReadTextures()
     assert(renderPass:getFramebuffer() ~= nil)
+    assert(not renderPass:hasScreenEffect())
     renderPass:setWriteDepthTexture(Texture2D.create(TextureColorspace.DEPTH))
     renderPass:addWriteColorTexture(Texture2D.create(TextureColorspace.RGB), 0)
     renderPass:removeWriteTexture(Texture2D.create(TextureColorspace.GRAY))
@@ -847,6 +870,9 @@ TEST_CASE("LuaRender ShaderProgram", "[script][lua][render]") {
     renderShaderProgram:compileShaders()
     renderShaderProgram:link()
     assert(not renderShaderProgram:isLinked())
+    renderShaderProgram:startLink()
+    renderShaderProgram:completeLink()
+    assert(ShaderProgram.getBinaryCacheDirectory():isEmpty())
     renderShaderProgram:updateShaders()
     renderShaderProgram:use()
     assert(not renderShaderProgram:isUsed())
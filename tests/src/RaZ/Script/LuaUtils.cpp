@@ -197,6 +197,8 @@ TEST_CASE("LuaUtils TriggerVolume", "[script][lua][utils]") {
     local triggerer = Triggerer.new()
 
     local triggerSystem = TriggerSystem.new()
+    triggerSystem:setCellSize(2)
+    assert(triggerSystem:getCellSize() == 2)
 
     local triggerVolume = TriggerVolume.new(AABB.new(Vec3f.new(-1), Vec3f.new(1)))
     triggerVolume       = TriggerVolume.new(OBB.new(Vec3f.new(-1), Vec3f.new(1), Quaternionf.identity()))
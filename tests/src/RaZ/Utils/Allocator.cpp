@@ -0,0 +1,147 @@
+#include "RaZ/Utils/Allocator.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace {
+
+#if defined(RAZ_USE_PROFILING)
+struct alignas(64) AlignedObject {
+  int value {};
+};
+#endif
+
+struct PooledObject : Raz::PoolAllocated<PooledObject> {
+  explicit PooledObject(int val) noexcept : value{ val } {}
+
+  int value {};
+};
+
+} // namespace
+
+TEST_CASE("LinearArena basic", "[utils]") {
+  CHECK_THROWS(Raz::LinearArena(0));
+  CHECK_THROWS(Raz::LinearArena(16, nullptr));
+
+  Raz::LinearArena arena(64);
+  CHECK(arena.getBlockSize() == 64);
+  CHECK(arena.getBlockCount() == 0); // No memory is allocated until needed
+  CHECK(arena.getCapacity() == 0);
+
+  void* firstPtr = arena.allocate(3, 1);
+  CHECK(arena.getBlockCount() == 1);
+  CHECK(arena.getCapacity() == 64);
+  CHECK(arena.getUsedByteCount() == 3);
+
+  // Allocations are contiguous, only separated by their alignment padding
+  void* secondPtr = arena.allocate(8, 8);
+  CHECK(reinterpret_cast<std::uintptr_t>(secondPtr) % 8 == 0);
+  CHECK(static_cast<std::byte*>(secondPtr) - static_cast<std::byte*>(firstPtr) == 8);
+  CHECK(arena.getUsedByteCount() == 16);
+
+  // Deallocating does not reclaim anything
+  arena.deallocate(secondPtr, 8, 8);
+  CHECK(arena.getUsedByteCount() == 16);
+  CHECK(arena.getStats().allocationCount == 2);
+  CHECK(arena.getStats().deallocationCount == 1);
+  CHECK(arena.getStats().allocatedByteCount == 11);
+
+  // Allocations larger than the block size get their own block
+  CHECK(reinterpret_cast<std::uintptr_t>(arena.allocate(100, 64)) % 64 == 0);
+  CHECK(arena.getBlockCount() == 2);
+  CHECK(arena.getCapacity() == 64 + 164);
+
+  // Resetting merges the blocks, the next allocations being served from the beginning of the new one
+  arena.reset();
+  CHECK(arena.getBlockCount() == 1);
+  CHECK(arena.getCapacity() == 64 + 164);
+  CHECK(arena.getUsedByteCount() == 0);
+  CHECK(arena.getStats().allocationCount == 0);
+
+  CHECK(arena.allocate(200, 1) != nullptr);
+  CHECK(arena.getBlockCount() == 1);
+
+  // Moving transfers the blocks, the moved-from arena being left empty but still usable
+  Raz::LinearArena movedArena(std::move(arena));
+  CHECK(movedArena.getBlockSize() == 64);
+  CHECK(movedArena.getBlockCount() == 1);
+  CHECK(movedArena.getUsedByteCount() == 200);
+  CHECK(movedArena.getStats().allocationCount == 1);
+  CHECK(arena.getBlockCount() == 0);
+  CHECK(arena.getUsedByteCount() == 0);
+  CHECK(arena.getStats().allocationCount == 0);
+
+  CHECK(arena.allocate(8, 8) != nullptr);
+  arena = std::move(movedArena);
+  CHECK(arena.getBlockCount() == 1);
+  CHECK(arena.getCapacity() == 64 + 164);
+  CHECK(arena.getUsedByteCount() == 200);
+  CHECK(movedArena.getBlockCount() == 0);
+
+  arena.release();
+  CHECK(arena.getBlockCount() == 0);
+  CHECK(arena.getCapacity() == 0);
+}
+
+TEST_CASE("LinearArena containers", "[utils]") {
+  Raz::LinearArena arena(1024);
+
+  std::pmr::vector<int> values(&arena);
+  values.resize(10);
+  std::iota(values.begin(), values.end(), 0);
+  CHECK(values[9] == 9);
+  CHECK(arena.getStats().allocationCount == 1);
+
+  values.resize(100); // Growing the vector requires another allocation, the previous one not being reused
+  CHECK(values[9] == 9);
+  CHECK(arena.getStats().allocationCount == 2);
+  CHECK(arena.getUsedByteCount() == 110 * sizeof(int));
+}
+
+TEST_CASE("PoolAllocated objects", "[utils]") {
+  auto obj = std::make_unique<PooledObject>(42);
+  CHECK(obj->value == 42);
+
+  // A released object's memory is directly reused for the next one of the same size
+  const PooledObject* prevAddress = obj.get();
+  obj = nullptr;
+  obj = std::make_unique<PooledObject>(3);
+  CHECK(obj.get() == prevAddress);
+  CHECK(obj->value == 3);
+
+  // Standard containers do not use the class-level operators, and placement new must still be available
+  std::vector<PooledObject> objects;
+  objects.emplace_back(1);
+  CHECK(objects.front().value == 1);
+
+  alignas(PooledObject) std::byte buffer[sizeof(PooledObject)];
+  const PooledObject* placedObj = new (buffer) PooledObject(7);
+  CHECK(static_cast<const void*>(placedObj) == buffer);
+  CHECK(placedObj->value == 7);
+}
+
+#if defined(RAZ_USE_PROFILING)
+TEST_CASE("Allocator global stats", "[utils]") {
+  const Raz::AllocationStats initialStats = Raz::Allocator::getGlobalStats();
+
+  // Every form of the global operators is counted, including the aligned & array ones
+  auto alignedObject = std::make_unique<AlignedObject>();
+  auto values        = std::make_unique<int[]>(4);
+  // Checking the pointers also prevents the allocations from being optimized away
+  CHECK(reinterpret_cast<std::uintptr_t>(alignedObject.get()) % 64 == 0);
+  CHECK(reinterpret_cast<std::uintptr_t>(values.get()) % alignof(int) == 0);
+
+  const Raz::AllocationStats allocatedStats = Raz::Allocator::getGlobalStats();
+  CHECK(allocatedStats.allocationCount - initialStats.allocationCount >= 2);
+  CHECK(allocatedStats.allocatedByteCount - initialStats.allocatedByteCount >= sizeof(AlignedObject) + sizeof(int) * 4);
+
+  alignedObject = nullptr;
+  values        = nullptr;
+  CHECK(Raz::Allocator::getGlobalStats().deallocationCount - allocatedStats.deallocationCount >= 2);
+}
+#endif
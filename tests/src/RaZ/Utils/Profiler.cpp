@@ -0,0 +1,127 @@
+#include "RaZ/Application.hpp"
+#include "RaZ/System.hpp"
+#include "RaZ/World.hpp"
+#include "RaZ/Utils/Profiler.hpp"
+#include "RaZ/Utils/Threading.hpp"
+#include "RaZ/Utils/TypeUtils.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <sstream>
+
+namespace {
+
+class ProfiledSystem final : public Raz::System {
+public:
+  bool update(const Raz::FrameTimeInfo&) override { return true; }
+};
+
+} // namespace
+
+TEST_CASE("TimingWindow statistics", "[utils]") {
+  CHECK_THROWS(Raz::TimingWindow(0));
+
+  Raz::TimingWindow window(100);
+  CHECK(window.getCapacity() == 100);
+  CHECK(window.getLatestSample() == 0.f);
+  CHECK(window.computeStats().sampleCount == 0);
+
+  for (int i = 1; i <= 100; ++i)
+    window.addSample(static_cast<float>(i));
+
+  Raz::TimingStats stats = window.computeStats();
+  CHECK(stats.sampleCount == 100);
+  CHECK(stats.average == 50.5f);
+  CHECK(stats.median == 50.f);
+  CHECK(stats.percentile95 == 95.f);
+  CHECK(stats.percentile99 == 99.f);
+  CHECK(stats.maximum == 100.f);
+
+  // Once full, the oldest samples get replaced
+  for (int i = 0; i < 50; ++i)
+    window.addSample(1000.f);
+
+  CHECK(window.getSampleCount() == 100);
+  CHECK(window.getLatestSample() == 1000.f);
+
+  stats = window.computeStats();
+  CHECK(stats.median == 100.f);
+  CHECK(stats.percentile95 == 1000.f);
+
+  window.clear();
+  CHECK(window.getSampleCount() == 0);
+}
+
+TEST_CASE("Profiler events", "[utils]") {
+  Raz::Profiler::clear();
+
+  {
+    const Raz::ProfileScope scope("Disabled");
+  }
+  CHECK(Raz::Profiler::collectEvents().empty());
+
+  Raz::Profiler::enable();
+
+  {
+    const Raz::ProfileScope outerScope("Outer", true);
+    const Raz::ProfileScope innerScope(Raz::Profiler::storeName(std::string("In\"ner")));
+  }
+
+  Raz::Threading::parallelize([] () {
+    const Raz::ProfileScope scope("Parallel");
+  }, 4);
+
+  const std::vector<Raz::ProfileEvent> events = Raz::Profiler::collectEvents();
+  CHECK(events.size() == 6);
+  CHECK(std::ranges::is_sorted(events, {}, &Raz::ProfileEvent::startTime));
+  CHECK(std::ranges::count(events, "Parallel", &Raz::ProfileEvent::name) == 4);
+
+  const auto outerEvent = std::ranges::find(events, "Outer", &Raz::ProfileEvent::name);
+  const auto innerEvent = std::ranges::find(events, "In\"ner", &Raz::ProfileEvent::name);
+  REQUIRE(outerEvent != events.cend());
+  REQUIRE(innerEvent != events.cend());
+  CHECK(outerEvent->startTime <= innerEvent->startTime);
+  CHECK(outerEvent->duration >= innerEvent->duration);
+  CHECK(outerEvent->threadIndex == innerEvent->threadIndex);
+
+  // Collecting the events empties the buffers
+  CHECK(Raz::Profiler::collectEvents().empty());
+
+  // Only the scopes requesting it are aggregated
+  CHECK(Raz::Profiler::computeTimingStats("Outer").sampleCount == 1);
+  CHECK(Raz::Profiler::computeTimingStats("In\"ner").sampleCount == 0);
+
+  std::ostringstream stream;
+  Raz::Profiler::exportChromeTrace({ *outerEvent, *innerEvent }, stream);
+  const std::string trace = stream.str();
+  CHECK(trace.starts_with("{\"traceEvents\":["));
+  CHECK(trace.find(R"({"name":"Outer","cat":"RaZ","ph":"X","ts":)") != std::string::npos);
+  CHECK(trace.find(R"({"name":"In\"ner",)") != std::string::npos);
+  CHECK(trace.ends_with("],\"displayTimeUnit\":\"ms\"}\n"));
+
+  Raz::Profiler::disable();
+  Raz::Profiler::clear();
+}
+
+TEST_CASE("Profiler world timings", "[utils]") {
+  Raz::Profiler::clear();
+  Raz::Profiler::enable();
+
+  Raz::World world;
+  world.addSystem<ProfiledSystem>();
+
+  for (int i = 0; i < 3; ++i)
+    world.update({});
+
+  Raz::Profiler::disable();
+
+  CHECK(Raz::Profiler::computeTimingStats("World::update").sampleCount == 3);
+  CHECK(Raz::Profiler::computeTimingStats(Raz::TypeUtils::getTypeStr<ProfiledSystem>()).sampleCount == 3);
+
+  // Updates made while the profiler is disabled are not recorded
+  world.update({});
+  CHECK(Raz::Profiler::computeTimingStats("World::update").sampleCount == 3);
+
+  Raz::Profiler::clear();
+}
@@ -427,6 +427,23 @@ TEST_CASE("Triangle bounding box", "[utils]") {
   CHECK(triangle3.computeBoundingBox() == Raz::AABB(Raz::Vec3f(-1.5f, -1.75f, -1.f), Raz::Vec3f(0.f, -1.f, 1.f)));
 }
 
+TEST_CASE("Triangle point projection", "[utils]") {
+  // Points projecting inside the triangle are projected onto its plane
+  CHECK(triangle1.computeProjection(Raz::Vec3f(0.f, 5.f, 0.f)) == Raz::Vec3f(0.f, 0.5f, 0.f));
+  CHECK(triangle1.computeProjection(Raz::Vec3f(0.f, -5.f, 0.f)) == Raz::Vec3f(0.f, 0.5f, 0.f));
+  CHECK(triangle2.computeProjection(Raz::Vec3f(3.f, 0.f, 0.f)) == Raz::Vec3f(0.5f, 0.f, 0.f));
+
+  // Others are projected onto the closest edge or vertex
+  CHECK(triangle1.computeProjection(Raz::Vec3f(0.f, 0.5f, 10.f)) == Raz::Vec3f(0.f, 0.5f, 3.f));
+  CHECK(triangle1.computeProjection(Raz::Vec3f(-10.f, 0.5f, 10.f)) == triangle1.getFirstPos());
+  CHECK(triangle1.computeProjection(Raz::Vec3f(10.f, 3.f, 10.f)) == triangle1.getSecondPos());
+  CHECK(triangle1.computeProjection(Raz::Vec3f(0.f, 0.f, -10.f)) == triangle1.getThirdPos());
+  CHECK(triangle2.computeProjection(Raz::Vec3f(0.f, -1.f, 0.f)) == Raz::Vec3f(0.5f, -0.5f, 0.f));
+
+  CHECK(triangle1.contains(Raz::Vec3f(0.f, 0.5f, 0.f)));
+  CHECK_FALSE(triangle1.contains(Raz::Vec3f(0.f, 0.f, 0.f)));
+}
+
 TEST_CASE("Triangle clockwiseness", "[utils]") {
   CHECK(triangle1.isCounterClockwise(Raz::Axis::Y));
   CHECK(triangle2.isCounterClockwise(Raz::Axis::X));
@@ -681,6 +698,14 @@ TEST_CASE("OBB corners computation", "[utils]") {
   }
 }
 
+TEST_CASE("OBB bounding box", "[utils]") {
+  CHECK(obb1.computeBoundingBox() == Raz::AABB(Raz::Vec3f(-0.5f), Raz::Vec3f(0.5f)));
+
+  const Raz::AABB obb2BoundingBox = obb2.computeBoundingBox();
+  CHECK_THAT(obb2BoundingBox.getMinPosition(), IsNearlyEqualToVector(Raz::Vec3f(-1.09619427f, 3.f, -4.59619427f)));
+  CHECK_THAT(obb2BoundingBox.getMaxPosition(), IsNearlyEqualToVector(Raz::Vec3f(8.09619427f, 5.f, 4.59619427f)));
+}
+
 TEST_CASE("OBB equality", "[utils]") {
   CHECK(obb1 == obb1);
   CHECK(obb2 == obb2);
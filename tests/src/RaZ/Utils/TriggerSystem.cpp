@@ -6,6 +6,10 @@
 #include "RaZ/Utils/TriggerVolume.hpp"
 
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <numeric>
+#include <vector>
 
 using namespace Raz::Literals;
 
@@ -293,3 +297,127 @@ TEST_CASE("TriggerSystem trigger actions", "[utils]") {
   CHECK(sphereStayCount == 2);
   CHECK(sphereLeaveCount == 1);
 }
+
+TEST_CASE("TriggerSystem spatial grid", "[utils]") {
+  Raz::World world;
+
+  auto& triggerSystem = world.addSystem<Raz::TriggerSystem>();
+  CHECK(triggerSystem.getCellSize() == 5.f);
+  CHECK_THROWS(triggerSystem.setCellSize(0.f));
+  triggerSystem.setCellSize(2.f);
+
+  Raz::Entity& triggererEntity = world.addEntityWithComponent<Raz::Transform>();
+  triggererEntity.addComponent<Raz::Triggerer>().registerComponents<Raz::TriggerVolume>();
+
+  // Field of small volumes, each covering only a few cells
+  std::vector<Raz::Entity*> volumeEntities;
+  std::vector<int> enterCounts(100);
+  std::vector<int> leaveCounts(100);
+
+  for (int volumeIndex = 0; volumeIndex < 100; ++volumeIndex) {
+    Raz::Entity& volumeEntity = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(static_cast<float>(volumeIndex % 10) * 3.f,
+                                                                                        0.f,
+                                                                                        static_cast<float>(volumeIndex / 10) * 3.f));
+    auto& triggerVolume = volumeEntity.addComponent<Raz::TriggerVolume>(Raz::Sphere(Raz::Vec3f(0.f), 1.f));
+    triggerVolume.setEnterAction([&enterCounts, volumeIndex] (const Raz::Entity&) noexcept { ++enterCounts[volumeIndex]; });
+    triggerVolume.setLeaveAction([&leaveCounts, volumeIndex] (const Raz::Entity&) noexcept { ++leaveCounts[volumeIndex]; });
+    volumeEntities.emplace_back(&volumeEntity);
+  }
+
+  // Volume large enough not to be stored in the grid, tested against all triggerers
+  Raz::Entity& largeVolumeEntity = world.addEntityWithComponent<Raz::Transform>();
+  int largeEnterCount = 0;
+  int largeLeaveCount = 0;
+  auto& largeTriggerVolume = largeVolumeEntity.addComponent<Raz::TriggerVolume>(Raz::AABB(Raz::Vec3f(-100.f), Raz::Vec3f(100.f)));
+  largeTriggerVolume.setEnterAction([&largeEnterCount] (const Raz::Entity&) noexcept { ++largeEnterCount; });
+  largeTriggerVolume.setLeaveAction([&largeLeaveCount] (const Raz::Entity&) noexcept { ++largeLeaveCount; });
+
+  auto& triggererTransform = triggererEntity.getComponent<Raz::Transform>();
+
+  world.update({});
+  CHECK(enterCounts[0] == 1);
+  CHECK(std::accumulate(enterCounts.cbegin(), enterCounts.cend(), 0) == 1);
+  CHECK(largeEnterCount == 1);
+
+  // Moving the triggerer far from its previous volume, which is not in its cell anymore but must still be left
+  triggererTransform.setPosition(Raz::Vec3f(27.f, 0.f, 27.f));
+  world.update({});
+  CHECK(leaveCounts[0] == 1);
+  CHECK(enterCounts[99] == 1);
+  CHECK(std::accumulate(enterCounts.cbegin(), enterCounts.cend(), 0) == 2);
+  CHECK(largeLeaveCount == 0);
+
+  // Moving a volume onto the triggerer updates the grid
+  volumeEntities[50]->getComponent<Raz::Transform>().setPosition(Raz::Vec3f(27.5f, 0.f, 27.f));
+  world.update({});
+  CHECK(enterCounts[50] == 1);
+
+  // Moving it away makes the triggerer leave it
+  volumeEntities[50]->getComponent<Raz::Transform>().setPosition(Raz::Vec3f(-50.f));
+  world.update({});
+  CHECK(leaveCounts[50] == 1);
+  CHECK(leaveCounts[99] == 0);
+
+  // A removed volume is not triggered anymore
+  world.removeEntity(*volumeEntities[99]);
+  triggererTransform.setPosition(Raz::Vec3f(0.f));
+  world.update({});
+  CHECK(leaveCounts[99] == 0);
+  CHECK(enterCounts[0] == 2);
+
+  // Changing a volume's shape without moving it updates the grid, the volume now overlapping the triggerer's cell
+  volumeEntities[1]->addComponent<Raz::TriggerVolume>(Raz::AABB(Raz::Vec3f(-3.5f, -0.5f, -0.5f), Raz::Vec3f(1.f, 0.5f, 0.5f)))
+                    .setEnterAction([&enterCounts] (const Raz::Entity&) noexcept { ++enterCounts[1]; });
+  world.update({});
+  CHECK(enterCounts[1] == 1);
+  CHECK(enterCounts[0] == 2);
+
+  // Changing the cell size rebuilds the grid, keeping the current state
+  triggerSystem.setCellSize(50.f);
+  world.update({});
+  CHECK(enterCounts[0] == 2);
+  CHECK(leaveCounts[0] == 1);
+
+  triggererTransform.setPosition(Raz::Vec3f(500.f));
+  world.update({});
+  CHECK(leaveCounts[0] == 2);
+  CHECK(largeLeaveCount == 1);
+}
+
+TEST_CASE("TriggerSystem benchmark", "[utils][.benchmark]") {
+  constexpr int sideCount   = 100;
+  constexpr int entityCount = sideCount * sideCount;
+
+  // Setting up 10k volumes & 10k triggerers; with a tiny cell size, every volume is considered large & is tested by all triggerers,
+  //  which amounts to a brute force approach
+  const auto setupWorld = [] (Raz::World& world, float cellSize) {
+    world.addSystem<Raz::TriggerSystem>().setCellSize(cellSize);
+
+    for (int entityIndex = 0; entityIndex < entityCount; ++entityIndex) {
+      const auto x = static_cast<float>(entityIndex % sideCount) * 3.f;
+      const auto z = static_cast<float>(entityIndex / sideCount) * 3.f;
+
+      Raz::Entity& volumeEntity = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(x, 0.f, z));
+      volumeEntity.addComponent<Raz::TriggerVolume>(Raz::Sphere(Raz::Vec3f(0.f), 1.f));
+
+      Raz::Entity& triggererEntity = world.addEntityWithComponent<Raz::Transform>(Raz::Vec3f(x + 0.5f, 0.f, z + 0.5f));
+      triggererEntity.addComponent<Raz::Triggerer>().registerComponents<Raz::TriggerVolume>();
+    }
+
+    world.update({});
+  };
+
+  Raz::World gridWorld(entityCount * 2);
+  setupWorld(gridWorld, 5.f);
+
+  BENCHMARK("Spatial grid") {
+    return gridWorld.update({});
+  };
+
+  Raz::World bruteForceWorld(entityCount * 2);
+  setupWorld(bruteForceWorld, 0.01f);
+
+  BENCHMARK("Brute force") {
+    return bruteForceWorld.update({});
+  };
+}